@@ -132,6 +132,39 @@ ArrayTemplate<T>::ArrayTemplate(const ArrayTemplate<T> &array)
    }
 }
 
+//------------------------------------------------------------------------------
+//  <constructor>
+//  ArrayTemplate(ArrayTemplate<T> &&array)
+//------------------------------------------------------------------------------
+/**
+ * Move constructor: takes the heap storage of the input array (which is left
+ * unsized), or copies the elements stored in it.
+ */
+//------------------------------------------------------------------------------
+template <class T>
+ArrayTemplate<T>::ArrayTemplate(ArrayTemplate<T> &&array)
+{
+   if (array.IsSized() == false)
+   {
+       throw ArrayTemplateExceptions::UnsizedArray();
+   }
+   if (array.elementD != array.inlineD && array.elementD != (T*) 0)
+   {
+      elementD       = array.elementD;
+      sizeD          = array.sizeD;
+      isSizedD       = true;
+      array.elementD = (T*) 0;
+      array.sizeD    = 0;
+      array.isSizedD = false;
+      return;
+   }
+   init(array.sizeD);
+   for (int i = 0; i < sizeD; i++)
+   {
+      elementD[i] = array.elementD[i];
+   }
+}
+
 //------------------------------------------------------------------------------
 //  <destructor>
 //  ~ArrayTemplate()
@@ -139,7 +172,7 @@ ArrayTemplate<T>::ArrayTemplate(const ArrayTemplate<T> &array)
 template <class T>
 ArrayTemplate<T>::~ArrayTemplate()
 {
-   delete [] elementD;
+   release();
 }
 
 //------------------------------------------------------------------------------
@@ -173,6 +206,45 @@ const ArrayTemplate<T>& ArrayTemplate<T>::operator=(
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  const ArrayTemplate<T>& operator=(ArrayTemplate<T> &&array)
+//------------------------------------------------------------------------------
+/**
+ * Move assignment (same size rules as the copy assignment): the heap storage
+ * of the arrays is exchanged, the elements stored in the objects are copied.
+ */
+//------------------------------------------------------------------------------
+template <class T>
+const ArrayTemplate<T>& ArrayTemplate<T>::operator=(ArrayTemplate<T> &&array)
+{
+   if (array.IsSized() == false)
+   {
+       throw ArrayTemplateExceptions::UnsizedArray();
+   }
+   if (isSizedD == true && sizeD != array.sizeD)
+   {
+      throw ArrayTemplateExceptions::DimensionError();
+   }
+   bool heap      = (elementD != inlineD && elementD != (T*) 0);
+   bool arrayHeap = (array.elementD != array.inlineD &&
+                     array.elementD != (T*) 0);
+   if (arrayHeap && (heap || isSizedD == false))
+   {
+      T *mine        = elementD;
+      elementD       = array.elementD;
+      sizeD          = array.sizeD;
+      isSizedD       = true;
+      array.elementD = heap ? mine : (T*) 0;
+      if (!heap)
+      {
+         array.sizeD    = 0;
+         array.isSizedD = false;
+      }
+      return *this;
+   }
+   return operator=((const ArrayTemplate<T>&) array);
+}
+
 //------------------------------------------------------------------------------
 //  bool operator==(const ArrayTemplate<T> &array) const
 //------------------------------------------------------------------------------
@@ -302,7 +374,7 @@ ArrayTemplate<T>::SetSize(int size)
    {
        //throw ArrayTemplateExceptions::ArrayAlreadySized();
       // wcs - 2005.02.01 - need to be able to resize
-      delete [] elementD;
+      release();
    }
 
    if (size < 0)
@@ -326,11 +398,12 @@ void ArrayTemplate<T>::Resize(Integer size)
    // if already sized, then resize
    if (isSizedD)
    {
-      // copy from existing storage into temp storage
-	  Integer originalSize = sizeD;
-      T* tmp = new T[size];
+      // copy from existing storage into temp storage (the elements kept)
+	  Integer keptSize = (sizeD < size) ? sizeD : size;
+      T  localTmp[INLINE_SIZE];
+      T* tmp = (keptSize <= INLINE_SIZE) ? localTmp : new T[keptSize];
       T* myElementD = &elementD[0];
-      for (Integer i = 0; i < originalSize; ++i)
+      for (Integer i = 0; i < keptSize; ++i)
       {
          tmp[i] = myElementD[i];
       }
@@ -339,13 +412,14 @@ void ArrayTemplate<T>::Resize(Integer size)
       SetSize(size);
 
       // copy from temp storage into new storage
-      for (Integer i = 0; i < originalSize; ++i)
+      for (Integer i = 0; i < keptSize; ++i)
       {
          elementD[i] = tmp[i];
       }
 
       // delete temp storage
-      delete [] tmp;
+      if (tmp != localTmp)
+         delete [] tmp;
 
       // all done
       return;
@@ -423,9 +497,32 @@ ArrayTemplate<T>::init(int s)
    {
        elementD = (T *) 0;
    }
+   else if (sizeD <= INLINE_SIZE)
+   {
+       elementD = inlineD;
+   }
    else
    {
        elementD = new T[sizeD];
    }
    isSizedD = true;
 }
+
+//------------------------------------------------------------------------------
+//  void release()
+//------------------------------------------------------------------------------
+/**
+ * Frees the heap storage of the elements (if they are not stored in the
+ * object).
+ */
+//------------------------------------------------------------------------------
+template <class T>
+void
+ArrayTemplate<T>::release()
+{
+   if (elementD != inlineD)
+   {
+      delete [] elementD;
+   }
+   elementD = (T *) 0;
+}
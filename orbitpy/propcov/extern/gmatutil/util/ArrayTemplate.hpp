@@ -74,6 +74,9 @@ class ArrayTemplate
  *  The exceptions are declared in a separate class because the current HP
  *  compiler cannot properly handle exceptions declared a template class 
  *  and thrown in another template class.
+ *  Arrays of up to INLINE_SIZE elements (e.g. Rvector3, Rvector6) are stored
+ *  in the object itself, so creating or copying them does not allocate;
+ *  larger arrays are allocated on the heap (and moved without copying).
  */
 
 public:
@@ -84,11 +87,13 @@ public:
                                                          // allowed by compiler
     ArrayTemplate(Integer sizeOfArray, const T* array); // copy from c style array  
     ArrayTemplate(const ArrayTemplate<T> &array); 
+    ArrayTemplate(ArrayTemplate<T> &&array); 
     virtual ~ArrayTemplate();
    
     // operators
    
     const ArrayTemplate<T>& operator=(const ArrayTemplate<T> &array); 
+    const ArrayTemplate<T>& operator=(ArrayTemplate<T> &&array); 
     bool operator==(const ArrayTemplate<T> &array) const;
     bool operator!=(const ArrayTemplate<T> &array) const;
     virtual T&        operator()(Integer index);          
@@ -104,13 +109,20 @@ public:
     virtual void SetElement(Integer index, const T& value);
     
     const T* GetDataVector() const {return elementD;}
+    /// Are the elements stored in the object (not on the heap)?
+    bool IsInline() const {return elementD == inlineD;}
  
+    /// Largest number of elements stored in the object
+    static const Integer INLINE_SIZE = 6;
+
 protected:
     void init(Integer s);      // used internally for initialization
+    void release();            // frees the heap storage, if any
 
     T    *elementD;
     Integer  sizeD;
     bool isSizedD;
+    T    inlineD[INLINE_SIZE]; // storage of the small arrays
 
 private:
 };
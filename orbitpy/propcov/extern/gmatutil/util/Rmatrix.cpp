@@ -33,6 +33,7 @@
 #include "Rvector3.hpp"
 #include "RealUtilities.hpp"
 #include "UtilityException.hpp"
+#include <utility>           // for std::move
 #include "Linear.hpp"         // for operator<<, operator >>
 #include "StringUtil.hpp"     // for Replace()
 #include <stdarg.h>
@@ -99,6 +100,14 @@ Rmatrix::Rmatrix(const Rmatrix &m)
 {
 }
 
+//------------------------------------------------------------------------------
+//  Rmatrix(Rmatrix &&m)
+//------------------------------------------------------------------------------
+Rmatrix::Rmatrix(Rmatrix &&m)
+   : TableTemplate<Real>(std::move(m)) 
+{
+}
+
 // ekf mod 12/16
 //------------------------------------------------------------------------------
 //  Rmatrix::Identity(unsigned int size)
@@ -240,6 +249,15 @@ const Rmatrix& Rmatrix::operator=(const Rmatrix &m)
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  const Rmatrix& operator=(Rmatrix &&m)
+//------------------------------------------------------------------------------
+const Rmatrix& Rmatrix::operator=(Rmatrix &&m) 
+{
+   TableTemplate<Real>::operator=(std::move(m));
+   return *this;
+}
+
 
 //------------------------------------------------------------------------------
 //  bool operator==(const Rmatrix &m)const
@@ -137,6 +137,41 @@ TableTemplate<T>::TableTemplate(const TableTemplate<T> &Table)
    }
 }
 
+//------------------------------------------------------------------------------
+//  <move constructor>
+//  TableTemplate(TableTemplate<T> &&Table)
+//------------------------------------------------------------------------------
+/**
+ * Move constructor: takes the heap storage of the input table (which is left
+ * unsized), or copies the elements stored in it.
+ */
+//------------------------------------------------------------------------------
+template <class T>
+TableTemplate<T>::TableTemplate(TableTemplate<T> &&Table) 
+{
+   if (Table.IsSized() == false)
+   {
+      throw TableTemplateExceptions::UnsizedTable();
+   }
+
+   if (Table.elementD != Table.inlineD && Table.elementD != (T*) 0)
+   {
+      elementD       = Table.elementD;
+      rowsD          = Table.rowsD;
+      colsD          = Table.colsD;
+      isSizedD       = true;
+      Table.elementD = (T*) 0;
+      Table.rowsD    = Table.colsD = 0;
+      Table.isSizedD = false;
+      return;
+   }
+   init(Table.rowsD, Table.colsD);
+   for (int i = 0; i < rowsD*colsD; i++)
+   {
+      elementD[i] = Table.elementD[i];
+   }
+}
+
 //------------------------------------------------------------------------------
 //  <destructor>
 //  ~TableTemplate()
@@ -144,7 +179,7 @@ TableTemplate<T>::TableTemplate(const TableTemplate<T> &Table)
 template <class T>
 TableTemplate<T>::~TableTemplate() 
 {
-   delete[] elementD;
+   release();
 }
 
 //------------------------------------------------------------------------------
@@ -256,6 +291,46 @@ TableTemplate<T>::operator=(const TableTemplate<T> &table)
    return *this;
 }
 
+//------------------------------------------------------------------------------
+//  TableTemplate<T>& operator=(TableTemplate<T> &&table)
+//------------------------------------------------------------------------------
+/**
+ * Move assignment (same size rules as the copy assignment): the heap storage
+ * of the tables is exchanged, the elements stored in the objects are copied.
+ */
+//------------------------------------------------------------------------------
+template <class T>
+TableTemplate<T>&
+TableTemplate<T>::operator=(TableTemplate<T> &&table) 
+{
+   if (table.IsSized() == false)
+   {
+      throw TableTemplateExceptions::UnsizedTable();
+   }
+   if (isSizedD && ((rowsD != table.rowsD) || (colsD != table.colsD)))
+      throw TableTemplateExceptions::DimensionError();
+
+   bool heap      = (elementD != inlineD && elementD != (T*) 0);
+   bool tableHeap = (table.elementD != table.inlineD &&
+                     table.elementD != (T*) 0);
+   if (tableHeap && (heap || isSizedD == false))
+   {
+      T *mine        = elementD;
+      elementD       = table.elementD;
+      rowsD          = table.rowsD;
+      colsD          = table.colsD;
+      isSizedD       = true;
+      table.elementD = heap ? mine : (T*) 0;
+      if (!heap)
+      {
+         table.rowsD    = table.colsD = 0;
+         table.isSizedD = false;
+      }
+      return *this;
+   }
+   return operator=((const TableTemplate<T>&) table);
+}
+
 //------------------------------------------------------------------------------
 //  virtual T GetElement(int r, int c)
 //
@@ -327,7 +402,7 @@ TableTemplate<T>::SetSize(int r, int c, bool zeroElements)
          for (int i=0; i<rowsD*colsD; i++)
             saved[i] = elementD[i];
       }
-      delete [] elementD;
+      release();
    }
 
    if ((r < 0) || (c < 0))
@@ -387,9 +462,7 @@ TableTemplate<T>::ChangeSize(int r, int c, bool zeroElements)
 
 
    // Step 2. Remove the current table
-   if (elementD != NULL)
-      delete [] elementD;
-   elementD = NULL;
+   release();
 
    // Step 3. Set new size and fill table content by 0
    init(r,c);
@@ -466,7 +539,10 @@ TableTemplate<T>::init(int r, int c)
    }
    else
    {
-      elementD = new T[rowsD*colsD];
+      if (rowsD*colsD <= INLINE_SIZE)
+         elementD = inlineD;
+      else
+         elementD = new T[rowsD*colsD];
 
       //loj: 9/20/04 added to initialize to 0.0
       for (int i=0; i<rowsD*colsD; i++)
@@ -475,3 +551,19 @@ TableTemplate<T>::init(int r, int c)
    isSizedD = true;
 }
 
+//------------------------------------------------------------------------------
+//  void release()
+//------------------------------------------------------------------------------
+/**
+ * Frees the heap storage of the elements (if they are not stored in the
+ * object).
+ */
+//------------------------------------------------------------------------------
+template <class T>
+void
+TableTemplate<T>::release()
+{
+   if (elementD != inlineD)
+      delete [] elementD;
+   elementD = (T *) 0;
+}
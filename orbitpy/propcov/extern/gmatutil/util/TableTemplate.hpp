@@ -77,6 +77,9 @@ class TableTemplate
  *  The exceptions are declared in a separate class because the current HP
  *  compiler cannot properly handle exceptions declared a template class 
  *  and thrown in another template class.
+ *  Tables of up to INLINE_SIZE elements (e.g. Rmatrix33) are stored in the
+ *  object itself, so creating or copying them does not allocate; larger
+ *  tables are allocated on the heap (and moved without copying).
  */
 
 public:
@@ -86,11 +89,13 @@ public:
     // TableTemplate(Integer r, Integer c, const T &a11,...);
     TableTemplate(Integer r, Integer c, const T* array);
     TableTemplate(const TableTemplate<T> &table);
+    TableTemplate(TableTemplate<T> &&table);
     virtual ~TableTemplate();
 
     T& operator()(Integer r, Integer c);
     const T& operator()(Integer r, Integer c) const;
     TableTemplate<T>& operator=(const TableTemplate<T> &table);
+    TableTemplate<T>& operator=(TableTemplate<T> &&table);
     bool operator==(const TableTemplate<T> &table) const;
     bool operator!=(const TableTemplate<T> &table) const;
     
@@ -105,12 +110,19 @@ public:
     virtual Integer  GetNumRows() const;
     
     const T* GetDataVector() {return elementD;}
+    /// Are the elements stored in the object (not on the heap)?
+    bool IsInline() const {return elementD == inlineD;}
    
+    /// Largest number of elements stored in the object
+    static const Integer INLINE_SIZE = 9;
+
 protected:
     T   *elementD;
     Integer rowsD, colsD;
     bool isSizedD;
+    T   inlineD[INLINE_SIZE]; // storage of the small tables
     void init(Integer r, Integer c);
+    void release();           // frees the heap storage, if any
 
 private:
 };
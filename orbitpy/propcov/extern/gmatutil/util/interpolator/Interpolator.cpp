@@ -103,6 +103,9 @@ Interpolator::Interpolator(const Interpolator &i) :
    allowExtrapolation (i.allowExtrapolation),
    instanceName       (i.instanceName)
 {
+   // CopyArrays(.) frees the current arrays first
+   independent = NULL;
+   dependent   = NULL;
    if (i.independent)
       CopyArrays(i);
    else
@@ -324,6 +327,40 @@ Integer Interpolator::GetPointCount()
 }
 
 
+//------------------------------------------------------------------------------
+//  Integer GetBufferedPoints(RealArray &ind, RealArray &data)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the points held in the ring buffer, oldest first, so that adding
+ * them back in order to a cleared interpolator restores the buffer.
+ *
+ * @param ind   The values of the independent variable.
+ * @param data  The dependent data, dimension values per point.
+ *
+ * @return  The number of buffered points.
+ */
+//------------------------------------------------------------------------------
+Integer Interpolator::GetBufferedPoints(RealArray &ind, RealArray &data)
+{
+   ind.clear();
+   data.clear();
+   if (!independent || pointCount == 0)
+      return 0;
+   
+   Integer count = (pointCount < bufferSize ? pointCount : bufferSize);
+   Integer first = (pointCount < bufferSize ? 0 : (latestPoint + 1) % bufferSize);
+   for (Integer i = 0; i < count; ++i)
+   {
+      Integer index = (first + i) % bufferSize;
+      ind.push_back(independent[index]);
+      for (Integer j = 0; j < dimension; ++j)
+         data.push_back(dependent[index][j]);
+   }
+   
+   return count;
+}
+
+
 //------------------------------------------------------------------------------
 // std::string GetName()
 //------------------------------------------------------------------------------
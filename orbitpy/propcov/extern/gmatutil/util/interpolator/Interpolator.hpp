@@ -57,6 +57,7 @@ public:
    virtual void    Clear();
    virtual Integer GetBufferSize();
    virtual Integer GetPointCount();
+   virtual Integer GetBufferedPoints(RealArray &ind, RealArray &data);
    virtual void    SetExtrapolation(bool flag);
    
    std::string     GetName();
@@ -0,0 +1,271 @@
+//------------------------------------------------------------------------------
+//                           AccessInterval
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the AccessIntervalBuilder class
+ */
+//------------------------------------------------------------------------------
+#include "gmatdefs.hpp"
+#include "AccessInterval.hpp"
+#include "Profiler.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_ACCESS_INTERVALS
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+// None
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// AccessIntervalBuilder(Integer numPoints, Integer satIdx, Integer optionIdx)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param numPts     number of points (of the PointGroup) being checked
+ * @param satIdx     satellite index written into the intervals
+ * @param optionIdx  pointing-option index written into the intervals
+ *
+ */
+//------------------------------------------------------------------------------
+AccessIntervalBuilder::AccessIntervalBuilder(Integer numPts, Integer satIdx,
+                                             Integer optionIdx) :
+   numPoints      (numPts),
+   satIndex       (satIdx),
+   optionIndex    (optionIdx),
+   stepCount      (0),
+   lastTime       (0.0),
+   accountedMemory(0)
+{
+   if (numPoints < 0)
+      throw TATCException("AccessIntervalBuilder: number of points must be "
+                          "non-negative\n");
+   openStart.assign(numPoints, 0.0);
+   lastSeenStep.assign(numPoints, -1);
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// AccessIntervalBuilder(const AccessIntervalBuilder &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the AccessIntervalBuilder object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+AccessIntervalBuilder::AccessIntervalBuilder(const AccessIntervalBuilder &copy) :
+   numPoints      (copy.numPoints),
+   satIndex       (copy.satIndex),
+   optionIndex    (copy.optionIndex),
+   stepCount      (copy.stepCount),
+   lastTime       (copy.lastTime),
+   intervals      (copy.intervals),
+   openStart      (copy.openStart),
+   lastSeenStep   (copy.lastSeenStep),
+   openPoints     (copy.openPoints),
+   accountedMemory(0)
+{
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// AccessIntervalBuilder& operator=(const AccessIntervalBuilder &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for AccessIntervalBuilder.
+ *
+ * @param copy  the AccessIntervalBuilder object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+AccessIntervalBuilder& AccessIntervalBuilder::operator=(
+                                          const AccessIntervalBuilder &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   numPoints      = copy.numPoints;
+   satIndex       = copy.satIndex;
+   optionIndex    = copy.optionIndex;
+   stepCount      = copy.stepCount;
+   lastTime       = copy.lastTime;
+   intervals      = copy.intervals;
+   openStart      = copy.openStart;
+   lastSeenStep   = copy.lastSeenStep;
+   openPoints     = copy.openPoints;
+   AccountMemory();
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~AccessIntervalBuilder()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+AccessIntervalBuilder::~AccessIntervalBuilder()
+{
+   Profiler::UpdateMemory(Profiler::ACCESS_MEMORY, accountedMemory, 0);
+}
+
+//------------------------------------------------------------------------------
+// void AddCoverage(Real jd, const IntegerArray &coveredPoints)
+//------------------------------------------------------------------------------
+/**
+ * Adds the coverage result at the input time. Accesses of points which are no
+ * longer in view are closed (at the time of the previous step), accesses of points
+ * coming into view are opened. The calls must be in increasing order of time.
+ *
+ * @param jd             time of the coverage result (JDUT1)
+ * @param coveredPoints  indices of the points in view (as returned by
+ *                       CoverageChecker::CheckPointCoverage(.))
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessIntervalBuilder::AddCoverage(Real jd,
+                                        const IntegerArray &coveredPoints)
+{
+   Profiler::Scope timer(Profiler::INTERVAL_BUILDING);
+   if (stepCount > 0 && jd < lastTime)
+      throw TATCException("AccessIntervalBuilder: coverage must be added in "
+                          "increasing order of time\n");
+
+   nextOpenPoints.clear();
+   for (Integer k = 0; k < (Integer) coveredPoints.size(); k++)
+   {
+      Integer ptIdx = coveredPoints[k];
+      if (ptIdx < 0 || ptIdx >= numPoints)
+         throw TATCException("AccessIntervalBuilder: point index out of range\n");
+      if (lastSeenStep[ptIdx] == stepCount)
+         continue; // duplicate index within the step
+      if (lastSeenStep[ptIdx] != stepCount - 1 || stepCount == 0)
+         openStart[ptIdx] = jd; // the access begins
+      lastSeenStep[ptIdx] = stepCount;
+      nextOpenPoints.push_back(ptIdx);
+   }
+
+   // close the accesses of the points which were open but are not seen now
+   for (Integer k = 0; k < (Integer) openPoints.size(); k++)
+   {
+      Integer ptIdx = openPoints[k];
+      if (lastSeenStep[ptIdx] != stepCount)
+      {
+         AccessInterval acc = {satIndex, ptIdx, optionIndex,
+                               openStart[ptIdx], lastTime};
+         intervals.push_back(acc);
+         #ifdef DEBUG_ACCESS_INTERVALS
+            MessageInterface::ShowMessage(
+                  "AccessIntervalBuilder: point %d access [%.8f, %.8f]\n",
+                  ptIdx, acc.startTime, acc.stopTime);
+         #endif
+      }
+   }
+   openPoints.swap(nextOpenPoints);
+
+   lastTime = jd;
+   stepCount++;
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// void Finalize()
+//------------------------------------------------------------------------------
+/**
+ * Closes the accesses which are still open (at the time of the last step).
+ * Further calls to AddCoverage(.) begin new accesses.
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessIntervalBuilder::Finalize()
+{
+   Profiler::Scope timer(Profiler::INTERVAL_BUILDING);
+   for (Integer k = 0; k < (Integer) openPoints.size(); k++)
+   {
+      Integer ptIdx = openPoints[k];
+      AccessInterval acc = {satIndex, ptIdx, optionIndex,
+                            openStart[ptIdx], lastTime};
+      intervals.push_back(acc);
+      lastSeenStep[ptIdx] = -1;
+   }
+   openPoints.clear();
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// const std::vector<AccessInterval>& GetIntervals() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the intervals completed so far (call Finalize() first to include
+ * the accesses still open at the last step).
+ *
+ * @return  the access intervals, in the order in which they were closed
+ *
+ */
+//------------------------------------------------------------------------------
+const std::vector<AccessInterval>& AccessIntervalBuilder::GetIntervals() const
+{
+   return intervals;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumPoints() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of points for which the builder was set up.
+ *
+ * @return  number of points
+ *
+ */
+//------------------------------------------------------------------------------
+Integer AccessIntervalBuilder::GetNumPoints() const
+{
+   return numPoints;
+}
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Clears the intervals and the open accesses.
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessIntervalBuilder::Reset()
+{
+   intervals.clear();
+   openPoints.clear();
+   lastSeenStep.assign(numPoints, -1);
+   stepCount = 0;
+   lastTime  = 0.0;
+}
+
+//------------------------------------------------------------------------------
+// void AccountMemory()
+//------------------------------------------------------------------------------
+/**
+ * Accounts the memory of the intervals and of the per-point arrays
+ * (Profiler::ACCESS_MEMORY).
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessIntervalBuilder::AccountMemory()
+{
+   long long bytes = intervals.capacity() * sizeof(AccessInterval) +
+                     openStart.capacity() * sizeof(Real) +
+                     (lastSeenStep.capacity() + openPoints.capacity() +
+                      nextOpenPoints.capacity()) * sizeof(Integer);
+   Profiler::UpdateMemory(Profiler::ACCESS_MEMORY, accountedMemory, bytes);
+}
@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+//                           AccessInterval
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the AccessInterval structure and of the AccessIntervalBuilder class.
+ *
+ * An AccessInterval is a contiguous time interval (JDUT1) over which a point (of a
+ * PointGroup) is seen by a satellite, optionally through one of the satellite's
+ * pointing options (e.g. roll angles of an agile spacecraft).
+ *
+ * The AccessIntervalBuilder accumulates the per-time-step results of
+ * CoverageChecker::CheckPointCoverage(.) (the indices of the points in view) and
+ * converts them into access intervals. A point seen at consecutive steps k .. m
+ * forms the interval [t_k, t_m]; a point seen at a single step forms a zero-length
+ * interval. The work per step is proportional to the number of points in view
+ * (plus the number of points whose access ends at that step).
+ */
+//------------------------------------------------------------------------------
+#ifndef AccessInterval_hpp
+#define AccessInterval_hpp
+
+#include <vector>
+#include "gmatdefs.hpp"
+
+struct AccessInterval
+{
+   /// index of the satellite
+   Integer satIndex;
+   /// index of the point (in the PointGroup)
+   Integer pointIndex;
+   /// index of the pointing option (0 if the satellite has a single pointing)
+   Integer optionIndex;
+   /// start of the access (JDUT1)
+   Real    startTime;
+   /// stop of the access (JDUT1)
+   Real    stopTime;
+};
+
+class AccessIntervalBuilder
+{
+public:
+
+   /// class construction/destruction
+   AccessIntervalBuilder(Integer numPoints, Integer satIdx = 0,
+                         Integer optionIdx = 0);
+   AccessIntervalBuilder(const AccessIntervalBuilder &copy);
+   AccessIntervalBuilder& operator=(const AccessIntervalBuilder &copy);
+
+   virtual ~AccessIntervalBuilder();
+
+   /// Add the coverage result (indices of the points in view) at the input time
+   virtual void      AddCoverage(Real jd, const IntegerArray &coveredPoints);
+   /// Close the intervals which are still open
+   virtual void      Finalize();
+   /// Get the intervals completed so far
+   const std::vector<AccessInterval>& GetIntervals() const;
+   /// Get the number of points for which the builder was set up
+   Integer           GetNumPoints() const;
+   /// Clear all the intervals and the open accesses
+   void              Reset();
+
+protected:
+
+   /// number of points
+   Integer                      numPoints;
+   /// satellite index written into the intervals
+   Integer                      satIndex;
+   /// pointing-option index written into the intervals
+   Integer                      optionIndex;
+   /// number of calls to AddCoverage(.) so far
+   Integer                      stepCount;
+   /// time of the last call to AddCoverage(.)
+   Real                         lastTime;
+   /// completed intervals
+   std::vector<AccessInterval>  intervals;
+   /// start time of the open access of each point
+   RealArray                    openStart;
+   /// step index at which each point was last seen (-1 if never)
+   IntegerArray                 lastSeenStep;
+   /// indices of the points with an open access
+   IntegerArray                 openPoints;
+   /// scratch array for the open points of the current step
+   IntegerArray                 nextOpenPoints;
+   /// memory accounted for this object (Profiler::ACCESS_MEMORY)
+   long long                    accountedMemory;
+
+   /// Account the memory of the intervals and per-point arrays
+   void              AccountMemory();
+};
+#endif // AccessInterval_hpp
@@ -0,0 +1,558 @@
+//------------------------------------------------------------------------------
+//                           AccessStore
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the AccessStore class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <fstream>
+#include <cmath>            // for INFINITY
+#include <cstdint>
+#include <cstring>
+#include "gmatdefs.hpp"
+#include "AccessStore.hpp"
+#include "Profiler.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// file signature and format version of the binary file
+static const char    ACCESS_STORE_MAGIC[4] = {'P', 'C', 'A', 'S'};
+static const int32_t ACCESS_STORE_VERSION  = 1;
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// AccessStore()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor (empty store).
+ *
+ */
+//------------------------------------------------------------------------------
+AccessStore::AccessStore() :
+   numPoints      (0),
+   accountedMemory(0)
+{
+   pointOffsets.assign(1, 0);
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// AccessStore(const std::vector<AccessInterval> &accesses, Integer numPts)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param accesses  the access intervals
+ * @param numPts    number of points; if negative, 1 + the largest point index
+ *
+ */
+//------------------------------------------------------------------------------
+AccessStore::AccessStore(const std::vector<AccessInterval> &accesses,
+                         Integer numPts) :
+   numPoints      (0),
+   accountedMemory(0)
+{
+   Build(accesses, numPts);
+}
+
+//------------------------------------------------------------------------------
+// AccessStore(const AccessStore &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the AccessStore object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+AccessStore::AccessStore(const AccessStore &copy) :
+   numPoints      (copy.numPoints),
+   records        (copy.records),
+   pointOffsets   (copy.pointOffsets),
+   maxStops       (copy.maxStops),
+   timeIndex      (copy.timeIndex),
+   accountedMemory(0)
+{
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// AccessStore& operator=(const AccessStore &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for AccessStore.
+ *
+ * @param copy  the AccessStore object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+AccessStore& AccessStore::operator=(const AccessStore &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   numPoints      = copy.numPoints;
+   records        = copy.records;
+   pointOffsets   = copy.pointOffsets;
+   maxStops       = copy.maxStops;
+   timeIndex      = copy.timeIndex;
+   AccountMemory();
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~AccessStore()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+AccessStore::~AccessStore()
+{
+   Profiler::UpdateMemory(Profiler::ACCESS_MEMORY, accountedMemory, 0);
+}
+
+//------------------------------------------------------------------------------
+// void Build(const std::vector<AccessInterval> &accesses, Integer numPts)
+//------------------------------------------------------------------------------
+/**
+ * (Re)builds the store from the input intervals.
+ *
+ * @param accesses  the access intervals
+ * @param numPts    number of points; if negative, 1 + the largest point index
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessStore::Build(const std::vector<AccessInterval> &accesses,
+                        Integer numPts)
+{
+   Integer maxPoint = -1;
+   for (Integer ii = 0; ii < (Integer) accesses.size(); ii++)
+   {
+      if (accesses[ii].pointIndex < 0)
+         throw TATCException("AccessStore: point index must be non-negative\n");
+      if (accesses[ii].stopTime < accesses[ii].startTime)
+         throw TATCException("AccessStore: interval stop time is before its "
+                             "start time\n");
+      maxPoint = std::max(maxPoint, accesses[ii].pointIndex);
+   }
+   if (numPts < 0)
+      numPts = maxPoint + 1;
+   else if (maxPoint >= numPts)
+      throw TATCException("AccessStore: point index out of range\n");
+
+   numPoints = numPts;
+   records   = accesses;
+   std::sort(records.begin(), records.end(),
+             [](const AccessInterval &a, const AccessInterval &b)
+             {
+                if (a.pointIndex != b.pointIndex)
+                   return a.pointIndex < b.pointIndex;
+                if (a.startTime != b.startTime)
+                   return a.startTime < b.startTime;
+                return a.satIndex < b.satIndex;
+             });
+
+   pointOffsets.assign(numPoints + 1, 0);
+   for (Integer ii = 0; ii < (Integer) records.size(); ii++)
+      pointOffsets[records[ii].pointIndex + 1]++;
+   for (Integer pp = 0; pp < numPoints; pp++)
+      pointOffsets[pp + 1] += pointOffsets[pp];
+
+   BuildIndices();
+}
+
+//------------------------------------------------------------------------------
+// std::vector<AccessInterval> GetPointAccesses(Integer pointIndex,
+//                                              Real t1, Real t2) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the accesses of a point which overlap the window [t1, t2].
+ *
+ * @param pointIndex  index of the point
+ * @param t1          window start (JDUT1)
+ * @param t2          window stop (JDUT1)
+ *
+ * @return  the accesses, ordered by start time
+ *
+ */
+//------------------------------------------------------------------------------
+std::vector<AccessInterval> AccessStore::GetPointAccesses(Integer pointIndex,
+                                                          Real t1,
+                                                          Real t2) const
+{
+   if (pointIndex < 0 || pointIndex >= numPoints)
+      throw TATCException("AccessStore: point index out of range\n");
+
+   IntegerArray idx;
+   if (t1 <= t2)
+      QueryPoint(pointOffsets[pointIndex], pointOffsets[pointIndex + 1],
+                 t1, t2, idx);
+   std::vector<AccessInterval> result;
+   result.reserve(idx.size());
+   for (Integer ii = 0; ii < (Integer) idx.size(); ii++)
+      result.push_back(records[idx[ii]]);
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray GetSatellitesSeeingPoint(Integer pointIndex,
+//                                       Real t1, Real t2) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the satellites which saw a point during the window [t1, t2].
+ *
+ * @param pointIndex  index of the point
+ * @param t1          window start (JDUT1)
+ * @param t2          window stop (JDUT1)
+ *
+ * @return  sorted, unique satellite indices
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray AccessStore::GetSatellitesSeeingPoint(Integer pointIndex,
+                                                   Real t1, Real t2) const
+{
+   std::vector<AccessInterval> acc = GetPointAccesses(pointIndex, t1, t2);
+   IntegerArray sats;
+   sats.reserve(acc.size());
+   for (Integer ii = 0; ii < (Integer) acc.size(); ii++)
+      sats.push_back(acc[ii].satIndex);
+   std::sort(sats.begin(), sats.end());
+   sats.erase(std::unique(sats.begin(), sats.end()), sats.end());
+   return sats;
+}
+
+//------------------------------------------------------------------------------
+// std::vector<AccessInterval> GetAccessesDuring(Real t1, Real t2) const
+//------------------------------------------------------------------------------
+/**
+ * Returns all the accesses which overlap the window [t1, t2].
+ *
+ * @param t1  window start (JDUT1)
+ * @param t2  window stop (JDUT1)
+ *
+ * @return  the accesses, ordered by start time
+ *
+ */
+//------------------------------------------------------------------------------
+std::vector<AccessInterval> AccessStore::GetAccessesDuring(Real t1,
+                                                           Real t2) const
+{
+   IntegerArray idx = timeIndex.Overlapping(t1, t2);
+   std::vector<AccessInterval> result;
+   result.reserve(idx.size());
+   for (Integer ii = 0; ii < (Integer) idx.size(); ii++)
+      result.push_back(records[idx[ii]]);
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray GetPointsCoveredDuring(Real t1, Real t2) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the points which were covered (by any satellite) during the
+ * window [t1, t2].
+ *
+ * @param t1  window start (JDUT1)
+ * @param t2  window stop (JDUT1)
+ *
+ * @return  sorted, unique point indices
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray AccessStore::GetPointsCoveredDuring(Real t1, Real t2) const
+{
+   IntegerArray idx = timeIndex.Overlapping(t1, t2);
+   IntegerArray points;
+   points.reserve(idx.size());
+   for (Integer ii = 0; ii < (Integer) idx.size(); ii++)
+      points.push_back(records[idx[ii]].pointIndex);
+   std::sort(points.begin(), points.end());
+   points.erase(std::unique(points.begin(), points.end()), points.end());
+   return points;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumPoints() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of points.
+ *
+ * @return  number of points
+ *
+ */
+//------------------------------------------------------------------------------
+Integer AccessStore::GetNumPoints() const
+{
+   return numPoints;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumAccesses() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of stored intervals.
+ *
+ * @return  number of intervals
+ *
+ */
+//------------------------------------------------------------------------------
+Integer AccessStore::GetNumAccesses() const
+{
+   return records.size();
+}
+
+//------------------------------------------------------------------------------
+// const std::vector<AccessInterval>& GetAccesses() const
+//------------------------------------------------------------------------------
+/**
+ * Returns all the intervals.
+ *
+ * @return  the intervals, ordered by point index and start time
+ *
+ */
+//------------------------------------------------------------------------------
+const std::vector<AccessInterval>& AccessStore::GetAccesses() const
+{
+   return records;
+}
+
+//------------------------------------------------------------------------------
+// void Save(const std::string &filename) const
+//------------------------------------------------------------------------------
+/**
+ * Saves the store to a binary file (see the class description for the format).
+ *
+ * @param filename  path of the file
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessStore::Save(const std::string &filename) const
+{
+   Profiler::Scope timer(Profiler::OUTPUT);
+   std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+   if (!out)
+      throw TATCException("AccessStore: unable to open " + filename +
+                          " for writing\n");
+
+   int32_t nPts = numPoints;
+   int64_t nRec = records.size();
+   out.write(ACCESS_STORE_MAGIC, 4);
+   out.write((const char*) &ACCESS_STORE_VERSION, sizeof(int32_t));
+   out.write((const char*) &nPts, sizeof(int32_t));
+   out.write((const char*) &nRec, sizeof(int64_t));
+   for (Integer pp = 0; pp <= numPoints; pp++)
+   {
+      int32_t off = pointOffsets[pp];
+      out.write((const char*) &off, sizeof(int32_t));
+   }
+   for (Integer ii = 0; ii < (Integer) records.size(); ii++)
+   {
+      int32_t idx[3] = {records[ii].satIndex, records[ii].pointIndex,
+                        records[ii].optionIndex};
+      double  t[2]   = {records[ii].startTime, records[ii].stopTime};
+      out.write((const char*) idx, sizeof(idx));
+      out.write((const char*) t, sizeof(t));
+   }
+   if (!out)
+      throw TATCException("AccessStore: error writing " + filename + "\n");
+   Profiler::AddCount(Profiler::BYTES_WRITTEN, out.tellp());
+}
+
+//------------------------------------------------------------------------------
+// AccessStore Load(const std::string &filename)
+//------------------------------------------------------------------------------
+/**
+ * Loads a store from a binary file written by Save(.).
+ *
+ * @param filename  path of the file
+ *
+ * @return  the store
+ *
+ */
+//------------------------------------------------------------------------------
+AccessStore AccessStore::Load(const std::string &filename)
+{
+   std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+   if (!in)
+      throw TATCException("AccessStore: unable to open " + filename + "\n");
+
+   char    magic[4];
+   int32_t version = 0;
+   int32_t nPts    = 0;
+   int64_t nRec    = 0;
+   in.read(magic, 4);
+   in.read((char*) &version, sizeof(int32_t));
+   in.read((char*) &nPts, sizeof(int32_t));
+   in.read((char*) &nRec, sizeof(int64_t));
+   if (!in || std::memcmp(magic, ACCESS_STORE_MAGIC, 4) != 0)
+      throw TATCException("AccessStore: " + filename +
+                          " is not an access store file\n");
+   if (version != ACCESS_STORE_VERSION)
+      throw TATCException("AccessStore: unsupported file version in " +
+                          filename + "\n");
+   if (nPts < 0 || nRec < 0)
+      throw TATCException("AccessStore: corrupt header in " + filename + "\n");
+
+   // the sizes in the header must fit in the rest of the file before anything
+   // is allocated
+   const int64_t recordBytes = 3 * sizeof(int32_t) + 2 * sizeof(double);
+   std::streampos dataStart = in.tellg();
+   in.seekg(0, std::ios::end);
+   int64_t remaining = (int64_t) (in.tellg() - dataStart);
+   in.seekg(dataStart);
+   if (!in || remaining < ((int64_t) nPts + 1) * (int64_t) sizeof(int32_t) ||
+       nRec > (remaining - ((int64_t) nPts + 1) * (int64_t) sizeof(int32_t)) /
+              recordBytes)
+      throw TATCException("AccessStore: truncated or corrupt file " +
+                          filename + "\n");
+
+   AccessStore store;
+   store.numPoints = nPts;
+   store.pointOffsets.resize(nPts + 1);
+   for (Integer pp = 0; pp <= nPts; pp++)
+   {
+      int32_t off = 0;
+      in.read((char*) &off, sizeof(int32_t));
+      store.pointOffsets[pp] = off;
+   }
+   store.records.resize(nRec);
+   for (int64_t ii = 0; ii < nRec; ii++)
+   {
+      int32_t idx[3];
+      double  t[2];
+      in.read((char*) idx, sizeof(idx));
+      in.read((char*) t, sizeof(t));
+      AccessInterval acc = {idx[0], idx[1], idx[2], t[0], t[1]};
+      store.records[ii] = acc;
+   }
+   if (!in || store.pointOffsets[0] != 0 || store.pointOffsets[nPts] != nRec)
+      throw TATCException("AccessStore: truncated or corrupt file " +
+                          filename + "\n");
+   // the offsets index the records below
+   for (Integer pp = 0; pp < nPts; pp++)
+      if (store.pointOffsets[pp] > store.pointOffsets[pp + 1])
+         throw TATCException("AccessStore: corrupt file " + filename + "\n");
+   for (Integer pp = 0; pp < nPts; pp++)
+      for (Integer ii = store.pointOffsets[pp]; ii < store.pointOffsets[pp + 1];
+           ii++)
+         if (store.records[ii].pointIndex != pp)
+            throw TATCException("AccessStore: corrupt file " + filename + "\n");
+
+   store.BuildIndices();
+   return store;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void BuildIndices()
+//------------------------------------------------------------------------------
+/**
+ * Builds the per-point trees (subtree maximum stop times) and the time index
+ * from the sorted records and point offsets.
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessStore::BuildIndices()
+{
+   maxStops.assign(records.size(), 0.0);
+   for (Integer pp = 0; pp < numPoints; pp++)
+      BuildMaxStops(pointOffsets[pp], pointOffsets[pp + 1]);
+
+   timeIndex.Clear();
+   for (Integer ii = 0; ii < (Integer) records.size(); ii++)
+      timeIndex.Add(records[ii].startTime, records[ii].stopTime, ii);
+   timeIndex.Build();
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// void AccountMemory()
+//------------------------------------------------------------------------------
+/**
+ * Accounts the memory of the records and of the per-point index
+ * (Profiler::ACCESS_MEMORY).
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessStore::AccountMemory()
+{
+   long long bytes = records.capacity() * sizeof(AccessInterval) +
+                     pointOffsets.capacity() * sizeof(Integer) +
+                     maxStops.capacity() * sizeof(Real);
+   Profiler::UpdateMemory(Profiler::ACCESS_MEMORY, accountedMemory, bytes);
+}
+
+//------------------------------------------------------------------------------
+// Real BuildMaxStops(Integer lo, Integer hi)
+//------------------------------------------------------------------------------
+/**
+ * Computes the maximum stop time of the implicit subtree over [lo, hi)
+ * (the node of a range is its middle element).
+ *
+ * @param lo  first record of the range
+ * @param hi  one past the last record of the range
+ *
+ * @return  maximum stop time within the range
+ *
+ */
+//------------------------------------------------------------------------------
+Real AccessStore::BuildMaxStops(Integer lo, Integer hi)
+{
+   if (lo >= hi)
+      return -INFINITY;
+   Integer mid    = lo + (hi - lo) / 2;
+   Real    maxVal = records[mid].stopTime;
+   maxVal = std::max(maxVal, BuildMaxStops(lo, mid));
+   maxVal = std::max(maxVal, BuildMaxStops(mid + 1, hi));
+   maxStops[mid] = maxVal;
+   return maxVal;
+}
+
+//------------------------------------------------------------------------------
+// void QueryPoint(Integer lo, Integer hi, Real t1, Real t2,
+//                 IntegerArray &result) const
+//------------------------------------------------------------------------------
+/**
+ * Collects (in order of start time) the records within [lo, hi) which overlap
+ * the window [t1, t2].
+ *
+ * @param lo      first record of the range
+ * @param hi      one past the last record of the range
+ * @param t1      window start
+ * @param t2      window stop
+ * @param result  array to which the record indices are appended
+ *
+ */
+//------------------------------------------------------------------------------
+void AccessStore::QueryPoint(Integer lo, Integer hi, Real t1, Real t2,
+                             IntegerArray &result) const
+{
+   while (lo < hi)
+   {
+      Integer mid = lo + (hi - lo) / 2;
+      if (maxStops[mid] < t1)
+         return;
+      QueryPoint(lo, mid, t1, t2, result);
+      if (records[mid].startTime > t2)
+         return;
+      if (records[mid].stopTime >= t1)
+         result.push_back(mid);
+      lo = mid + 1;
+   }
+}
@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+//                           AccessStore
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the AccessStore class, a queryable store of the access intervals
+ * (AccessInterval) of a coverage run.
+ *
+ * Layout:
+ *  - The intervals are sorted by (point index, start time) and stored contiguously;
+ *    pointOffsets[p] .. pointOffsets[p+1] is the range of the intervals of point p.
+ *    Each per-point range is an implicit interval tree (as in the IntervalTree class):
+ *    maxStops holds the maximum stop time of each node's subtree, so the accesses of a
+ *    point over a time window are found in O(log n + k).
+ *  - A time index (an IntervalTree over all the intervals) answers the "which points were
+ *    covered during this window" queries in O(log n + k).
+ *
+ * The store can be saved to / loaded from a binary file (little-endian, fixed-width fields):
+ *    char[4]  magic "PCAS"
+ *    int32    version
+ *    int32    number of points
+ *    int64    number of intervals
+ *    int32    point offsets (number of points + 1)
+ *    then, for each interval: int32 satIndex, int32 pointIndex, int32 optionIndex,
+ *                             float64 startTime, float64 stopTime
+ * The indices are rebuilt on load.
+ */
+//------------------------------------------------------------------------------
+#ifndef AccessStore_hpp
+#define AccessStore_hpp
+
+#include <string>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "AccessInterval.hpp"
+#include "IntervalTree.hpp"
+
+class AccessStore
+{
+public:
+
+   /// class construction/destruction
+   AccessStore();
+   AccessStore(const std::vector<AccessInterval> &accesses, Integer numPts = -1);
+   AccessStore(const AccessStore &copy);
+   AccessStore& operator=(const AccessStore &copy);
+
+   virtual ~AccessStore();
+
+   /// (Re)build the store from the input intervals
+   void           Build(const std::vector<AccessInterval> &accesses,
+                        Integer numPts = -1);
+
+   /// Get the accesses of a point overlapping the window [t1, t2]
+   std::vector<AccessInterval> GetPointAccesses(Integer pointIndex,
+                                                Real t1, Real t2) const;
+   /// Get the (sorted, unique) satellites which saw a point during [t1, t2]
+   IntegerArray   GetSatellitesSeeingPoint(Integer pointIndex,
+                                           Real t1, Real t2) const;
+   /// Get all the accesses overlapping the window [t1, t2]
+   std::vector<AccessInterval> GetAccessesDuring(Real t1, Real t2) const;
+   /// Get the (sorted, unique) points covered during [t1, t2]
+   IntegerArray   GetPointsCoveredDuring(Real t1, Real t2) const;
+
+   /// Get the number of points / intervals
+   Integer        GetNumPoints() const;
+   Integer        GetNumAccesses() const;
+   /// Get all the intervals, ordered by point and start time
+   const std::vector<AccessInterval>& GetAccesses() const;
+
+   /// Save the store to a binary file
+   void           Save(const std::string &filename) const;
+   /// Load a store from a binary file
+   static AccessStore Load(const std::string &filename);
+
+protected:
+
+   /// number of points
+   Integer                      numPoints;
+   /// the intervals, sorted by point index and start time
+   std::vector<AccessInterval>  records;
+   /// offsets of the per-point ranges into `records`
+   IntegerArray                 pointOffsets;
+   /// maximum stop time of the subtree of each node of the per-point trees
+   RealArray                    maxStops;
+   /// index of all the intervals by time
+   IntervalTree                 timeIndex;
+   /// memory accounted for this object (Profiler::ACCESS_MEMORY)
+   long long                    accountedMemory;
+
+   /// Build the per-point trees and the time index from the sorted records
+   void           BuildIndices();
+   /// Compute the subtree maximum stop times over [lo, hi)
+   Real           BuildMaxStops(Integer lo, Integer hi);
+   /// Collect the record indices overlapping [t1, t2] within [lo, hi)
+   void           QueryPoint(Integer lo, Integer hi, Real t1, Real t2,
+                             IntegerArray &result) const;
+   /// Account the memory of the records and per-point index
+   void           AccountMemory();
+};
+#endif // AccessStore_hpp
@@ -0,0 +1,531 @@
+//------------------------------------------------------------------------------
+//                           BatchConversions
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the BatchConversions class
+ */
+//------------------------------------------------------------------------------
+#include <cmath>
+#include <sstream>
+#include "gmatdefs.hpp"
+#include "BatchConversions.hpp"
+#include "DateUtil.hpp"
+#include "RealUtilities.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_BATCH_CONVERSIONS
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Integer BatchConversions::GEODETIC_ITERATIONS = 6;
+
+namespace
+{
+   /// acos clamped to [-1, 1] (round-off), as GmatMathUtil::ACos
+   inline Real ClampedACos(Real x)
+   {
+      return acos(x > 1.0 ? 1.0 : (x < -1.0 ? -1.0 : x));
+   }
+
+   /// Throw for the first invalid element of a conversion
+   void ThrowInvalid(const std::string &conversion, Integer index)
+   {
+      std::stringstream errmsg;
+      errmsg << "BatchConversions: cannot convert element " << index
+             << " " << conversion << "\n";
+      throw TATCException(errmsg.str());
+   }
+}
+
+//------------------------------------------------------------------------------
+// public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void InertialToBodyFixed(const Real *jd, const Real *states, Integer n,
+//                          Real *out)
+//------------------------------------------------------------------------------
+/**
+ * Converts Earth inertial states to Earth-fixed states (the velocity is
+ * rotated, as in Earth::GetBodyFixedState; the omega cross r term is ignored).
+ *
+ * @param jd      Julian dates (n)
+ * @param states  inertial states (n x 6)
+ * @param n       number of states
+ * @param out     Earth-fixed states (n x 6, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::InertialToBodyFixed(const Real *jd, const Real *states,
+                                           Integer n, Real *out)
+{
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      Real        gmt = ComputeGMT(jd[ii]);
+      Real        cG  = cos(gmt);
+      Real        sG  = sin(gmt);
+      const Real *in  = states + 6*ii;
+      Real       *res = out + 6*ii;
+      Real x = in[0], y = in[1], z = in[2];
+      Real vx = in[3], vy = in[4], vz = in[5];
+      res[0] =  cG * x  + sG * y;
+      res[1] = -sG * x  + cG * y;
+      res[2] =  z;
+      res[3] =  cG * vx + sG * vy;
+      res[4] = -sG * vx + cG * vy;
+      res[5] =  vz;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void BodyFixedToInertial(const Real *jd, const Real *states, Integer n,
+//                          Real *out)
+//------------------------------------------------------------------------------
+/**
+ * Converts Earth-fixed states to Earth inertial states (the inverse of
+ * InertialToBodyFixed).
+ *
+ * @param jd      Julian dates (n)
+ * @param states  Earth-fixed states (n x 6)
+ * @param n       number of states
+ * @param out     inertial states (n x 6, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::BodyFixedToInertial(const Real *jd, const Real *states,
+                                           Integer n, Real *out)
+{
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      Real        gmt = ComputeGMT(jd[ii]);
+      Real        cG  = cos(gmt);
+      Real        sG  = sin(gmt);
+      const Real *in  = states + 6*ii;
+      Real       *res = out + 6*ii;
+      Real x = in[0], y = in[1], z = in[2];
+      Real vx = in[3], vy = in[4], vz = in[5];
+      res[0] = cG * x  - sG * y;
+      res[1] = sG * x  + cG * y;
+      res[2] = z;
+      res[3] = cG * vx - sG * vy;
+      res[4] = sG * vx + cG * vy;
+      res[5] = vz;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void CartesianToKeplerian(const Real *cart, Integer n, Real *kepl,
+//                           Real mu = Earth::MU)
+//------------------------------------------------------------------------------
+/**
+ * Converts Cartesian states to Keplerian elements, with the same handling of
+ * the circular and equatorial orbits as StateConversionUtil.
+ *
+ * @param cart  Cartesian states (n x 6)
+ * @param n     number of states
+ * @param kepl  Keplerian elements (n x 6: SMA, ECC, INC, RAAN, AOP, TA,
+ *              output)
+ * @param mu    gravitational parameter
+ *
+ * @note Throws for states which have no Keplerian elements (zero position or
+ *       angular momentum, (nearly) parabolic or singular orbits); the
+ *       elements of the other states are computed.
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::CartesianToKeplerian(const Real *cart, Integer n,
+                                            Real *kepl, Real mu)
+{
+   const Real TWO_PI = GmatMathConstants::TWO_PI;
+   const Real PI     = GmatMathConstants::PI;
+   const Real ANGLE_TOL = 1.0e-11;
+   Real       invMu  = 1.0 / mu;
+   Integer    firstInvalid = -1;
+
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      const Real *s   = cart + 6*ii;
+      Real       *res = kepl + 6*ii;
+      Real rx = s[0], ry = s[1], rz = s[2];
+      Real vx = s[3], vy = s[4], vz = s[5];
+
+      // angular momentum and node vectors
+      Real hx = ry*vz - rz*vy;
+      Real hy = rz*vx - rx*vz;
+      Real hz = rx*vy - ry*vx;
+      Real h  = sqrt(hx*hx + hy*hy + hz*hz);
+      Real nx = -hy;
+      Real ny = hx;
+      Real nMag = sqrt(nx*nx + ny*ny);
+
+      Real r    = sqrt(rx*rx + ry*ry + rz*rz);
+      Real vMag = sqrt(vx*vx + vy*vy + vz*vz);
+      Real v2   = vMag*vMag;
+      Real rv   = rx*vx + ry*vy + rz*vz;
+
+      // eccentricity vector
+      Real ce = v2 - mu/r;
+      Real ex = invMu*(ce*rx - rv*vx);
+      Real ey = invMu*(ce*ry - rv*vy);
+      Real ez = invMu*(ce*rz - rv*vz);
+      Real e  = sqrt(ex*ex + ey*ey + ez*ez);
+
+      Real zeta = 0.5*v2 - mu/r;
+      Real sma  = -mu/(2*zeta);
+      Real inc  = ClampedACos(hz/h);
+
+      bool invalid = (r == 0.0) || (h == 0.0) || (zeta == 0.0) ||
+                     (fabs(1.0 - e) <= GmatOrbitConstants::KEP_ECC_TOL) ||
+                     (fabs(sma*(1 - e)) < .001) || std::isnan(inc);
+      if (invalid && firstInvalid < 0)
+         firstInvalid = ii;
+
+      bool circular   = e < ANGLE_TOL;
+      bool retrograde = inc > PI - ANGLE_TOL;
+      bool equatorial = (inc < ANGLE_TOL) || retrograde;
+
+      Real raan = 0.0, aop = 0.0, ta = 0.0;
+      if (!equatorial)
+      {
+         raan = ClampedACos(nx/nMag);
+         raan = (ny < 0) ? TWO_PI - raan : raan;
+      }
+      if (!circular)
+      {
+         if (!equatorial)
+         {
+            aop = ClampedACos((nx*ex + ny*ey)/(nMag*e));
+            aop = (ez < 0) ? TWO_PI - aop : aop;
+         }
+         else
+         {
+            aop = ClampedACos(ex/e);
+            aop = (ey < 0) ? TWO_PI - aop : aop;
+            aop = retrograde ? -aop : aop;
+            aop = (aop < 0.0) ? aop + TWO_PI : aop;
+         }
+         ta = ClampedACos((ex*rx + ey*ry + ez*rz)/(e*r));
+         ta = (rv < 0) ? TWO_PI - ta : ta;
+      }
+      else if (!equatorial)
+      {
+         ta = ClampedACos((nx*rx + ny*ry)/(nMag*r));
+         ta = (rz < 0) ? TWO_PI - ta : ta;
+      }
+      else
+      {
+         ta = ClampedACos(rx/r);
+         ta = (ry < 0) ? TWO_PI - ta : ta;
+         ta = retrograde ? -ta : ta;
+         ta = (ta < 0.0) ? ta + TWO_PI : ta;
+      }
+
+      res[0] = sma;
+      res[1] = e;
+      res[2] = inc;
+      res[3] = raan;
+      res[4] = aop;
+      res[5] = ta;
+   }
+
+   if (firstInvalid >= 0)
+      ThrowInvalid("from Cartesian to Keplerian state (no Keplerian elements)",
+                   firstInvalid);
+}
+
+//------------------------------------------------------------------------------
+// void KeplerianToCartesian(const Real *kepl, Integer n, Real *cart,
+//                           Real mu = Earth::MU)
+//------------------------------------------------------------------------------
+/**
+ * Converts Keplerian elements to Cartesian states. As in StateConversionUtil,
+ * a negative eccentricity and an SMA sign inconsistent with the eccentricity
+ * are corrected.
+ *
+ * @param kepl  Keplerian elements (n x 6: SMA, ECC, INC, RAAN, AOP, TA)
+ * @param n     number of states
+ * @param cart  Cartesian states (n x 6, output)
+ * @param mu    gravitational parameter
+ *
+ * @note Throws for (nearly) parabolic or singular orbits.
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::KeplerianToCartesian(const Real *kepl, Integer n,
+                                            Real *cart, Real mu)
+{
+   if (mu < 1.0e-15)
+      throw TATCException("BatchConversions: gravitational parameter is too "
+                          "small\n");
+   Integer firstInvalid = -1;
+
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      const Real *k   = kepl + 6*ii;
+      Real       *res = cart + 6*ii;
+      Real ecc  = fabs(k[1]);
+      Real sma  = (ecc > 1.0) ? -fabs(k[0]) : fabs(k[0]);
+      Real inc  = k[2];
+      Real raan = k[3];
+      Real per  = k[4];
+      Real anom = k[5];
+
+      Real p    = sma*(1 - ecc*ecc);
+      bool invalid = (fabs(sma*(1.0 - ecc)) < .001) ||
+                     (fabs(1.0 - ecc) < 1.0e-7) || (fabs(p) < 1.0e-30);
+      if (invalid && firstInvalid < 0)
+         firstInvalid = ii;
+
+      Real rad          = p/(1 + ecc*cos(anom));
+      Real cosPerAnom   = cos(per + anom);
+      Real sinPerAnom   = sin(per + anom);
+      Real cosInc       = cos(inc);
+      Real sinInc       = sin(inc);
+      Real cosRaan      = cos(raan);
+      Real sinRaan      = sin(raan);
+      Real sqrtGravP    = sqrt(mu/p);
+      Real cosAnomPlusE = cos(anom) + ecc;
+      Real sinAnom      = sin(anom);
+      Real cosPer       = cos(per);
+      Real sinPer       = sin(per);
+
+      res[0] = rad * (cosPerAnom * cosRaan - cosInc * sinPerAnom * sinRaan);
+      res[1] = rad * (cosPerAnom * sinRaan + cosInc * sinPerAnom * cosRaan);
+      res[2] = rad * sinPerAnom  * sinInc;
+      res[3] = sqrtGravP * cosAnomPlusE*(-sinPer*cosRaan-cosInc*sinRaan*cosPer)
+               - sqrtGravP*sinAnom*(cosPer*cosRaan-cosInc*sinRaan*sinPer);
+      res[4] = sqrtGravP * cosAnomPlusE*(-sinPer*sinRaan+cosInc*cosRaan*cosPer)
+               - sqrtGravP*sinAnom*(cosPer*sinRaan+cosInc*cosRaan*sinPer);
+      res[5] = sqrtGravP * (cosAnomPlusE*sinInc*cosPer - sinAnom*sinInc*sinPer);
+   }
+
+   if (firstInvalid >= 0)
+      ThrowInvalid("from Keplerian to Cartesian state (parabolic or singular "
+                   "orbit)", firstInvalid);
+}
+
+//------------------------------------------------------------------------------
+// void CartesianToGeodetic(const Real *cart, Integer n, Real *geo)
+//------------------------------------------------------------------------------
+/**
+ * Converts Earth-fixed Cartesian positions to geodetic latitude, longitude
+ * (in [0, 2pi)) and height, as BodyFixedStateConverterUtil (Cartesian to
+ * "Ellipsoid") but with a fixed number of iterations of the latitude.
+ *
+ * @param cart  Cartesian positions (n x 3)
+ * @param n     number of positions
+ * @param geo   latitude, longitude and height (n x 3, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::CartesianToGeodetic(const Real *cart, Integer n,
+                                           Real *geo)
+{
+   const Real ee = 2.0 * Earth::FLATTENING - Earth::FLATTENING*Earth::FLATTENING;
+
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      const Real *c   = cart + 3*ii;
+      Real       *res = geo + 3*ii;
+      Real longitude = atan2(c[1], c[0]);
+      longitude      = (longitude < 0.0) ?
+                       longitude + GmatMathConstants::TWO_PI : longitude;
+
+      Real rxy      = sqrt(c[0]*c[0] + c[1]*c[1]);
+      Real latitude = atan2(c[2], rxy);
+      for (Integer it = 0; it < GEODETIC_ITERATIONS; it++)
+      {
+         Real sinLat = sin(latitude);
+         Real C      = Earth::RADIUS / sqrt(1.0 - ee*sinLat*sinLat);
+         latitude    = atan((c[2] + C*ee*sinLat) / rxy);
+      }
+
+      Real sinLat = sin(latitude);
+      Real C      = Earth::RADIUS / sqrt(1.0 - ee*sinLat*sinLat);
+      Real S      = C * (1.0 - ee);
+      // the horizontal distance is not used near the poles
+      bool nearPole = (GmatMathConstants::PI_OVER_TWO - fabs(latitude)) <= .02;
+      res[0] = latitude;
+      res[1] = longitude;
+      res[2] = nearPole ? (c[2] / sinLat) - S : (rxy / cos(latitude)) - C;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GeodeticToCartesian(const Real *geo, Integer n, Real *cart)
+//------------------------------------------------------------------------------
+/**
+ * Converts geodetic latitude, longitude and height to Earth-fixed Cartesian
+ * positions.
+ *
+ * @param geo   latitude, longitude and height (n x 3)
+ * @param n     number of positions
+ * @param cart  Cartesian positions (n x 3, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::GeodeticToCartesian(const Real *geo, Integer n,
+                                           Real *cart)
+{
+   const Real ee = 2.0 * Earth::FLATTENING - Earth::FLATTENING*Earth::FLATTENING;
+
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      const Real *g   = geo + 3*ii;
+      Real       *res = cart + 3*ii;
+      Real sinLat = sin(g[0]);
+      Real C      = Earth::RADIUS / sqrt(1.0 - ee*sinLat*sinLat);
+      Real S      = C * (1.0 - ee);
+      Real rxy    = (C + g[2]) * cos(g[0]);
+      res[0] = rxy * cos(g[1]);
+      res[1] = rxy * sin(g[1]);
+      res[2] = (S + g[2]) * sinLat;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GeocentricToGeodeticLat(const Real *gcLat, Integer n, Real *gdLat)
+//------------------------------------------------------------------------------
+/**
+ * Converts geocentric latitudes (of points on the Earth surface) to geodetic
+ * latitudes, as Earth::GeocentricToGeodeticLat but with a fixed number of
+ * iterations.
+ *
+ * @param gcLat  geocentric latitudes (n)
+ * @param n      number of latitudes
+ * @param gdLat  geodetic latitudes (n, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::GeocentricToGeodeticLat(const Real *gcLat, Integer n,
+                                               Real *gdLat)
+{
+   const Real ee = 2.0 * Earth::FLATTENING - Earth::FLATTENING*Earth::FLATTENING;
+
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      Real xyPos = Earth::RADIUS * cos(gcLat[ii]);
+      Real zPos  = Earth::RADIUS * sin(gcLat[ii]);
+      Real lat   = gcLat[ii];
+      for (Integer it = 0; it < GEODETIC_ITERATIONS; it++)
+      {
+         Real sinLat = sin(lat);
+         Real C      = Earth::RADIUS / sqrt(1 - ee*sinLat*sinLat);
+         lat         = atan2(zPos + C*ee*sinLat, xyPos);
+      }
+      gdLat[ii] = lat;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void JulianToGregorian(const Real *jd, Integer n, Real *greg)
+//------------------------------------------------------------------------------
+/**
+ * Converts Julian dates to Gregorian dates, as AbsoluteDate::GetGregorianDate.
+ *
+ * @param jd    Julian dates (n)
+ * @param n     number of dates
+ * @param greg  year, month, day, hour, minute, second (n x 6, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::JulianToGregorian(const Real *jd, Integer n, Real *greg)
+{
+   const Real JD_1900 = 2415019.5;
+
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      Real    *res     = greg + 6*ii;
+      Real    t1900    = (jd[ii] - JD_1900) / GmatTimeConstants::DAYS_PER_YEAR;
+      Integer year     = 1900 + (Integer) GmatMathUtil::Fix(t1900);
+      Integer leapYrs  = (Integer) GmatMathUtil::Fix((year - 1900 - 1)*0.25);
+      Real    days     = (jd[ii] - JD_1900) - ((year - 1900) * 365 + leapYrs);
+      if (days < 1)
+      {
+         year--;
+         leapYrs = (Integer) GmatMathUtil::Fix((year - 1900 - 1)*0.25);
+         days    = (jd[ii] - JD_1900) - ((year - 1900) * 365 + leapYrs);
+      }
+
+      Real    dayOfYr = GmatMathUtil::Fix(days);
+      Integer month, day;
+      ToMonthDayFromYearDOY(year, (Integer) dayOfYr, month, day);
+
+      Real    tau     = (days - dayOfYr) * 24;
+      Integer hour    = (Integer) GmatMathUtil::Fix(tau);
+      Real    minute  = GmatMathUtil::Fix((tau - hour) * 60);
+      res[0] = year;
+      res[1] = month;
+      res[2] = day;
+      res[3] = hour;
+      res[4] = (Integer) minute;
+      res[5] = (tau - hour - minute/60) * GmatTimeConstants::SECS_PER_HOUR;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GregorianToJulian(const Real *greg, Integer n, Real *jd)
+//------------------------------------------------------------------------------
+/**
+ * Converts Gregorian dates to Julian dates (as AbsoluteDate::SetGregorianDate,
+ * for the years 1900 to 2100).
+ *
+ * @param greg  year, month, day, hour, minute, second (n x 6)
+ * @param n     number of dates
+ * @param jd    Julian dates (n, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void BatchConversions::GregorianToJulian(const Real *greg, Integer n, Real *jd)
+{
+   Integer firstInvalid = -1;
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      const Real *g     = greg + 6*ii;
+      Integer    year   = (Integer) g[0];
+      Integer    month  = (Integer) g[1];
+      bool invalid = (year < 1900) || (year > 2100) || (month < 1) ||
+                     (month > 12) || (g[3] < 0) || (g[3] >= 24) ||
+                     (g[4] < 0) || (g[4] >= 60) || (g[5] < 0.0) ||
+                     (g[5] >= 60.0);
+      if (invalid && firstInvalid < 0)
+         firstInvalid = ii;
+      jd[ii] = JulianDate(year, month, (Integer) g[2], (Integer) g[3],
+                          (Integer) g[4], g[5]);
+   }
+
+   if (firstInvalid >= 0)
+      ThrowInvalid("from Gregorian to Julian date (invalid date)",
+                   firstInvalid);
+}
+
+//------------------------------------------------------------------------------
+// protected static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Real ComputeGMT(Real jd)
+//------------------------------------------------------------------------------
+/**
+ * Returns the Greenwich mean sidereal angle (same as Earth::ComputeGMT).
+ *
+ * @param jd  the Julian date
+ *
+ * @return  GMT (rad)
+ */
+//------------------------------------------------------------------------------
+Real BatchConversions::ComputeGMT(Real jd)
+{
+   Real timeUT1 = (jd - GmatTimeConstants::JD_OF_J2000) /
+                  GmatTimeConstants::DAYS_PER_JULIAN_CENTURY;
+   Real GMT     = 67310.54841 +(876600.0 * 3600.0+8640184.812866) * timeUT1 +
+                  0.093104 * (timeUT1*timeUT1) -
+                  6.2e-6 * (timeUT1*timeUT1*timeUT1);
+   GMT = (GMT - floor(GMT / GmatTimeConstants::SECS_PER_DAY) *
+                GmatTimeConstants::SECS_PER_DAY) / 240.0 *
+         GmatMathConstants::RAD_PER_DEG;
+   return GMT;
+}
@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+//                           BatchConversions
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the BatchConversions class, the array versions of the frame,
+ * state and date conversions of the Earth, OrbitState, BodyFixedStateConverter
+ * and AbsoluteDate classes.
+ *
+ * Each conversion works on n elements stored contiguously (row-major, e.g. an
+ * n x 6 array of states) and writes to a caller-allocated output array, with
+ * no per-element objects. The loops are branch-light (selects instead of
+ * branches where possible, fixed iteration counts) so that the compiler can
+ * vectorize them. The formulas are those of the one-element conversions, so
+ * the results agree with them to round-off.
+ *
+ * Angles are in radians, distances in km and times are Julian dates (UT1).
+ * NOTE: This is a static class: No instances of this class may be declared.
+ */
+//------------------------------------------------------------------------------
+#ifndef BatchConversions_hpp
+#define BatchConversions_hpp
+
+#include "gmatdefs.hpp"
+#include "Earth.hpp"
+
+class BatchConversions
+{
+public:
+
+   /// Earth inertial (states: n x 6) to Earth-fixed (rotation about z by the
+   /// GMT, also applied to the velocity, as in Earth::GetBodyFixedState)
+   static void  InertialToBodyFixed(const Real *jd, const Real *states,
+                                    Integer n, Real *out);
+   /// Earth-fixed (states: n x 6) to Earth inertial
+   static void  BodyFixedToInertial(const Real *jd, const Real *states,
+                                    Integer n, Real *out);
+
+   /// Cartesian (n x 6) to Keplerian (n x 6: SMA, ECC, INC, RAAN, AOP, TA)
+   static void  CartesianToKeplerian(const Real *cart, Integer n, Real *kepl,
+                                     Real mu = Earth::MU);
+   /// Keplerian (n x 6: SMA, ECC, INC, RAAN, AOP, TA) to Cartesian (n x 6)
+   static void  KeplerianToCartesian(const Real *kepl, Integer n, Real *cart,
+                                     Real mu = Earth::MU);
+
+   /// Earth-fixed Cartesian position (n x 3) to geodetic latitude, longitude
+   /// and height (n x 3)
+   static void  CartesianToGeodetic(const Real *cart, Integer n, Real *geo);
+   /// Geodetic latitude, longitude and height (n x 3) to Earth-fixed
+   /// Cartesian position (n x 3)
+   static void  GeodeticToCartesian(const Real *geo, Integer n, Real *cart);
+   /// Geocentric latitude (n) to geodetic latitude (n)
+   static void  GeocentricToGeodeticLat(const Real *gcLat, Integer n,
+                                        Real *gdLat);
+
+   /// Julian date (n) to Gregorian date (n x 6: year, month, day, hour,
+   /// minute, second)
+   static void  JulianToGregorian(const Real *jd, Integer n, Real *greg);
+   /// Gregorian date (n x 6) to Julian date (n)
+   static void  GregorianToJulian(const Real *greg, Integer n, Real *jd);
+
+protected:
+
+   /// Number of iterations of the geodetic latitude (the iteration converges
+   /// by a factor of ~e^2 per iteration, to round-off in 6 iterations)
+   static const Integer GEODETIC_ITERATIONS;
+
+   /// Compute the Greenwich mean sidereal angle (as Earth::ComputeGMT)
+   static Real  ComputeGMT(Real jd);
+
+private:
+
+   //------------------------------------------------------------------------------
+   // private constructors, destructor, operator=
+   //------------------------------------------------------------------------------
+
+   /// class methods (unimplemented, since this is a static class)
+   BatchConversions();
+   BatchConversions( const BatchConversions &copy);
+   BatchConversions& operator=(const BatchConversions &copy);
+
+   ~BatchConversions();
+
+};
+#endif // BatchConversions_hpp
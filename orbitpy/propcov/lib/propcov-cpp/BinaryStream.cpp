@@ -0,0 +1,437 @@
+//------------------------------------------------------------------------------
+//                           BinaryStream
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the BinaryWriter and BinaryReader classes
+ */
+//------------------------------------------------------------------------------
+#include "gmatdefs.hpp"
+#include "BinaryStream.hpp"
+#include "TATCException.hpp"
+
+//------------------------------------------------------------------------------
+// BinaryWriter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// BinaryWriter()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+BinaryWriter::BinaryWriter()
+{
+}
+
+//------------------------------------------------------------------------------
+// ~BinaryWriter()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+BinaryWriter::~BinaryWriter()
+{
+}
+
+//------------------------------------------------------------------------------
+// void WriteHeader(const std::string &className, Integer version)
+//------------------------------------------------------------------------------
+/**
+ * Writes the header of an object.
+ *
+ * @param className  name of the class of the object
+ * @param version    version of the format of the class
+ *
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteHeader(const std::string &className, Integer version)
+{
+   WriteString(className);
+   WriteInt(version);
+}
+
+//------------------------------------------------------------------------------
+// void WriteInt(Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Writes an integer (int32).
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteInt(Integer value)
+{
+   Write<int32_t>(value);
+}
+
+//------------------------------------------------------------------------------
+// void WriteReal(Real value)
+//------------------------------------------------------------------------------
+/**
+ * Writes a real (float64).
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteReal(Real value)
+{
+   Write<double>(value);
+}
+
+//------------------------------------------------------------------------------
+// void WriteBool(bool value)
+//------------------------------------------------------------------------------
+/**
+ * Writes a flag (uint8).
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteBool(bool value)
+{
+   Write<uint8_t>(value ? 1 : 0);
+}
+
+//------------------------------------------------------------------------------
+// void WriteString(const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Writes a string (length, then the characters).
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteString(const std::string &value)
+{
+   WriteInt(value.size());
+   buffer.append(value);
+}
+
+//------------------------------------------------------------------------------
+// void WriteIntArray(const IntegerArray &values)
+//------------------------------------------------------------------------------
+/**
+ * Writes an array of integers (count, then the values).
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteIntArray(const IntegerArray &values)
+{
+   WriteInt(values.size());
+   for (Integer ii = 0; ii < (Integer) values.size(); ii++)
+      WriteInt(values[ii]);
+}
+
+//------------------------------------------------------------------------------
+// void WriteRealArray(const RealArray &values)
+//------------------------------------------------------------------------------
+/**
+ * Writes an array of reals (count, then the values).
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteRealArray(const RealArray &values)
+{
+   WriteInt(values.size());
+   buffer.append((const char*) values.data(), values.size() * sizeof(Real));
+}
+
+//------------------------------------------------------------------------------
+// void WriteRvector(const Rvector &value)
+//------------------------------------------------------------------------------
+/**
+ * Writes an Rvector (size, then the elements).
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteRvector(const Rvector &value)
+{
+   Integer size = value.GetSize();
+   WriteInt(size);
+   if (size > 0)
+      buffer.append((const char*) value.GetDataVector(), size * sizeof(Real));
+}
+
+//------------------------------------------------------------------------------
+// void WriteRvector3(const Rvector3 &value)
+//------------------------------------------------------------------------------
+/**
+ * Writes the 3 elements of an Rvector3.
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteRvector3(const Rvector3 &value)
+{
+   for (Integer ii = 0; ii < 3; ii++)
+      WriteReal(value[ii]);
+}
+
+//------------------------------------------------------------------------------
+// void WriteRvector6(const Rvector6 &value)
+//------------------------------------------------------------------------------
+/**
+ * Writes the 6 elements of an Rvector6.
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteRvector6(const Rvector6 &value)
+{
+   for (Integer ii = 0; ii < 6; ii++)
+      WriteReal(value[ii]);
+}
+
+//------------------------------------------------------------------------------
+// void WriteRmatrix33(const Rmatrix33 &value)
+//------------------------------------------------------------------------------
+/**
+ * Writes the 9 elements of an Rmatrix33, row by row.
+ */
+//------------------------------------------------------------------------------
+void BinaryWriter::WriteRmatrix33(const Rmatrix33 &value)
+{
+   for (Integer ii = 0; ii < 3; ii++)
+      for (Integer jj = 0; jj < 3; jj++)
+         WriteReal(value(ii, jj));
+}
+
+//------------------------------------------------------------------------------
+// const std::string& GetBuffer() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the bytes written so far.
+ */
+//------------------------------------------------------------------------------
+const std::string& BinaryWriter::GetBuffer() const
+{
+   return buffer;
+}
+
+//------------------------------------------------------------------------------
+// BinaryReader
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// BinaryReader(const std::string &data)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param data  the bytes to read (not copied)
+ *
+ */
+//------------------------------------------------------------------------------
+BinaryReader::BinaryReader(const std::string &data) :
+   data     (data),
+   offset   (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~BinaryReader()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+BinaryReader::~BinaryReader()
+{
+}
+
+//------------------------------------------------------------------------------
+// Integer ReadHeader(const std::string &className, Integer maxVersion)
+//------------------------------------------------------------------------------
+/**
+ * Reads the header of an object.
+ *
+ * @param className   expected class name
+ * @param maxVersion  newest version of the format that can be read
+ *
+ * @return  the version of the format of the object
+ *
+ */
+//------------------------------------------------------------------------------
+Integer BinaryReader::ReadHeader(const std::string &className,
+                                 Integer maxVersion)
+{
+   if (ReadString() != className)
+      throw TATCException("BinaryReader: the data is not a serialized " +
+                          className + "\n");
+   Integer version = ReadInt();
+   if (version < 1 || version > maxVersion)
+      throw TATCException("BinaryReader: unsupported " + className +
+                          " format version\n");
+   return version;
+}
+
+//------------------------------------------------------------------------------
+// Integer ReadInt()
+//------------------------------------------------------------------------------
+/**
+ * Reads an integer.
+ */
+//------------------------------------------------------------------------------
+Integer BinaryReader::ReadInt()
+{
+   return Read<int32_t>();
+}
+
+//------------------------------------------------------------------------------
+// Real ReadReal()
+//------------------------------------------------------------------------------
+/**
+ * Reads a real.
+ */
+//------------------------------------------------------------------------------
+Real BinaryReader::ReadReal()
+{
+   return Read<double>();
+}
+
+//------------------------------------------------------------------------------
+// bool ReadBool()
+//------------------------------------------------------------------------------
+/**
+ * Reads a flag.
+ */
+//------------------------------------------------------------------------------
+bool BinaryReader::ReadBool()
+{
+   return (Read<uint8_t>() != 0);
+}
+
+//------------------------------------------------------------------------------
+// std::string ReadString()
+//------------------------------------------------------------------------------
+/**
+ * Reads a string.
+ */
+//------------------------------------------------------------------------------
+std::string BinaryReader::ReadString()
+{
+   Integer count = ReadCount(1);
+   std::string value(data, offset, count);
+   offset += count;
+   return value;
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray ReadIntArray()
+//------------------------------------------------------------------------------
+/**
+ * Reads an array of integers.
+ */
+//------------------------------------------------------------------------------
+IntegerArray BinaryReader::ReadIntArray()
+{
+   Integer count = ReadCount(sizeof(int32_t));
+   IntegerArray values(count);
+   for (Integer ii = 0; ii < count; ii++)
+      values[ii] = ReadInt();
+   return values;
+}
+
+//------------------------------------------------------------------------------
+// RealArray ReadRealArray()
+//------------------------------------------------------------------------------
+/**
+ * Reads an array of reals.
+ */
+//------------------------------------------------------------------------------
+RealArray BinaryReader::ReadRealArray()
+{
+   Integer count = ReadCount(sizeof(Real));
+   RealArray values(count);
+   if (count > 0)
+      std::memcpy(values.data(), data.data() + offset, count * sizeof(Real));
+   offset += count * sizeof(Real);
+   return values;
+}
+
+//------------------------------------------------------------------------------
+// Rvector ReadRvector()
+//------------------------------------------------------------------------------
+/**
+ * Reads an Rvector.
+ */
+//------------------------------------------------------------------------------
+Rvector BinaryReader::ReadRvector()
+{
+   Integer count = ReadCount(sizeof(Real));
+   Rvector value(count);
+   for (Integer ii = 0; ii < count; ii++)
+      value[ii] = ReadReal();
+   return value;
+}
+
+//------------------------------------------------------------------------------
+// Rvector3 ReadRvector3()
+//------------------------------------------------------------------------------
+/**
+ * Reads an Rvector3.
+ */
+//------------------------------------------------------------------------------
+Rvector3 BinaryReader::ReadRvector3()
+{
+   Real x = ReadReal();
+   Real y = ReadReal();
+   Real z = ReadReal();
+   return Rvector3(x, y, z);
+}
+
+//------------------------------------------------------------------------------
+// Rvector6 ReadRvector6()
+//------------------------------------------------------------------------------
+/**
+ * Reads an Rvector6.
+ */
+//------------------------------------------------------------------------------
+Rvector6 BinaryReader::ReadRvector6()
+{
+   Rvector6 value;
+   for (Integer ii = 0; ii < 6; ii++)
+      value[ii] = ReadReal();
+   return value;
+}
+
+//------------------------------------------------------------------------------
+// Rmatrix33 ReadRmatrix33()
+//------------------------------------------------------------------------------
+/**
+ * Reads an Rmatrix33 (row by row).
+ */
+//------------------------------------------------------------------------------
+Rmatrix33 BinaryReader::ReadRmatrix33()
+{
+   Rmatrix33 value;
+   for (Integer ii = 0; ii < 3; ii++)
+      for (Integer jj = 0; jj < 3; jj++)
+         value(ii, jj) = ReadReal();
+   return value;
+}
+
+//------------------------------------------------------------------------------
+// bool AtEnd() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if all the bytes were read.
+ */
+//------------------------------------------------------------------------------
+bool BinaryReader::AtEnd() const
+{
+   return (offset == data.size());
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Integer ReadCount(size_t elementSize)
+//------------------------------------------------------------------------------
+/**
+ * Reads the count of an array and checks that its elements fit in the data.
+ *
+ * @param elementSize  size (bytes) of an element
+ *
+ * @return  the count
+ *
+ */
+//------------------------------------------------------------------------------
+Integer BinaryReader::ReadCount(size_t elementSize)
+{
+   Integer count = ReadInt();
+   if (count < 0 || offset + (size_t) count * elementSize > data.size())
+      throw TATCException("BinaryReader: truncated data\n");
+   return count;
+}
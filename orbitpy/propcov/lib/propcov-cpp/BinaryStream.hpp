@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------------
+//                           BinaryStream
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the BinaryWriter and BinaryReader classes, a compact binary
+ * serialization of the state of the propcov objects (e.g. for pickling the
+ * objects to the worker processes of a multiprocessing pool).
+ *
+ * The values are written in the native (little-endian) layout: int32
+ * integers, float64 reals, uint8 flags; arrays, vectors and strings are an
+ * int32 count followed by the elements, matrices are written row by row.
+ * Each serialized object starts with a header (class name and format
+ * version) checked when reading.
+ */
+//------------------------------------------------------------------------------
+#ifndef BinaryStream_hpp
+#define BinaryStream_hpp
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "Rvector.hpp"
+#include "Rvector3.hpp"
+#include "Rvector6.hpp"
+#include "Rmatrix33.hpp"
+#include "TATCException.hpp"
+
+class BinaryWriter
+{
+public:
+
+   /// class construction/destruction
+   BinaryWriter();
+   virtual ~BinaryWriter();
+
+   /// Write the header of an object
+   void                 WriteHeader(const std::string &className,
+                                    Integer version);
+
+   void                 WriteInt(Integer value);
+   void                 WriteReal(Real value);
+   void                 WriteBool(bool value);
+   void                 WriteString(const std::string &value);
+   void                 WriteIntArray(const IntegerArray &values);
+   void                 WriteRealArray(const RealArray &values);
+   void                 WriteRvector(const Rvector &value);
+   void                 WriteRvector3(const Rvector3 &value);
+   void                 WriteRvector6(const Rvector6 &value);
+   void                 WriteRmatrix33(const Rmatrix33 &value);
+
+   /// Get the bytes written so far
+   const std::string&   GetBuffer() const;
+
+protected:
+
+   /// the bytes written
+   std::string          buffer;
+
+   /// Append a value
+   template <typename T>
+   void                 Write(T value)
+   {
+      buffer.append((const char*) &value, sizeof(T));
+   }
+};
+
+class BinaryReader
+{
+public:
+
+   /// class construction/destruction
+   BinaryReader(const std::string &data);
+   virtual ~BinaryReader();
+
+   /// Read the header of an object, checking the class name and that the
+   /// version is not newer than the input one; returns the version
+   Integer              ReadHeader(const std::string &className,
+                                   Integer maxVersion);
+
+   Integer              ReadInt();
+   Real                 ReadReal();
+   bool                 ReadBool();
+   std::string          ReadString();
+   IntegerArray         ReadIntArray();
+   RealArray            ReadRealArray();
+   Rvector              ReadRvector();
+   Rvector3             ReadRvector3();
+   Rvector6             ReadRvector6();
+   Rmatrix33            ReadRmatrix33();
+
+   /// Check if all the bytes were read
+   bool                 AtEnd() const;
+
+protected:
+
+   /// the bytes read from (not copied, must outlive the reader)
+   const std::string    &data;
+   /// offset of the next value
+   size_t               offset;
+
+   /// Read a count (checking that the elements fit in the data)
+   Integer              ReadCount(size_t elementSize);
+
+   /// Read a value
+   template <typename T>
+   T                    Read()
+   {
+      if (offset + sizeof(T) > data.size())
+         throw TATCException("BinaryReader: truncated data\n");
+      T value;
+      std::memcpy(&value, data.data() + offset, sizeof(T));
+      offset += sizeof(T);
+      return value;
+   }
+};
+#endif // BinaryStream_hpp
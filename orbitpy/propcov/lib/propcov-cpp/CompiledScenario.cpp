@@ -0,0 +1,420 @@
+//------------------------------------------------------------------------------
+//                           CompiledScenario
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CompiledScenario and ScenarioEvaluator classes
+ */
+//------------------------------------------------------------------------------
+#include "gmatdefs.hpp"
+#include "CompiledScenario.hpp"
+#include "CoverageKernels.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "GMATCustomSensor.hpp"
+#include "polygon/DSPIPCustomSensor.hpp"
+#include "OrbitState.hpp"
+#include "BinaryStream.hpp"
+#include "Profiler.hpp"
+#include "TATCException.hpp"
+
+//------------------------------------------------------------------------------
+// static functions
+//------------------------------------------------------------------------------
+
+/// Check that a scenario is not NULL (for the member initializers)
+static const CompiledScenario* CheckScenario(const CompiledScenario *scenario)
+{
+   if (!scenario)
+      throw TATCException("ScenarioEvaluator: NULL scenario\n");
+   return scenario;
+}
+
+//------------------------------------------------------------------------------
+// CompiledScenario
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CompiledScenario(PointGroup *ptGroup, Spacecraft *sat)
+//------------------------------------------------------------------------------
+/**
+ * Constructor; takes the snapshot of the points and of the spacecraft (at its
+ * current orbit epoch and state).
+ *
+ * @param ptGroup  the points
+ * @param sat      the spacecraft
+ *
+ */
+//------------------------------------------------------------------------------
+CompiledScenario::CompiledScenario(PointGroup *ptGroup, Spacecraft *sat) :
+   pointGroup  (NULL),
+   spacecraft  (NULL),
+   propagator  (NULL),
+   epoch       (0.0)
+{
+   if (!ptGroup || !sat)
+      throw TATCException("CompiledScenario: NULL point group or "
+                          "spacecraft\n");
+   pointGroup = new PointGroup(*ptGroup);
+
+   // the copy owns copies of the orbit state, epoch, attitude and
+   // interpolator; its sensors are replaced by copies
+   spacecraft = new Spacecraft(*sat);
+   spacecraft->RemoveSensors();
+   for (Integer ii = 0; ii < sat->GetNumSensors(); ii++)
+   {
+      Sensor *sensor = CopySensor(sat->GetSensor(ii));
+      if (sensor)
+         ownedSensors.push_back(sensor);
+      else
+         sensor = sat->GetSensor(ii);
+      spacecraft->AddSensor(sensor);
+   }
+
+   propagator  = new Propagator(spacecraft);
+   epoch       = spacecraft->GetJulianDate();
+   nadirToBody = spacecraft->GetNadirToBodyMatrix();
+}
+
+//------------------------------------------------------------------------------
+// ~CompiledScenario()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+CompiledScenario::~CompiledScenario()
+{
+   delete propagator;
+   delete spacecraft;
+   for (Sensor *sensor : ownedSensors)
+      delete sensor;
+   delete pointGroup;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumPoints() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of points.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CompiledScenario::GetNumPoints() const
+{
+   return pointGroup->GetNumPoints();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumSensors() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of sensors of the spacecraft.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CompiledScenario::GetNumSensors() const
+{
+   return spacecraft->GetNumSensors();
+}
+
+//------------------------------------------------------------------------------
+// Real GetEpoch() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the orbit epoch of the spacecraft.
+ *
+ * @return  the epoch (JDUT1)
+ *
+ */
+//------------------------------------------------------------------------------
+Real CompiledScenario::GetEpoch() const
+{
+   return epoch;
+}
+
+//------------------------------------------------------------------------------
+// const Rmatrix33& GetNadirToBodyMatrix() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the rotation matrix from the nadir frame to the spacecraft body
+ * frame.
+ *
+ */
+//------------------------------------------------------------------------------
+const Rmatrix33& CompiledScenario::GetNadirToBodyMatrix() const
+{
+   return nadirToBody;
+}
+
+//------------------------------------------------------------------------------
+// Rvector6 GetOrbitalElements(Real jd) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the Keplerian elements of the spacecraft at the input time (J2
+ * secular propagation from the epoch, without drag).
+ *
+ * @param jd  time (JDUT1)
+ *
+ * @return  the elements (SMA [km], ECC, INC, RAAN, AOP, TA [rad])
+ *
+ */
+//------------------------------------------------------------------------------
+Rvector6 CompiledScenario::GetOrbitalElements(Real jd) const
+{
+   return propagator->GetOrbitalElementsAt(jd);
+}
+
+//------------------------------------------------------------------------------
+// Rvector6 GetCartesianState(Real jd) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the Cartesian state of the spacecraft at the input time (the state
+ * Propagator::Propagate sets on the spacecraft).
+ *
+ * @param jd  time (JDUT1)
+ *
+ * @return  the state (MJ2000 Earth-centered inertial, km and km/s)
+ *
+ */
+//------------------------------------------------------------------------------
+Rvector6 CompiledScenario::GetCartesianState(Real jd) const
+{
+   Profiler::Scope timer(Profiler::PROPAGATION);
+   OrbitState state(*spacecraft->GetOrbitState());
+   state.SetKeplerianVectorState(propagator->GetOrbitalElementsAt(jd));
+   return state.GetCartesianState();
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// static Sensor* CopySensor(Sensor *sensor)
+//------------------------------------------------------------------------------
+/**
+ * Returns a copy of a sensor of one of the library types.
+ *
+ * @param sensor  the sensor
+ *
+ * @return  the copy (owned by the caller), NULL for the other sensor types
+ *
+ */
+//------------------------------------------------------------------------------
+Sensor* CompiledScenario::CopySensor(Sensor *sensor)
+{
+   switch (GetFovSensorKind(sensor))
+   {
+      case CONICAL_SENSOR:
+         return new ConicalSensor(*static_cast<ConicalSensor*>(sensor));
+      case RECTANGULAR_SENSOR:
+         return new RectangularSensor(*static_cast<RectangularSensor*>(sensor));
+      case GMAT_CUSTOM_SENSOR:
+         return new GMATCustomSensor(*static_cast<GMATCustomSensor*>(sensor));
+      case DSPIP_CUSTOM_SENSOR:
+      {
+         // copied through its serialized data (the preprocessed polygon is
+         // restored, not recomputed)
+         BinaryWriter out;
+         sensor->Serialize(out);
+         BinaryReader in(out.GetBuffer());
+         return new DSPIPCustomSensor(in);
+      }
+      default:
+         return NULL;
+   }
+}
+
+//------------------------------------------------------------------------------
+// ScenarioEvaluator
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// ScenarioEvaluator(const CompiledScenario *scenario)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param scenario  the scenario to evaluate (must outlive the evaluator)
+ *
+ */
+//------------------------------------------------------------------------------
+ScenarioEvaluator::ScenarioEvaluator(const CompiledScenario *scenario) :
+   scenario    (CheckScenario(scenario)),
+   covChecker  (scenario->pointGroup, scenario->spacecraft)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~ScenarioEvaluator()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+ScenarioEvaluator::~ScenarioEvaluator()
+{
+}
+
+//------------------------------------------------------------------------------
+// const CompiledScenario* GetScenario() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the scenario evaluated.
+ *
+ */
+//------------------------------------------------------------------------------
+const CompiledScenario* ScenarioEvaluator::GetScenario() const
+{
+   return scenario;
+}
+
+//------------------------------------------------------------------------------
+// void SetSinglePrecision(bool single)
+//------------------------------------------------------------------------------
+/**
+ * Sets the single precision feasibility mode of the coverage checks (see
+ * CoverageChecker::SetSinglePrecision).
+ *
+ * @param single  use the single precision feasibility test?
+ *
+ */
+//------------------------------------------------------------------------------
+void ScenarioEvaluator::SetSinglePrecision(bool single)
+{
+   covChecker.SetSinglePrecision(single);
+}
+
+//------------------------------------------------------------------------------
+// bool GetSinglePrecision() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the single precision feasibility mode of the coverage checks.
+ *
+ */
+//------------------------------------------------------------------------------
+bool ScenarioEvaluator::GetSinglePrecision() const
+{
+   return covChecker.GetSinglePrecision();
+}
+
+//------------------------------------------------------------------------------
+// void SetUseFovLookupTable(bool useTable, Integer coneCells,
+//                           Integer clockCells)
+//------------------------------------------------------------------------------
+/**
+ * Sets the use of a field-of-view lookup table in the coverage checks (see
+ * CoverageChecker::SetUseFovLookupTable); the table is built by this
+ * evaluator for the sensor of the scenario.
+ *
+ * @param useTable    use a lookup table?
+ * @param coneCells   number of cells of the table over the cone angles
+ * @param clockCells  number of cells of the table over the clock angles
+ *
+ */
+//------------------------------------------------------------------------------
+void ScenarioEvaluator::SetUseFovLookupTable(bool useTable, Integer coneCells,
+                                             Integer clockCells)
+{
+   covChecker.SetUseFovLookupTable(useTable, coneCells, clockCells);
+}
+
+//------------------------------------------------------------------------------
+// bool GetUseFovLookupTable() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the coverage checks use a field-of-view lookup table.
+ *
+ */
+//------------------------------------------------------------------------------
+bool ScenarioEvaluator::GetUseFovLookupTable() const
+{
+   return covChecker.GetUseFovLookupTable();
+}
+
+//------------------------------------------------------------------------------
+// Rvector6 GetCartesianState(Real jd)
+//------------------------------------------------------------------------------
+/**
+ * Returns the Cartesian state of the spacecraft at the input time.
+ *
+ * @param jd  time (JDUT1)
+ *
+ * @return  the state (MJ2000 Earth-centered inertial, km and km/s)
+ *
+ */
+//------------------------------------------------------------------------------
+Rvector6 ScenarioEvaluator::GetCartesianState(Real jd)
+{
+   return scenario->GetCartesianState(jd);
+}
+
+//------------------------------------------------------------------------------
+// Rvector6 GetBodyFixedState(Real jd, const Rvector6 &cartState)
+//------------------------------------------------------------------------------
+/**
+ * Returns the Earth-fixed state of the spacecraft (as the CoverageChecker:
+ * the velocity is rotated, without the omega cross r term).
+ *
+ * @param jd         time (JDUT1)
+ * @param cartState  inertial state of the spacecraft at jd
+ *
+ * @return  the Earth-fixed state
+ *
+ */
+//------------------------------------------------------------------------------
+Rvector6 ScenarioEvaluator::GetBodyFixedState(Real jd,
+                                              const Rvector6 &cartState)
+{
+   Profiler::Scope timer(Profiler::FRAME_CONVERSION);
+   Rmatrix33 inertialToFixed = earth.GetInertialToFixedRotation(jd);
+   Rvector3  fixedPos        = inertialToFixed * cartState.GetR();
+   Rvector3  fixedVel        = inertialToFixed * cartState.GetV();
+   return Rvector6(fixedPos(0), fixedPos(1), fixedPos(2),
+                   fixedVel(0), fixedVel(1), fixedVel(2));
+}
+
+//------------------------------------------------------------------------------
+// void CheckPointCoverageInto(Real jd, const Rvector6 &cartState,
+//                             IntegerArray &result)
+//------------------------------------------------------------------------------
+/**
+ * Checks the coverage of all the points at the input time.
+ *
+ * @param jd         time (JDUT1)
+ * @param cartState  inertial state of the spacecraft at jd (from
+ *                   GetCartesianState)
+ * @param result     indices of the points in view (output, cleared first)
+ *
+ */
+//------------------------------------------------------------------------------
+void ScenarioEvaluator::CheckPointCoverageInto(Real jd,
+                                               const Rvector6 &cartState,
+                                               IntegerArray &result)
+{
+   covChecker.CheckPointCoverageInto(GetBodyFixedState(jd, cartState), jd,
+                                     result);
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray CheckPointCoverage(Real jd)
+//------------------------------------------------------------------------------
+/**
+ * Checks the coverage of all the points at the input time.
+ *
+ * @param jd  time (JDUT1)
+ *
+ * @return  indices of the points in view
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray ScenarioEvaluator::CheckPointCoverage(Real jd)
+{
+   IntegerArray result;
+   CheckPointCoverageInto(jd, GetCartesianState(jd), result);
+   return result;
+}
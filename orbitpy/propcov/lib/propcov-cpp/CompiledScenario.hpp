@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+//                           CompiledScenario
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CompiledScenario and ScenarioEvaluator classes.
+ *
+ * A CompiledScenario is an immutable snapshot of a coverage scenario: the
+ * points, and the spacecraft with its orbit (the J2 secular elements and
+ * rates of the propagator), its attitude offsets (the nadir-to-body matrix)
+ * and its sensors (their geometry and body-to-sensor matrices). The snapshot
+ * is taken at construction: later changes to the input point group,
+ * spacecraft or sensors do not affect it. Sensors of types other than the
+ * conical, rectangular, GMAT custom and DSPIP custom sensors cannot be copied
+ * and are shared with the input spacecraft.
+ *
+ * A scenario is not modified after its construction and can be shared by any
+ * number of threads. Each thread evaluates it with its own ScenarioEvaluator,
+ * which holds the scratch data of the computations (frame conversion and
+ * coverage checker); the results are those of a Propagator and a
+ * CoverageChecker on the spacecraft (without drag).
+ */
+//------------------------------------------------------------------------------
+#ifndef CompiledScenario_hpp
+#define CompiledScenario_hpp
+
+#include <vector>
+#include "gmatdefs.hpp"
+#include "Rvector6.hpp"
+#include "Rmatrix33.hpp"
+#include "PointGroup.hpp"
+#include "Spacecraft.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "Earth.hpp"
+
+class CompiledScenario
+{
+public:
+
+   /// class construction/destruction
+   CompiledScenario(PointGroup *ptGroup, Spacecraft *sat);
+   virtual ~CompiledScenario();
+
+   /// Get the number of points and sensors
+   Integer           GetNumPoints() const;
+   Integer           GetNumSensors() const;
+   /// Get the orbit epoch (JDUT1)
+   Real              GetEpoch() const;
+   /// Get the nadir-to-body rotation matrix of the spacecraft
+   const Rmatrix33&  GetNadirToBodyMatrix() const;
+   /// Get the Keplerian elements / Cartesian state (MJ2000 Earth-centered
+   /// inertial) of the spacecraft at the input time (JDUT1)
+   Rvector6          GetOrbitalElements(Real jd) const;
+   Rvector6          GetCartesianState(Real jd) const;
+
+protected:
+
+   /// the points (copy of the input point group)
+   PointGroup           *pointGroup;
+   /// the spacecraft (copy of the input spacecraft, with copies of its
+   /// sensors); never modified
+   Spacecraft           *spacecraft;
+   /// the sensor copies owned by the scenario
+   std::vector<Sensor*> ownedSensors;
+   /// the propagator of the spacecraft; only its const methods are used
+   Propagator           *propagator;
+   /// orbit epoch (JDUT1) and nadir-to-body matrix of the spacecraft
+   Real                 epoch;
+   Rmatrix33            nadirToBody;
+
+   /// Copy a sensor (NULL if its type cannot be copied)
+   static Sensor*       CopySensor(Sensor *sensor);
+
+   friend class ScenarioEvaluator;
+
+private:
+
+   CompiledScenario(const CompiledScenario &copy);
+   CompiledScenario& operator=(const CompiledScenario &copy);
+};
+
+class ScenarioEvaluator
+{
+public:
+
+   /// class construction/destruction
+   ScenarioEvaluator(const CompiledScenario *scenario);
+   virtual ~ScenarioEvaluator();
+
+   const CompiledScenario* GetScenario() const;
+   /// Set/get the single precision feasibility mode of the coverage checks
+   void              SetSinglePrecision(bool single);
+   bool              GetSinglePrecision() const;
+   /// Set/get the use of a field-of-view lookup table in the coverage checks
+   void              SetUseFovLookupTable(bool useTable,
+                                          Integer coneCells = 128,
+                                          Integer clockCells = 256);
+   bool              GetUseFovLookupTable() const;
+
+   /// Get the Cartesian state (MJ2000 Earth-centered inertial) of the
+   /// spacecraft at the input time (JDUT1)
+   Rvector6          GetCartesianState(Real jd);
+   /// Get the Earth-fixed state of the spacecraft for its inertial state at
+   /// the input time
+   Rvector6          GetBodyFixedState(Real jd, const Rvector6 &cartState);
+   /// Check the coverage of all the points at the input time, for the
+   /// inertial state of the spacecraft at that time; the indices are
+   /// written into result (cleared first; its capacity is reused)
+   void              CheckPointCoverageInto(Real jd, const Rvector6 &cartState,
+                                            IntegerArray &result);
+   /// Check the coverage of all the points at the input time
+   IntegerArray      CheckPointCoverage(Real jd);
+
+protected:
+
+   /// the scenario evaluated
+   const CompiledScenario  *scenario;
+   /// the central body
+   Earth                   earth;
+   /// the coverage checker of the scenario points and spacecraft
+   CoverageChecker         covChecker;
+
+private:
+
+   ScenarioEvaluator(const ScenarioEvaluator &copy);
+   ScenarioEvaluator& operator=(const ScenarioEvaluator &copy);
+};
+#endif // CompiledScenario_hpp
@@ -68,6 +68,21 @@ ConicalSensor::ConicalSensor(const ConicalSensor &copy) :
 {
 }
 
+//------------------------------------------------------------------------------
+// ConicalSensor(BinaryReader &in)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data (see Serialize)
+ * 
+ * @param in the reader of the data
+ */
+//------------------------------------------------------------------------------
+ConicalSensor::ConicalSensor(BinaryReader &in) :
+   Sensor(in, "ConicalSensor")
+{
+   fieldOfView = in.ReadReal();
+}
+
 //------------------------------------------------------------------------------
 // ConicalSensor& operator=(const ConicalSensor &copy)
 //------------------------------------------------------------------------------
@@ -148,6 +163,21 @@ bool ConicalSensor::CheckTargetVisibility(Real viewConeAngle,
    return CheckTargetMaxExcursionAngle(viewConeAngle);
 }
 
+//------------------------------------------------------------------------------
+//  void Serialize(BinaryWriter &out) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the state of the sensor
+ *
+ * @param out  the writer
+ */
+//------------------------------------------------------------------------------
+void ConicalSensor::Serialize(BinaryWriter &out) const
+{
+   WriteSensorData(out, "ConicalSensor");
+   out.WriteReal(fieldOfView);
+}
+
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
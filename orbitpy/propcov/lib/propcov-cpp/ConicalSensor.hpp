@@ -42,6 +42,8 @@ public:
    /// class construction/destruction
    ConicalSensor(Real fov);
    ConicalSensor( const ConicalSensor &copy);
+   /// Construct from the data written by Serialize
+   ConicalSensor(BinaryReader &in);
    ConicalSensor& operator=(const ConicalSensor &copy);
    
    virtual ~ConicalSensor();
@@ -55,6 +57,8 @@ public:
    /// determines whether or not the point is in the sensor FOV.
    virtual bool  CheckTargetVisibility(Real viewConeAngle,
                                        Real viewClockAngle = 0.0);
+   /// Write the state of the sensor
+   virtual void  Serialize(BinaryWriter &out) const;
 
 protected:
    
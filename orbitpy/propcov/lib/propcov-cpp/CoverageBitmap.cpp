@@ -0,0 +1,975 @@
+//------------------------------------------------------------------------------
+//                           CoverageBitmap
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageBitmap class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <iterator>
+#include "gmatdefs.hpp"
+#include "CoverageBitmap.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Integer CoverageBitmap::ARRAY_MAX_SIZE = 4096;
+const Integer CoverageBitmap::BITMAP_WORDS   = 1024;
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageBitmap()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor (empty set).
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::CoverageBitmap()
+{
+}
+
+//------------------------------------------------------------------------------
+// CoverageBitmap(const IntegerArray &indices)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from an array of indices (in any order, duplicates allowed).
+ *
+ * @param indices  the (non-negative) indices
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::CoverageBitmap(const IntegerArray &indices)
+{
+   AddIndices(indices);
+}
+
+//------------------------------------------------------------------------------
+// CoverageBitmap(const CoverageBitmap &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the CoverageBitmap object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::CoverageBitmap(const CoverageBitmap &copy) :
+   keys        (copy.keys),
+   containers  (copy.containers)
+{
+}
+
+//------------------------------------------------------------------------------
+// CoverageBitmap& operator=(const CoverageBitmap &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for CoverageBitmap.
+ *
+ * @param copy  the CoverageBitmap object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap& CoverageBitmap::operator=(const CoverageBitmap &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   keys        = copy.keys;
+   containers  = copy.containers;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageBitmap()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::~CoverageBitmap()
+{
+}
+
+//------------------------------------------------------------------------------
+// void Add(Integer idx)
+//------------------------------------------------------------------------------
+/**
+ * Adds an index to the set.
+ *
+ * @param idx  the (non-negative) index
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::Add(Integer idx)
+{
+   if (idx < 0)
+      throw TATCException("CoverageBitmap: index must be non-negative\n");
+   uint16_t key = (uint16_t) ((uint32_t) idx >> 16);
+   uint16_t low = (uint16_t) ((uint32_t) idx & 0xFFFF);
+
+   // fast path for increasing indices: append to the last container
+   if (!keys.empty() && keys.back() == key)
+   {
+      Container &c = containers.back();
+      if (!c.isBitmap && !c.values.empty() && c.values.back() < low)
+      {
+         if ((Integer) c.values.size() < ARRAY_MAX_SIZE)
+         {
+            c.values.push_back(low);
+            c.cardinality++;
+            return;
+         }
+      }
+      ContainerAdd(c, low);
+      return;
+   }
+   ContainerAdd(GetOrCreateContainer(key), low);
+}
+
+//------------------------------------------------------------------------------
+// void AddIndices(const IntegerArray &indices)
+//------------------------------------------------------------------------------
+/**
+ * Adds all the indices of an array to the set.
+ *
+ * @param indices  the (non-negative) indices
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::AddIndices(const IntegerArray &indices)
+{
+   for (Integer ii = 0; ii < (Integer) indices.size(); ii++)
+      Add(indices[ii]);
+}
+
+//------------------------------------------------------------------------------
+// void Remove(Integer idx)
+//------------------------------------------------------------------------------
+/**
+ * Removes an index from the set (if present).
+ *
+ * @param idx  the index
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::Remove(Integer idx)
+{
+   if (idx < 0)
+      return;
+   Integer pos = FindKey((uint16_t) ((uint32_t) idx >> 16));
+   if (pos < 0)
+      return;
+   ContainerRemove(containers[pos], (uint16_t) ((uint32_t) idx & 0xFFFF));
+   if (containers[pos].cardinality == 0)
+   {
+      keys.erase(keys.begin() + pos);
+      containers.erase(containers.begin() + pos);
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool Contains(Integer idx) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if an index is in the set.
+ *
+ * @param idx  the index
+ *
+ * @return  true if the index is in the set
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageBitmap::Contains(Integer idx) const
+{
+   if (idx < 0)
+      return false;
+   Integer pos = FindKey((uint16_t) ((uint32_t) idx >> 16));
+   if (pos < 0)
+      return false;
+   return ContainerContains(containers[pos], (uint16_t) ((uint32_t) idx & 0xFFFF));
+}
+
+//------------------------------------------------------------------------------
+// Integer GetCardinality() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of indices in the set.
+ *
+ * @return  cardinality of the set
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageBitmap::GetCardinality() const
+{
+   Integer card = 0;
+   for (Integer ii = 0; ii < (Integer) containers.size(); ii++)
+      card += containers[ii].cardinality;
+   return card;
+}
+
+//------------------------------------------------------------------------------
+// bool IsEmpty() const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the set is empty.
+ *
+ * @return  true if the set is empty
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageBitmap::IsEmpty() const
+{
+   return containers.empty();
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all the indices.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::Clear()
+{
+   keys.clear();
+   containers.clear();
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray ToIndices() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the indices of the set.
+ *
+ * @return  indices in increasing order
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray CoverageBitmap::ToIndices() const
+{
+   IntegerArray result;
+   result.reserve(GetCardinality());
+   for (Integer ii = 0; ii < (Integer) containers.size(); ii++)
+   {
+      const Container &c    = containers[ii];
+      Integer          base = ((Integer) keys[ii]) << 16;
+      if (c.isBitmap)
+      {
+         for (Integer w = 0; w < BITMAP_WORDS; w++)
+         {
+            uint64_t word = c.words[w];
+            while (word)
+            {
+               Integer bit = __builtin_ctzll(word);
+               result.push_back(base + w * 64 + bit);
+               word &= word - 1;
+            }
+         }
+      }
+      else
+      {
+         for (Integer k = 0; k < (Integer) c.values.size(); k++)
+            result.push_back(base + c.values[k]);
+      }
+   }
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// CoverageBitmap Union(const CoverageBitmap &other) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the union of this set and the input set.
+ *
+ * @param other  the other set
+ *
+ * @return  the union
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap CoverageBitmap::Union(const CoverageBitmap &other) const
+{
+   CoverageBitmap result;
+   Integer ii = 0, jj = 0;
+   while (ii < (Integer) keys.size() || jj < (Integer) other.keys.size())
+   {
+      if (jj >= (Integer) other.keys.size() ||
+          (ii < (Integer) keys.size() && keys[ii] < other.keys[jj]))
+      {
+         result.keys.push_back(keys[ii]);
+         result.containers.push_back(containers[ii++]);
+      }
+      else if (ii >= (Integer) keys.size() || other.keys[jj] < keys[ii])
+      {
+         result.keys.push_back(other.keys[jj]);
+         result.containers.push_back(other.containers[jj++]);
+      }
+      else
+      {
+         result.keys.push_back(keys[ii]);
+         result.containers.push_back(ContainerUnion(containers[ii++],
+                                                    other.containers[jj++]));
+      }
+   }
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// CoverageBitmap Intersection(const CoverageBitmap &other) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the intersection of this set and the input set.
+ *
+ * @param other  the other set
+ *
+ * @return  the intersection
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap CoverageBitmap::Intersection(const CoverageBitmap &other) const
+{
+   CoverageBitmap result;
+   Integer ii = 0, jj = 0;
+   while (ii < (Integer) keys.size() && jj < (Integer) other.keys.size())
+   {
+      if (keys[ii] < other.keys[jj])
+         ii++;
+      else if (other.keys[jj] < keys[ii])
+         jj++;
+      else
+      {
+         Container c = ContainerIntersection(containers[ii],
+                                             other.containers[jj]);
+         if (c.cardinality > 0)
+         {
+            result.keys.push_back(keys[ii]);
+            result.containers.push_back(c);
+         }
+         ii++;
+         jj++;
+      }
+   }
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// CoverageBitmap Difference(const CoverageBitmap &other) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the indices of this set which are not in the input set (e.g. the
+ * points newly covered at a step: current.Difference(cumulative)).
+ *
+ * @param other  the other set
+ *
+ * @return  the difference
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap CoverageBitmap::Difference(const CoverageBitmap &other) const
+{
+   CoverageBitmap result;
+   Integer jj = 0;
+   for (Integer ii = 0; ii < (Integer) keys.size(); ii++)
+   {
+      while (jj < (Integer) other.keys.size() && other.keys[jj] < keys[ii])
+         jj++;
+      if (jj < (Integer) other.keys.size() && other.keys[jj] == keys[ii])
+      {
+         Container c = ContainerDifference(containers[ii], other.containers[jj]);
+         if (c.cardinality > 0)
+         {
+            result.keys.push_back(keys[ii]);
+            result.containers.push_back(c);
+         }
+      }
+      else
+      {
+         result.keys.push_back(keys[ii]);
+         result.containers.push_back(containers[ii]);
+      }
+   }
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// void UnionWith(const CoverageBitmap &other)
+//------------------------------------------------------------------------------
+/**
+ * Adds the indices of the input set to this set.
+ *
+ * @param other  the other set
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::UnionWith(const CoverageBitmap &other)
+{
+   for (Integer jj = 0; jj < (Integer) other.keys.size(); jj++)
+   {
+      Integer pos = FindKey(other.keys[jj]);
+      if (pos < 0)
+      {
+         std::vector<uint16_t>::iterator it =
+               std::lower_bound(keys.begin(), keys.end(), other.keys[jj]);
+         Integer insertAt = it - keys.begin();
+         keys.insert(it, other.keys[jj]);
+         containers.insert(containers.begin() + insertAt, other.containers[jj]);
+      }
+      else
+      {
+         Container &c = containers[pos];
+         if (c.isBitmap)
+         {
+            // in place, avoiding a copy of the bitmap
+            const Container &o = other.containers[jj];
+            if (o.isBitmap)
+               for (Integer w = 0; w < BITMAP_WORDS; w++)
+                  c.words[w] |= o.words[w];
+            else
+               for (Integer k = 0; k < (Integer) o.values.size(); k++)
+                  c.words[o.values[k] >> 6] |= ((uint64_t) 1) << (o.values[k] & 63);
+            c.cardinality = 0;
+            for (Integer w = 0; w < BITMAP_WORDS; w++)
+               c.cardinality += __builtin_popcountll(c.words[w]);
+         }
+         else
+            c = ContainerUnion(c, other.containers[jj]);
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// Integer IntersectionCardinality(const CoverageBitmap &other) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of indices in both sets.
+ *
+ * @param other  the other set
+ *
+ * @return  cardinality of the intersection
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageBitmap::IntersectionCardinality(const CoverageBitmap &other) const
+{
+   Integer card = 0;
+   Integer ii = 0, jj = 0;
+   while (ii < (Integer) keys.size() && jj < (Integer) other.keys.size())
+   {
+      if (keys[ii] < other.keys[jj])
+         ii++;
+      else if (other.keys[jj] < keys[ii])
+         jj++;
+      else
+         card += ContainerIntersectionCardinality(containers[ii++],
+                                                  other.containers[jj++]);
+   }
+   return card;
+}
+
+//------------------------------------------------------------------------------
+// Integer UnionCardinality(const CoverageBitmap &other) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of indices in either set.
+ *
+ * @param other  the other set
+ *
+ * @return  cardinality of the union
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageBitmap::UnionCardinality(const CoverageBitmap &other) const
+{
+   return GetCardinality() + other.GetCardinality() -
+          IntersectionCardinality(other);
+}
+
+//------------------------------------------------------------------------------
+// bool operator==(const CoverageBitmap &other) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the two sets hold the same indices.
+ *
+ * @param other  the other set
+ *
+ * @return  true if the sets are equal
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageBitmap::operator==(const CoverageBitmap &other) const
+{
+   if (keys != other.keys)
+      return false;
+   for (Integer ii = 0; ii < (Integer) containers.size(); ii++)
+      if (!ContainerEquals(containers[ii], other.containers[ii]))
+         return false;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool operator!=(const CoverageBitmap &other) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the two sets differ.
+ *
+ * @param other  the other set
+ *
+ * @return  true if the sets differ
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageBitmap::operator!=(const CoverageBitmap &other) const
+{
+   return !(*this == other);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumContainers() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of containers.
+ *
+ * @return  number of containers
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageBitmap::GetNumContainers() const
+{
+   return containers.size();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumBitmapContainers() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of bitmap (dense) containers.
+ *
+ * @return  number of bitmap containers
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageBitmap::GetNumBitmapContainers() const
+{
+   Integer num = 0;
+   for (Integer ii = 0; ii < (Integer) containers.size(); ii++)
+      if (containers[ii].isBitmap)
+         num++;
+   return num;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Integer FindKey(uint16_t key) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the position of the container of a key.
+ *
+ * @param key  high 16 bits of the indices
+ *
+ * @return  position of the container, -1 if there is none
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageBitmap::FindKey(uint16_t key) const
+{
+   std::vector<uint16_t>::const_iterator it =
+         std::lower_bound(keys.begin(), keys.end(), key);
+   if (it == keys.end() || *it != key)
+      return -1;
+   return it - keys.begin();
+}
+
+//------------------------------------------------------------------------------
+// Container& GetOrCreateContainer(uint16_t key)
+//------------------------------------------------------------------------------
+/**
+ * Returns the container of a key, inserting an empty array container if needed.
+ *
+ * @param key  high 16 bits of the indices
+ *
+ * @return  the container
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::Container& CoverageBitmap::GetOrCreateContainer(uint16_t key)
+{
+   std::vector<uint16_t>::iterator it =
+         std::lower_bound(keys.begin(), keys.end(), key);
+   Integer pos = it - keys.begin();
+   if (it == keys.end() || *it != key)
+   {
+      Container c;
+      c.isBitmap    = false;
+      c.cardinality = 0;
+      keys.insert(it, key);
+      containers.insert(containers.begin() + pos, c);
+   }
+   return containers[pos];
+}
+
+//------------------------------------------------------------------------------
+// static bool ContainerContains(const Container &c, uint16_t low)
+//------------------------------------------------------------------------------
+/**
+ * Checks if a container holds a value.
+ *
+ * @param c    the container
+ * @param low  low 16 bits of the index
+ *
+ * @return  true if the value is in the container
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageBitmap::ContainerContains(const Container &c, uint16_t low)
+{
+   if (c.isBitmap)
+      return (c.words[low >> 6] >> (low & 63)) & 1;
+   return std::binary_search(c.values.begin(), c.values.end(), low);
+}
+
+//------------------------------------------------------------------------------
+// static void ContainerAdd(Container &c, uint16_t low)
+//------------------------------------------------------------------------------
+/**
+ * Adds a value to a container, converting an array container to a bitmap
+ * when it grows beyond ARRAY_MAX_SIZE values.
+ *
+ * @param c    the container
+ * @param low  low 16 bits of the index
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::ContainerAdd(Container &c, uint16_t low)
+{
+   if (c.isBitmap)
+   {
+      uint64_t mask = ((uint64_t) 1) << (low & 63);
+      if (!(c.words[low >> 6] & mask))
+      {
+         c.words[low >> 6] |= mask;
+         c.cardinality++;
+      }
+      return;
+   }
+   std::vector<uint16_t>::iterator it =
+         std::lower_bound(c.values.begin(), c.values.end(), low);
+   if (it != c.values.end() && *it == low)
+      return;
+   c.values.insert(it, low);
+   c.cardinality++;
+   if (c.cardinality > ARRAY_MAX_SIZE)
+      ToBitmap(c);
+}
+
+//------------------------------------------------------------------------------
+// static void ContainerRemove(Container &c, uint16_t low)
+//------------------------------------------------------------------------------
+/**
+ * Removes a value from a container, converting a bitmap container back to an
+ * array when it becomes sparse.
+ *
+ * @param c    the container
+ * @param low  low 16 bits of the index
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::ContainerRemove(Container &c, uint16_t low)
+{
+   if (c.isBitmap)
+   {
+      uint64_t mask = ((uint64_t) 1) << (low & 63);
+      if (c.words[low >> 6] & mask)
+      {
+         c.words[low >> 6] &= ~mask;
+         c.cardinality--;
+         ToArrayIfSparse(c);
+      }
+      return;
+   }
+   std::vector<uint16_t>::iterator it =
+         std::lower_bound(c.values.begin(), c.values.end(), low);
+   if (it != c.values.end() && *it == low)
+   {
+      c.values.erase(it);
+      c.cardinality--;
+   }
+}
+
+//------------------------------------------------------------------------------
+// static void ToBitmap(Container &c)
+//------------------------------------------------------------------------------
+/**
+ * Converts an array container to a bitmap container.
+ *
+ * @param c  the container
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::ToBitmap(Container &c)
+{
+   if (c.isBitmap)
+      return;
+   c.words.assign(BITMAP_WORDS, 0);
+   for (Integer k = 0; k < (Integer) c.values.size(); k++)
+      c.words[c.values[k] >> 6] |= ((uint64_t) 1) << (c.values[k] & 63);
+   c.values.clear();
+   c.values.shrink_to_fit();
+   c.isBitmap = true;
+}
+
+//------------------------------------------------------------------------------
+// static void ToArrayIfSparse(Container &c)
+//------------------------------------------------------------------------------
+/**
+ * Converts a bitmap container to an array container if it holds no more
+ * than ARRAY_MAX_SIZE values.
+ *
+ * @param c  the container
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageBitmap::ToArrayIfSparse(Container &c)
+{
+   if (!c.isBitmap || c.cardinality > ARRAY_MAX_SIZE)
+      return;
+   c.values.clear();
+   c.values.reserve(c.cardinality);
+   for (Integer w = 0; w < BITMAP_WORDS; w++)
+   {
+      uint64_t word = c.words[w];
+      while (word)
+      {
+         c.values.push_back((uint16_t) (w * 64 + __builtin_ctzll(word)));
+         word &= word - 1;
+      }
+   }
+   c.words.clear();
+   c.words.shrink_to_fit();
+   c.isBitmap = false;
+}
+
+//------------------------------------------------------------------------------
+// static Container ContainerUnion(const Container &a, const Container &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the union of two containers.
+ *
+ * @param a  first container
+ * @param b  second container
+ *
+ * @return  the union
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::Container CoverageBitmap::ContainerUnion(const Container &a,
+                                                         const Container &b)
+{
+   Container result;
+   if (!a.isBitmap && !b.isBitmap &&
+       (Integer) (a.values.size() + b.values.size()) <= ARRAY_MAX_SIZE)
+   {
+      result.isBitmap = false;
+      result.values.reserve(a.values.size() + b.values.size());
+      std::set_union(a.values.begin(), a.values.end(),
+                     b.values.begin(), b.values.end(),
+                     std::back_inserter(result.values));
+      result.cardinality = result.values.size();
+      return result;
+   }
+
+   result = a;
+   ToBitmap(result);
+   if (b.isBitmap)
+      for (Integer w = 0; w < BITMAP_WORDS; w++)
+         result.words[w] |= b.words[w];
+   else
+      for (Integer k = 0; k < (Integer) b.values.size(); k++)
+         result.words[b.values[k] >> 6] |= ((uint64_t) 1) << (b.values[k] & 63);
+   result.cardinality = 0;
+   for (Integer w = 0; w < BITMAP_WORDS; w++)
+      result.cardinality += __builtin_popcountll(result.words[w]);
+   ToArrayIfSparse(result);
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// static Container ContainerIntersection(const Container &a,
+//                                        const Container &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the intersection of two containers.
+ *
+ * @param a  first container
+ * @param b  second container
+ *
+ * @return  the intersection
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::Container CoverageBitmap::ContainerIntersection(
+                                          const Container &a,
+                                          const Container &b)
+{
+   Container result;
+   result.isBitmap = false;
+   if (a.isBitmap && b.isBitmap)
+   {
+      result.isBitmap = true;
+      result.words.resize(BITMAP_WORDS);
+      result.cardinality = 0;
+      for (Integer w = 0; w < BITMAP_WORDS; w++)
+      {
+         result.words[w] = a.words[w] & b.words[w];
+         result.cardinality += __builtin_popcountll(result.words[w]);
+      }
+      ToArrayIfSparse(result);
+      return result;
+   }
+   if (a.isBitmap || b.isBitmap)
+   {
+      const Container &bits = a.isBitmap ? a : b;
+      const Container &arr  = a.isBitmap ? b : a;
+      for (Integer k = 0; k < (Integer) arr.values.size(); k++)
+         if (ContainerContains(bits, arr.values[k]))
+            result.values.push_back(arr.values[k]);
+   }
+   else
+      std::set_intersection(a.values.begin(), a.values.end(),
+                            b.values.begin(), b.values.end(),
+                            std::back_inserter(result.values));
+   result.cardinality = result.values.size();
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// static Container ContainerDifference(const Container &a,
+//                                      const Container &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the values of the first container which are not in the second.
+ *
+ * @param a  first container
+ * @param b  second container
+ *
+ * @return  the difference
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap::Container CoverageBitmap::ContainerDifference(
+                                          const Container &a,
+                                          const Container &b)
+{
+   Container result;
+   result.isBitmap = false;
+   if (a.isBitmap)
+   {
+      result = a;
+      if (b.isBitmap)
+         for (Integer w = 0; w < BITMAP_WORDS; w++)
+            result.words[w] &= ~b.words[w];
+      else
+         for (Integer k = 0; k < (Integer) b.values.size(); k++)
+            result.words[b.values[k] >> 6] &= ~(((uint64_t) 1) << (b.values[k] & 63));
+      result.cardinality = 0;
+      for (Integer w = 0; w < BITMAP_WORDS; w++)
+         result.cardinality += __builtin_popcountll(result.words[w]);
+      ToArrayIfSparse(result);
+      return result;
+   }
+   if (b.isBitmap)
+   {
+      for (Integer k = 0; k < (Integer) a.values.size(); k++)
+         if (!ContainerContains(b, a.values[k]))
+            result.values.push_back(a.values[k]);
+   }
+   else
+      std::set_difference(a.values.begin(), a.values.end(),
+                          b.values.begin(), b.values.end(),
+                          std::back_inserter(result.values));
+   result.cardinality = result.values.size();
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// static Integer ContainerIntersectionCardinality(const Container &a,
+//                                                 const Container &b)
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of values in both containers.
+ *
+ * @param a  first container
+ * @param b  second container
+ *
+ * @return  cardinality of the intersection
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageBitmap::ContainerIntersectionCardinality(const Container &a,
+                                                         const Container &b)
+{
+   Integer card = 0;
+   if (a.isBitmap && b.isBitmap)
+   {
+      for (Integer w = 0; w < BITMAP_WORDS; w++)
+         card += __builtin_popcountll(a.words[w] & b.words[w]);
+      return card;
+   }
+   if (a.isBitmap || b.isBitmap)
+   {
+      const Container &bits = a.isBitmap ? a : b;
+      const Container &arr  = a.isBitmap ? b : a;
+      for (Integer k = 0; k < (Integer) arr.values.size(); k++)
+         if (ContainerContains(bits, arr.values[k]))
+            card++;
+      return card;
+   }
+   Integer ii = 0, jj = 0;
+   while (ii < (Integer) a.values.size() && jj < (Integer) b.values.size())
+   {
+      if (a.values[ii] < b.values[jj])
+         ii++;
+      else if (b.values[jj] < a.values[ii])
+         jj++;
+      else
+      {
+         card++;
+         ii++;
+         jj++;
+      }
+   }
+   return card;
+}
+
+//------------------------------------------------------------------------------
+// static bool ContainerEquals(const Container &a, const Container &b)
+//------------------------------------------------------------------------------
+/**
+ * Checks if two containers hold the same values (regardless of their form).
+ *
+ * @param a  first container
+ * @param b  second container
+ *
+ * @return  true if the containers are equal
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageBitmap::ContainerEquals(const Container &a, const Container &b)
+{
+   if (a.cardinality != b.cardinality)
+      return false;
+   return ContainerIntersectionCardinality(a, b) == a.cardinality;
+}
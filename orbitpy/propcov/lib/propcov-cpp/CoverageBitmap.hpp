@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+//                           CoverageBitmap
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageBitmap class, a compressed bitmap of (non-negative)
+ * point indices, used as an alternative to the IntegerArray of covered point indices
+ * returned by the CoverageChecker.
+ *
+ * The representation follows the "roaring bitmap" scheme: the 32-bit index space is
+ * split into chunks of 2^16 indices keyed by the high 16 bits of the index. Each
+ * non-empty chunk is held in a container which is either
+ *   - an array container: the sorted low 16 bits of the indices (at most 4096 of them), or
+ *   - a bitmap container: 2^16 bits (1024 64-bit words), used for denser chunks.
+ * Union, intersection and difference work container-by-container, with word-wise
+ * operations for bitmap containers and merges for array containers. The cardinality is
+ * kept per container, so GetCardinality() is O(number of containers).
+ *
+ * Indices added in increasing order (as produced by the coverage loop) are appended in
+ * O(1) amortized time.
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageBitmap_hpp
+#define CoverageBitmap_hpp
+
+#include <cstdint>
+#include <vector>
+#include "gmatdefs.hpp"
+
+class CoverageBitmap
+{
+public:
+
+   /// class construction/destruction
+   CoverageBitmap();
+   CoverageBitmap(const IntegerArray &indices);
+   CoverageBitmap(const CoverageBitmap &copy);
+   CoverageBitmap& operator=(const CoverageBitmap &copy);
+
+   virtual ~CoverageBitmap();
+
+   /// Add an index (fastest when the indices are added in increasing order)
+   void              Add(Integer idx);
+   /// Add all the indices of an array
+   void              AddIndices(const IntegerArray &indices);
+   /// Remove an index
+   void              Remove(Integer idx);
+   /// Check if an index is in the set
+   bool              Contains(Integer idx) const;
+   /// Get the number of indices in the set
+   Integer           GetCardinality() const;
+   /// Check if the set is empty
+   bool              IsEmpty() const;
+   /// Remove all the indices
+   void              Clear();
+   /// Get the indices in increasing order
+   IntegerArray      ToIndices() const;
+
+   /// Set operations returning a new bitmap
+   CoverageBitmap    Union(const CoverageBitmap &other) const;
+   CoverageBitmap    Intersection(const CoverageBitmap &other) const;
+   CoverageBitmap    Difference(const CoverageBitmap &other) const;
+   /// In-place union (e.g. for cumulative coverage)
+   void              UnionWith(const CoverageBitmap &other);
+   /// Cardinality of the intersection/union, without building the result
+   Integer           IntersectionCardinality(const CoverageBitmap &other) const;
+   Integer           UnionCardinality(const CoverageBitmap &other) const;
+
+   bool              operator==(const CoverageBitmap &other) const;
+   bool              operator!=(const CoverageBitmap &other) const;
+
+   /// Get the number of containers and the number of bitmap containers
+   Integer           GetNumContainers() const;
+   Integer           GetNumBitmapContainers() const;
+
+protected:
+
+   /// A chunk of 2^16 indices
+   struct Container
+   {
+      /// true for a bitmap container, false for an array container
+      bool                  isBitmap;
+      /// number of indices in the container
+      Integer               cardinality;
+      /// sorted low 16 bits of the indices (array container)
+      std::vector<uint16_t> values;
+      /// 1024 words of bits (bitmap container)
+      std::vector<uint64_t> words;
+   };
+
+   /// high 16 bits of the indices of each container, sorted
+   std::vector<uint16_t>    keys;
+   /// the containers, parallel to `keys`
+   std::vector<Container>   containers;
+
+   /// maximum number of values of an array container
+   static const Integer     ARRAY_MAX_SIZE;
+   /// number of 64-bit words of a bitmap container
+   static const Integer     BITMAP_WORDS;
+
+   /// Find the position of a key (or -1)
+   Integer           FindKey(uint16_t key) const;
+   /// Get (creating if needed) the container of a key
+   Container&        GetOrCreateContainer(uint16_t key);
+
+   /// Container helpers
+   static bool       ContainerContains(const Container &c, uint16_t low);
+   static void       ContainerAdd(Container &c, uint16_t low);
+   static void       ContainerRemove(Container &c, uint16_t low);
+   static void       ToBitmap(Container &c);
+   static void       ToArrayIfSparse(Container &c);
+   static Container  ContainerUnion(const Container &a, const Container &b);
+   static Container  ContainerIntersection(const Container &a,
+                                           const Container &b);
+   static Container  ContainerDifference(const Container &a,
+                                         const Container &b);
+   static Integer    ContainerIntersectionCardinality(const Container &a,
+                                                      const Container &b);
+   static bool       ContainerEquals(const Container &a, const Container &b);
+};
+#endif // CoverageBitmap_hpp
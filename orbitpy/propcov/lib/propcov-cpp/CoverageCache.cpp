@@ -0,0 +1,894 @@
+//------------------------------------------------------------------------------
+//                           CoverageCache
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageCache class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <typeinfo>
+#include <unistd.h>
+#include "gmatdefs.hpp"
+#include "CoverageCache.hpp"
+#include "CoverageRunner.hpp"
+#include "CoverageSink.hpp"
+#include "CoverageKernels.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "GMATCustomSensor.hpp"
+#include "OrbitState.hpp"
+#include "BinaryStream.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_COVERAGE_CACHE
+
+namespace fs = std::filesystem;
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const std::string CoverageCache::ENTRY_EXTENSION = ".pcc";
+
+/// format version of the entries and of the canonical text
+static const Integer ENTRY_VERSION = 1;
+
+//------------------------------------------------------------------------------
+// static functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// static uint64_t HashBytes(const char *data, size_t size, uint64_t hash)
+//------------------------------------------------------------------------------
+/**
+ * FNV-1a hash of a byte range, continuing from the input hash.
+ */
+//------------------------------------------------------------------------------
+static uint64_t HashBytes(const char *data, size_t size,
+                          uint64_t hash = 14695981039346656037ULL)
+{
+   for (size_t ii = 0; ii < size; ii++)
+   {
+      hash ^= (unsigned char) data[ii];
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+//------------------------------------------------------------------------------
+// static void AppendReal(std::string &text, Real value)
+//------------------------------------------------------------------------------
+/**
+ * Appends a real with 12 significant digits (and a separator).
+ */
+//------------------------------------------------------------------------------
+static void AppendReal(std::string &text, Real value)
+{
+   char buf[32];
+   int  n = std::snprintf(buf, sizeof(buf), "%.11e ", value);
+   // -0 and the values rounding to 0 are written as 0
+   if (std::strtod(buf, NULL) == 0.0)
+      text += "0 ";
+   else
+      text.append(buf, n);
+}
+
+//------------------------------------------------------------------------------
+// static void AppendVector(std::string &text, const Real *values, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Appends the components of a vector (or matrix), the components smaller than
+ * 1e-12 of the largest one being written as 0.
+ */
+//------------------------------------------------------------------------------
+static void AppendVector(std::string &text, const Real *values, Integer n)
+{
+   Real largest = 0.0;
+   for (Integer ii = 0; ii < n; ii++)
+      largest = std::max(largest, std::fabs(values[ii]));
+   for (Integer ii = 0; ii < n; ii++)
+      AppendReal(text, std::fabs(values[ii]) < 1e-12 * largest ?
+                       0.0 : values[ii]);
+}
+
+//------------------------------------------------------------------------------
+// static void AppendTime(std::string &text, Real jd)
+//------------------------------------------------------------------------------
+/**
+ * Appends a time (JDUT1) as its day and its milliseconds in the day.
+ */
+//------------------------------------------------------------------------------
+static void AppendTime(std::string &text, Real jd)
+{
+   Real      day = std::floor(jd);
+   long long ms  = std::llround((jd - day) *
+                                GmatTimeConstants::SECS_PER_DAY * 1000.0);
+   text += std::to_string((long long) day) + "+" + std::to_string(ms) + "ms ";
+}
+
+//------------------------------------------------------------------------------
+// static std::string GridHash(PointGroup *ptGroup)
+//------------------------------------------------------------------------------
+/**
+ * Returns the content hash (hex) of the latitudes and longitudes of the points,
+ * rounded to 1e-12 rad.
+ */
+//------------------------------------------------------------------------------
+static std::string GridHash(PointGroup *ptGroup)
+{
+   RealArray lats, lons;
+   ptGroup->GetLatLonVectors(lats, lons);
+   uint64_t hash = HashBytes(NULL, 0);
+   for (size_t ii = 0; ii < lats.size(); ii++)
+   {
+      long long q[2] = {std::llround(lats[ii] * 1e12),
+                        std::llround(lons[ii] * 1e12)};
+      hash = HashBytes((const char*) q, sizeof(q), hash);
+   }
+   char buf[20];
+   std::snprintf(buf, sizeof(buf), "%016llx", (unsigned long long) hash);
+   return buf;
+}
+
+//------------------------------------------------------------------------------
+// static bool AppendSensor(std::string &text, Sensor *sensor)
+//------------------------------------------------------------------------------
+/**
+ * Appends the type, geometry and body-to-sensor matrix of a sensor; false if
+ * the type of the sensor is not known.
+ */
+//------------------------------------------------------------------------------
+static bool AppendSensor(std::string &text, Sensor *sensor)
+{
+   switch (GetFovSensorKind(sensor))
+   {
+      case CONICAL_SENSOR:
+         text += "conical ";
+         AppendReal(text, ((ConicalSensor*) sensor)->GetFieldOfView());
+         break;
+      case RECTANGULAR_SENSOR:
+         text += "rectangular ";
+         AppendReal(text, ((RectangularSensor*) sensor)->GetAngleHeight());
+         AppendReal(text, ((RectangularSensor*) sensor)->GetAngleWidth());
+         break;
+      case GMAT_CUSTOM_SENSOR:
+      {
+         text += "custom ";
+         Rvector cones  = ((GMATCustomSensor*) sensor)->GetConeAngleVector();
+         Rvector clocks = ((GMATCustomSensor*) sensor)->GetClockAngleVector();
+         text += std::to_string(cones.GetSize()) + " ";
+         for (Integer ii = 0; ii < cones.GetSize(); ii++)
+         {
+            AppendReal(text, cones[ii]);
+            AppendReal(text, clocks[ii]);
+         }
+         break;
+      }
+      case DSPIP_CUSTOM_SENSOR:
+      {
+         BinaryWriter out;
+         sensor->Serialize(out);
+         const std::string &data = out.GetBuffer();
+         char buf[20];
+         std::snprintf(buf, sizeof(buf), "%016llx", (unsigned long long)
+                       HashBytes(data.data(), data.size()));
+         text += "dspip ";
+         text += buf;
+         text += " ";
+         break;
+      }
+      default:
+         return false;
+   }
+   Rmatrix33 bodyToSensor = sensor->GetBodyToSensorMatrix(0.0);
+   AppendVector(text, bodyToSensor.GetDataVector(), 9);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// static void WriteResults(BinaryWriter &out, const CoverageResults &results)
+//------------------------------------------------------------------------------
+/**
+ * Writes the results of a run (after the canonical text of an entry).
+ */
+//------------------------------------------------------------------------------
+static void WriteResults(BinaryWriter &out, const CoverageResults &results)
+{
+   out.WriteInt(results.numPoints);
+   out.WriteInt(results.numSteps);
+   out.WriteReal(results.startJd);
+   out.WriteReal(results.stepSize);
+   out.WriteInt((Integer) results.intervals.size());
+   for (const AccessInterval &acc : results.intervals)
+   {
+      out.WriteInt(acc.satIndex);
+      out.WriteInt(acc.pointIndex);
+      out.WriteInt(acc.optionIndex);
+      out.WriteReal(acc.startTime);
+      out.WriteReal(acc.stopTime);
+   }
+   out.WriteIntArray(results.numAccesses);
+   out.WriteRealArray(results.dwellTimes);
+   out.WriteRealArray(results.maxGaps);
+}
+
+//------------------------------------------------------------------------------
+// static void ReadResults(BinaryReader &in, CoverageResults &results)
+//------------------------------------------------------------------------------
+/**
+ * Reads the results of a run written by WriteResults.
+ */
+//------------------------------------------------------------------------------
+static void ReadResults(BinaryReader &in, CoverageResults &results)
+{
+   results.numPoints = in.ReadInt();
+   results.numSteps  = in.ReadInt();
+   results.startJd   = in.ReadReal();
+   results.stepSize  = in.ReadReal();
+   Integer numIntervals = in.ReadInt();
+   if (numIntervals < 0)
+      throw TATCException("CoverageCache: invalid entry\n");
+   results.intervals.resize(numIntervals);
+   for (AccessInterval &acc : results.intervals)
+   {
+      acc.satIndex    = in.ReadInt();
+      acc.pointIndex  = in.ReadInt();
+      acc.optionIndex = in.ReadInt();
+      acc.startTime   = in.ReadReal();
+      acc.stopTime    = in.ReadReal();
+   }
+   results.numAccesses = in.ReadIntArray();
+   results.dwellTimes  = in.ReadRealArray();
+   results.maxGaps     = in.ReadRealArray();
+   if (!in.AtEnd())
+      throw TATCException("CoverageCache: invalid entry\n");
+}
+
+//------------------------------------------------------------------------------
+// ResultsSink
+//------------------------------------------------------------------------------
+/**
+ * Sink of a run building its access intervals and per-point statistics.
+ */
+//------------------------------------------------------------------------------
+class ResultsSink : public CoverageSink
+{
+public:
+   ResultsSink(CoverageResults &results) :
+      results(results), builder(NULL) {}
+   ~ResultsSink() { delete builder; }
+
+   void BeginRun(Integer numPoints, Real startJd, Real stepSize,
+                 Integer numSteps)
+   {
+      results.numPoints = numPoints;
+      results.numSteps  = numSteps;
+      results.startJd   = startJd;
+      results.stepSize  = stepSize;
+      results.intervals.clear();
+      results.numAccesses.assign(numPoints, 0);
+      results.dwellTimes.assign(numPoints, 0.0);
+      results.maxGaps.assign(numPoints, 0.0);
+      lastSeen.assign(numPoints, -1);
+      delete builder;
+      builder = new AccessIntervalBuilder(numPoints);
+   }
+   void ProcessStep(Integer stepIndex, Real jd,
+                    const IntegerArray &coveredPoints)
+   {
+      builder->AddCoverage(jd, coveredPoints);
+      for (Integer pt : coveredPoints)
+      {
+         results.dwellTimes[pt] += results.stepSize;
+         if (lastSeen[pt] < 0 || lastSeen[pt] != stepIndex - 1)
+         {
+            results.numAccesses[pt]++;
+            if (lastSeen[pt] >= 0)
+               results.maxGaps[pt] = std::max(results.maxGaps[pt],
+                     (stepIndex - lastSeen[pt] - 1) * results.stepSize);
+         }
+         lastSeen[pt] = stepIndex;
+      }
+   }
+   void EndRun()
+   {
+      builder->Finalize();
+      results.intervals = builder->GetIntervals();
+   }
+
+private:
+   CoverageResults        &results;
+   AccessIntervalBuilder  *builder;
+   /// last step at which each point was covered (-1 if never)
+   IntegerArray           lastSeen;
+};
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageCache(const std::string &directory, long long maxBytes)
+//------------------------------------------------------------------------------
+/**
+ * Constructor; creates the cache directory if needed.
+ *
+ * @param directory  the cache directory
+ * @param maxBytes   size limit of the entries (bytes)
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageCache::CoverageCache(const std::string &directory,
+                             long long maxBytes) :
+   directory        (directory),
+   maxBytes         (maxBytes),
+   singlePrecision  (false),
+   numHits          (0),
+   numMisses        (0),
+   numEvictions     (0)
+{
+   std::error_code ec;
+   fs::create_directories(directory, ec);
+   if (!fs::is_directory(directory))
+      throw TATCException("CoverageCache: cannot create the directory " +
+                          directory + "\n");
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageCache()
+//------------------------------------------------------------------------------
+/**
+ * Destructor (the entries are kept).
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageCache::~CoverageCache()
+{
+}
+
+//------------------------------------------------------------------------------
+// static std::string GetKey(PointGroup *ptGroup, Spacecraft *sat,
+//                           Real startJd, Real duration, Real stepSize)
+//------------------------------------------------------------------------------
+/**
+ * Returns the key of a run.
+ *
+ * @param ptGroup   the points
+ * @param sat       the spacecraft
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration (days)
+ * @param stepSize  step size (s)
+ *
+ * @return  the key (32 hex digits), empty if the run cannot be cached
+ *
+ */
+//------------------------------------------------------------------------------
+std::string CoverageCache::GetKey(PointGroup *ptGroup, Spacecraft *sat,
+                                  Real startJd, Real duration, Real stepSize)
+{
+   std::string canonical = GetCanonicalInputs(ptGroup, sat, startJd, duration,
+                                              stepSize);
+   if (canonical.empty())
+      return canonical;
+   return HashCanonicalInputs(canonical);
+}
+
+//------------------------------------------------------------------------------
+// bool Lookup(PointGroup *ptGroup, Spacecraft *sat, Real startJd,
+//             Real duration, Real stepSize, CoverageResults &results)
+//------------------------------------------------------------------------------
+/**
+ * Gets the results of a run from the cache (and marks the entry as the most
+ * recently used).
+ *
+ * @param ptGroup   the points
+ * @param sat       the spacecraft
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration (days)
+ * @param stepSize  step size (s)
+ * @param results   the results (output, on a hit)
+ *
+ * @return  true on a hit
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageCache::Lookup(PointGroup *ptGroup, Spacecraft *sat, Real startJd,
+                           Real duration, Real stepSize,
+                           CoverageResults &results)
+{
+   std::string canonical = GetCanonicalInputs(ptGroup, sat, startJd, duration,
+                                              stepSize);
+   bool hit = false;
+   if (!canonical.empty())
+   {
+      std::string   path = GetEntryPath(HashCanonicalInputs(canonical));
+      std::ifstream file(path, std::ios::binary);
+      if (file)
+      {
+         std::stringstream data;
+         data << file.rdbuf();
+         std::string bytes = data.str();
+         try
+         {
+            BinaryReader in(bytes);
+            in.ReadHeader("CoverageCacheEntry", ENTRY_VERSION);
+            if (in.ReadString() == canonical)
+            {
+               ReadResults(in, results);
+               hit = true;
+            }
+         }
+         catch (TATCException &)
+         {
+            // a damaged (or concurrently replaced) entry is a miss
+         }
+         if (hit)
+         {
+            std::error_code ec;
+            fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+         }
+      }
+   }
+
+   #ifdef DEBUG_COVERAGE_CACHE
+      MessageInterface::ShowMessage("CoverageCache: %s\n",
+                                    hit ? "hit" : "miss");
+   #endif
+   std::lock_guard<std::mutex> lock(mtx);
+   if (hit)
+      numHits++;
+   else
+      numMisses++;
+   return hit;
+}
+
+//------------------------------------------------------------------------------
+// void Store(PointGroup *ptGroup, Spacecraft *sat, Real startJd,
+//            Real duration, Real stepSize, const CoverageResults &results)
+//------------------------------------------------------------------------------
+/**
+ * Stores the results of a run (nothing is stored if the run cannot be cached),
+ * then deletes the least recently used entries beyond the size limit.
+ *
+ * @param ptGroup   the points
+ * @param sat       the spacecraft
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration (days)
+ * @param stepSize  step size (s)
+ * @param results   the results of the run
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageCache::Store(PointGroup *ptGroup, Spacecraft *sat, Real startJd,
+                          Real duration, Real stepSize,
+                          const CoverageResults &results)
+{
+   std::string canonical = GetCanonicalInputs(ptGroup, sat, startJd, duration,
+                                              stepSize);
+   if (canonical.empty())
+      return;
+   BinaryWriter out;
+   out.WriteHeader("CoverageCacheEntry", ENTRY_VERSION);
+   out.WriteString(canonical);
+   WriteResults(out, results);
+
+   std::string path = GetEntryPath(HashCanonicalInputs(canonical));
+   std::ostringstream tmpPath;
+   tmpPath << path << ".tmp" << getpid() << "_"
+           << std::hash<std::thread::id>()(std::this_thread::get_id());
+   {
+      std::ofstream file(tmpPath.str(), std::ios::binary | std::ios::trunc);
+      const std::string &bytes = out.GetBuffer();
+      file.write(bytes.data(), bytes.size());
+      if (!file)
+         throw TATCException("CoverageCache: cannot write " + tmpPath.str() +
+                             "\n");
+   }
+   if (std::rename(tmpPath.str().c_str(), path.c_str()) != 0)
+   {
+      std::remove(tmpPath.str().c_str());
+      throw TATCException("CoverageCache: cannot write " + path + "\n");
+   }
+   Evict(path);
+}
+
+//------------------------------------------------------------------------------
+// CoverageResults Run(PointGroup *ptGroup, Spacecraft *sat, Real startJd,
+//                     Real duration, Real stepSize)
+//------------------------------------------------------------------------------
+/**
+ * Returns the results of a run from the cache, or computes and stores them.
+ *
+ * @param ptGroup   the points
+ * @param sat       the spacecraft
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration (days)
+ * @param stepSize  step size (s)
+ *
+ * @return  the results
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageResults CoverageCache::Run(PointGroup *ptGroup, Spacecraft *sat,
+                                   Real startJd, Real duration, Real stepSize)
+{
+   CoverageResults results;
+   if (Lookup(ptGroup, sat, startJd, duration, stepSize, results))
+      return results;
+   results = Compute(ptGroup, sat, startJd, duration, stepSize,
+                     singlePrecision);
+   Store(ptGroup, sat, startJd, duration, stepSize, results);
+   return results;
+}
+
+//------------------------------------------------------------------------------
+// static CoverageResults Compute(PointGroup *ptGroup, Spacecraft *sat,
+//                                Real startJd, Real duration, Real stepSize,
+//                                bool singlePrecision)
+//------------------------------------------------------------------------------
+/**
+ * Computes the results of a run with a CoverageRunner (the steps are run in
+ * order, on the calling thread).
+ *
+ * @param ptGroup          the points
+ * @param sat              the spacecraft
+ * @param startJd          start time (JDUT1)
+ * @param duration         duration (days)
+ * @param stepSize         step size (s)
+ * @param singlePrecision  use the single precision feasibility test?
+ *
+ * @return  the results
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageResults CoverageCache::Compute(PointGroup *ptGroup, Spacecraft *sat,
+                                       Real startJd, Real duration,
+                                       Real stepSize, bool singlePrecision)
+{
+   CoverageResults results;
+   ResultsSink     sink(results);
+   CoverageRunner  runner(ptGroup, sat);
+   runner.SetNumThreads(1);
+   runner.SetSinglePrecision(singlePrecision);
+   runner.Run(sink, startJd, duration, stepSize);
+   return results;
+}
+
+//------------------------------------------------------------------------------
+// void SetSinglePrecision(bool single)
+//------------------------------------------------------------------------------
+/**
+ * Sets the single precision feasibility mode of the runs of Run (the results
+ * are the same, so the key does not depend on it).
+ *
+ * @param single  use the single precision feasibility test?
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageCache::SetSinglePrecision(bool single)
+{
+   singlePrecision = single;
+}
+
+//------------------------------------------------------------------------------
+// bool GetSinglePrecision() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the single precision feasibility mode of the runs of Run.
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageCache::GetSinglePrecision() const
+{
+   return singlePrecision;
+}
+
+//------------------------------------------------------------------------------
+// void SetMaxBytes(long long bytes)
+//------------------------------------------------------------------------------
+/**
+ * Sets the size limit of the entries (applied at the next Store).
+ *
+ * @param bytes  the limit (bytes)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageCache::SetMaxBytes(long long bytes)
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   maxBytes = bytes;
+}
+
+//------------------------------------------------------------------------------
+// long long GetMaxBytes() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the size limit of the entries (bytes).
+ *
+ */
+//------------------------------------------------------------------------------
+long long CoverageCache::GetMaxBytes() const
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   return maxBytes;
+}
+
+//------------------------------------------------------------------------------
+// const std::string& GetDirectory() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the cache directory.
+ *
+ */
+//------------------------------------------------------------------------------
+const std::string& CoverageCache::GetDirectory() const
+{
+   return directory;
+}
+
+//------------------------------------------------------------------------------
+// long long GetNumHits() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of lookups which found their entry.
+ *
+ */
+//------------------------------------------------------------------------------
+long long CoverageCache::GetNumHits() const
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   return numHits;
+}
+
+//------------------------------------------------------------------------------
+// long long GetNumMisses() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of lookups which did not find their entry.
+ *
+ */
+//------------------------------------------------------------------------------
+long long CoverageCache::GetNumMisses() const
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   return numMisses;
+}
+
+//------------------------------------------------------------------------------
+// long long GetNumEvictions() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of entries deleted for the size limit.
+ *
+ */
+//------------------------------------------------------------------------------
+long long CoverageCache::GetNumEvictions() const
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   return numEvictions;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumEntries() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of entries in the cache directory.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageCache::GetNumEntries() const
+{
+   Integer         count = 0;
+   std::error_code ec;
+   for (const fs::directory_entry &entry :
+        fs::directory_iterator(directory, ec))
+      if (entry.path().extension() == ENTRY_EXTENSION)
+         count++;
+   return count;
+}
+
+//------------------------------------------------------------------------------
+// long long GetTotalBytes() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the total size of the entries in the cache directory.
+ *
+ * @return  the size (bytes)
+ *
+ */
+//------------------------------------------------------------------------------
+long long CoverageCache::GetTotalBytes() const
+{
+   long long       total = 0;
+   std::error_code ec;
+   for (const fs::directory_entry &entry :
+        fs::directory_iterator(directory, ec))
+      if (entry.path().extension() == ENTRY_EXTENSION)
+         total += (long long) entry.file_size(ec);
+   return total;
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Deletes all the entries of the cache directory.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageCache::Clear()
+{
+   std::vector<fs::path> paths;
+   std::error_code       ec;
+   for (const fs::directory_entry &entry :
+        fs::directory_iterator(directory, ec))
+      if (entry.path().extension() == ENTRY_EXTENSION)
+         paths.push_back(entry.path());
+   for (const fs::path &path : paths)
+      fs::remove(path, ec);
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// static std::string GetCanonicalInputs(PointGroup *ptGroup, Spacecraft *sat,
+//                                       Real startJd, Real duration,
+//                                       Real stepSize)
+//------------------------------------------------------------------------------
+/**
+ * Returns the canonical text of the inputs of a run.
+ *
+ * @param ptGroup   the points
+ * @param sat       the spacecraft
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration (days)
+ * @param stepSize  step size (s)
+ *
+ * @return  the text, empty if a sensor type is not known
+ *
+ */
+//------------------------------------------------------------------------------
+std::string CoverageCache::GetCanonicalInputs(PointGroup *ptGroup,
+                                              Spacecraft *sat, Real startJd,
+                                              Real duration, Real stepSize)
+{
+   if (!ptGroup || !sat)
+      throw TATCException("CoverageCache: NULL point group or spacecraft\n");
+   std::string text = "propcov coverage " + std::to_string(ENTRY_VERSION) +
+                      "\nrun ";
+   AppendTime(text, startJd);
+   AppendReal(text, duration);
+   AppendReal(text, stepSize);
+
+   text += "\ngrid " + std::to_string(ptGroup->GetNumPoints()) + " " +
+           GridHash(ptGroup);
+
+   text += "\norbit ";
+   AppendTime(text, sat->GetJulianDate());
+   Rvector6 cart = sat->GetOrbitState()->GetCartesianState();
+   AppendVector(text, cart.GetDataVector(), 3);
+   AppendVector(text, cart.GetDataVector() + 3, 3);
+
+   text += "\nattitude ";
+   text += sat->GetAttitude() ? typeid(*sat->GetAttitude()).name() : "none";
+   text += " ";
+   Rmatrix33 nadirToBody = sat->GetNadirToBodyMatrix();
+   AppendVector(text, nadirToBody.GetDataVector(), 9);
+
+   for (Integer ii = 0; ii < sat->GetNumSensors(); ii++)
+   {
+      text += "\nsensor ";
+      if (!AppendSensor(text, sat->GetSensor(ii)))
+         return "";
+   }
+   return text;
+}
+
+//------------------------------------------------------------------------------
+// static std::string HashCanonicalInputs(const std::string &canonical)
+//------------------------------------------------------------------------------
+/**
+ * Returns the key of a canonical text: two 64-bit FNV-1a hashes (with
+ * different offset bases), in hex.
+ *
+ * @param canonical  the canonical text
+ *
+ * @return  the key (32 hex digits)
+ *
+ */
+//------------------------------------------------------------------------------
+std::string CoverageCache::HashCanonicalInputs(const std::string &canonical)
+{
+   uint64_t hash1 = HashBytes(canonical.data(), canonical.size());
+   uint64_t hash2 = HashBytes(canonical.data(), canonical.size(),
+                              HashBytes("CoverageCache", 13));
+   char buf[40];
+   std::snprintf(buf, sizeof(buf), "%016llx%016llx",
+                 (unsigned long long) hash1, (unsigned long long) hash2);
+   return buf;
+}
+
+//------------------------------------------------------------------------------
+// std::string GetEntryPath(const std::string &key) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the path of the entry of a key.
+ *
+ */
+//------------------------------------------------------------------------------
+std::string CoverageCache::GetEntryPath(const std::string &key) const
+{
+   return (fs::path(directory) / (key + ENTRY_EXTENSION)).string();
+}
+
+//------------------------------------------------------------------------------
+// void Evict(const std::string &keepPath)
+//------------------------------------------------------------------------------
+/**
+ * Deletes the least recently used entries (oldest modification time) until
+ * the entries fit in the size limit. The input entry (just stored) is kept.
+ *
+ * @param keepPath  path of the entry to keep
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageCache::Evict(const std::string &keepPath)
+{
+   struct Entry
+   {
+      fs::file_time_type   time;
+      long long            size;
+      fs::path             path;
+   };
+   std::vector<Entry> entries;
+   long long          total = 0;
+   std::error_code    ec;
+   for (const fs::directory_entry &entry :
+        fs::directory_iterator(directory, ec))
+   {
+      if (entry.path().extension() != ENTRY_EXTENSION)
+         continue;
+      Entry e = {entry.last_write_time(ec), (long long) entry.file_size(ec),
+                 entry.path()};
+      if (ec)
+         continue;   // deleted by another process
+      total += e.size;
+      if (e.path != fs::path(keepPath))
+         entries.push_back(e);
+   }
+   long long limit = GetMaxBytes();
+   if (total <= limit)
+      return;
+
+   std::sort(entries.begin(), entries.end(),
+             [](const Entry &a, const Entry &b) { return a.time < b.time; });
+   Integer evicted = 0;
+   for (const Entry &e : entries)
+   {
+      if (total <= limit)
+         break;
+      if (fs::remove(e.path, ec))
+         evicted++;
+      total -= e.size;
+   }
+
+   #ifdef DEBUG_COVERAGE_CACHE
+      MessageInterface::ShowMessage("CoverageCache: %d entries evicted\n",
+                                    evicted);
+   #endif
+   std::lock_guard<std::mutex> lock(mtx);
+   numEvictions += evicted;
+}
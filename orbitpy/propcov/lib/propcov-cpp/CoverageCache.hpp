@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//                           CoverageCache
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageCache class, an optional on-disk cache of the
+ * results (access intervals and per-point statistics) of coverage runs, keyed
+ * by the content of their inputs.
+ *
+ * The key of a run is a hash of a canonical text of all its inputs: the start
+ * time, duration and step size of the run, the orbit epoch and Cartesian state,
+ * the attitude (type and nadir-to-body matrix) and the sensors (type, geometry
+ * and body-to-sensor matrix) of the spacecraft, and the content hash of the
+ * grid (its latitudes and longitudes). Equivalent inputs produced by different
+ * computations or text formats get the same key: the reals are written with 12
+ * significant digits, the components of a vector or matrix smaller than 1e-12
+ * of its largest one are written as zero, the times are rounded to the
+ * millisecond and the grid angles to 1e-12 rad. The DSPIP custom sensors are
+ * keyed by their serialized data (exactly); runs with sensors of other types
+ * are not cached.
+ *
+ * Each entry is a file <key>.pcc of the cache directory holding the canonical
+ * text (checked on lookup, so a hash collision is a miss) and the results. A
+ * hit updates the modification time of the entry; when the entries exceed the
+ * size limit, the least recently used ones are deleted. Entries are written to
+ * a temporary file and renamed, so processes can share a directory.
+ *
+ * The entry file layout is that of BinaryWriter:
+ *    header "CoverageCacheEntry", version 1
+ *    string   canonical text of the inputs
+ *    int32    number of points, int32 number of steps
+ *    float64  start time (JDUT1), float64 step size (s)
+ *    int32    number of intervals, then per interval int32 satIndex,
+ *             int32 pointIndex, int32 optionIndex, float64 startTime,
+ *             float64 stopTime
+ *    int32 array  number of accesses per point
+ *    float64 arrays  dwell time (s) and maximum gap (s) per point
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageCache_hpp
+#define CoverageCache_hpp
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "AccessInterval.hpp"
+#include "PointGroup.hpp"
+#include "Spacecraft.hpp"
+
+/// Results of a coverage run (as defined for the CoverageRaster cells, per
+/// point)
+struct CoverageResults
+{
+   /// number of points and of steps of the run
+   Integer                     numPoints;
+   Integer                     numSteps;
+   /// start time (JDUT1) and step size (s) of the run
+   Real                        startJd;
+   Real                        stepSize;
+   /// access intervals, in order of their end
+   std::vector<AccessInterval> intervals;
+   /// number of accesses (maximal runs of covered steps) of each point
+   IntegerArray                numAccesses;
+   /// number of covered steps times the step size (s) of each point
+   RealArray                   dwellTimes;
+   /// maximum number of uncovered steps between two accesses times the step
+   /// size (s) of each point
+   RealArray                   maxGaps;
+};
+
+class CoverageCache
+{
+public:
+
+   /// class construction/destruction
+   CoverageCache(const std::string &directory,
+                 long long maxBytes = 1LL << 30);
+   virtual ~CoverageCache();
+
+   /// Get the key of a run (empty if the run cannot be cached)
+   static std::string   GetKey(PointGroup *ptGroup, Spacecraft *sat,
+                               Real startJd, Real duration, Real stepSize);
+   /// Get the results of a run from the cache; false on a miss
+   bool                 Lookup(PointGroup *ptGroup, Spacecraft *sat,
+                               Real startJd, Real duration, Real stepSize,
+                               CoverageResults &results);
+   /// Store the results of a run (evicting the least recently used entries
+   /// beyond the size limit)
+   void                 Store(PointGroup *ptGroup, Spacecraft *sat,
+                              Real startJd, Real duration, Real stepSize,
+                              const CoverageResults &results);
+   /// Get the results of a run from the cache, or run it with a
+   /// CoverageRunner and store them
+   CoverageResults      Run(PointGroup *ptGroup, Spacecraft *sat,
+                            Real startJd, Real duration, Real stepSize);
+   /// Run the coverage of a run (without the cache)
+   static CoverageResults Compute(PointGroup *ptGroup, Spacecraft *sat,
+                                  Real startJd, Real duration, Real stepSize,
+                                  bool singlePrecision = false);
+
+   /// Set/get the single precision mode of the coverage checks of Run
+   void                 SetSinglePrecision(bool single);
+   bool                 GetSinglePrecision() const;
+   /// Set/get the size limit (bytes) of the entries
+   void                 SetMaxBytes(long long bytes);
+   long long            GetMaxBytes() const;
+   const std::string&   GetDirectory() const;
+   /// Number of hits, misses and evicted entries so far
+   long long            GetNumHits() const;
+   long long            GetNumMisses() const;
+   long long            GetNumEvictions() const;
+   /// Number and total size (bytes) of the entries in the directory
+   Integer              GetNumEntries() const;
+   long long            GetTotalBytes() const;
+   /// Delete all the entries
+   void                 Clear();
+
+   /// extension of the entry files
+   static const std::string ENTRY_EXTENSION;
+
+protected:
+
+   /// cache directory
+   std::string          directory;
+   /// size limit of the entries (bytes)
+   long long            maxBytes;
+   /// single precision mode of the runs
+   bool                 singlePrecision;
+   /// statistics (guarded by mtx)
+   long long            numHits;
+   long long            numMisses;
+   long long            numEvictions;
+   mutable std::mutex   mtx;
+
+   /// Get the canonical text of the inputs of a run (empty if the run cannot
+   /// be cached)
+   static std::string   GetCanonicalInputs(PointGroup *ptGroup,
+                                           Spacecraft *sat, Real startJd,
+                                           Real duration, Real stepSize);
+   /// Get the key (hash) of a canonical text
+   static std::string   HashCanonicalInputs(const std::string &canonical);
+   /// Get the path of the entry of a key
+   std::string          GetEntryPath(const std::string &key) const;
+   /// Delete the least recently used entries beyond the size limit (except
+   /// the input one)
+   void                 Evict(const std::string &keepPath);
+
+private:
+
+   CoverageCache(const CoverageCache &copy);
+   CoverageCache& operator=(const CoverageCache &copy);
+};
+#endif // CoverageCache_hpp
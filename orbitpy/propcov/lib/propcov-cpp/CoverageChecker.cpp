@@ -29,8 +29,10 @@
 #include "RealUtilities.hpp"
 #include "GmatConstants.hpp"
 #include "Rmatrix33.hpp"
+#include "Profiler.hpp"
 #include "TATCException.hpp"
 #include "MessageInterface.hpp"
+#include <cmath>
 #include <iostream>
 
 //#define DEBUG_COV_CHECK
@@ -40,6 +42,9 @@
 //------------------------------------------------------------------------------
 // static data
 //------------------------------------------------------------------------------
+/// The error of the single precision dot products of the (unit) vectors is
+/// below 1e-6 (a few roundings of 2^-24 relative error); the band is wider.
+const float CoverageChecker::SINGLE_PRECISION_GUARD = 1.0e-5f;
 
 //------------------------------------------------------------------------------
 // public methods
@@ -58,7 +63,17 @@
 CoverageChecker::CoverageChecker(PointGroup *ptGroup, Spacecraft *sat) :
    pointGroup        (ptGroup),
    sc                (sat),
-   centralBody       (NULL)
+   centralBody       (NULL),
+   singlePrecision   (false),
+   hasSensor         (false),
+   offsetAttitude    (false),
+   kernelSensor      (NULL),
+   sensorKind        (GENERIC_SENSOR),
+   useFovTable       (false),
+   fovTableConeCells (128),
+   fovTableClockCells(256),
+   fovTable          (NULL),
+   accountedMemory   (0)
 {
    pointArray.clear();
    feasibilityTest.clear();
@@ -81,6 +96,7 @@ CoverageChecker::CoverageChecker(PointGroup *ptGroup, Spacecraft *sat) :
       pointArray.push_back(posUnit);
       feasibilityTest.push_back(false);
    }
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -98,7 +114,22 @@ CoverageChecker::CoverageChecker(PointGroup *ptGroup, Spacecraft *sat) :
 CoverageChecker::CoverageChecker(const CoverageChecker &copy) :
    pointGroup        (copy.pointGroup),
    sc                (copy.sc),
-   centralBody       (copy.centralBody)
+   centralBody       (new Earth()),  // owned (deleted by the destructor)
+   centralBodyRadius (copy.centralBodyRadius),
+   singlePrecision   (copy.singlePrecision),
+   unitX             (copy.unitX),
+   unitY             (copy.unitY),
+   unitZ             (copy.unitZ),
+   pointStatus       (copy.pointStatus),
+   hasSensor         (false),
+   offsetAttitude    (false),
+   kernelSensor      (NULL),
+   sensorKind        (GENERIC_SENSOR),
+   useFovTable       (copy.useFovTable),
+   fovTableConeCells (copy.fovTableConeCells),
+   fovTableClockCells(copy.fovTableClockCells),
+   fovTable          (NULL),  // built for the sensor at the first step
+   accountedMemory   (0)
 {  
    for (Integer ii = 0; ii < pointArray.size(); ii++)
       delete pointArray.at(ii);
@@ -112,6 +143,7 @@ CoverageChecker::CoverageChecker(const CoverageChecker &copy) :
    feasibilityTest.clear();
    for (Integer ff = 0; ff < copy.feasibilityTest.size(); ff++)
       feasibilityTest.push_back(copy.feasibilityTest.at(ff));
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -133,7 +165,20 @@ CoverageChecker& CoverageChecker::operator=(const CoverageChecker &copy)
    
    pointGroup        = copy.pointGroup;
    sc                = copy.sc;
-   centralBody       = copy.centralBody;
+   // centralBody is owned: the object keeps its own
+   centralBodyRadius = copy.centralBodyRadius;
+   singlePrecision   = copy.singlePrecision;
+   unitX             = copy.unitX;
+   unitY             = copy.unitY;
+   unitZ             = copy.unitZ;
+   pointStatus       = copy.pointStatus;
+   useFovTable       = copy.useFovTable;
+   fovTableConeCells = copy.fovTableConeCells;
+   fovTableClockCells= copy.fovTableClockCells;
+   // the table is rebuilt for the sensor at the next step
+   delete fovTable;
+   fovTable          = NULL;
+   kernelSensor      = NULL;
 
    for (Integer ii = 0; ii < pointArray.size(); ii++)
       delete pointArray.at(ii);
@@ -147,6 +192,7 @@ CoverageChecker& CoverageChecker::operator=(const CoverageChecker &copy)
    feasibilityTest.clear();
    for (Integer ff = 0; ff < copy.feasibilityTest.size(); ff++)
       feasibilityTest.push_back(copy.feasibilityTest.at(ff));
+   AccountMemory();
 
    return *this;
 }
@@ -162,10 +208,12 @@ CoverageChecker& CoverageChecker::operator=(const CoverageChecker &copy)
 CoverageChecker::~CoverageChecker()
 {
    delete centralBody;
+   delete fovTable;
    for(int x = 0; x < pointArray.size(); x++)
    {
       delete pointArray[x];
    }
+   Profiler::UpdateMemory(Profiler::CHECKER_MEMORY, accountedMemory, 0);
 }
 
 //------------------------------------------------------------------------------
@@ -180,13 +228,9 @@ CoverageChecker::~CoverageChecker()
 //------------------------------------------------------------------------------
 IntegerArray CoverageChecker::CheckPointCoverage()
 {
-   const Integer numPts = pointGroup->GetNumPoints();
-   IntegerArray PointIndices;
-   for(int i=0; i < numPts; i++) // Coverage calculation done for all points in pointGroup object
-   {
-      PointIndices.push_back(i);
-   }
-   return CoverageChecker::CheckPointCoverage(PointIndices);
+   IntegerArray result;
+   CheckPointCoverageInto(result);
+   return result;
 }
 
 //------------------------------------------------------------------------------
@@ -232,13 +276,9 @@ IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &bodyFixedState,
                                                  Real           theTime, 
                                                  const Rvector6 &scCartState)   
 {
-   const Integer numPts = pointGroup->GetNumPoints();
-   IntegerArray PointIndices;
-   for(int i=0; i < numPts; i++) // Coverage calculation done for all points in PointGroup object
-   {
-      PointIndices.push_back(i);
-   }
-   return CoverageChecker::CheckPointCoverage(bodyFixedState, theTime, scCartState, PointIndices);
+   IntegerArray result;
+   CheckPointCoverageInto(bodyFixedState, theTime, result);
+   return result;
 }
 //------------------------------------------------------------------------------
 //  IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &theState,
@@ -255,6 +295,8 @@ IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &bodyFixedState,
  *
  * @return  Array of point-indices (starting from 0) which are in-view of sensor/spacecraft
  *
+ * @note  throws TATCException if a point index is out of range (the indices
+ *        are validated once here, the loops below do not check them)
  */
 //------------------------------------------------------------------------------
 IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &bodyFixedState,
@@ -262,6 +304,11 @@ IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &bodyFixedState,
                                                  const Rvector6 &scCartState,
                                                  const IntegerArray &PointIndices)   
 {
+   Integer numPoints = (Integer) pointArray.size();
+   for (Integer ptIdx : PointIndices)
+      if (ptIdx < 0 || ptIdx >= numPoints)
+         throw TATCException("CoverageChecker: point index out of range\n");
+
    #ifdef DEBUG_COV_CHECK
       MessageInterface::ShowMessage("In CoverageChecker::CheckPointCoverage\n");
       MessageInterface::ShowMessage("  theState = %s\n",
@@ -289,55 +336,147 @@ IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &bodyFixedState,
       MessageInterface::ShowMessage(" --- Checking Feasibility ...\n");
    #endif
    
-   CheckGridFeasibility(centralBodyFixedPos); // line of sight followed by horizon test for each point, the `feasibilityTest` instance variable is updated 
-   for ( Integer k = 0; k < numPts; k++)
+   // line of sight followed by horizon test for the requested points only, the
+   // `feasibilityTest` instance variable is updated for those points
    {
-      // if (CheckGridFeasibility(pointIdx, centralBodyFixedPos)) // this is slower
-      if (feasibilityTest.at(PointIndices[k])) //  > 0)
-      {
-         #ifdef DEBUG_COV_CHECK
-            MessageInterface::ShowMessage(
-                              " --- feasibility at point %d is TRUE!\n",
-                              PointIndices[k]);
-         #endif
-
-         Integer  sensorNum = 0; // 1; // Currently only works for one sensor, hence hardcoded!!
-
-         bool     inView    = false;         
-
-         if (sc->HasSensors())
-         {
-            // The CheckTargetVisibility function first expresses the satToTargetVec in sensor frame and then 
-            // evaluates its presence/absence in sensor FOV
-            Rvector3 pointLocation = (*pointArray.at(PointIndices[k])) *
-                                   centralBodyRadius;
-            Rvector3 satToTargetVec = pointLocation - centralBodyFixedPos;
-            inView = sc->CheckTargetVisibility(bodyFixedState, satToTargetVec,
-                                               theTime,  sensorNum);                 
-         }
-         else
-         {
-            // No sensor, just report the results of the horizon test (done in the CheckGridFeasibility(.) function)
-            inView = true;
-         }
-         if(inView)
-         {
-            result.push_back(PointIndices[k]);   // covCount'th entry
-            covCount++;
-         }
-
-         #ifdef DEBUG_COV_CHECK
-            MessageInterface::ShowMessage(
-                            " --- In CheckPointCoverage, bodyFixedState = %s\n",
-                            bodyFixedState.ToString(12).c_str());
-         #endif
-
-      }
+      Profiler::Scope timer(Profiler::FEASIBILITY);
+      CheckGridFeasibility(centralBodyFixedPos, PointIndices);
    }
+   SetStepGeometry(bodyFixedState, theTime);
+   Profiler::Scope timer(Profiler::FOV_TEST);
+   auto    append      = [&result](Integer ptIdx) { result.push_back(ptIdx); };
+   Integer numFeasible = CheckFeasiblePoints(&PointIndices, append);
+   covCount            = result.size();
+   Profiler::AddCount(Profiler::POINTS_TESTED, numPts);
+   Profiler::AddCount(Profiler::FEASIBLE_POINTS, numFeasible);
+   Profiler::AddCount(Profiler::VISIBLE_POINTS, covCount);
 
    return result;
 }
 
+//------------------------------------------------------------------------------
+// CoverageBitmap CheckPointCoverageBitmap()
+//------------------------------------------------------------------------------
+/**
+ * Check point coverage for all points in the pointGroup object, at the current
+ * date and spacecraft state.
+ *
+ * @return  compressed bitmap of the indices of the points in view
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap CoverageChecker::CheckPointCoverageBitmap()
+{
+   Real     theDate   = sc->GetJulianDate();
+   Rvector6 scCartState = sc->GetCartesianState();
+   Rvector6 bodyFixedState  = GetCentralBodyFixedState(theDate, scCartState);
+   return CheckPointCoverageBitmap(bodyFixedState, theDate, scCartState);
+}
+
+//------------------------------------------------------------------------------
+//  CoverageBitmap CheckPointCoverageBitmap(const Rvector6 &bodyFixedState,
+//                                          Real           theTime,
+//                                          const Rvector6 &scCartState)
+//------------------------------------------------------------------------------
+/**
+ * Coverage calculation done for all points in PointGroup object. Same as
+ * CheckPointCoverage(bodyFixedState, theTime, scCartState) but the result is
+ * built directly as a compressed bitmap (no intermediate index array).
+ *
+ * @param   bodyFixedState    central body fixed state of spacecraft (Cartesian (x[km], y[km], z[km], vx[km/s], vy[km/s], vz[km/s]))
+ * @param   theTime     time corresponding to the state of spacecraft (JDUT1)
+ * @param   scCartState   inertial state of spacecraft (Cartesian (x[km], y[km], z[km], vx[km/s], vy[km/s], vz[km/s])) (UNUSED)
+ *
+ * @return  compressed bitmap of the indices of the points in view
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageBitmap CoverageChecker::CheckPointCoverageBitmap(
+                                          const Rvector6 &bodyFixedState,
+                                          Real           theTime,
+                                          const Rvector6 &scCartState)
+{
+   CoverageBitmap result;
+   Rvector3       centralBodyFixedPos(bodyFixedState[0],
+                                      bodyFixedState[1],
+                                      bodyFixedState[2]);
+   const Integer  numPts = pointGroup->GetNumPoints();
+
+   {
+      Profiler::Scope timer(Profiler::FEASIBILITY);
+      CheckGridFeasibility(centralBodyFixedPos);
+   }
+   SetStepGeometry(bodyFixedState, theTime);
+   Profiler::Scope timer(Profiler::FOV_TEST);
+   // indices are increasing, so they are appended to the bitmap
+   auto    add         = [&result](Integer ptIdx) { result.Add(ptIdx); };
+   Integer numFeasible = CheckFeasiblePoints(NULL, add);
+   Profiler::AddCount(Profiler::POINTS_TESTED, numPts);
+   Profiler::AddCount(Profiler::FEASIBLE_POINTS, numFeasible);
+   Profiler::AddCount(Profiler::VISIBLE_POINTS, result.GetCardinality());
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// void CheckPointCoverageInto(IntegerArray &result)
+//------------------------------------------------------------------------------
+/**
+ * Check point coverage for all points in the pointGroup object, at the current
+ * date and spacecraft state. Same as CheckPointCoverage() but the indices are
+ * written into the input array, whose capacity is reused: a caller checking
+ * the coverage at successive steps with the same array makes no heap
+ * allocation in the point loops once the array has grown to the largest
+ * result.
+ *
+ * @param result  indices of the points in view (output, cleared first)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::CheckPointCoverageInto(IntegerArray &result)
+{
+   Real     theDate        = sc->GetJulianDate();
+   Rvector6 scCartState    = sc->GetCartesianState();
+   Rvector6 bodyFixedState = GetCentralBodyFixedState(theDate, scCartState);
+   CheckPointCoverageInto(bodyFixedState, theDate, result);
+}
+
+//------------------------------------------------------------------------------
+// void CheckPointCoverageInto(const Rvector6 &bodyFixedState, Real theTime,
+//                             IntegerArray &result)
+//------------------------------------------------------------------------------
+/**
+ * Coverage calculation done for all points in PointGroup object, written into
+ * the input array (see CheckPointCoverageInto(IntegerArray&)).
+ *
+ * @param   bodyFixedState    central body fixed state of spacecraft (Cartesian (x[km], y[km], z[km], vx[km/s], vy[km/s], vz[km/s]))
+ * @param   theTime           time corresponding to the state of spacecraft (JDUT1)
+ * @param   result            indices of the points in view (output, cleared first)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::CheckPointCoverageInto(const Rvector6 &bodyFixedState,
+                                             Real           theTime,
+                                             IntegerArray   &result)
+{
+   Rvector3       centralBodyFixedPos(bodyFixedState[0],
+                                      bodyFixedState[1],
+                                      bodyFixedState[2]);
+   const Integer  numPts = pointGroup->GetNumPoints();
+
+   result.clear();
+   {
+      Profiler::Scope timer(Profiler::FEASIBILITY);
+      CheckGridFeasibility(centralBodyFixedPos);
+   }
+   SetStepGeometry(bodyFixedState, theTime);
+   Profiler::Scope timer(Profiler::FOV_TEST);
+   auto    append      = [&result](Integer ptIdx) { result.push_back(ptIdx); };
+   Integer numFeasible = CheckFeasiblePoints(NULL, append);
+   Profiler::AddCount(Profiler::POINTS_TESTED, numPts);
+   Profiler::AddCount(Profiler::FEASIBLE_POINTS, numFeasible);
+   Profiler::AddCount(Profiler::VISIBLE_POINTS, result.size());
+}
+
 //------------------------------------------------------------------------------
 // Rvector6 GetCentralBodyFixedState(Real jd, const Rvector6& scCartState)
 //------------------------------------------------------------------------------
@@ -353,16 +492,16 @@ IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &bodyFixedState,
 Rvector6 CoverageChecker::GetCentralBodyFixedState(Real jd,
                                                 const Rvector6& scCartState)
 {
+   Profiler::Scope timer(Profiler::FRAME_CONVERSION);
    // Converts state from inertial to body-fixed
    Rvector3 inertialPos   = scCartState.GetR();
    Rvector3 inertialVel   = scCartState.GetV();
    // TODO.  Handle differences in units of points and states.
    // TODO.  This ignores omega cross r term in velocity, which is ok and 
    // perhaps desired for current use cases but is not always desired.
-   Rvector3 centralBodyFixedPos  = centralBody->GetBodyFixedState(inertialPos,
-                                                                  jd);
-   Rvector3 centralBodyFixedVel  = centralBody->GetBodyFixedState(inertialVel,
-                                                                  jd);
+   Rmatrix33 inertialToFixed     = centralBody->GetInertialToFixedRotation(jd);
+   Rvector3 centralBodyFixedPos  = inertialToFixed * inertialPos;
+   Rvector3 centralBodyFixedVel  = inertialToFixed * inertialVel;
    Rvector6 bodyFixedState(centralBodyFixedPos(0), centralBodyFixedPos(1),
                             centralBodyFixedPos(2),
                             centralBodyFixedVel(0), centralBodyFixedVel(1),
@@ -370,10 +509,473 @@ Rvector6 CoverageChecker::GetCentralBodyFixedState(Real jd,
    return bodyFixedState;
 }
 
+//------------------------------------------------------------------------------
+// void SetSinglePrecision(bool singlePrec)
+//------------------------------------------------------------------------------
+/**
+ * Sets the use of the single precision feasibility test of all points. The
+ * unit position vectors of the points are then also kept in single precision
+ * (12 bytes per point, contiguous), and the hemisphere and horizon tests are
+ * computed on them, vectorized. The points whose single precision results
+ * are within a guard band of the decision boundary are tested again in double
+ * precision, so the results are identical to those of the double precision
+ * test. The field-of-view test (of the feasible points only) is always in
+ * double precision.
+ *
+ * @param singlePrec  true to use the single precision test
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::SetSinglePrecision(bool singlePrec)
+{
+   singlePrecision = singlePrec;
+   unitX.clear();
+   unitY.clear();
+   unitZ.clear();
+   pointStatus.clear();
+   if (singlePrecision)
+   {
+      Integer numPts = (Integer) pointArray.size();
+      unitX.resize(numPts);
+      unitY.resize(numPts);
+      unitZ.resize(numPts);
+      pointStatus.resize(numPts);
+      for (Integer ii = 0; ii < numPts; ii++)
+      {
+         const Real *unitPos = pointArray[ii]->GetDataVector();
+         unitX[ii] = (float) unitPos[0];
+         unitY[ii] = (float) unitPos[1];
+         unitZ[ii] = (float) unitPos[2];
+      }
+   }
+   unitX.shrink_to_fit();
+   unitY.shrink_to_fit();
+   unitZ.shrink_to_fit();
+   pointStatus.shrink_to_fit();
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// bool GetSinglePrecision() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the single precision feasibility test is used.
+ */
+//------------------------------------------------------------------------------
+bool CoverageChecker::GetSinglePrecision() const
+{
+   return singlePrecision;
+}
+
+//------------------------------------------------------------------------------
+// void SetUseFovLookupTable(bool useTable, Integer coneCells,
+//                           Integer clockCells)
+//------------------------------------------------------------------------------
+/**
+ * Sets the use of a field-of-view lookup table (FovLookupTable) for the
+ * field-of-view test of the custom sensors and of the sensors of other types
+ * (the conical and rectangular sensors keep their inline tests). The table is
+ * built for the sensor of the next step, and rebuilt when the sensor changes;
+ * calling this method again rebuilds it after a change of the sensor
+ * parameters. The results are those of the sensor test, except for the
+ * field-of-view features narrower than the cells of the sampled tables (see
+ * FovLookupTable).
+ *
+ * @param useTable    true to use a lookup table
+ * @param coneCells   number of cells of the table over the cone angles
+ * @param clockCells  number of cells of the table over the clock angles
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::SetUseFovLookupTable(bool    useTable,
+                                           Integer coneCells,
+                                           Integer clockCells)
+{
+   if (coneCells < 1 || clockCells < 1)
+      throw TATCException("CoverageChecker: the numbers of cells of the "
+                          "lookup table must be positive\n");
+   useFovTable        = useTable;
+   fovTableConeCells  = coneCells;
+   fovTableClockCells = clockCells;
+   delete fovTable;
+   fovTable           = NULL;
+   kernelSensor       = NULL;  // resolved again at the next step
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// bool GetUseFovLookupTable() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if a field-of-view lookup table is used.
+ */
+//------------------------------------------------------------------------------
+bool CoverageChecker::GetUseFovLookupTable() const
+{
+   return useFovTable;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetFovTableConeCells() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of cone angle cells of the field-of-view lookup table.
+ */
+//------------------------------------------------------------------------------
+Integer CoverageChecker::GetFovTableConeCells() const
+{
+   return fovTableConeCells;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetFovTableClockCells() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of clock angle cells of the field-of-view lookup table.
+ */
+//------------------------------------------------------------------------------
+Integer CoverageChecker::GetFovTableClockCells() const
+{
+   return fovTableClockCells;
+}
+
+//------------------------------------------------------------------------------
+// PointGroup* GetPointGroup()
+//------------------------------------------------------------------------------
+/**
+ * Returns the point group.
+ */
+//------------------------------------------------------------------------------
+PointGroup* CoverageChecker::GetPointGroup()
+{
+   return pointGroup;
+}
+
+//------------------------------------------------------------------------------
+// Spacecraft* GetSpacecraft()
+//------------------------------------------------------------------------------
+/**
+ * Returns the spacecraft.
+ */
+//------------------------------------------------------------------------------
+Spacecraft* CoverageChecker::GetSpacecraft()
+{
+   return sc;
+}
+
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+// bool IsPointInView(Integer ptIdx, const Rvector6 &bodyFixedState,
+//                    const Rvector3 &centralBodyFixedPos, Real theTime)
+//------------------------------------------------------------------------------
+/**
+ * Checks if a (feasible) point is in view of the sensor. If the spacecraft
+ * has no sensors, the result of the horizon test (done in
+ * CheckGridFeasibility(.)) is reported, i.e. the point is in view.
+ *
+ * @param ptIdx                index of the point
+ * @param bodyFixedState       central body fixed state of the spacecraft
+ * @param centralBodyFixedPos  central body fixed position of the spacecraft
+ * @param theTime              time (JDUT1)
+ *
+ * @return  true if the point is in view
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageChecker::IsPointInView(Integer         ptIdx,
+                                    const Rvector6  &bodyFixedState,
+                                    const Rvector3  &centralBodyFixedPos,
+                                    Real            theTime)
+{
+   SetStepGeometry(bodyFixedState, theTime);
+   return IsPointInSensorView(ptIdx);
+}
+
+//------------------------------------------------------------------------------
+// void SetStepGeometry(const Rvector6 &bodyFixedState, Real theTime)
+//------------------------------------------------------------------------------
+/**
+ * Sets the geometry of the step used by the field-of-view kernels: the
+ * spacecraft position and the rotations from the central body fixed frame to
+ * the sensor frame. They depend only on the spacecraft state, so they are
+ * computed once per step instead of once per point. The kernel type of the
+ * sensor (and its lookup table, if used) is resolved when the sensor changes.
+ *
+ * @param bodyFixedState  central body fixed state of the spacecraft
+ * @param theTime         time (JDUT1)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::SetStepGeometry(const Rvector6 &bodyFixedState,
+                                      Real           theTime)
+{
+   Integer  sensorNum = 0; // Currently only works for one sensor, hence hardcoded!!
+
+   hasSensor = sc->HasSensors();
+   if (!hasSensor)
+      return;
+   Sensor *sensor = sc->GetSensor(sensorNum);
+   if (sensor != kernelSensor)
+   {
+      kernelSensor = sensor;
+      sensorKind   = GetFovSensorKind(sensor);
+      delete fovTable;
+      fovTable     = NULL;
+      // the conical and rectangular tests are cheaper than a table
+      if (useFovTable && sensorKind != CONICAL_SENSOR &&
+          sensorKind != RECTANGULAR_SENSOR)
+         fovTable  = new FovLookupTable(sensor, fovTableConeCells,
+                                        fovTableClockCells);
+      AccountMemory();
+   }
+   for (Integer ii = 0; ii < 3; ii++)
+      stepGeometry.scPosition[ii] = bodyFixedState[ii];
+   stepGeometry.radius = centralBodyRadius;
+   Rmatrix33 fixedToNadirMat  = sc->GetBodyFixedToReference(bodyFixedState);
+   Rmatrix33 nadirToBodyMat   = sc->GetNadirToBodyMatrix();
+   Rmatrix33 bodyToSensorMat  = sensor->GetBodyToSensorMatrix(theTime);
+   offsetAttitude = false;
+   for (Integer ii = 0; ii < 3; ii++)
+      for (Integer jj = 0; jj < 3; jj++)
+      {
+         stepGeometry.fixedToNadir[3*ii + jj] = fixedToNadirMat(ii, jj);
+         stepGeometry.nadirToBody[3*ii + jj]  = nadirToBodyMat(ii, jj);
+         stepGeometry.bodyToSensor[3*ii + jj] = bodyToSensorMat(ii, jj);
+         if (nadirToBodyMat(ii, jj) != (ii == jj ? 1.0 : 0.0))
+            offsetAttitude = true;
+      }
+}
+
+//------------------------------------------------------------------------------
+// bool IsPointInSensorView(Integer ptIdx)
+//------------------------------------------------------------------------------
+/**
+ * Checks if a (feasible) point is in view of the sensor, with the geometry of
+ * the step set by SetStepGeometry(.). If the spacecraft has no sensors, the
+ * point is in view. The computation is that of
+ * Spacecraft::CheckTargetVisibility(bodyFixedState, satToTargetVec, ...) in
+ * the same order of operations (so with identical results), on the vector
+ * components (no temporary vectors or matrices). The point loops use the
+ * specialized kernels (CheckFeasiblePoints) instead.
+ *
+ * @param ptIdx  index of the point
+ *
+ * @return  true if the point is in view
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageChecker::IsPointInSensorView(Integer ptIdx)
+{
+   if (!hasSensor)
+      return true;
+   FovKernel<GenericFovTest, true> kernel(GenericFovTest(kernelSensor),
+                                          stepGeometry);
+   return kernel.InView(pointArray[ptIdx]->GetDataVector());
+}
+
+//------------------------------------------------------------------------------
+// template <class Output>
+// Integer CheckFeasiblePoints(const IntegerArray *pointIndices,
+//                             Output &output)
+//------------------------------------------------------------------------------
+/**
+ * Runs the field-of-view test of the feasible points with the kernel of the
+ * sensor and attitude of the step (set by SetStepGeometry(.)): the dispatch
+ * on the sensor type is done once per call, and the point loop is compiled
+ * for each kernel.
+ *
+ * @param pointIndices  indices of the points to test (NULL for all points)
+ * @param output        called with the index of each point in view
+ *
+ * @return  number of feasible points
+ *
+ */
+//------------------------------------------------------------------------------
+template <class Output>
+Integer CoverageChecker::CheckFeasiblePoints(const IntegerArray *pointIndices,
+                                             Output             &output)
+{
+   if (!hasSensor)
+      return CheckFeasiblePointsWith(NoSensorKernel(), pointIndices, output);
+   if (fovTable)
+      return CheckFeasiblePoints(LookupFovTest(fovTable), pointIndices,
+                                 output);
+   switch (sensorKind)
+   {
+      case CONICAL_SENSOR:
+         return CheckFeasiblePoints(ConicalFovTest(kernelSensor),
+                                    pointIndices, output);
+      case RECTANGULAR_SENSOR:
+         return CheckFeasiblePoints(RectangularFovTest(kernelSensor),
+                                    pointIndices, output);
+      case DSPIP_CUSTOM_SENSOR:
+         return CheckFeasiblePoints(
+                DirectFovTest<DSPIPCustomSensor>(kernelSensor),
+                pointIndices, output);
+      case GMAT_CUSTOM_SENSOR:
+         return CheckFeasiblePoints(
+                DirectFovTest<GMATCustomSensor>(kernelSensor),
+                pointIndices, output);
+      default:
+         return CheckFeasiblePoints(GenericFovTest(kernelSensor),
+                                    pointIndices, output);
+   }
+}
+
+//------------------------------------------------------------------------------
+// template <class Test, class Output>
+// Integer CheckFeasiblePoints(const Test &test,
+//                             const IntegerArray *pointIndices,
+//                             Output &output)
+//------------------------------------------------------------------------------
+/**
+ * Runs the field-of-view test of the feasible points with the sensor test,
+ * specialized on the attitude of the step.
+ *
+ * @param test          the sensor test
+ * @param pointIndices  indices of the points to test (NULL for all points)
+ * @param output        called with the index of each point in view
+ *
+ * @return  number of feasible points
+ *
+ */
+//------------------------------------------------------------------------------
+template <class Test, class Output>
+Integer CoverageChecker::CheckFeasiblePoints(const Test         &test,
+                                             const IntegerArray *pointIndices,
+                                             Output             &output)
+{
+   if (offsetAttitude)
+      return CheckFeasiblePointsWith(FovKernel<Test, true>(test, stepGeometry),
+                                     pointIndices, output);
+   return CheckFeasiblePointsWith(FovKernel<Test, false>(test, stepGeometry),
+                                  pointIndices, output);
+}
+
+//------------------------------------------------------------------------------
+// template <class Kernel, class Output>
+// Integer CheckFeasiblePointsWith(const Kernel &kernel,
+//                                 const IntegerArray *pointIndices,
+//                                 Output &output)
+//------------------------------------------------------------------------------
+/**
+ * The point loop of the field-of-view test, with the kernel inlined.
+ *
+ * @param kernel        the field-of-view kernel
+ * @param pointIndices  indices of the points to test (NULL for all points)
+ * @param output        called with the index of each point in view
+ *
+ * @return  number of feasible points
+ *
+ */
+//------------------------------------------------------------------------------
+template <class Kernel, class Output>
+Integer CoverageChecker::CheckFeasiblePointsWith(
+                                             const Kernel       &kernel,
+                                             const IntegerArray *pointIndices,
+                                             Output             &output)
+{
+   Integer numPts      = pointIndices ? (Integer) pointIndices->size() :
+                                        (Integer) pointArray.size();
+   Integer numFeasible = 0;
+   for (Integer k = 0; k < numPts; k++)
+   {
+      Integer ptIdx = pointIndices ? (*pointIndices)[k] : k;
+      if (!feasibilityTest[ptIdx])
+         continue;
+      numFeasible++;
+      if (kernel.InView(pointArray[ptIdx]->GetDataVector()))
+         output(ptIdx);
+   }
+   return numFeasible;
+}
+
+//------------------------------------------------------------------------------
+// void CheckGridFeasibilitySingle(const Real unitBody[3],
+//                                 const Real scaledPos[3])
+//------------------------------------------------------------------------------
+/**
+ * Checks the grid feasibility of all points in single precision. The first
+ * loop (vectorized) computes the hemisphere (u.b > 0) and horizon
+ * ((s - u).u > 0) dot products in single precision and classifies each point
+ * as feasible, infeasible or uncertain (a dot product deciding the result is
+ * within the guard band, scaled by the magnitudes of the vectors, of zero).
+ * The second loop sets the feasibility values, with the double precision test
+ * (IsPointFeasible) of the uncertain points.
+ *
+ * @param   unitBody    unit position vector of the spacecraft
+ * @param   scaledPos   position of the spacecraft / central body radius
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::CheckGridFeasibilitySingle(const Real unitBody[3],
+                                                 const Real scaledPos[3])
+{
+   const Integer numPts = (Integer) unitX.size();
+   const float   bx = (float) unitBody[0];
+   const float   by = (float) unitBody[1];
+   const float   bz = (float) unitBody[2];
+   const float   sx = (float) scaledPos[0];
+   const float   sy = (float) scaledPos[1];
+   const float   sz = (float) scaledPos[2];
+   const float   guard1 = SINGLE_PRECISION_GUARD;
+   const float   guard2 = SINGLE_PRECISION_GUARD *
+                          (1.0f + std::fabs(sx) + std::fabs(sy) + std::fabs(sz));
+   const float   *ux = unitX.data();
+   const float   *uy = unitY.data();
+   const float   *uz = unitZ.data();
+   unsigned char *status = pointStatus.data();
+
+   for (Integer ii = 0; ii < numPts; ii++)
+   {
+      float dot1 = ux[ii]*bx + uy[ii]*by + uz[ii]*bz;
+      float dot2 = (sx - ux[ii])*ux[ii] + (sy - uy[ii])*uy[ii] +
+                   (sz - uz[ii])*uz[ii];
+      bool  sameSide  = dot1 > guard1;
+      bool  feasible  = sameSide & (dot2 > guard2);
+      bool  uncertain = (std::fabs(dot1) <= guard1) |
+                        (sameSide & (std::fabs(dot2) <= guard2));
+      status[ii] = (unsigned char) (feasible | (uncertain << 1));
+   }
+
+   Integer numUncertain = 0;
+   for (Integer ii = 0; ii < numPts; ii++)
+   {
+      if (status[ii] & 2)
+      {
+         feasibilityTest[ii] = IsPointFeasible(ii, unitBody, scaledPos);
+         numUncertain++;
+      }
+      else
+         feasibilityTest[ii] = status[ii] & 1;
+   }
+   Profiler::AddCount(Profiler::PRECISION_FALLBACKS, numUncertain);
+}
+
+//------------------------------------------------------------------------------
+// void AccountMemory()
+//------------------------------------------------------------------------------
+/**
+ * Accounts the memory of the point vectors, feasibility flags and lookup
+ * table cells (Profiler::CHECKER_MEMORY).
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::AccountMemory()
+{
+   long long bytes = pointArray.capacity() * sizeof(Rvector3*) +
+                     pointArray.size() * sizeof(Rvector3) +
+                     feasibilityTest.capacity() / 8 +
+                     (unitX.capacity() + unitY.capacity() + unitZ.capacity()) *
+                     sizeof(float) + pointStatus.capacity() +
+                     (fovTable ? (long long) fovTable->GetNumConeCells() *
+                                 fovTable->GetNumClockCells() : 0);
+   Profiler::UpdateMemory(Profiler::CHECKER_MEMORY, accountedMemory, bytes);
+}
+
 //------------------------------------------------------------------------------
 // bool CheckGridFeasibility(Integer         ptIdx,,
 //                           const Rvector3& bodyFixedState)
@@ -446,32 +1048,107 @@ void CoverageChecker::CheckGridFeasibility(const Rvector3& bodyFixedState)
                                     bodyFixedState.ToString(12).c_str());
    #endif
 
-   bodyUnit = bodyFixedState.GetUnitVector();   
-   
-   for (Integer ptIdx = 0; ptIdx < pointArray.size(); ptIdx++)
+   Real unitBody[3], scaledPos[3];
+   SetFeasibilityGeometry(bodyFixedState, unitBody, scaledPos);
+
+   if (singlePrecision)
    {
-      feasibilityTest.at(ptIdx) = false; //initialize
-      
-      // feasibilityTest.at(ptIdx) = CheckGridFeasibility(ptIdx, bodyFixedState); // this makes it slow because unit body vector is calculated repeatedly
+      CheckGridFeasibilitySingle(unitBody, scaledPos);
+      return;
+   }
 
-      unitPtPos    = *(pointArray.at(ptIdx)); // is normalized
-      //Real  feasibilityReal = unitPtPos * bodyUnit; // gives the cosine of the angle b/w the spacecraft and point
-      
-      if ((unitPtPos * bodyUnit) > 0.0) // i.e. check if the point and satellite are on the same hemisphere
-      {
-         // do horizon test           
-         /* This code is  slower. Next snippet is the faster.
-         ptPos  = unitPtPos*centralBodyRadius;
-         rangeVec  = bodyFixedState - ptPos;
-         unitRangeVec   = rangeVec.GetUnitVector(); 
-         Real dot  = unitRangeVec * unitPtPos;
-         if (dot > 0.0)
-            isFeasible = true;
-         */      
-         rangeVec  = bodyFixedState/centralBodyRadius - unitPtPos; // scaled version of the actual range vector
-         if ((rangeVec * unitPtPos) > 0.0)
-            feasibilityTest.at(ptIdx) = true;         
-      }
+   // The range vector is computed in its scaled version (bodyFixedState/
+   // centralBodyRadius - unitPtPos), faster than the actual (normalized) one;
+   // the components are used directly so that there is no temporary vector.
+   for (Integer ptIdx = 0; ptIdx < (Integer) pointArray.size(); ptIdx++)
+      feasibilityTest[ptIdx] = IsPointFeasible(ptIdx, unitBody, scaledPos);
+}
 
+//------------------------------------------------------------------------------
+// void CheckGridFeasibility(const Rvector3& bodyFixedState,
+//                           const IntegerArray &pointIndices)
+//------------------------------------------------------------------------------
+/**
+ * Checks the grid feasibility for the select points (same tests as for all
+ * points). Only the feasibility values of the select points are updated, so
+ * the cost is proportional to the number of select points.
+ *
+ * @param   bodyFixedState    central body fixed state (position) of spacecraft
+ * @param   pointIndices      indices of the points to check
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::CheckGridFeasibility(const Rvector3& bodyFixedState,
+                                           const IntegerArray &pointIndices)
+{
+   Real unitBody[3], scaledPos[3];
+   SetFeasibilityGeometry(bodyFixedState, unitBody, scaledPos);
+
+   for (Integer k = 0; k < (Integer) pointIndices.size(); k++)
+   {
+      Integer ptIdx = pointIndices[k];
+      feasibilityTest[ptIdx] = IsPointFeasible(ptIdx, unitBody, scaledPos);
    }
-}
\ No newline at end of file
+}
+
+//------------------------------------------------------------------------------
+// void SetFeasibilityGeometry(const Rvector3 &bodyFixedState,
+//                             Real unitBody[3], Real scaledPos[3])
+//------------------------------------------------------------------------------
+/**
+ * Computes the unit vector and the position scaled by the central body radius
+ * of the spacecraft, used by IsPointFeasible(.).
+ *
+ * @param   bodyFixedState    central body fixed state (position) of spacecraft
+ * @param   unitBody          unit position vector (output)
+ * @param   scaledPos         position / central body radius (output)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::SetFeasibilityGeometry(const Rvector3 &bodyFixedState,
+                                             Real           unitBody[3],
+                                             Real           scaledPos[3])
+{
+   Real mag = bodyFixedState.GetMagnitude();
+   if (GmatMathUtil::IsZero(mag))
+      throw TATCException("Zero spacecraft position in "
+                          "CoverageChecker::CheckGridFeasibility\n");
+   for (Integer ii = 0; ii < 3; ii++)
+   {
+      unitBody[ii]  = bodyFixedState[ii] / mag;
+      scaledPos[ii] = bodyFixedState[ii] / centralBodyRadius;
+   }
+}
+
+//------------------------------------------------------------------------------
+// bool IsPointFeasible(Integer ptIdx, const Real unitBody[3],
+//                      const Real scaledPos[3])
+//------------------------------------------------------------------------------
+/**
+ * Checks if a point and the spacecraft are on the same hemisphere and the
+ * point is above the horizon of the spacecraft (same tests, and values, as
+ * the Rvector3 versions, on the components).
+ *
+ * @param   ptIdx       index of the point
+ * @param   unitBody    unit position vector of the spacecraft
+ * @param   scaledPos   position of the spacecraft / central body radius
+ *
+ * @return  true if the point is feasible
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageChecker::IsPointFeasible(Integer    ptIdx,
+                                      const Real unitBody[3],
+                                      const Real scaledPos[3])
+{
+   const Real *unitPos = pointArray[ptIdx]->GetDataVector(); // is normalized
+   // check if the point and satellite are on the same hemisphere
+   if ((unitPos[0]*unitBody[0] + unitPos[1]*unitBody[1] +
+        unitPos[2]*unitBody[2]) <= 0.0)
+      return false;
+   // horizon test with the scaled version of the actual range vector
+   Real range[3] = {scaledPos[0] - unitPos[0], scaledPos[1] - unitPos[1],
+                    scaledPos[2] - unitPos[2]};
+   return (range[0]*unitPos[0] + range[1]*unitPos[1] +
+           range[2]*unitPos[2]) > 0.0;
+}
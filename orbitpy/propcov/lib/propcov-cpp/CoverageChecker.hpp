@@ -49,6 +49,8 @@
 #include "Earth.hpp"
 #include "Rvector.hpp"
 #include "Rvector3.hpp"
+#include "CoverageBitmap.hpp"
+#include "CoverageKernels.hpp"
 
 class CoverageChecker
 {
@@ -71,6 +73,34 @@ public:
    virtual IntegerArray      CheckPointCoverage(const Rvector6 &bodyFixedState,
                                                 Real           theTime,
                                                 const Rvector6 &scCartState);
+   /// Check the point coverage (all points) and return the result as a compressed bitmap
+   virtual CoverageBitmap    CheckPointCoverageBitmap();
+   virtual CoverageBitmap    CheckPointCoverageBitmap(const Rvector6 &bodyFixedState,
+                                                      Real           theTime,
+                                                      const Rvector6 &scCartState);
+   /// Same as CheckPointCoverage() and
+   /// CheckPointCoverage(bodyFixedState, theTime, scCartState), with the
+   /// indices written into result (cleared first; its capacity is reused)
+   virtual void              CheckPointCoverageInto(IntegerArray &result);
+   virtual void              CheckPointCoverageInto(
+                                  const Rvector6 &bodyFixedState,
+                                  Real theTime,
+                                  IntegerArray &result);
+   /// Use (or not) the single precision feasibility test of the points
+   virtual void              SetSinglePrecision(bool singlePrec);
+   bool                      GetSinglePrecision() const;
+   /// Use (or not) a field-of-view lookup table for the custom and other
+   /// sensors (built for the sensor at the next step)
+   virtual void              SetUseFovLookupTable(bool useTable,
+                                  Integer coneCells = 128,
+                                  Integer clockCells = 256);
+   bool                      GetUseFovLookupTable() const;
+   /// Get the dimensions of the field-of-view lookup table
+   Integer                   GetFovTableConeCells() const;
+   Integer                   GetFovTableClockCells() const;
+   /// Get the point group and the spacecraft
+   PointGroup*               GetPointGroup();
+   Spacecraft*               GetSpacecraft();
    
 protected:
    
@@ -90,12 +120,93 @@ protected:
    
    /// Get the central body fixed state at the input time for the input cartesian state
    virtual Rvector6          GetCentralBodyFixedState(Real jd, const Rvector6& scCartState);
+   /// Check if a (feasible) point is in view of the sensor
+   virtual bool              IsPointInView(Integer ptIdx,
+                                  const Rvector6 &bodyFixedState,
+                                  const Rvector3 &centralBodyFixedPos,
+                                  Real theTime);
+   /// Set the spacecraft position and rotations of the step used by
+   /// IsPointInSensorView
+   virtual void              SetStepGeometry(const Rvector6 &bodyFixedState,
+                                  Real theTime);
+   /// Check if a (feasible) point is in view of the sensor, with the geometry
+   /// of the step
+   virtual bool              IsPointInSensorView(Integer ptIdx);
    /// Check the grid feasibility for the input point with the input body fixed state
    virtual bool              CheckGridFeasibility(Integer ptIdx,
                                   const Rvector3& bodyFixedState);
    /// Check the grid feasibility for all points for the input body fixed state
    virtual void              CheckGridFeasibility(
                                   const Rvector3& bodyFixedState);
+   /// Check the grid feasibility for the select points for the input body fixed state
+   virtual void              CheckGridFeasibility(
+                                  const Rvector3& bodyFixedState,
+                                  const IntegerArray &pointIndices);
+   /// Unit and scaled spacecraft position used by IsPointFeasible
+   void                      SetFeasibilityGeometry(
+                                  const Rvector3 &bodyFixedState,
+                                  Real unitBody[3], Real scaledPos[3]);
+   /// Check if a point is on the spacecraft side and above its horizon
+   bool                      IsPointFeasible(Integer ptIdx,
+                                  const Real unitBody[3],
+                                  const Real scaledPos[3]);
+   /// Single precision feasibility test of all points, with the double
+   /// precision test of the points within the guard band
+   void                      CheckGridFeasibilitySingle(
+                                  const Real unitBody[3],
+                                  const Real scaledPos[3]);
+   /// Account the memory of pointArray and feasibilityTest
+   void                      AccountMemory();
+   /// Field-of-view test of the feasible points (all the points, or those of
+   /// pointIndices if not NULL) with the kernel of the sensor of the step;
+   /// output(ptIdx) is called for the points in view. Returns the number of
+   /// feasible points.
+   template <class Output>
+   Integer                   CheckFeasiblePoints(
+                                  const IntegerArray *pointIndices,
+                                  Output &output);
+   template <class Test, class Output>
+   Integer                   CheckFeasiblePoints(const Test &test,
+                                  const IntegerArray *pointIndices,
+                                  Output &output);
+   template <class Kernel, class Output>
+   Integer                   CheckFeasiblePointsWith(const Kernel &kernel,
+                                  const IntegerArray *pointIndices,
+                                  Output &output);
+
+   /// use the single precision feasibility test?
+   bool                       singlePrecision;
+   /// unit position vectors of the points in single precision (structure of
+   /// arrays; empty unless singlePrecision is true)
+   std::vector<float>         unitX;
+   std::vector<float>         unitY;
+   std::vector<float>         unitZ;
+   /// result of the single precision test of each point: bit 0 feasible,
+   /// bit 1 within the guard band (to be tested in double precision)
+   std::vector<unsigned char> pointStatus;
+   /// guard band of the single precision tests
+   static const float         SINGLE_PRECISION_GUARD;
+
+   /// Spacecraft position (body fixed) and the rotations from the body fixed
+   /// frame to the nadir, body and sensor frames of the step
+   FovGeometry                stepGeometry;
+   /// Has the spacecraft a sensor (at the step)?
+   bool                       hasSensor;
+   /// Is the nadir-to-body rotation of the step not the identity?
+   bool                       offsetAttitude;
+   /// The sensor of the step and its kernel type (resolved when the sensor
+   /// changes)
+   Sensor                     *kernelSensor;
+   FovSensorKind              sensorKind;
+   /// use a field-of-view lookup table, and its dimensions
+   bool                       useFovTable;
+   Integer                    fovTableConeCells;
+   Integer                    fovTableClockCells;
+   /// the lookup table of the sensor of the step (owned; NULL if not used or
+   /// for the conical and rectangular sensors)
+   FovLookupTable             *fovTable;
+   /// Memory accounted for this object (Profiler::CHECKER_MEMORY)
+   long long                  accountedMemory;
    
    /// local Rvectors used for Grid Feasibility calculations
    /// (for performance)
@@ -29,6 +29,7 @@
 #include "RealUtilities.hpp"
 #include "GmatConstants.hpp"
 #include "Rmatrix33.hpp"
+#include "Profiler.hpp"
 #include "TATCException.hpp"
 #include "MessageInterface.hpp"
 #include <iostream>
@@ -63,7 +64,8 @@ CoverageChecker::CoverageChecker(PointGroup *ptGroup, Spacecraft *sat) :
    centralBody       (NULL),
    timeIdx           (-1) ,
    coverageStart     (0.0),
-   coverageEnd       (0.0)
+   coverageEnd       (0.0),
+   accountedMemory   (0)
 {
    timeSeriesData.clear();
    
@@ -98,6 +100,7 @@ CoverageChecker::CoverageChecker(PointGroup *ptGroup, Spacecraft *sat) :
       pointArray.push_back(posUnit);
       feasibilityTest.push_back(false);
    }
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -116,7 +119,8 @@ CoverageChecker::CoverageChecker(const CoverageChecker &copy) :
    centralBody       (copy.centralBody),
    timeIdx           (copy.timeIdx),
    coverageStart     (copy.coverageStart),  // or 0.0?
-   coverageEnd       (copy.coverageEnd)     // or 0.0?
+   coverageEnd       (copy.coverageEnd),    // or 0.0?
+   accountedMemory   (0)
 {
    timeSeriesData.clear();
    for (Integer ii = 0; ii < copy.timeSeriesData.size(); ii++)
@@ -147,7 +151,7 @@ CoverageChecker::CoverageChecker(const CoverageChecker &copy) :
       feasibilityTest.push_back(copy.feasibilityTest.at(ff));
 
    computePOIGeometryData = copy.computePOIGeometryData;
-
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -201,6 +205,7 @@ CoverageChecker& CoverageChecker::operator=(const CoverageChecker &copy)
       feasibilityTest.push_back(copy.feasibilityTest.at(ff));
 
    computePOIGeometryData = copy.computePOIGeometryData;
+   AccountMemory();
 
    return *this;
 }
@@ -220,6 +225,26 @@ CoverageChecker::~CoverageChecker()
    {
       delete pointArray[x];
    }
+   Profiler::UpdateMemory(Profiler::TIME_SERIES_MEMORY, accountedMemory, 0);
+}
+
+//------------------------------------------------------------------------------
+//  void AccountMemory()
+//------------------------------------------------------------------------------
+/**
+ * Accounts the memory of the time series data (Profiler::TIME_SERIES_MEMORY).
+ * The growth of the series during the coverage checks is accounted as the
+ * indices are added.
+ * 
+ */
+//------------------------------------------------------------------------------
+void CoverageChecker::AccountMemory()
+{
+   long long bytes = timeSeriesData.capacity() * sizeof(IntegerArray);
+   for (Integer ii = 0; ii < timeSeriesData.size(); ii++)
+      bytes += timeSeriesData[ii].capacity() * sizeof(Integer);
+   Profiler::UpdateMemory(Profiler::TIME_SERIES_MEMORY, accountedMemory,
+                          bytes);
 }
 
 
@@ -356,7 +381,13 @@ IntegerArray CoverageChecker::CheckPointCoverage(const Rvector6 &theState,
             result.push_back(PointIndices[k]);   // covCount'th entry
             covCount++;
             numEventsPerPoint.at(PointIndices[k]) = numEventsPerPoint.at(PointIndices[k]) + 1;
-            timeSeriesData.at(PointIndices[k]).push_back(timeIdx);
+            IntegerArray &series     = timeSeriesData.at(PointIndices[k]);
+            long long    oldCapacity = series.capacity();
+            series.push_back(timeIdx);
+            if ((long long) series.capacity() != oldCapacity)
+               Profiler::UpdateMemory(Profiler::TIME_SERIES_MEMORY,
+                     accountedMemory, accountedMemory +
+                     (series.capacity() - oldCapacity) * sizeof(Integer));
             if (computePOIGeometryData)
             {
 
@@ -104,6 +104,8 @@ protected:
    Real                       coverageStart;
    /// End time of the coverage
    Real                       coverageEnd;
+   /// Memory accounted for the time series (Profiler::TIME_SERIES_MEMORY)
+   long long                  accountedMemory;
    
    /// <static const> body radius
    static const Real BODY_RADIUS;
@@ -117,6 +119,8 @@ protected:
    /// Check the grid feasibility for all points for the input body fixed state
    virtual void              CheckGridFeasibility(
                                   const Rvector3& bodyFixedState);
+   /// Account the memory of the time series data
+   void                      AccountMemory();
    
    /// local Rvectors used for Grid Feasibility calculations
    /// (for performance)
@@ -0,0 +1,322 @@
+//------------------------------------------------------------------------------
+//                           CoverageClient
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageClient class
+ */
+//------------------------------------------------------------------------------
+#include <cstring>
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+#include "gmatdefs.hpp"
+#include "CoverageClient.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageClient(const std::string &socketPath)
+//------------------------------------------------------------------------------
+/**
+ * Constructor; connects to the service.
+ *
+ * @param socketPath  path of the Unix domain socket of the service
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageClient::CoverageClient(const std::string &socketPath) :
+   fd (-1)
+{
+#ifndef _WIN32
+   struct sockaddr_un addr;
+   if (socketPath.size() >= sizeof(addr.sun_path))
+      throw TATCException("CoverageClient: the socket path is too long\n");
+   std::memset(&addr, 0, sizeof(addr));
+   addr.sun_family = AF_UNIX;
+   std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+   fd = socket(AF_UNIX, SOCK_STREAM, 0);
+   if (fd < 0)
+      throw TATCException("CoverageClient: cannot create the socket\n");
+   if (connect(fd, (struct sockaddr*) &addr, sizeof(addr)) < 0)
+   {
+      close(fd);
+      fd = -1;
+      throw TATCException("CoverageClient: cannot connect to " + socketPath +
+                          "\n");
+   }
+#else
+   throw TATCException("CoverageClient: not supported on this platform\n");
+#endif
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageClient()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; closes the connection.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageClient::~CoverageClient()
+{
+   Close();
+}
+
+//------------------------------------------------------------------------------
+// bool Ping()
+//------------------------------------------------------------------------------
+/**
+ * Checks that the service answers.
+ *
+ * @return  true if the service answered with a PONG
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageClient::Ping()
+{
+   std::vector<char> payload, reply;
+   return (Request(CoverageProtocol::PING, payload, reply) ==
+           CoverageProtocol::PONG);
+}
+
+//------------------------------------------------------------------------------
+// Integer RegisterGrid(const RealArray &lats, const RealArray &lons)
+//------------------------------------------------------------------------------
+/**
+ * Registers a grid with the service.
+ *
+ * @param lats  latitudes of the points (rad)
+ * @param lons  longitudes of the points (rad)
+ *
+ * @return  the grid id (the same for identical grids)
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageClient::RegisterGrid(const RealArray &lats,
+                                     const RealArray &lons)
+{
+   std::vector<char> payload, reply;
+   CoverageProtocol::PutRealArray(payload, lats);
+   CoverageProtocol::PutRealArray(payload, lons);
+   if (Request(CoverageProtocol::REGISTER_GRID, payload, reply) !=
+       CoverageProtocol::GRID_ID)
+   {
+      Close();
+      throw TATCException("CoverageClient: unexpected reply\n");
+   }
+   size_t offset = 0;
+   return CoverageProtocol::GetInt(reply, offset);
+}
+
+//------------------------------------------------------------------------------
+// Integer RunCoverage(const CoverageRequest &req, CoverageSink &sink)
+//------------------------------------------------------------------------------
+/**
+ * Runs a coverage request on the service and feeds the results to the sink
+ * as they are received. If the sink throws, the connection is closed (the
+ * rest of the results cannot be skipped).
+ *
+ * @param req   the request
+ * @param sink  the consumer of the results
+ *
+ * @return  the number of steps
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageClient::RunCoverage(const CoverageRequest &req,
+                                    CoverageSink &sink)
+{
+   std::vector<char> payload, reply;
+   CoverageProtocol::WriteRequest(payload, req);
+   if (Request(CoverageProtocol::COVERAGE, payload, reply) !=
+       CoverageProtocol::BEGIN)
+   {
+      Close();
+      throw TATCException("CoverageClient: unexpected reply\n");
+   }
+
+   try
+   {
+      size_t  offset    = 0;
+      Integer numPoints = CoverageProtocol::GetInt(reply, offset);
+      Integer numSteps  = CoverageProtocol::GetInt(reply, offset);
+      Real    stepDays  = req.stepSize / GmatTimeConstants::SECS_PER_DAY;
+      IntegerArray noCoverage;
+      Integer next = 0;   // next step to feed to the sink
+
+      sink.BeginRun(numPoints, req.epoch, req.stepSize, numSteps);
+      uint32_t type;
+      while ((type = ReadReply(reply)) == CoverageProtocol::STEPS)
+      {
+         offset = 0;
+         while (offset < reply.size())
+         {
+            Integer      step    = CoverageProtocol::GetInt(reply, offset);
+            Real         jd      = CoverageProtocol::GetReal(reply, offset);
+            IntegerArray covered = CoverageProtocol::GetIntArray(reply,
+                                                                 offset);
+            if (step < next || step >= numSteps)
+               throw TATCException("CoverageClient: invalid step index\n");
+            for (; next < step; next++)
+               sink.ProcessStep(next, req.epoch + next * stepDays, noCoverage);
+            sink.ProcessStep(step, jd, covered);
+            next = step + 1;
+         }
+      }
+      if (type != CoverageProtocol::END)
+         throw TATCException("CoverageClient: unexpected reply\n");
+      for (; next < numSteps; next++)
+         sink.ProcessStep(next, req.epoch + next * stepDays, noCoverage);
+      sink.EndRun();
+      return numSteps;
+   }
+   catch (...)
+   {
+      Close();
+      throw;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Shutdown()
+//------------------------------------------------------------------------------
+/**
+ * Asks the service to stop; the connection is closed.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageClient::Shutdown()
+{
+   CheckConnected();
+   std::vector<char> payload;
+   CoverageProtocol::WriteMessage(fd, CoverageProtocol::SHUTDOWN, payload);
+   Close();
+}
+
+//------------------------------------------------------------------------------
+// void Close()
+//------------------------------------------------------------------------------
+/**
+ * Closes the connection.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageClient::Close()
+{
+#ifndef _WIN32
+   if (fd >= 0)
+      close(fd);
+#endif
+   fd = -1;
+}
+
+//------------------------------------------------------------------------------
+// bool IsConnected() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true while the connection is open.
+ */
+//------------------------------------------------------------------------------
+bool CoverageClient::IsConnected() const
+{
+   return (fd >= 0);
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// uint32_t Request(uint32_t type, const std::vector<char> &payload,
+//                  std::vector<char> &reply)
+//------------------------------------------------------------------------------
+/**
+ * Sends a request and reads the (first) reply.
+ *
+ * @param type     request type
+ * @param payload  request payload
+ * @param reply    [out] reply payload
+ *
+ * @return  the reply type
+ *
+ */
+//------------------------------------------------------------------------------
+uint32_t CoverageClient::Request(uint32_t type,
+                                 const std::vector<char> &payload,
+                                 std::vector<char> &reply)
+{
+   CheckConnected();
+   try
+   {
+      CoverageProtocol::WriteMessage(fd, type, payload);
+   }
+   catch (BaseException &)
+   {
+      Close();
+      throw;
+   }
+   return ReadReply(reply);
+}
+
+//------------------------------------------------------------------------------
+// uint32_t ReadReply(std::vector<char> &reply)
+//------------------------------------------------------------------------------
+/**
+ * Reads a reply; an ERROR reply is thrown as a TATCException with the message
+ * of the service.
+ *
+ * @param reply    [out] reply payload
+ *
+ * @return  the reply type
+ *
+ */
+//------------------------------------------------------------------------------
+uint32_t CoverageClient::ReadReply(std::vector<char> &reply)
+{
+   uint32_t type;
+   bool     ok;
+   try
+   {
+      ok = CoverageProtocol::ReadMessage(fd, type, reply);
+   }
+   catch (BaseException &)
+   {
+      Close();
+      throw;
+   }
+   if (!ok)
+   {
+      Close();
+      throw TATCException("CoverageClient: the service closed the "
+                          "connection\n");
+   }
+   if (type == CoverageProtocol::ERROR)
+   {
+      size_t offset = 0;
+      throw TATCException(CoverageProtocol::GetString(reply, offset));
+   }
+   return type;
+}
+
+//------------------------------------------------------------------------------
+// void CheckConnected() const
+//------------------------------------------------------------------------------
+/**
+ * Throws if the connection is closed.
+ */
+//------------------------------------------------------------------------------
+void CoverageClient::CheckConnected() const
+{
+   if (fd < 0)
+      throw TATCException("CoverageClient: not connected\n");
+}
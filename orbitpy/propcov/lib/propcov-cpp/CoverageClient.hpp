@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+//                           CoverageClient
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageClient class, the client side of the
+ * CoverageService (see CoverageProtocol for the messages).
+ *
+ * The results of a coverage request are fed to a CoverageSink as the steps
+ * are received, with the same calls as a (single-threaded) CoverageRunner
+ * run: BeginRun, ProcessStep for every step (the steps without coverage get
+ * an empty array), EndRun.
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageClient_hpp
+#define CoverageClient_hpp
+
+#include <string>
+#include "gmatdefs.hpp"
+#include "CoverageProtocol.hpp"
+#include "CoverageSink.hpp"
+
+class CoverageClient
+{
+public:
+
+   /// class construction/destruction (the constructor connects)
+   CoverageClient(const std::string &socketPath);
+   virtual ~CoverageClient();
+
+   /// Check that the service answers
+   bool           Ping();
+   /// Register a grid (lat/lon in radians); returns its id
+   Integer        RegisterGrid(const RealArray &lats, const RealArray &lons);
+   /// Run a coverage request, feeding the results to the sink; returns the
+   /// number of steps
+   Integer        RunCoverage(const CoverageRequest &req, CoverageSink &sink);
+   /// Ask the service to stop
+   void           Shutdown();
+   /// Close the connection
+   void           Close();
+   bool           IsConnected() const;
+
+protected:
+
+   /// the connected socket (-1 when closed)
+   int            fd;
+
+   /// Send a request and read the reply, throwing on an ERROR reply
+   uint32_t       Request(uint32_t type, const std::vector<char> &payload,
+                          std::vector<char> &reply);
+   /// Read a reply, throwing on an ERROR reply
+   uint32_t       ReadReply(std::vector<char> &reply);
+   void           CheckConnected() const;
+
+private:
+
+   CoverageClient(const CoverageClient &copy);
+   CoverageClient& operator=(const CoverageClient &copy);
+};
+#endif // CoverageClient_hpp
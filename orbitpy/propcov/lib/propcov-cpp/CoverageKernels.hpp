@@ -0,0 +1,222 @@
+//------------------------------------------------------------------------------
+//                           CoverageKernels
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the field-of-view kernels of the CoverageChecker: the test of
+ * the points in view of the sensor, specialized at compile time on the sensor
+ * type and on the spacecraft attitude.
+ *
+ * A kernel is built once per step from the step geometry (FovGeometry) and
+ * the sensor, so its InView(unitPos) method makes no virtual call, sensor
+ * number check or bounds-checked access, and can be inlined in the point
+ * loop. The sensor type is resolved once per sensor (GetFovSensorKind):
+ *  - CONICAL and RECTANGULAR sensors are tested inline on copies of their
+ *    parameters (maximum excursion angle, poles of the sides);
+ *  - DSPIP_CUSTOM and GMAT_CUSTOM sensors are tested with a direct
+ *    (non-virtual) call of their CheckTargetVisibility;
+ *  - the other sensor types (or subclasses) use the virtual call.
+ * With a field-of-view lookup table (CoverageChecker::SetUseFovLookupTable), the
+ * custom and other sensors are tested on the table (LookupFovTest).
+ * With the nadir attitude (no spacecraft body offset), the nadir-to-body
+ * rotation (the identity) is skipped.
+ *
+ * The kernels do the operations of Spacecraft::CheckTargetVisibility and of
+ * the sensors in the same order, so the results are identical.
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageKernels_hpp
+#define CoverageKernels_hpp
+
+#include <typeinfo>
+#include "gmatdefs.hpp"
+#include "GmatConstants.hpp"
+#include "RealUtilities.hpp"
+#include "Sensor.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "GMATCustomSensor.hpp"
+#include "polygon/DSPIPCustomSensor.hpp"
+#include "FovLookupTable.hpp"
+
+/// Sensor types with a specialized kernel
+enum FovSensorKind
+{
+   GENERIC_SENSOR = 0,  ///< any other sensor type (virtual call)
+   CONICAL_SENSOR,
+   RECTANGULAR_SENSOR,
+   DSPIP_CUSTOM_SENSOR,
+   GMAT_CUSTOM_SENSOR
+};
+
+/// Geometry of a step: spacecraft position (body fixed) and the rotations
+/// (row major) from the body fixed frame to the nadir, body and sensor frames
+struct FovGeometry
+{
+   Real scPosition[3];
+   Real fixedToNadir[9];
+   Real nadirToBody[9];
+   Real bodyToSensor[9];
+   /// central body radius (the points are unit vectors)
+   Real radius;
+};
+
+//------------------------------------------------------------------------------
+// FovSensorKind GetFovSensorKind(const Sensor *sensor)
+//------------------------------------------------------------------------------
+/**
+ * Returns the kernel type of a sensor. Only the exact types are specialized:
+ * a subclass may override CheckTargetVisibility.
+ */
+//------------------------------------------------------------------------------
+inline FovSensorKind GetFovSensorKind(const Sensor *sensor)
+{
+   const std::type_info &type = typeid(*sensor);
+   if (type == typeid(ConicalSensor))
+      return CONICAL_SENSOR;
+   if (type == typeid(RectangularSensor))
+      return RECTANGULAR_SENSOR;
+   if (type == typeid(DSPIPCustomSensor))
+      return DSPIP_CUSTOM_SENSOR;
+   if (type == typeid(GMATCustomSensor))
+      return GMAT_CUSTOM_SENSOR;
+   return GENERIC_SENSOR;
+}
+
+/// Conical sensor: the cone angle is within the field of view
+/// (ConicalSensor::CheckTargetVisibility)
+class ConicalFovTest
+{
+public:
+   ConicalFovTest(Sensor *sensor) :
+      maxExcursionAngle(sensor->GetMaxExcursionAngle()) {}
+   bool InView(Real cone, Real clock) const
+      { return cone < maxExcursionAngle; }
+private:
+   Real maxExcursionAngle;
+};
+
+/// Rectangular sensor: the view vector is on the inner side of the four
+/// sides (RectangularSensor::CheckTargetVisibility)
+class RectangularFovTest
+{
+public:
+   RectangularFovTest(Sensor *sensor) :
+      maxExcursionAngle(sensor->GetMaxExcursionAngle())
+   {
+      const std::vector<Rvector3> &sides =
+            ((RectangularSensor*) sensor)->GetPoles();
+      for (Integer ii = 0; ii < 4; ii++)
+         for (Integer jj = 0; jj < 3; jj++)
+            poles[3*ii + jj] = sides[ii][jj];
+   }
+   bool InView(Real cone, Real clock) const
+   {
+      if (!(cone < maxExcursionAngle))
+         return false;
+      Real viewDec = GmatMathConstants::PI/2.0 - cone;
+      Real cosDec  = cos(viewDec);
+      Real view[3] = {cosDec * cos(clock), cosDec * sin(clock), sin(viewDec)};
+      for (Integer ii = 0; ii < 4; ii++)
+         if (poles[3*ii]*view[0] + poles[3*ii + 1]*view[1] +
+             poles[3*ii + 2]*view[2] <= 0.0)
+            return false;
+      return true;
+   }
+private:
+   Real maxExcursionAngle;
+   Real poles[12];
+};
+
+/// Sensor of type SensorType: direct (non-virtual) call of its test
+template <class SensorType>
+class DirectFovTest
+{
+public:
+   DirectFovTest(Sensor *sensor) : sensor((SensorType*) sensor) {}
+   bool InView(Real cone, Real clock) const
+      { return sensor->SensorType::CheckTargetVisibility(cone, clock); }
+private:
+   SensorType *sensor;
+};
+
+/// Any sensor: virtual call of its test
+class GenericFovTest
+{
+public:
+   GenericFovTest(Sensor *sensor) : sensor(sensor) {}
+   bool InView(Real cone, Real clock) const
+      { return sensor->CheckTargetVisibility(cone, clock); }
+private:
+   Sensor *sensor;
+};
+
+/// Any sensor with a lookup table: the cell of the angles, or the exact test
+/// in the boundary cells (FovLookupTable::CheckTargetVisibility)
+class LookupFovTest
+{
+public:
+   LookupFovTest(const FovLookupTable *table) : table(table) {}
+   bool InView(Real cone, Real clock) const
+      { return table->CheckTargetVisibility(cone, clock); }
+private:
+   const FovLookupTable *table;
+};
+
+/// Field-of-view test of a (feasible) point: the spacecraft-to-point vector
+/// rotated to the sensor frame, its cone and clock angles and the sensor test.
+/// OffsetAttitude is false if the nadir-to-body rotation is the identity.
+template <class SensorTest, bool OffsetAttitude>
+class FovKernel
+{
+public:
+   FovKernel(const SensorTest &test, const FovGeometry &geometry) :
+      test(test), geometry(geometry) {}
+
+   /// Is the point (unit position vector, body fixed) in view?
+   bool InView(const Real unitPos[3]) const
+   {
+      const FovGeometry &g = geometry;
+      Real fixedVec[3], nadirVec[3], bodyVec[3], sensorVec[3];
+      for (Integer ii = 0; ii < 3; ii++)
+         fixedVec[ii] = unitPos[ii] * g.radius - g.scPosition[ii];
+      for (Integer ii = 0; ii < 3; ii++)
+         nadirVec[ii] = g.fixedToNadir[3*ii] * fixedVec[0] +
+                        g.fixedToNadir[3*ii + 1] * fixedVec[1] +
+                        g.fixedToNadir[3*ii + 2] * fixedVec[2];
+      for (Integer ii = 0; ii < 3; ii++)
+         bodyVec[ii] = OffsetAttitude ?
+                       g.nadirToBody[3*ii] * nadirVec[0] +
+                       g.nadirToBody[3*ii + 1] * nadirVec[1] +
+                       g.nadirToBody[3*ii + 2] * nadirVec[2] : nadirVec[ii];
+      for (Integer ii = 0; ii < 3; ii++)
+         sensorVec[ii] = g.bodyToSensor[3*ii] * bodyVec[0] +
+                         g.bodyToSensor[3*ii + 1] * bodyVec[1] +
+                         g.bodyToSensor[3*ii + 2] * bodyVec[2];
+
+      // cone and clock angles, as Spacecraft::VectorToConeClock
+      Real mag   = GmatMathUtil::Sqrt(sensorVec[0]*sensorVec[0] +
+                                      sensorVec[1]*sensorVec[1] +
+                                      sensorVec[2]*sensorVec[2]);
+      Real cone  = GmatMathConstants::PI_OVER_TWO -
+                   GmatMathUtil::ASin(sensorVec[2] / mag);
+      Real clock = GmatMathUtil::ATan2(sensorVec[1], sensorVec[0]);
+      while (clock < 0)
+         clock += 2*M_PI;
+      return test.InView(cone, clock);
+   }
+
+private:
+   SensorTest  test;
+   FovGeometry geometry;
+};
+
+/// No sensor: the feasible points are in view
+class NoSensorKernel
+{
+public:
+   bool InView(const Real unitPos[3]) const { return true; }
+};
+
+#endif // CoverageKernels_hpp
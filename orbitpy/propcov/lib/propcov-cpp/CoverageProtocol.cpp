@@ -0,0 +1,358 @@
+//------------------------------------------------------------------------------
+//                           CoverageProtocol
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageProtocol class
+ */
+//------------------------------------------------------------------------------
+#include <cerrno>
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+#include "gmatdefs.hpp"
+#include "CoverageProtocol.hpp"
+#include "TATCException.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const uint32_t CoverageProtocol::MAX_PAYLOAD = 1u << 30;
+
+#ifndef _WIN32
+#ifdef MSG_NOSIGNAL
+static const int SEND_FLAGS = MSG_NOSIGNAL;   // no SIGPIPE if the peer is gone
+#else
+static const int SEND_FLAGS = 0;
+#endif
+
+//------------------------------------------------------------------------------
+// static void WriteAll(int fd, const char *data, size_t size)
+//------------------------------------------------------------------------------
+/**
+ * Writes all the input bytes to a socket.
+ */
+//------------------------------------------------------------------------------
+static void WriteAll(int fd, const char *data, size_t size)
+{
+   while (size > 0)
+   {
+      ssize_t n = send(fd, data, size, SEND_FLAGS);
+      if (n < 0)
+      {
+         if (errno == EINTR)
+            continue;
+         throw TATCException("CoverageProtocol: error writing to the socket\n");
+      }
+      data += n;
+      size -= n;
+   }
+}
+
+//------------------------------------------------------------------------------
+// static bool ReadAll(int fd, char *data, size_t size)
+//------------------------------------------------------------------------------
+/**
+ * Reads the input number of bytes from a socket; returns false if the stream
+ * ends before the first byte.
+ */
+//------------------------------------------------------------------------------
+static bool ReadAll(int fd, char *data, size_t size)
+{
+   size_t done = 0;
+   while (done < size)
+   {
+      ssize_t n = recv(fd, data + done, size - done, 0);
+      if (n < 0)
+      {
+         if (errno == EINTR)
+            continue;
+         throw TATCException("CoverageProtocol: error reading from the socket\n");
+      }
+      if (n == 0)
+      {
+         if (done == 0)
+            return false;
+         throw TATCException("CoverageProtocol: connection closed in the "
+                             "middle of a message\n");
+      }
+      done += n;
+   }
+   return true;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// static void WriteMessage(int fd, uint32_t type,
+//                          const std::vector<char> &payload)
+//------------------------------------------------------------------------------
+/**
+ * Writes a message (header and payload) to a socket.
+ *
+ * @param fd       the socket
+ * @param type     message type
+ * @param payload  the payload
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageProtocol::WriteMessage(int fd, uint32_t type,
+                                    const std::vector<char> &payload)
+{
+#ifndef _WIN32
+   uint32_t header[2] = {type, (uint32_t) payload.size()};
+   WriteAll(fd, (const char*) header, sizeof(header));
+   if (!payload.empty())
+      WriteAll(fd, payload.data(), payload.size());
+#else
+   throw TATCException("CoverageProtocol: not supported on this platform\n");
+#endif
+}
+
+//------------------------------------------------------------------------------
+// static bool ReadMessage(int fd, uint32_t &type, std::vector<char> &payload)
+//------------------------------------------------------------------------------
+/**
+ * Reads a message from a socket.
+ *
+ * @param fd       the socket
+ * @param type     [out] message type
+ * @param payload  [out] the payload
+ *
+ * @return  false if the peer closed the connection (before a new message)
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageProtocol::ReadMessage(int fd, uint32_t &type,
+                                   std::vector<char> &payload)
+{
+#ifndef _WIN32
+   uint32_t header[2];
+   if (!ReadAll(fd, (char*) header, sizeof(header)))
+      return false;
+   if (header[1] > MAX_PAYLOAD)
+      throw TATCException("CoverageProtocol: message too large\n");
+   type = header[0];
+   payload.resize(header[1]);
+   if (header[1] > 0 && !ReadAll(fd, payload.data(), header[1]))
+      throw TATCException("CoverageProtocol: connection closed in the middle "
+                          "of a message\n");
+   return true;
+#else
+   throw TATCException("CoverageProtocol: not supported on this platform\n");
+#endif
+}
+
+//------------------------------------------------------------------------------
+// static void PutInt(std::vector<char> &buf, Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Appends an int32 to a payload.
+ */
+//------------------------------------------------------------------------------
+void CoverageProtocol::PutInt(std::vector<char> &buf, Integer value)
+{
+   Put<int32_t>(buf, value);
+}
+
+//------------------------------------------------------------------------------
+// static void PutReal(std::vector<char> &buf, Real value)
+//------------------------------------------------------------------------------
+/**
+ * Appends a float64 to a payload.
+ */
+//------------------------------------------------------------------------------
+void CoverageProtocol::PutReal(std::vector<char> &buf, Real value)
+{
+   Put<double>(buf, value);
+}
+
+//------------------------------------------------------------------------------
+// static void PutIntArray(std::vector<char> &buf, const IntegerArray &values)
+//------------------------------------------------------------------------------
+/**
+ * Appends an array of int32 (count, then values) to a payload.
+ */
+//------------------------------------------------------------------------------
+void CoverageProtocol::PutIntArray(std::vector<char> &buf,
+                                   const IntegerArray &values)
+{
+   PutInt(buf, values.size());
+   size_t offset = buf.size();
+   buf.resize(offset + values.size() * sizeof(int32_t));
+   for (size_t ii = 0; ii < values.size(); ii++)
+   {
+      int32_t v = values[ii];
+      std::memcpy(buf.data() + offset + ii * sizeof(int32_t), &v,
+                  sizeof(int32_t));
+   }
+}
+
+//------------------------------------------------------------------------------
+// static void PutRealArray(std::vector<char> &buf, const RealArray &values)
+//------------------------------------------------------------------------------
+/**
+ * Appends an array of float64 (count, then values) to a payload.
+ */
+//------------------------------------------------------------------------------
+void CoverageProtocol::PutRealArray(std::vector<char> &buf,
+                                    const RealArray &values)
+{
+   PutInt(buf, values.size());
+   const char *p = (const char*) values.data();
+   buf.insert(buf.end(), p, p + values.size() * sizeof(double));
+}
+
+//------------------------------------------------------------------------------
+// static void PutString(std::vector<char> &buf, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Appends a string (length, then characters) to a payload.
+ */
+//------------------------------------------------------------------------------
+void CoverageProtocol::PutString(std::vector<char> &buf,
+                                 const std::string &value)
+{
+   PutInt(buf, value.size());
+   buf.insert(buf.end(), value.begin(), value.end());
+}
+
+//------------------------------------------------------------------------------
+// static Integer GetInt(const std::vector<char> &buf, size_t &offset)
+//------------------------------------------------------------------------------
+/**
+ * Reads an int32 from a payload.
+ */
+//------------------------------------------------------------------------------
+Integer CoverageProtocol::GetInt(const std::vector<char> &buf, size_t &offset)
+{
+   return Get<int32_t>(buf, offset);
+}
+
+//------------------------------------------------------------------------------
+// static Real GetReal(const std::vector<char> &buf, size_t &offset)
+//------------------------------------------------------------------------------
+/**
+ * Reads a float64 from a payload.
+ */
+//------------------------------------------------------------------------------
+Real CoverageProtocol::GetReal(const std::vector<char> &buf, size_t &offset)
+{
+   return Get<double>(buf, offset);
+}
+
+//------------------------------------------------------------------------------
+// static IntegerArray GetIntArray(const std::vector<char> &buf,
+//                                 size_t &offset)
+//------------------------------------------------------------------------------
+/**
+ * Reads an array of int32 from a payload.
+ */
+//------------------------------------------------------------------------------
+IntegerArray CoverageProtocol::GetIntArray(const std::vector<char> &buf,
+                                           size_t &offset)
+{
+   Integer count = GetInt(buf, offset);
+   if (count < 0 || offset + (size_t) count * sizeof(int32_t) > buf.size())
+      throw TATCException("CoverageProtocol: truncated message\n");
+   IntegerArray values(count);
+   for (Integer ii = 0; ii < count; ii++)
+   {
+      int32_t v;
+      std::memcpy(&v, buf.data() + offset + ii * sizeof(int32_t),
+                  sizeof(int32_t));
+      values[ii] = v;
+   }
+   offset += count * sizeof(int32_t);
+   return values;
+}
+
+//------------------------------------------------------------------------------
+// static RealArray GetRealArray(const std::vector<char> &buf, size_t &offset)
+//------------------------------------------------------------------------------
+/**
+ * Reads an array of float64 from a payload.
+ */
+//------------------------------------------------------------------------------
+RealArray CoverageProtocol::GetRealArray(const std::vector<char> &buf,
+                                         size_t &offset)
+{
+   Integer count = GetInt(buf, offset);
+   if (count < 0 || offset + (size_t) count * sizeof(double) > buf.size())
+      throw TATCException("CoverageProtocol: truncated message\n");
+   RealArray values(count);
+   if (count > 0)
+      std::memcpy(values.data(), buf.data() + offset, count * sizeof(double));
+   offset += count * sizeof(double);
+   return values;
+}
+
+//------------------------------------------------------------------------------
+// static std::string GetString(const std::vector<char> &buf, size_t &offset)
+//------------------------------------------------------------------------------
+/**
+ * Reads a string from a payload.
+ */
+//------------------------------------------------------------------------------
+std::string CoverageProtocol::GetString(const std::vector<char> &buf,
+                                        size_t &offset)
+{
+   Integer count = GetInt(buf, offset);
+   if (count < 0 || offset + count > buf.size())
+      throw TATCException("CoverageProtocol: truncated message\n");
+   std::string value(buf.data() + offset, count);
+   offset += count;
+   return value;
+}
+
+//------------------------------------------------------------------------------
+// static void WriteRequest(std::vector<char> &buf, const CoverageRequest &req)
+//------------------------------------------------------------------------------
+/**
+ * Appends a coverage request to a payload: int32 grid id, int32 sensor type,
+ * float64 array of sensor parameters, float64 epoch, float64 array of the
+ * Keplerian elements, float64 duration, float64 step size.
+ */
+//------------------------------------------------------------------------------
+void CoverageProtocol::WriteRequest(std::vector<char> &buf,
+                                    const CoverageRequest &req)
+{
+   PutInt(buf, req.gridId);
+   PutInt(buf, req.sensorType);
+   PutRealArray(buf, req.sensorParams);
+   PutReal(buf, req.epoch);
+   PutRealArray(buf, req.keplerianState);
+   PutReal(buf, req.duration);
+   PutReal(buf, req.stepSize);
+}
+
+//------------------------------------------------------------------------------
+// static CoverageRequest ReadRequest(const std::vector<char> &buf,
+//                                    size_t &offset)
+//------------------------------------------------------------------------------
+/**
+ * Reads a coverage request from a payload.
+ */
+//------------------------------------------------------------------------------
+CoverageRequest CoverageProtocol::ReadRequest(const std::vector<char> &buf,
+                                              size_t &offset)
+{
+   CoverageRequest req;
+   req.gridId         = GetInt(buf, offset);
+   req.sensorType     = GetInt(buf, offset);
+   req.sensorParams   = GetRealArray(buf, offset);
+   req.epoch          = GetReal(buf, offset);
+   req.keplerianState = GetRealArray(buf, offset);
+   req.duration       = GetReal(buf, offset);
+   req.stepSize       = GetReal(buf, offset);
+   if (req.keplerianState.size() != 6)
+      throw TATCException("CoverageProtocol: the Keplerian state must have 6 "
+                          "elements\n");
+   return req;
+}
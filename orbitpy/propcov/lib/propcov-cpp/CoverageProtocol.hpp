@@ -0,0 +1,136 @@
+//------------------------------------------------------------------------------
+//                           CoverageProtocol
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the binary protocol shared by the CoverageService and the
+ * CoverageClient over a (Unix domain) stream socket.
+ *
+ * Each message is a header of two uint32 values (message type, payload size in
+ * bytes) followed by the payload. All the values are little-endian (native),
+ * with int32 integers and float64 reals; arrays are an int32 count followed by
+ * the values.
+ *
+ * Requests (client to service) and their replies:
+ *  - PING                                 -> PONG
+ *  - REGISTER_GRID: lats, lons (rad)      -> GRID_ID: int32 grid id
+ *    (identical grids get the same id, the grid is built once; the id stays
+ *    valid until the service evicts the grid for its grid limit)
+ *  - COVERAGE: a CoverageRequest (see Write/ReadRequest)
+ *                                         -> BEGIN: int32 numPoints,
+ *                                            int32 numSteps,
+ *                                            then STEPS*, then END
+ *    The run starts at the epoch of the orbit. Each STEPS message holds a
+ *    batch of the steps with coverage (in increasing order), each as int32
+ *    step index, float64 time (JDUT1), int32 array of point indices; the
+ *    steps without coverage are not sent.
+ *  - SHUTDOWN                             -> stops the service (no reply)
+ * Any failed request is answered with ERROR: the message as a string (int32
+ * length followed by the characters).
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageProtocol_hpp
+#define CoverageProtocol_hpp
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "TATCException.hpp"
+
+/// Coverage request: a spacecraft (with an optional sensor) over a grid
+struct CoverageRequest
+{
+   /// id of the (registered) grid
+   Integer     gridId;
+   /// sensor type: 0 none (horizon test only), 1 conical (half angle),
+   /// 2 rectangular (angle height, angle width), 3 custom (the cone angles,
+   /// then as many clock angles); angles in radians
+   Integer     sensorType;
+   RealArray   sensorParams;
+   /// epoch of the orbit (JDUT1)
+   Real        epoch;
+   /// Keplerian elements: SMA (km), ECC, INC, RAAN, AOP, TA (rad)
+   RealArray   keplerianState;
+   /// duration (days) and step size (s) of the run
+   Real        duration;
+   Real        stepSize;
+};
+
+class CoverageProtocol
+{
+public:
+
+   /// message types
+   enum MessageType
+   {
+      PING           = 1,
+      REGISTER_GRID  = 2,
+      COVERAGE       = 3,
+      SHUTDOWN       = 4,
+      PONG           = 101,
+      GRID_ID        = 102,
+      BEGIN          = 103,
+      STEPS          = 104,
+      END            = 105,
+      ERROR          = 199
+   };
+
+   /// sensor types of a CoverageRequest
+   enum SensorType
+   {
+      NO_SENSOR            = 0,
+      CONICAL_SENSOR       = 1,
+      RECTANGULAR_SENSOR   = 2,
+      CUSTOM_SENSOR        = 3
+   };
+
+   /// Write a message to a socket
+   static void    WriteMessage(int fd, uint32_t type,
+                               const std::vector<char> &payload);
+   /// Read a message from a socket; false at the end of the stream
+   static bool    ReadMessage(int fd, uint32_t &type,
+                              std::vector<char> &payload);
+
+   /// Append values to a payload
+   template <typename T>
+   static void    Put(std::vector<char> &buf, T value)
+   {
+      const char *p = (const char*) &value;
+      buf.insert(buf.end(), p, p + sizeof(T));
+   }
+   static void    PutInt(std::vector<char> &buf, Integer value);
+   static void    PutReal(std::vector<char> &buf, Real value);
+   static void    PutIntArray(std::vector<char> &buf, const IntegerArray &values);
+   static void    PutRealArray(std::vector<char> &buf, const RealArray &values);
+   static void    PutString(std::vector<char> &buf, const std::string &value);
+
+   /// Read values from a payload at (and advancing) the input offset
+   template <typename T>
+   static T       Get(const std::vector<char> &buf, size_t &offset)
+   {
+      if (offset + sizeof(T) > buf.size())
+         throw TATCException("CoverageProtocol: truncated message\n");
+      T value;
+      std::memcpy(&value, buf.data() + offset, sizeof(T));
+      offset += sizeof(T);
+      return value;
+   }
+   static Integer       GetInt(const std::vector<char> &buf, size_t &offset);
+   static Real          GetReal(const std::vector<char> &buf, size_t &offset);
+   static IntegerArray  GetIntArray(const std::vector<char> &buf, size_t &offset);
+   static RealArray     GetRealArray(const std::vector<char> &buf, size_t &offset);
+   static std::string   GetString(const std::vector<char> &buf, size_t &offset);
+
+   /// Serialize/deserialize a coverage request
+   static void             WriteRequest(std::vector<char> &buf,
+                                        const CoverageRequest &req);
+   static CoverageRequest  ReadRequest(const std::vector<char> &buf,
+                                       size_t &offset);
+
+   /// largest accepted payload (bytes)
+   static const uint32_t   MAX_PAYLOAD;
+};
+#endif // CoverageProtocol_hpp
@@ -0,0 +1,478 @@
+//------------------------------------------------------------------------------
+//                           CoverageRaster
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageRaster class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include "gmatdefs.hpp"
+#include "CoverageRaster.hpp"
+#include "Profiler.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// file signature and format version of the binary file
+static const char    RASTER_MAGIC[4] = {'P', 'C', 'R', 'S'};
+static const int32_t RASTER_VERSION  = 1;
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageRaster(PointGroup *ptGroup, Real cellSize)
+//------------------------------------------------------------------------------
+/**
+ * Constructor; maps the points of the point group to the raster cells.
+ *
+ * @param ptGroup   pointer to the PointGroup object of the coverage runs
+ * @param cellSize  cell size (deg), 180 deg must be a multiple of it (to
+ *                  within rounding)
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRaster::CoverageRaster(PointGroup *ptGroup, Real cellSize) :
+   CoverageSink   (),
+   cellSize       (cellSize),
+   numRows        (0),
+   numColumns     (0),
+   stepSize       (0.0),
+   numSteps       (0)
+{
+   if (!ptGroup)
+      throw TATCException("CoverageRaster: NULL point group\n");
+   if (cellSize <= 0.0 || cellSize > 180.0)
+      throw TATCException("CoverageRaster: cell size must be in (0, 180] deg\n");
+
+   numRows    = (Integer) std::ceil(180.0 / cellSize - 1.0e-9);
+   numColumns = 2 * numRows;
+   cellNumPoints.assign(numRows * numColumns, 0);
+
+   Integer numPts = ptGroup->GetNumPoints();
+   pointCells.resize(numPts);
+   for (Integer ii = 0; ii < numPts; ii++)
+   {
+      Real lat, lon;
+      ptGroup->GetLatAndLon(ii, lat, lon);
+      lat *= GmatMathConstants::DEG_PER_RAD;
+      lon  = std::fmod(lon * GmatMathConstants::DEG_PER_RAD + 180.0, 360.0);
+      if (lon < 0.0)
+         lon += 360.0;
+      Integer row = std::min(numRows - 1,
+                             std::max(0, (Integer) std::floor((lat + 90.0) / cellSize)));
+      Integer col = std::min(numColumns - 1,
+                             std::max(0, (Integer) std::floor(lon / cellSize)));
+      pointCells[ii] = row * numColumns + col;
+      cellNumPoints[pointCells[ii]]++;
+   }
+   Reset();
+}
+
+//------------------------------------------------------------------------------
+// CoverageRaster(const CoverageRaster &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the CoverageRaster object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRaster::CoverageRaster(const CoverageRaster &copy) :
+   CoverageSink   (copy),
+   cellSize       (copy.cellSize),
+   numRows        (copy.numRows),
+   numColumns     (copy.numColumns),
+   pointCells     (copy.pointCells),
+   cellNumPoints  (copy.cellNumPoints),
+   stepSize       (copy.stepSize),
+   numSteps       (copy.numSteps),
+   accessCounts   (copy.accessCounts),
+   coveredSteps   (copy.coveredSteps),
+   maxGapSteps    (copy.maxGapSteps),
+   firstSteps     (copy.firstSteps),
+   lastSteps      (copy.lastSteps)
+{
+}
+
+//------------------------------------------------------------------------------
+// CoverageRaster& operator=(const CoverageRaster &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for CoverageRaster.
+ *
+ * @param copy  the CoverageRaster object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRaster& CoverageRaster::operator=(const CoverageRaster &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   CoverageSink::operator=(copy);
+   cellSize       = copy.cellSize;
+   numRows        = copy.numRows;
+   numColumns     = copy.numColumns;
+   pointCells     = copy.pointCells;
+   cellNumPoints  = copy.cellNumPoints;
+   stepSize       = copy.stepSize;
+   numSteps       = copy.numSteps;
+   accessCounts   = copy.accessCounts;
+   coveredSteps   = copy.coveredSteps;
+   maxGapSteps    = copy.maxGapSteps;
+   firstSteps     = copy.firstSteps;
+   lastSteps      = copy.lastSteps;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageRaster()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRaster::~CoverageRaster()
+{
+}
+
+//------------------------------------------------------------------------------
+// void BeginRun(Integer numPoints, Real startJd, Real stepSize,
+//               Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Prepares the raster for a run (the statistics are reset).
+ *
+ * @param numPoints  number of points of the coverage grid
+ * @param startJd    time of the first step (JDUT1)
+ * @param stepSize   step size (s)
+ * @param numSteps   number of steps of the run
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRaster::BeginRun(Integer numPoints, Real startJd, Real stepSize,
+                              Integer numSteps)
+{
+   if (numPoints != (Integer) pointCells.size())
+      throw TATCException("CoverageRaster: the run point group does not match "
+                          "the raster point group\n");
+   this->stepSize = stepSize;
+   this->numSteps = numSteps;
+   Reset();
+}
+
+//------------------------------------------------------------------------------
+// void ProcessStep(Integer stepIndex, Real jd,
+//                  const IntegerArray &coveredPoints)
+//------------------------------------------------------------------------------
+/**
+ * Accumulates the covered points of a step onto the raster. The steps must be
+ * processed in increasing order.
+ *
+ * @param stepIndex      index of the step
+ * @param jd             time of the step (JDUT1)
+ * @param coveredPoints  indices of the points covered at the step
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRaster::ProcessStep(Integer stepIndex, Real jd,
+                                 const IntegerArray &coveredPoints)
+{
+   Profiler::Scope timer(Profiler::INTERVAL_BUILDING);
+   Integer numPts = pointCells.size();
+   for (Integer ii = 0; ii < (Integer) coveredPoints.size(); ii++)
+   {
+      Integer pt = coveredPoints[ii];
+      if (pt < 0 || pt >= numPts)
+         throw TATCException("CoverageRaster: point index out of range\n");
+      Integer cell = pointCells[pt];
+      Integer last = lastSteps[cell];
+      if (last >= stepIndex)
+      {
+         if (last == stepIndex)
+            continue;   // cell already counted at this step
+         throw TATCException("CoverageRaster: steps must be processed in "
+                             "increasing order\n");
+      }
+      if (last < 0)
+      {
+         firstSteps[cell] = stepIndex;
+         accessCounts[cell]++;
+      }
+      else if (last < stepIndex - 1)
+      {
+         accessCounts[cell]++;
+         maxGapSteps[cell] = std::max(maxGapSteps[cell], stepIndex - last - 1);
+      }
+      coveredSteps[cell]++;
+      lastSteps[cell] = stepIndex;
+   }
+}
+
+//------------------------------------------------------------------------------
+// CoverageSink* CreatePartial() const
+//------------------------------------------------------------------------------
+/**
+ * Creates an empty raster with the same cells and run parameters.
+ *
+ * @return  the new partial raster (owned by the caller)
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageSink* CoverageRaster::CreatePartial() const
+{
+   CoverageRaster *partial = new CoverageRaster(*this);
+   partial->Reset();
+   return partial;
+}
+
+//------------------------------------------------------------------------------
+// void MergePartial(const CoverageSink &partial)
+//------------------------------------------------------------------------------
+/**
+ * Merges a partial raster which accumulated the steps following those of this
+ * raster.
+ *
+ * @param partial  the partial raster
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRaster::MergePartial(const CoverageSink &partial)
+{
+   const CoverageRaster *other = dynamic_cast<const CoverageRaster*>(&partial);
+   if (!other || other->pointCells.size() != pointCells.size() ||
+       other->numRows != numRows || other->numColumns != numColumns)
+      throw TATCException("CoverageRaster: incompatible partial raster\n");
+
+   for (Integer cell = 0; cell < numRows * numColumns; cell++)
+   {
+      if (other->firstSteps[cell] < 0)
+         continue;
+      Integer last = lastSteps[cell];
+      if (last >= other->firstSteps[cell])
+         throw TATCException("CoverageRaster: partial rasters must be merged "
+                             "in step order\n");
+      accessCounts[cell] += other->accessCounts[cell];
+      coveredSteps[cell] += other->coveredSteps[cell];
+      maxGapSteps[cell]   = std::max(maxGapSteps[cell], other->maxGapSteps[cell]);
+      if (last < 0)
+         firstSteps[cell] = other->firstSteps[cell];
+      else if (last == other->firstSteps[cell] - 1)
+         accessCounts[cell]--;   // access continuing across the two ranges
+      else
+         maxGapSteps[cell] = std::max(maxGapSteps[cell],
+                                      other->firstSteps[cell] - last - 1);
+      lastSteps[cell] = other->lastSteps[cell];
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Clears the accumulated statistics.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRaster::Reset()
+{
+   Integer numCells = numRows * numColumns;
+   accessCounts.assign(numCells, 0);
+   coveredSteps.assign(numCells, 0);
+   maxGapSteps.assign(numCells, 0);
+   firstSteps.assign(numCells, -1);
+   lastSteps.assign(numCells, -1);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumRows() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of rows (latitude bands) of the raster.
+ *
+ * @return  number of rows
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageRaster::GetNumRows() const
+{
+   return numRows;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumColumns() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of columns (longitude bands) of the raster.
+ *
+ * @return  number of columns
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageRaster::GetNumColumns() const
+{
+   return numColumns;
+}
+
+//------------------------------------------------------------------------------
+// Real GetCellSize() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the cell size.
+ *
+ * @return  cell size (deg)
+ *
+ */
+//------------------------------------------------------------------------------
+Real CoverageRaster::GetCellSize() const
+{
+   return cellSize;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetCellIndex(Integer pointIndex) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the cell of a grid point.
+ *
+ * @param pointIndex  index of the point
+ *
+ * @return  cell index (row*numColumns + column)
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageRaster::GetCellIndex(Integer pointIndex) const
+{
+   if (pointIndex < 0 || pointIndex >= (Integer) pointCells.size())
+      throw TATCException("CoverageRaster: point index out of range\n");
+   return pointCells[pointIndex];
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray GetNumPointsPerCell() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of grid points of each cell (e.g. to mask the cells
+ * without points).
+ *
+ * @return  number of points per cell (row-major)
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray CoverageRaster::GetNumPointsPerCell() const
+{
+   return cellNumPoints;
+}
+
+//------------------------------------------------------------------------------
+// const IntegerArray& GetAccessCounts() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of accesses of each cell.
+ *
+ * @return  number of accesses per cell (row-major)
+ *
+ */
+//------------------------------------------------------------------------------
+const IntegerArray& CoverageRaster::GetAccessCounts() const
+{
+   return accessCounts;
+}
+
+//------------------------------------------------------------------------------
+// RealArray GetDwellTimes() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the dwell time of each cell.
+ *
+ * @return  dwell time per cell (s, row-major)
+ *
+ */
+//------------------------------------------------------------------------------
+RealArray CoverageRaster::GetDwellTimes() const
+{
+   RealArray dwell(coveredSteps.size());
+   for (Integer ii = 0; ii < (Integer) coveredSteps.size(); ii++)
+      dwell[ii] = coveredSteps[ii] * stepSize;
+   return dwell;
+}
+
+//------------------------------------------------------------------------------
+// RealArray GetMaxGaps() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the maximum gap between two accesses of each cell (0 for cells
+ * with less than two accesses).
+ *
+ * @return  maximum gap per cell (s, row-major)
+ *
+ */
+//------------------------------------------------------------------------------
+RealArray CoverageRaster::GetMaxGaps() const
+{
+   RealArray gaps(maxGapSteps.size());
+   for (Integer ii = 0; ii < (Integer) maxGapSteps.size(); ii++)
+      gaps[ii] = maxGapSteps[ii] * stepSize;
+   return gaps;
+}
+
+//------------------------------------------------------------------------------
+// void Write(const std::string &filename) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the raster to a flat binary file (see the class description for the
+ * format).
+ *
+ * @param filename  name of the file
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRaster::Write(const std::string &filename) const
+{
+   Profiler::Scope timer(Profiler::OUTPUT);
+   std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+   if (!out)
+      throw TATCException("CoverageRaster: unable to open " + filename +
+                          " for writing\n");
+
+   int32_t dims[2]  = {numRows, numColumns};
+   double  sizes[2] = {cellSize, stepSize};
+   int32_t nSteps   = numSteps;
+   out.write(RASTER_MAGIC, 4);
+   out.write((const char*) &RASTER_VERSION, sizeof(int32_t));
+   out.write((const char*) dims, sizeof(dims));
+   out.write((const char*) sizes, sizeof(sizes));
+   out.write((const char*) &nSteps, sizeof(int32_t));
+
+   Integer numCells = numRows * numColumns;
+   std::vector<int32_t> ints(numCells);
+   std::vector<double>  reals(numCells);
+   for (Integer ii = 0; ii < numCells; ii++)
+      ints[ii] = cellNumPoints[ii];
+   out.write((const char*) ints.data(), numCells * sizeof(int32_t));
+   for (Integer ii = 0; ii < numCells; ii++)
+      ints[ii] = accessCounts[ii];
+   out.write((const char*) ints.data(), numCells * sizeof(int32_t));
+   for (Integer ii = 0; ii < numCells; ii++)
+      reals[ii] = coveredSteps[ii] * stepSize;
+   out.write((const char*) reals.data(), numCells * sizeof(double));
+   for (Integer ii = 0; ii < numCells; ii++)
+      reals[ii] = maxGapSteps[ii] * stepSize;
+   out.write((const char*) reals.data(), numCells * sizeof(double));
+   if (!out)
+      throw TATCException("CoverageRaster: error writing " + filename + "\n");
+   Profiler::AddCount(Profiler::BYTES_WRITTEN, out.tellp());
+}
@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+//                           CoverageRaster
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageRaster class, a CoverageSink accumulating coverage
+ * statistics on a regular latitude/longitude raster instead of per point.
+ *
+ * The raster spans latitudes [-90, 90] deg and longitudes [-180, 180) deg with
+ * square cells of the input size; row 0 is the southernmost row and column 0
+ * starts at longitude -180 deg. Each grid point is mapped to its cell once, at
+ * construction. A cell is covered at a step if any of its points is covered.
+ * Per cell the raster accumulates:
+ *  - the number of accesses (maximal runs of consecutive covered steps),
+ *  - the dwell time, i.e. the number of covered steps times the step size (s),
+ *  - the maximum gap between two accesses (s), as the number of uncovered steps
+ *    between them times the step size.
+ *
+ * For multi-threaded runs each thread accumulates a contiguous range of steps in
+ * a partial raster; the partial rasters are merged in step order (the first and
+ * last covered steps of each cell are kept, so accesses and gaps spanning two
+ * ranges are merged exactly).
+ *
+ * The raster is written as a flat binary file (little-endian):
+ *    char[4]  magic "PCRS"
+ *    int32    version
+ *    int32    number of rows, int32 number of columns
+ *    float64  cell size (deg), float64 step size (s)
+ *    int32    number of steps of the run
+ *    then, each as a row-major array of rows*columns values:
+ *    int32    number of grid points in the cell
+ *    int32    number of accesses
+ *    float64  dwell time (s)
+ *    float64  maximum gap (s)
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageRaster_hpp
+#define CoverageRaster_hpp
+
+#include <string>
+#include "gmatdefs.hpp"
+#include "PointGroup.hpp"
+#include "CoverageSink.hpp"
+
+class CoverageRaster : public CoverageSink
+{
+public:
+
+   /// class construction/destruction
+   CoverageRaster(PointGroup *ptGroup, Real cellSize);
+   CoverageRaster(const CoverageRaster &copy);
+   CoverageRaster& operator=(const CoverageRaster &copy);
+
+   virtual ~CoverageRaster();
+
+   /// CoverageSink interface
+   virtual void            BeginRun(Integer numPoints, Real startJd,
+                                    Real stepSize, Integer numSteps);
+   virtual void            ProcessStep(Integer stepIndex, Real jd,
+                                       const IntegerArray &coveredPoints);
+   virtual CoverageSink*   CreatePartial() const;
+   virtual void            MergePartial(const CoverageSink &partial);
+
+   /// Clear the accumulated statistics
+   void                    Reset();
+
+   /// Get the raster dimensions and cell size (deg)
+   Integer                 GetNumRows() const;
+   Integer                 GetNumColumns() const;
+   Real                    GetCellSize() const;
+   /// Get the cell (row*numColumns + column) of a grid point
+   Integer                 GetCellIndex(Integer pointIndex) const;
+   /// Get the per-cell statistics (row-major)
+   IntegerArray            GetNumPointsPerCell() const;
+   const IntegerArray&     GetAccessCounts() const;
+   RealArray               GetDwellTimes() const;
+   RealArray               GetMaxGaps() const;
+
+   /// Write the raster to a flat binary file
+   void                    Write(const std::string &filename) const;
+
+protected:
+
+   /// cell size (deg)
+   Real                    cellSize;
+   /// number of rows (latitude) and columns (longitude)
+   Integer                 numRows;
+   Integer                 numColumns;
+   /// cell of each grid point
+   IntegerArray            pointCells;
+   /// number of grid points of each cell
+   IntegerArray            cellNumPoints;
+   /// step size of the run (s) and number of steps
+   Real                    stepSize;
+   Integer                 numSteps;
+
+   /// per-cell statistics (in steps)
+   IntegerArray            accessCounts;
+   IntegerArray            coveredSteps;
+   IntegerArray            maxGapSteps;
+   /// first and last covered steps of each cell (-1 if none)
+   IntegerArray            firstSteps;
+   IntegerArray            lastSteps;
+};
+#endif // CoverageRaster_hpp
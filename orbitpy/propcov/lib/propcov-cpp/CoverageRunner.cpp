@@ -0,0 +1,331 @@
+//------------------------------------------------------------------------------
+//                           CoverageRunner
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageRunner class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "CoverageRunner.hpp"
+#include "CompiledScenario.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_COVERAGE_RUNNER
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageRunner(PointGroup *ptGroup, Spacecraft *sat)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param ptGroup  pointer to the PointGroup object to use
+ * @param sat      pointer to the Spacecraft object to use
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRunner::CoverageRunner(PointGroup *ptGroup, Spacecraft *sat) :
+   pointGroup     (ptGroup),
+   sc             (sat),
+   numThreads     (1),
+   singlePrecision(false)
+{
+   if (!pointGroup || !sc)
+      throw TATCException("CoverageRunner: NULL point group or spacecraft\n");
+}
+
+//------------------------------------------------------------------------------
+// CoverageRunner(const CoverageRunner &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the CoverageRunner object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRunner::CoverageRunner(const CoverageRunner &copy) :
+   pointGroup     (copy.pointGroup),
+   sc             (copy.sc),
+   numThreads     (copy.numThreads),
+   singlePrecision(copy.singlePrecision)
+{
+}
+
+//------------------------------------------------------------------------------
+// CoverageRunner& operator=(const CoverageRunner &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for CoverageRunner.
+ *
+ * @param copy  the CoverageRunner object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRunner& CoverageRunner::operator=(const CoverageRunner &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   pointGroup  = copy.pointGroup;
+   sc          = copy.sc;
+   numThreads  = copy.numThreads;
+   singlePrecision = copy.singlePrecision;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageRunner()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageRunner::~CoverageRunner()
+{
+}
+
+//------------------------------------------------------------------------------
+// void SetNumThreads(Integer nThreads)
+//------------------------------------------------------------------------------
+/**
+ * Sets the number of worker threads.
+ *
+ * @param nThreads  number of threads (0 for the hardware concurrency)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRunner::SetNumThreads(Integer nThreads)
+{
+   if (nThreads < 0)
+      throw TATCException("CoverageRunner: number of threads must be "
+                          "non-negative\n");
+   numThreads = nThreads;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumThreads() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of worker threads.
+ *
+ * @return  number of threads (0 for the hardware concurrency)
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageRunner::GetNumThreads() const
+{
+   return numThreads;
+}
+
+//------------------------------------------------------------------------------
+// void SetSinglePrecision(bool single)
+//------------------------------------------------------------------------------
+/**
+ * Sets the single precision feasibility mode of the coverage checkers of the
+ * runs (see CoverageChecker::SetSinglePrecision).
+ *
+ * @param single  use the single precision feasibility test?
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRunner::SetSinglePrecision(bool single)
+{
+   singlePrecision = single;
+}
+
+//------------------------------------------------------------------------------
+// bool GetSinglePrecision() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the single precision feasibility mode of the runs.
+ *
+ * @return  true if the single precision feasibility test is used
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageRunner::GetSinglePrecision() const
+{
+   return singlePrecision;
+}
+
+//------------------------------------------------------------------------------
+// static Integer GetNumSteps(Real startJd, Real duration, Real stepSize)
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of steps of a run, i.e. the number of step times
+ * startJd + k*stepSize before startJd + duration.
+ *
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration (days)
+ * @param stepSize  step size (s)
+ *
+ * @return  number of steps
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageRunner::GetNumSteps(Real startJd, Real duration, Real stepSize)
+{
+   if (stepSize <= 0.0)
+      throw TATCException("CoverageRunner: step size must be positive\n");
+   Real    endJd    = startJd + duration;
+   Real    stepDays = stepSize / GmatTimeConstants::SECS_PER_DAY;
+   Integer numSteps = 0;
+   while (startJd + numSteps * stepDays < endJd)
+      numSteps++;
+   return numSteps;
+}
+
+//------------------------------------------------------------------------------
+// Integer Run(CoverageSink &sink, Real startJd, Real duration,
+//             Real stepSize)
+//------------------------------------------------------------------------------
+/**
+ * Runs the coverage loop and feeds the results to the sink.
+ *
+ * @param sink      the sink
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration (days)
+ * @param stepSize  step size (s)
+ *
+ * @return  number of steps
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageRunner::Run(CoverageSink &sink, Real startJd, Real duration,
+                            Real stepSize)
+{
+   Integer numSteps = GetNumSteps(startJd, duration, stepSize);
+   // snapshot shared by all the threads
+   CompiledScenario scenario(pointGroup, sc);
+   sink.BeginRun(pointGroup->GetNumPoints(), startJd, stepSize, numSteps);
+
+   Integer nThreads = numThreads;
+   if (nThreads == 0)
+      nThreads = std::max(1u, std::thread::hardware_concurrency());
+   nThreads = std::min(nThreads, numSteps);
+
+   std::vector<CoverageSink*> partials;
+   if (nThreads > 1)
+   {
+      for (Integer tt = 0; tt < nThreads; tt++)
+      {
+         CoverageSink *partial = sink.CreatePartial();
+         if (!partial)
+            break;
+         partials.push_back(partial);
+      }
+      if ((Integer) partials.size() < nThreads)
+      {
+         for (Integer tt = 0; tt < (Integer) partials.size(); tt++)
+            delete partials[tt];
+         partials.clear();
+         nThreads = 1;
+      }
+   }
+
+   #ifdef DEBUG_COVERAGE_RUNNER
+      MessageInterface::ShowMessage("CoverageRunner: %d steps on %d threads\n",
+                                    numSteps, nThreads);
+   #endif
+
+   if (nThreads <= 1)
+   {
+      RunSteps(&sink, scenario, startJd, stepSize, 0, numSteps);
+      sink.EndRun();
+      return numSteps;
+   }
+
+   // contiguous step ranges, one per thread
+   std::vector<std::thread>        threads;
+   std::vector<std::exception_ptr> errors(nThreads);
+   for (Integer tt = 0; tt < nThreads; tt++)
+   {
+      Integer first = (Integer) (((long long) numSteps * tt) / nThreads);
+      Integer last  = (Integer) (((long long) numSteps * (tt + 1)) / nThreads);
+      threads.push_back(std::thread([this, &scenario, &partials, &errors, tt,
+                                     startJd, stepSize, first, last]()
+      {
+         try
+         {
+            RunSteps(partials[tt], scenario, startJd, stepSize, first,
+                     last);
+         }
+         catch (...)
+         {
+            errors[tt] = std::current_exception();
+         }
+      }));
+   }
+   for (Integer tt = 0; tt < nThreads; tt++)
+      threads[tt].join();
+
+   std::exception_ptr error;
+   for (Integer tt = 0; tt < nThreads; tt++)
+   {
+      if (!error && errors[tt])
+         error = errors[tt];
+      if (!error)
+         sink.MergePartial(*partials[tt]);
+      delete partials[tt];
+   }
+   if (error)
+      std::rethrow_exception(error);
+
+   sink.EndRun();
+   return numSteps;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void RunSteps(CoverageSink *sink, const CompiledScenario &scenario,
+//               Real startJd, Real stepSize, Integer firstStep,
+//               Integer lastStep)
+//------------------------------------------------------------------------------
+/**
+ * Runs the steps [firstStep, lastStep) with an evaluator of the scenario.
+ *
+ * @param sink       the (partial) sink
+ * @param scenario   the snapshot of the points and spacecraft
+ * @param startJd    start time of the run (JDUT1)
+ * @param stepSize   step size (s)
+ * @param firstStep  first step
+ * @param lastStep   step after the last step
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageRunner::RunSteps(CoverageSink *sink,
+                              const CompiledScenario &scenario, Real startJd,
+                              Real stepSize, Integer firstStep,
+                              Integer lastStep)
+{
+   ScenarioEvaluator evaluator(&scenario);
+   evaluator.SetSinglePrecision(singlePrecision);
+   Real              stepDays = stepSize / GmatTimeConstants::SECS_PER_DAY;
+   IntegerArray      covered;  // reused by the steps
+
+   for (Integer step = firstStep; step < lastStep; step++)
+   {
+      Real     jd   = startJd + step * stepDays;
+      Rvector6 cart = evaluator.GetCartesianState(jd);
+      sink->ProcessState(step, jd, cart);
+      evaluator.CheckPointCoverageInto(jd, cart, covered);
+      sink->ProcessStep(step, jd, covered);
+   }
+}
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+//                           CoverageRunner
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageRunner class, which runs the coverage loop of a
+ * spacecraft over a point group (propagate, check the point coverage) and feeds
+ * the per-step results to a CoverageSink.
+ *
+ * The step times are startJd + k*stepSize (k = 0, 1, ...) for all the times
+ * before startJd + duration. Each run compiles a snapshot of the points and
+ * spacecraft (CompiledScenario), so the inputs are not modified, and changes
+ * made to them during the run have no effect. With more than one thread (and a
+ * sink supporting partial accumulation) the steps are split in contiguous
+ * ranges, one per thread, each thread sharing the snapshot with its own
+ * evaluator and partial sink. Since the propagator is analytical, the
+ * results do not depend on the number of threads.
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageRunner_hpp
+#define CoverageRunner_hpp
+
+#include "gmatdefs.hpp"
+#include "PointGroup.hpp"
+#include "Spacecraft.hpp"
+#include "CoverageSink.hpp"
+#include "CompiledScenario.hpp"
+
+class CoverageRunner
+{
+public:
+
+   /// class construction/destruction
+   CoverageRunner(PointGroup *ptGroup, Spacecraft *sat);
+   CoverageRunner(const CoverageRunner &copy);
+   CoverageRunner& operator=(const CoverageRunner &copy);
+
+   virtual ~CoverageRunner();
+
+   /// Set/get the number of worker threads (0 for the hardware concurrency)
+   void              SetNumThreads(Integer nThreads);
+   Integer           GetNumThreads() const;
+   /// Set/get the single precision feasibility mode of the coverage checkers
+   void              SetSinglePrecision(bool single);
+   bool              GetSinglePrecision() const;
+
+   /// Get the number of steps of a run
+   static Integer    GetNumSteps(Real startJd, Real duration, Real stepSize);
+   /// Run the coverage loop and return the number of steps
+   virtual Integer   Run(CoverageSink &sink, Real startJd, Real duration,
+                         Real stepSize);
+
+protected:
+
+   /// the points to use for coverage
+   PointGroup        *pointGroup;
+   /// the spacecraft (only snapshots of it are propagated)
+   Spacecraft        *sc;
+   /// number of worker threads
+   Integer           numThreads;
+   /// use the single precision feasibility test?
+   bool              singlePrecision;
+
+   /// Run the steps [firstStep, lastStep) of a run on the scenario
+   virtual void      RunSteps(CoverageSink *sink,
+                              const CompiledScenario &scenario, Real startJd,
+                              Real stepSize, Integer firstStep,
+                              Integer lastStep);
+};
+#endif // CoverageRunner_hpp
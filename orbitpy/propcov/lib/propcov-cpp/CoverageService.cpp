@@ -0,0 +1,740 @@
+//------------------------------------------------------------------------------
+//                           CoverageService
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageService class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <cerrno>
+#include <thread>
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+#include "gmatdefs.hpp"
+#include "CoverageService.hpp"
+#include "CoverageRunner.hpp"
+#include "Propagator.hpp"
+#include "GmatConstants.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "GMATCustomSensor.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_COVERAGE_SERVICE
+
+/// size (bytes) above which a batch of steps is sent
+static const size_t STEPS_BATCH_SIZE = 65536;
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Integer CoverageService::DEFAULT_MAX_GRIDS = 32;
+
+//------------------------------------------------------------------------------
+// static uint64_t HashBytes(const char *data, size_t size, uint64_t hash)
+//------------------------------------------------------------------------------
+/**
+ * FNV-1a hash of a byte range, continuing from the input hash.
+ */
+//------------------------------------------------------------------------------
+static uint64_t HashBytes(const char *data, size_t size,
+                          uint64_t hash = 14695981039346656037ULL)
+{
+   for (size_t ii = 0; ii < size; ii++)
+   {
+      hash ^= (unsigned char) data[ii];
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageService(const std::string &socketPath)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param socketPath  path of the Unix domain socket
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageService::CoverageService(const std::string &socketPath) :
+   socketPath        (socketPath),
+   listenFd          (-1),
+   running           (false),
+   nextGridId        (0),
+   useCounter        (0),
+   maxGrids          (DEFAULT_MAX_GRIDS),
+   numEvictedGrids   (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageService()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; closes the socket and deletes the cached grids and contexts.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageService::~CoverageService()
+{
+   Stop();
+#ifndef _WIN32
+   if (listenFd >= 0)
+   {
+      close(listenFd);
+      unlink(socketPath.c_str());
+   }
+#endif
+   for (Integer ii = 0; ii < (Integer) contexts.size(); ii++)
+      DeleteContext(contexts[ii]);
+   for (std::map<Integer, Grid>::iterator it = grids.begin();
+        it != grids.end(); ++it)
+      delete it->second.pointGroup;
+}
+
+//------------------------------------------------------------------------------
+// void Start()
+//------------------------------------------------------------------------------
+/**
+ * Creates the socket, binds it to the socket path (removing an existing
+ * socket file) and starts listening.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::Start()
+{
+#ifndef _WIN32
+   if (listenFd >= 0)
+      throw TATCException("CoverageService: the service is already started\n");
+   struct sockaddr_un addr;
+   if (socketPath.size() >= sizeof(addr.sun_path))
+      throw TATCException("CoverageService: the socket path is too long\n");
+   std::memset(&addr, 0, sizeof(addr));
+   addr.sun_family = AF_UNIX;
+   std::strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+
+   int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+   if (fd < 0)
+      throw TATCException("CoverageService: cannot create the socket\n");
+   unlink(socketPath.c_str());
+   if (bind(fd, (struct sockaddr*) &addr, sizeof(addr)) < 0 ||
+       listen(fd, 16) < 0)
+   {
+      close(fd);
+      throw TATCException("CoverageService: cannot listen on " + socketPath +
+                          "\n");
+   }
+   listenFd = fd;
+   running  = true;
+#else
+   throw TATCException("CoverageService: not supported on this platform\n");
+#endif
+}
+
+//------------------------------------------------------------------------------
+// void Serve()
+//------------------------------------------------------------------------------
+/**
+ * Accepts the connections, each served by its own thread, until the service
+ * is stopped; then waits for the open connections to be closed.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::Serve()
+{
+#ifndef _WIN32
+   if (listenFd < 0)
+      throw TATCException("CoverageService: the service is not started\n");
+   while (running)
+   {
+      int fd = accept(listenFd, NULL, NULL);
+      if (fd < 0)
+      {
+         if (errno == EINTR || errno == ECONNABORTED)
+            continue;
+         break;   // the listening socket was shut down
+      }
+      std::lock_guard<std::mutex> lock(connMutex);
+      if (!running)
+      {
+         close(fd);
+         break;
+      }
+      clientFds.insert(fd);
+      std::thread(&CoverageService::HandleConnection, this, fd).detach();
+   }
+   running = false;
+
+   std::unique_lock<std::mutex> lock(connMutex);
+   connDone.wait(lock, [this] { return clientFds.empty(); });
+#else
+   throw TATCException("CoverageService: not supported on this platform\n");
+#endif
+}
+
+//------------------------------------------------------------------------------
+// void Stop()
+//------------------------------------------------------------------------------
+/**
+ * Stops the service: the accept loop of Serve() ends and the open connections
+ * are shut down (a request in progress ends with a write error).
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::Stop()
+{
+#ifndef _WIN32
+   std::lock_guard<std::mutex> lock(connMutex);
+   running = false;
+   if (listenFd >= 0)
+      shutdown(listenFd, SHUT_RDWR);
+   for (std::set<int>::iterator it = clientFds.begin(); it != clientFds.end();
+        ++it)
+      shutdown(*it, SHUT_RDWR);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// bool IsRunning() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true while the service accepts connections.
+ */
+//------------------------------------------------------------------------------
+bool CoverageService::IsRunning() const
+{
+   return running;
+}
+
+//------------------------------------------------------------------------------
+// const std::string& GetSocketPath() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the path of the socket.
+ */
+//------------------------------------------------------------------------------
+const std::string& CoverageService::GetSocketPath() const
+{
+   return socketPath;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumCachedGrids()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of cached (registered and not evicted) grids.
+ */
+//------------------------------------------------------------------------------
+Integer CoverageService::GetNumCachedGrids()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return grids.size();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumCachedContexts()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of cached coverage contexts (idle or in use).
+ */
+//------------------------------------------------------------------------------
+Integer CoverageService::GetNumCachedContexts()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return contexts.size();
+}
+
+//------------------------------------------------------------------------------
+// void SetMaxCachedGrids(Integer maxGrids)
+//------------------------------------------------------------------------------
+/**
+ * Sets the largest number of cached grids (applied at the next registration
+ * of a new grid).
+ *
+ * @param maxGrids  the limit (at least 1)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::SetMaxCachedGrids(Integer maxGrids)
+{
+   if (maxGrids < 1)
+      throw TATCException("CoverageService: the grid limit must be at "
+                          "least 1\n");
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   this->maxGrids = maxGrids;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetMaxCachedGrids()
+//------------------------------------------------------------------------------
+/**
+ * Returns the largest number of cached grids.
+ */
+//------------------------------------------------------------------------------
+Integer CoverageService::GetMaxCachedGrids()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return maxGrids;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumEvictedGrids()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of grids evicted for the grid limit.
+ */
+//------------------------------------------------------------------------------
+Integer CoverageService::GetNumEvictedGrids()
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   return numEvictedGrids;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void HandleConnection(int fd)
+//------------------------------------------------------------------------------
+/**
+ * Serves the requests of a connection until the client closes it or the
+ * service is stopped.
+ *
+ * @param fd  the connected socket
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::HandleConnection(int fd)
+{
+#ifndef _WIN32
+   try
+   {
+      uint32_t          type;
+      std::vector<char> payload;
+      while (CoverageProtocol::ReadMessage(fd, type, payload))
+         HandleRequest(fd, type, payload);
+   }
+   catch (BaseException &be)
+   {
+      // broken connection: nothing can be sent back
+      #ifdef DEBUG_COVERAGE_SERVICE
+         MessageInterface::ShowMessage("CoverageService: %s",
+                                       be.GetFullMessage().c_str());
+      #endif
+   }
+   catch (...)
+   {
+      // any other failure also drops the connection
+   }
+   close(fd);
+
+   std::lock_guard<std::mutex> lock(connMutex);
+   clientFds.erase(fd);
+   connDone.notify_all();
+#endif
+}
+
+//------------------------------------------------------------------------------
+// void HandleRequest(int fd, uint32_t type, const std::vector<char> &payload)
+//------------------------------------------------------------------------------
+/**
+ * Serves one request; a failed request is answered with an ERROR message.
+ *
+ * @param fd       the connected socket
+ * @param type     message type
+ * @param payload  the payload
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::HandleRequest(int fd, uint32_t type,
+                                    const std::vector<char> &payload)
+{
+   std::vector<char> reply;
+   try
+   {
+      size_t offset = 0;
+      switch (type)
+      {
+      case CoverageProtocol::PING:
+         CoverageProtocol::WriteMessage(fd, CoverageProtocol::PONG, reply);
+         break;
+      case CoverageProtocol::REGISTER_GRID:
+         {
+            RealArray lats = CoverageProtocol::GetRealArray(payload, offset);
+            RealArray lons = CoverageProtocol::GetRealArray(payload, offset);
+            CoverageProtocol::PutInt(reply, RegisterGrid(lats, lons));
+            CoverageProtocol::WriteMessage(fd, CoverageProtocol::GRID_ID,
+                                           reply);
+         }
+         break;
+      case CoverageProtocol::COVERAGE:
+         RunCoverage(fd, CoverageProtocol::ReadRequest(payload, offset));
+         break;
+      case CoverageProtocol::SHUTDOWN:
+         Stop();
+         break;
+      default:
+         throw TATCException("CoverageService: unknown request type\n");
+      }
+   }
+   catch (BaseException &be)
+   {
+      reply.clear();
+      CoverageProtocol::PutString(reply, be.GetFullMessage());
+      CoverageProtocol::WriteMessage(fd, CoverageProtocol::ERROR, reply);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Integer RegisterGrid(const RealArray &lats, const RealArray &lons)
+//------------------------------------------------------------------------------
+/**
+ * Returns the id of a grid, building its PointGroup if the grid is new (and
+ * evicting the least recently used grids beyond the grid limit).
+ *
+ * @param lats  latitudes of the points (rad)
+ * @param lons  longitudes of the points (rad)
+ *
+ * @return  the grid id
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageService::RegisterGrid(const RealArray &lats,
+                                      const RealArray &lons)
+{
+   if (lats.size() != lons.size() || lats.empty())
+      throw TATCException("CoverageService: the grid latitudes and longitudes "
+                          "must be non-empty arrays of the same size\n");
+   uint64_t hash = HashBytes((const char*) lats.data(),
+                             lats.size() * sizeof(Real));
+   hash = HashBytes((const char*) lons.data(), lons.size() * sizeof(Real),
+                    hash);
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   IntegerArray &candidates = gridsByHash[hash];
+   for (Integer ii = 0; ii < (Integer) candidates.size(); ii++)
+   {
+      Grid &g = grids[candidates[ii]];
+      if (g.lats == lats && g.lons == lons)
+      {
+         g.lastUsed = ++useCounter;
+         return candidates[ii];
+      }
+   }
+
+   Integer id = nextGridId++;
+   Grid &g    = grids[id];
+   g.lats       = lats;
+   g.lons       = lons;
+   g.pointGroup = new PointGroup();
+   g.pointGroup->AddUserDefinedPoints(lats, lons);
+   g.hash       = hash;
+   g.lastUsed   = ++useCounter;
+   g.numInUse   = 0;
+   candidates.push_back(id);
+   EvictGrids(id);
+   return id;
+}
+
+//------------------------------------------------------------------------------
+// void EvictGrids(Integer keepId)
+//------------------------------------------------------------------------------
+/**
+ * Deletes the least recently used grids, with their (idle) contexts, until
+ * the grids fit in the grid limit. The grids on which a request is running
+ * and the input grid (just registered) are kept. Called with cacheMutex
+ * locked.
+ *
+ * @param keepId  id of the grid to keep
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::EvictGrids(Integer keepId)
+{
+   while ((Integer) grids.size() > maxGrids)
+   {
+      std::map<Integer, Grid>::iterator oldest = grids.end();
+      for (std::map<Integer, Grid>::iterator it = grids.begin();
+           it != grids.end(); ++it)
+      {
+         if (it->first == keepId || it->second.numInUse > 0)
+            continue;
+         if (oldest == grids.end() ||
+             it->second.lastUsed < oldest->second.lastUsed)
+            oldest = it;
+      }
+      if (oldest == grids.end())
+         return;   // all the other grids are in use
+
+      Integer id = oldest->first;
+      // the contexts of the grid are all idle
+      std::map<std::pair<Integer, std::string>, std::vector<Context*> >::
+         iterator idle = idleContexts.lower_bound(
+                            std::make_pair(id, std::string()));
+      while (idle != idleContexts.end() && idle->first.first == id)
+      {
+         for (Integer ii = 0; ii < (Integer) idle->second.size(); ii++)
+         {
+            contexts.erase(std::find(contexts.begin(), contexts.end(),
+                                     idle->second[ii]));
+            DeleteContext(idle->second[ii]);
+         }
+         idle = idleContexts.erase(idle);
+      }
+      IntegerArray &candidates = gridsByHash[oldest->second.hash];
+      candidates.erase(std::find(candidates.begin(), candidates.end(), id));
+      if (candidates.empty())
+         gridsByHash.erase(oldest->second.hash);
+      delete oldest->second.pointGroup;
+      grids.erase(oldest);
+      numEvictedGrids++;
+
+      #ifdef DEBUG_COVERAGE_SERVICE
+         MessageInterface::ShowMessage("CoverageService: grid %d evicted\n",
+                                       id);
+      #endif
+   }
+}
+
+//------------------------------------------------------------------------------
+// void RunCoverage(int fd, const CoverageRequest &req)
+//------------------------------------------------------------------------------
+/**
+ * Runs a coverage request from the epoch of the orbit and streams the steps
+ * with coverage to the socket.
+ *
+ * @param fd   the connected socket
+ * @param req  the request
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::RunCoverage(int fd, const CoverageRequest &req)
+{
+   if (req.stepSize <= 0.0 || req.duration < 0.0)
+      throw TATCException("CoverageService: the step size must be positive "
+                          "and the duration non-negative\n");
+   Integer numSteps = CoverageRunner::GetNumSteps(req.epoch, req.duration,
+                                                  req.stepSize);
+   Context *ctx = AcquireContext(req);
+   try
+   {
+      Integer numPoints = ctx->checker->GetPointGroup()->GetNumPoints();
+      // reset the orbit of the (reused) spacecraft
+      Rvector6 kepl(req.keplerianState[0], req.keplerianState[1],
+                    req.keplerianState[2], req.keplerianState[3],
+                    req.keplerianState[4], req.keplerianState[5]);
+      ctx->sat->GetOrbitEpoch()->SetJulianDate(req.epoch);
+      ctx->sat->GetOrbitState()->SetKeplerianVectorState(kepl);
+      ctx->interp->Clear();
+      Propagator   prop(ctx->sat);
+      AbsoluteDate date;
+      Real         stepDays = req.stepSize / GmatTimeConstants::SECS_PER_DAY;
+
+      std::vector<char> buf;
+      IntegerArray      covered;  // reused by the steps
+      CoverageProtocol::PutInt(buf, numPoints);
+      CoverageProtocol::PutInt(buf, numSteps);
+      CoverageProtocol::WriteMessage(fd, CoverageProtocol::BEGIN, buf);
+      buf.clear();
+      for (Integer step = 0; step < numSteps; step++)
+      {
+         Real jd = req.epoch + step * stepDays;
+         date.SetJulianDate(jd);
+         prop.Propagate(date);
+         ctx->checker->CheckPointCoverageInto(covered);
+         if (covered.empty())
+            continue;
+         CoverageProtocol::PutInt(buf, step);
+         CoverageProtocol::PutReal(buf, jd);
+         CoverageProtocol::PutIntArray(buf, covered);
+         if (buf.size() >= STEPS_BATCH_SIZE)
+         {
+            CoverageProtocol::WriteMessage(fd, CoverageProtocol::STEPS, buf);
+            buf.clear();
+         }
+      }
+      if (!buf.empty())
+         CoverageProtocol::WriteMessage(fd, CoverageProtocol::STEPS, buf);
+      buf.clear();
+      CoverageProtocol::WriteMessage(fd, CoverageProtocol::END, buf);
+   }
+   catch (...)
+   {
+      ReleaseContext(ctx);
+      throw;
+   }
+   ReleaseContext(ctx);
+}
+
+//------------------------------------------------------------------------------
+// Context* AcquireContext(const CoverageRequest &req)
+//------------------------------------------------------------------------------
+/**
+ * Takes an idle context with the grid and sensor of the request, or builds a
+ * new one. The grid is in use (cannot be evicted) until the context is given
+ * back.
+ *
+ * @param req  the request
+ *
+ * @return  the context (to be given back with ReleaseContext)
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageService::Context* CoverageService::AcquireContext(
+                                                   const CoverageRequest &req)
+{
+   std::vector<char> spec;
+   CoverageProtocol::PutInt(spec, req.sensorType);
+   CoverageProtocol::PutRealArray(spec, req.sensorParams);
+   std::pair<Integer, std::string> key(req.gridId,
+                                       std::string(spec.begin(), spec.end()));
+   PointGroup *pg;
+   {
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      std::map<Integer, Grid>::iterator grid = grids.find(req.gridId);
+      if (grid == grids.end())
+         throw TATCException("CoverageService: unknown grid id\n");
+      pg = grid->second.pointGroup;
+      grid->second.numInUse++;
+      grid->second.lastUsed = ++useCounter;
+      std::vector<Context*> &idle = idleContexts[key];
+      if (!idle.empty())
+      {
+         Context *ctx = idle.back();
+         idle.pop_back();
+         return ctx;
+      }
+   }
+
+   // build the context outside of the lock
+   Sensor  *sensor;
+   try
+   {
+      sensor = CreateSensor(req);
+   }
+   catch (...)
+   {
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      grids[req.gridId].numInUse--;
+      throw;
+   }
+   Context *ctx    = new Context();
+   ctx->key        = key;
+   ctx->date       = new AbsoluteDate();
+   ctx->date->SetJulianDate(req.epoch);
+   ctx->state      = new OrbitState();
+   ctx->attitude   = new NadirPointingAttitude();
+   ctx->interp     = new LagrangeInterpolator(
+                            "PropcovCppLagrangeInterpolator", 6, 7);
+   ctx->sensor     = sensor;
+   ctx->sat        = new Spacecraft(ctx->date, ctx->state, ctx->attitude,
+                                    ctx->interp);
+   if (sensor)
+      ctx->sat->AddSensor(sensor);
+   ctx->checker    = new CoverageChecker(pg, ctx->sat);
+
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   contexts.push_back(ctx);
+   return ctx;
+}
+
+//------------------------------------------------------------------------------
+// void ReleaseContext(Context *ctx)
+//------------------------------------------------------------------------------
+/**
+ * Gives back a context taken with AcquireContext.
+ *
+ * @param ctx  the context
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::ReleaseContext(Context *ctx)
+{
+   std::lock_guard<std::mutex> lock(cacheMutex);
+   idleContexts[ctx->key].push_back(ctx);
+   grids[ctx->key.first].numInUse--;
+}
+
+//------------------------------------------------------------------------------
+// static Sensor* CreateSensor(const CoverageRequest &req)
+//------------------------------------------------------------------------------
+/**
+ * Builds the sensor of a request.
+ *
+ * @param req  the request
+ *
+ * @return  the sensor (NULL for NO_SENSOR)
+ *
+ */
+//------------------------------------------------------------------------------
+Sensor* CoverageService::CreateSensor(const CoverageRequest &req)
+{
+   const RealArray &params = req.sensorParams;
+   switch (req.sensorType)
+   {
+   case CoverageProtocol::NO_SENSOR:
+      return NULL;
+   case CoverageProtocol::CONICAL_SENSOR:
+      if (params.size() != 1)
+         throw TATCException("CoverageService: a conical sensor needs 1 "
+                             "parameter\n");
+      return new ConicalSensor(params[0]);
+   case CoverageProtocol::RECTANGULAR_SENSOR:
+      if (params.size() != 2)
+         throw TATCException("CoverageService: a rectangular sensor needs 2 "
+                             "parameters\n");
+      return new RectangularSensor(params[0], params[1]);
+   case CoverageProtocol::CUSTOM_SENSOR:
+      {
+         Integer n = params.size() / 2;
+         if (n < 3 || (Integer) params.size() != 2 * n)
+            throw TATCException("CoverageService: a custom sensor needs as "
+                                "many cone and clock angles (at least 3)\n");
+         Rvector cone(n), clock(n);
+         for (Integer ii = 0; ii < n; ii++)
+         {
+            cone[ii]  = params[ii];
+            clock[ii] = params[n + ii];
+         }
+         return new GMATCustomSensor(cone, clock);
+      }
+   default:
+      throw TATCException("CoverageService: unknown sensor type\n");
+   }
+}
+
+//------------------------------------------------------------------------------
+// static void DeleteContext(Context *ctx)
+//------------------------------------------------------------------------------
+/**
+ * Deletes a context and its components.
+ *
+ * @param ctx  the context
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageService::DeleteContext(Context *ctx)
+{
+   delete ctx->checker;
+   delete ctx->sat;
+   delete ctx->sensor;
+   delete ctx->interp;
+   delete ctx->attitude;
+   delete ctx->state;
+   delete ctx->date;
+   delete ctx;
+}
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+//                           CoverageService
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageService class, a long-lived coverage server
+ * listening on a Unix domain socket (see CoverageProtocol for the messages
+ * and CoverageClient for the client side).
+ *
+ * The service keeps warm state across requests and connections:
+ *  - the registered grids: the PointGroup (with its body-fixed point vectors)
+ *    is built once per distinct set of latitudes/longitudes, identical grids
+ *    get the same id; beyond the grid limit, registering a new grid evicts
+ *    the least recently used grid which no request is using (with its
+ *    contexts), whose id then becomes unknown;
+ *  - the coverage contexts: a spacecraft with its sensor (including the
+ *    preprocessed polygon of a custom sensor) and a CoverageChecker on a
+ *    grid, pooled per (grid, sensor) and reused by the following requests
+ *    with the same grid and sensor (only the orbit changes).
+ * Each connection is served by its own thread; requests of different
+ * connections run concurrently, each on its own context.
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageService_hpp
+#define CoverageService_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "PointGroup.hpp"
+#include "Spacecraft.hpp"
+#include "Sensor.hpp"
+#include "CoverageChecker.hpp"
+#include "CoverageProtocol.hpp"
+#include "AbsoluteDate.hpp"
+#include "OrbitState.hpp"
+#include "NadirPointingAttitude.hpp"
+#include "LagrangeInterpolator.hpp"
+
+class CoverageService
+{
+public:
+
+   /// class construction/destruction
+   CoverageService(const std::string &socketPath);
+   virtual ~CoverageService();
+
+   /// Bind and listen on the socket (an existing socket file is replaced)
+   void                 Start();
+   /// Accept and serve the connections until Stop() (or a SHUTDOWN request);
+   /// returns when all the connections are closed
+   void                 Serve();
+   /// Stop the service (may be called from any thread)
+   void                 Stop();
+   bool                 IsRunning() const;
+
+   const std::string&   GetSocketPath() const;
+   /// Number of cached grids and coverage contexts
+   Integer              GetNumCachedGrids();
+   Integer              GetNumCachedContexts();
+   /// Set/get the largest number of cached grids (applied at the next
+   /// registration of a new grid)
+   void                 SetMaxCachedGrids(Integer maxGrids);
+   Integer              GetMaxCachedGrids();
+   /// Number of grids evicted so far
+   Integer              GetNumEvictedGrids();
+
+   /// default largest number of cached grids
+   static const Integer DEFAULT_MAX_GRIDS;
+
+protected:
+
+   /// A registered grid
+   struct Grid
+   {
+      RealArray         lats;
+      RealArray         lons;
+      PointGroup        *pointGroup;
+      /// hash of the latitudes and longitudes
+      uint64_t          hash;
+      /// use counter value at the last registration or request
+      uint64_t          lastUsed;
+      /// number of contexts on the grid taken by requests
+      Integer           numInUse;
+   };
+
+   /// A spacecraft/sensor/checker set on a grid, reused across requests
+   struct Context
+   {
+      std::pair<Integer, std::string> key;
+      AbsoluteDate            *date;
+      OrbitState              *state;
+      NadirPointingAttitude   *attitude;
+      LagrangeInterpolator    *interp;
+      Sensor                  *sensor;
+      Spacecraft              *sat;
+      CoverageChecker         *checker;
+   };
+
+   /// socket path and listening socket
+   std::string             socketPath;
+   int                     listenFd;
+   std::atomic<bool>       running;
+
+   /// grid and context caches (guarded by cacheMutex)
+   std::mutex              cacheMutex;
+   std::map<Integer, Grid> grids;
+   std::map<uint64_t, IntegerArray>  gridsByHash;
+   Integer                 nextGridId;
+   uint64_t                useCounter;
+   Integer                 maxGrids;
+   Integer                 numEvictedGrids;
+   std::map<std::pair<Integer, std::string>, std::vector<Context*> >
+                           idleContexts;
+   std::vector<Context*>   contexts;
+
+   /// open connections (guarded by connMutex)
+   std::mutex              connMutex;
+   std::condition_variable connDone;
+   std::set<int>           clientFds;
+
+   /// Serve the requests of a connection until it is closed
+   void                 HandleConnection(int fd);
+   /// Serve one request
+   void                 HandleRequest(int fd, uint32_t type,
+                                      const std::vector<char> &payload);
+   /// Get the id of a grid (registering it if new)
+   Integer              RegisterGrid(const RealArray &lats,
+                                     const RealArray &lons);
+   /// Evict the least recently used grids not in use beyond the grid limit
+   /// (except the input one); called with cacheMutex locked
+   void                 EvictGrids(Integer keepId);
+   /// Run a coverage request, streaming the results to the socket
+   void                 RunCoverage(int fd, const CoverageRequest &req);
+   /// Take a context for a request (building it if none is idle)/give it back
+   Context*             AcquireContext(const CoverageRequest &req);
+   void                 ReleaseContext(Context *ctx);
+   /// Build the sensor of a request (NULL without sensor)
+   static Sensor*       CreateSensor(const CoverageRequest &req);
+   static void          DeleteContext(Context *ctx);
+
+private:
+
+   CoverageService(const CoverageService &copy);
+   CoverageService& operator=(const CoverageService &copy);
+};
+#endif // CoverageService_hpp
@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+//                           CoverageSink
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageSink class
+ */
+//------------------------------------------------------------------------------
+#include "gmatdefs.hpp"
+#include "CoverageSink.hpp"
+#include "TATCException.hpp"
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageSink()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageSink::CoverageSink()
+{
+}
+
+//------------------------------------------------------------------------------
+// CoverageSink(const CoverageSink &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the CoverageSink object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageSink::CoverageSink(const CoverageSink &copy)
+{
+}
+
+//------------------------------------------------------------------------------
+// CoverageSink& operator=(const CoverageSink &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for CoverageSink.
+ *
+ * @param copy  the CoverageSink object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageSink& CoverageSink::operator=(const CoverageSink &copy)
+{
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageSink()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageSink::~CoverageSink()
+{
+}
+
+//------------------------------------------------------------------------------
+// void BeginRun(Integer numPoints, Real startJd, Real stepSize,
+//               Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Prepares the sink for a run. The default implementation does nothing.
+ *
+ * @param numPoints  number of points of the coverage grid
+ * @param startJd    time of the first step (JDUT1)
+ * @param stepSize   step size (s)
+ * @param numSteps   number of steps of the run
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageSink::BeginRun(Integer numPoints, Real startJd, Real stepSize,
+                            Integer numSteps)
+{
+}
+
+//------------------------------------------------------------------------------
+// void ProcessState(Integer stepIndex, Real jd, const Rvector6 &cartState)
+//------------------------------------------------------------------------------
+/**
+ * Consumes the spacecraft state at a step (called before ProcessStep(.) for
+ * the same step). The default implementation does nothing.
+ *
+ * @param stepIndex  index of the step
+ * @param jd         time of the step (JDUT1)
+ * @param cartState  Cartesian state of the spacecraft (MJ2000 Earth-centered
+ *                   inertial, km and km/s)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageSink::ProcessState(Integer stepIndex, Real jd,
+                                const Rvector6 &cartState)
+{
+}
+
+//------------------------------------------------------------------------------
+// void EndRun()
+//------------------------------------------------------------------------------
+/**
+ * Finishes the run (after all the partial sinks are merged). The default
+ * implementation does nothing.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageSink::EndRun()
+{
+}
+
+//------------------------------------------------------------------------------
+// CoverageSink* CreatePartial() const
+//------------------------------------------------------------------------------
+/**
+ * Creates an empty partial sink for a worker thread. The default
+ * implementation returns NULL, i.e. the sink is run sequentially.
+ *
+ * @return  the new partial sink (owned by the caller), or NULL
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageSink* CoverageSink::CreatePartial() const
+{
+   return NULL;
+}
+
+//------------------------------------------------------------------------------
+// void MergePartial(const CoverageSink &partial)
+//------------------------------------------------------------------------------
+/**
+ * Merges a partial sink created by CreatePartial().
+ *
+ * @param partial  the partial sink
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageSink::MergePartial(const CoverageSink &partial)
+{
+   throw TATCException("CoverageSink: this sink does not support partial "
+                       "(multi-threaded) accumulation\n");
+}
@@ -0,0 +1,57 @@
+//------------------------------------------------------------------------------
+//                           CoverageSink
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageSink class, the base class of the consumers of the
+ * per-step coverage results of a CoverageRunner.
+ *
+ * A run calls BeginRun(.) once, then ProcessState(.) and ProcessStep(.) for
+ * each time step (in increasing step order) and EndRun() once.
+ *
+ * Sinks which support multi-threaded runs implement CreatePartial() and
+ * MergePartial(.): each worker thread accumulates a contiguous range of steps
+ * in its own partial sink (no locking in the step loop), and the partial sinks
+ * are merged into the sink in increasing step order at the end of the run.
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageSink_hpp
+#define CoverageSink_hpp
+
+#include "gmatdefs.hpp"
+#include "Rvector6.hpp"
+
+class CoverageSink
+{
+public:
+
+   /// class construction/destruction
+   CoverageSink();
+   CoverageSink(const CoverageSink &copy);
+   CoverageSink& operator=(const CoverageSink &copy);
+
+   virtual ~CoverageSink();
+
+   /// Prepare for a run
+   virtual void            BeginRun(Integer numPoints, Real startJd,
+                                    Real stepSize, Integer numSteps);
+   /// Consume the (inertial) state of the spacecraft at a step, before its
+   /// covered points
+   virtual void            ProcessState(Integer stepIndex, Real jd,
+                                        const Rvector6 &cartState);
+   /// Consume the indices of the points covered at a step
+   virtual void            ProcessStep(Integer stepIndex, Real jd,
+                                       const IntegerArray &coveredPoints) = 0;
+   /// Finish the run
+   virtual void            EndRun();
+
+   /// Create an empty sink (with the same configuration) accumulating a range
+   /// of steps in a worker thread; NULL if the sink only supports sequential
+   /// runs
+   virtual CoverageSink*   CreatePartial() const;
+   /// Merge a partial sink which processed the steps following those already
+   /// accumulated by this sink
+   virtual void            MergePartial(const CoverageSink &partial);
+};
+#endif // CoverageSink_hpp
@@ -0,0 +1,322 @@
+//------------------------------------------------------------------------------
+//                           CoverageStream
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageStream class
+ */
+//------------------------------------------------------------------------------
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "CoverageStream.hpp"
+#include "CoverageChecker.hpp"
+#include "CoverageRunner.hpp"
+#include "Propagator.hpp"
+#include "Earth.hpp"
+#include "AbsoluteDate.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_COVERAGE_STREAM
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageStream(PointGroup *ptGroup, Spacecraft *sat, Real startJd,
+//                Real duration, Real stepSize, Integer chunkSize = 100000,
+//                Integer maxChunks = 4, bool withGeometry = false)
+//------------------------------------------------------------------------------
+/**
+ * Constructor. The background computation starts with Start() or the first
+ * call to Next().
+ *
+ * @param ptGroup       pointer to the PointGroup object to use
+ * @param sat           pointer to the Spacecraft object (copied)
+ * @param startJd       start time (JDUT1)
+ * @param duration      duration (days)
+ * @param stepSize      step size (s)
+ * @param chunkSize     minimum number of accesses of a chunk (except the last)
+ * @param maxChunks     maximum number of buffered chunks
+ * @param withGeometry  true to compute the range and elevation of each access
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageStream::CoverageStream(PointGroup *ptGroup, Spacecraft *sat,
+                               Real startJd, Real duration, Real stepSize,
+                               Integer chunkSize, Integer maxChunks,
+                               bool withGeometry) :
+   pointGroup     (ptGroup),
+   sc             (NULL),
+   startJd        (startJd),
+   stepSize       (stepSize),
+   numSteps       (CoverageRunner::GetNumSteps(startJd, duration, stepSize)),
+   chunkSize      (chunkSize),
+   maxChunks      (maxChunks),
+   withGeometry   (withGeometry),
+   numStepsDone   (0),
+   started        (false),
+   finished       (false),
+   cancelled      (false)
+{
+   if (!pointGroup || !sat)
+      throw TATCException("CoverageStream: NULL point group or spacecraft\n");
+   if (chunkSize < 1 || maxChunks < 1)
+      throw TATCException("CoverageStream: chunk size and number of chunks "
+                          "must be positive\n");
+   sc = new Spacecraft(*sat);
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageStream()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; stops the background computation.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageStream::~CoverageStream()
+{
+   Cancel();
+   delete sc;
+}
+
+//------------------------------------------------------------------------------
+// void Start()
+//------------------------------------------------------------------------------
+/**
+ * Starts the background computation (no effect if already started).
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageStream::Start()
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   if (started)
+      return;
+   started  = true;
+   producer = std::thread(&CoverageStream::Produce, this);
+}
+
+//------------------------------------------------------------------------------
+// bool Next(Chunk &chunk)
+//------------------------------------------------------------------------------
+/**
+ * Waits for the next chunk.
+ *
+ * @param chunk  the chunk (output)
+ *
+ * @return  true if a chunk was returned, false at the end of the run
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageStream::Next(Chunk &chunk)
+{
+   Start();
+   std::unique_lock<std::mutex> lock(mtx);
+   chunkReady.wait(lock, [this]{ return !chunks.empty() || finished; });
+   if (!chunks.empty())
+   {
+      chunk = std::move(chunks.front());
+      chunks.pop_front();
+      numStepsDone = chunk.endStep;
+      spaceReady.notify_one();
+      return true;
+   }
+   if (error)
+      std::rethrow_exception(error);
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// void Cancel()
+//------------------------------------------------------------------------------
+/**
+ * Stops the background computation and drops the buffered chunks; Next()
+ * returns false afterwards.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageStream::Cancel()
+{
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      cancelled = true;
+      started   = true;
+      spaceReady.notify_all();
+   }
+   if (producer.joinable())
+      producer.join();
+   std::lock_guard<std::mutex> lock(mtx);
+   chunks.clear();
+   finished = true;
+   error    = nullptr;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumSteps() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of steps of the run.
+ *
+ * @return  number of steps
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageStream::GetNumSteps() const
+{
+   return numSteps;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumStepsDone() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of steps of the chunks handed to the consumer so far.
+ *
+ * @return  number of steps done
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageStream::GetNumStepsDone() const
+{
+   return numStepsDone;
+}
+
+//------------------------------------------------------------------------------
+// bool HasGeometry() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the chunks hold the range and elevation of the accesses.
+ *
+ * @return  true with geometry
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageStream::HasGeometry() const
+{
+   return withGeometry;
+}
+
+//------------------------------------------------------------------------------
+// Real GetStepTime(Integer stepIndex) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the time of a step.
+ *
+ * @param stepIndex  step index
+ *
+ * @return  time of the step (JDUT1)
+ *
+ */
+//------------------------------------------------------------------------------
+Real CoverageStream::GetStepTime(Integer stepIndex) const
+{
+   return startJd + stepIndex * stepSize / GmatTimeConstants::SECS_PER_DAY;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void Produce()
+//------------------------------------------------------------------------------
+/**
+ * Runs the coverage loop, queueing the chunks (background thread).
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageStream::Produce()
+{
+   try
+   {
+      Propagator      prop(sc);
+      CoverageChecker covChecker(pointGroup, sc);
+      Earth           earth;
+      Real            radius = earth.GetRadius();
+      AbsoluteDate    date;
+      Chunk           chunk;
+      IntegerArray    covered;  // reused by the steps
+      chunk.firstStep = 0;
+
+      for (Integer step = 0; step < numSteps; step++)
+      {
+         Real jd = GetStepTime(step);
+         date.SetJulianDate(jd);
+         prop.Propagate(date);
+         covChecker.CheckPointCoverageInto(covered);
+         chunk.stepIndices.insert(chunk.stepIndices.end(), covered.size(),
+                                  step);
+         chunk.pointIndices.insert(chunk.pointIndices.end(), covered.begin(),
+                                   covered.end());
+         if (withGeometry && !covered.empty())
+         {
+            Rvector3 scPos = earth.GetBodyFixedState(
+                                   sc->GetCartesianState().GetR(), jd);
+            for (Integer ptIdx : covered)
+            {
+               Rvector3 unitPtPos = pointGroup->GetPointPositionVector(ptIdx)->
+                                    GetUnitVector();
+               Rvector3 rangeVec  = scPos - unitPtPos * radius;
+               Real     range     = rangeVec.GetMagnitude();
+               chunk.ranges.push_back(range);
+               chunk.elevations.push_back(
+                                 asin((rangeVec * unitPtPos) / range));
+            }
+         }
+
+         if ((Integer) chunk.pointIndices.size() >= chunkSize ||
+             step == numSteps - 1)
+         {
+            chunk.endStep = step + 1;
+            #ifdef DEBUG_COVERAGE_STREAM
+               MessageInterface::ShowMessage(
+                     "CoverageStream: chunk of steps [%d, %d), %d accesses\n",
+                     chunk.firstStep, chunk.endStep,
+                     (Integer) chunk.pointIndices.size());
+            #endif
+            if (!Push(chunk))
+               return;
+            chunk = Chunk();
+            chunk.firstStep = step + 1;
+         }
+      }
+   }
+   catch (...)
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      error = std::current_exception();
+   }
+
+   std::lock_guard<std::mutex> lock(mtx);
+   finished = true;
+   chunkReady.notify_all();
+}
+
+//------------------------------------------------------------------------------
+// bool Push(Chunk &chunk)
+//------------------------------------------------------------------------------
+/**
+ * Queues a chunk (moved), waiting while the buffer is full (background thread).
+ *
+ * @param chunk  the chunk
+ *
+ * @return  false if the run was cancelled
+ *
+ */
+//------------------------------------------------------------------------------
+bool CoverageStream::Push(Chunk &chunk)
+{
+   std::unique_lock<std::mutex> lock(mtx);
+   spaceReady.wait(lock, [this]{
+      return cancelled || (Integer) chunks.size() < maxChunks; });
+   if (cancelled)
+      return false;
+   chunks.push_back(std::move(chunk));
+   chunkReady.notify_one();
+   return true;
+}
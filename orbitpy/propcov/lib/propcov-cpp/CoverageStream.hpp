@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+//                           CoverageStream
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageStream class, which runs the coverage loop of a
+ * spacecraft over a point group on a background thread and hands the results
+ * to the caller in chunks.
+ *
+ * A chunk holds the accesses (step index, point index and, optionally, the
+ * range and elevation of the spacecraft seen from the point) of consecutive
+ * whole steps, closed once it holds at least chunkSize accesses. At most
+ * maxChunks chunks are buffered: the background thread computes ahead of the
+ * consumer until the buffer is full and then waits, so the memory stays
+ * bounded whatever the length of the run.
+ *
+ * The step times are those of the CoverageRunner (startJd + k*stepSize). The
+ * run works on a copy of the spacecraft, so the input spacecraft is not
+ * modified.
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageStream_hpp
+#define CoverageStream_hpp
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include "gmatdefs.hpp"
+#include "PointGroup.hpp"
+#include "Spacecraft.hpp"
+
+class CoverageStream
+{
+public:
+
+   /// The accesses of consecutive steps (parallel arrays, one entry per access)
+   struct Chunk
+   {
+      /// the chunk holds the steps [firstStep, endStep)
+      Integer        firstStep;
+      Integer        endStep;
+      /// step index of each access
+      IntegerArray   stepIndices;
+      /// point index of each access
+      IntegerArray   pointIndices;
+      /// range from the point to the spacecraft (km), with geometry only
+      RealArray      ranges;
+      /// elevation of the spacecraft above the local horizontal plane of the
+      /// point (rad), with geometry only
+      RealArray      elevations;
+   };
+
+   /// class construction/destruction
+   CoverageStream(PointGroup *ptGroup, Spacecraft *sat, Real startJd,
+                  Real duration, Real stepSize, Integer chunkSize = 100000,
+                  Integer maxChunks = 4, bool withGeometry = false);
+   virtual ~CoverageStream();
+
+   /// Start the background computation (called by the first Next() if needed)
+   void              Start();
+   /// Wait for the next chunk; returns false at the end of the run (errors of
+   /// the background computation are rethrown here)
+   bool              Next(Chunk &chunk);
+   /// Stop the background computation (the buffered chunks are dropped)
+   void              Cancel();
+
+   Integer           GetNumSteps() const;
+   /// Number of steps handed to the consumer so far
+   Integer           GetNumStepsDone() const;
+   bool              HasGeometry() const;
+   Real              GetStepTime(Integer stepIndex) const;
+
+protected:
+
+   /// the points to use for coverage
+   PointGroup                 *pointGroup;
+   /// copy of the spacecraft propagated by the background thread
+   Spacecraft                 *sc;
+   Real                       startJd;
+   Real                       stepSize;
+   Integer                    numSteps;
+   Integer                    chunkSize;
+   Integer                    maxChunks;
+   bool                       withGeometry;
+
+   /// the background thread and the chunks it produced
+   std::thread                producer;
+   std::deque<Chunk>          chunks;
+   /// step following the last step of the chunks handed to the consumer
+   Integer                    numStepsDone;
+   bool                       started;
+   bool                       finished;
+   bool                       cancelled;
+   std::exception_ptr         error;
+   std::mutex                 mtx;
+   /// signaled when a chunk is added or the run ends
+   std::condition_variable    chunkReady;
+   /// signaled when a chunk is removed or the run is cancelled
+   std::condition_variable    spaceReady;
+
+   /// The coverage loop of the background thread
+   virtual void      Produce();
+   /// Queue a chunk, waiting for space; returns false if cancelled
+   bool              Push(Chunk &chunk);
+
+private:
+
+   CoverageStream(const CoverageStream &copy);
+   CoverageStream& operator=(const CoverageStream &copy);
+};
+#endif // CoverageStream_hpp
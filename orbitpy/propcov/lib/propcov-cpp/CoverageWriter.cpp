@@ -0,0 +1,824 @@
+//------------------------------------------------------------------------------
+//                           CoverageWriter
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CoverageWriter and StepFormatter classes
+ */
+//------------------------------------------------------------------------------
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include "gmatdefs.hpp"
+#include "CoverageWriter.hpp"
+#include "CsvEmitter.hpp"
+#include "GmatConstants.hpp"
+#include "Profiler.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_COVERAGE_WRITER
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// file signature and format version of the binary steps
+static const char    STEP_FILE_MAGIC[4]  = {'P', 'C', 'S', 'T'};
+static const int32_t STEP_FILE_VERSION   = 1;
+/// number of decimals of the reals of the legacy files
+static const Integer LEGACY_PRECISION    = 16;
+
+//------------------------------------------------------------------------------
+// static functions
+//------------------------------------------------------------------------------
+
+/// Append the value of a type to a buffer (native layout)
+template <typename T>
+static void AppendBinary(std::string &buffer, T value)
+{
+   buffer.append((const char*) &value, sizeof(T));
+}
+
+//------------------------------------------------------------------------------
+// StepFormatter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// StepFormatter()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor.
+ *
+ */
+//------------------------------------------------------------------------------
+StepFormatter::StepFormatter()
+{
+}
+
+//------------------------------------------------------------------------------
+// ~StepFormatter()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+StepFormatter::~StepFormatter()
+{
+}
+
+//------------------------------------------------------------------------------
+// void FormatHeader(std::string &buffer, Integer numPoints, Real startJd,
+//                   Real stepSize, Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Appends the start of the file. The default implementation appends nothing.
+ *
+ * @param buffer     the buffer (appended to)
+ * @param numPoints  number of points of the coverage grid
+ * @param startJd    time of the first step (JDUT1)
+ * @param stepSize   step size (s)
+ * @param numSteps   number of steps of the run
+ *
+ */
+//------------------------------------------------------------------------------
+void StepFormatter::FormatHeader(std::string &buffer, Integer numPoints,
+                                 Real startJd, Real stepSize, Integer numSteps)
+{
+}
+
+//------------------------------------------------------------------------------
+// void FormatFooter(std::string &buffer)
+//------------------------------------------------------------------------------
+/**
+ * Appends the end of the file. The default implementation appends nothing.
+ *
+ * @param buffer  the buffer (appended to)
+ *
+ */
+//------------------------------------------------------------------------------
+void StepFormatter::FormatFooter(std::string &buffer)
+{
+}
+
+//------------------------------------------------------------------------------
+// CsvStateFormatter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void FormatHeader(std::string &buffer, Integer numPoints, Real startJd,
+//                   Real stepSize, Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Appends the column names.
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvStateFormatter::FormatHeader(std::string &buffer, Integer numPoints,
+                                     Real startJd, Real stepSize,
+                                     Integer numSteps)
+{
+   buffer += "time index,jd,x [km],y [km],z [km],vx [km/s],vy [km/s],"
+             "vz [km/s]\n";
+}
+
+//------------------------------------------------------------------------------
+// void FormatStep(std::string &buffer, const CoverageStepRecord &step)
+//------------------------------------------------------------------------------
+/**
+ * Appends the state row of a step.
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvStateFormatter::FormatStep(std::string &buffer,
+                                   const CoverageStepRecord &step)
+{
+   CsvEmitter::AppendInteger(buffer, step.stepIndex);
+   buffer += ',';
+   CsvEmitter::AppendReal(buffer, step.jd);
+   for (Integer ii = 0; ii < 6; ii++)
+   {
+      buffer += ',';
+      CsvEmitter::AppendReal(buffer, step.state[ii]);
+   }
+   buffer += '\n';
+}
+
+//------------------------------------------------------------------------------
+// CsvAccessFormatter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void FormatHeader(std::string &buffer, Integer numPoints, Real startJd,
+//                   Real stepSize, Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Appends the column names.
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvAccessFormatter::FormatHeader(std::string &buffer, Integer numPoints,
+                                      Real startJd, Real stepSize,
+                                      Integer numSteps)
+{
+   buffer += "time index,GP index\n";
+}
+
+//------------------------------------------------------------------------------
+// void FormatStep(std::string &buffer, const CoverageStepRecord &step)
+//------------------------------------------------------------------------------
+/**
+ * Appends one row per covered point of a step.
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvAccessFormatter::FormatStep(std::string &buffer,
+                                    const CoverageStepRecord &step)
+{
+   for (Integer ptIdx : step.coveredPoints)
+   {
+      CsvEmitter::AppendInteger(buffer, step.stepIndex);
+      buffer += ',';
+      CsvEmitter::AppendInteger(buffer, ptIdx);
+      buffer += '\n';
+   }
+}
+
+//------------------------------------------------------------------------------
+// BinaryStepFormatter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void FormatHeader(std::string &buffer, Integer numPoints, Real startJd,
+//                   Real stepSize, Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Appends the file header (see the class description for the format).
+ *
+ */
+//------------------------------------------------------------------------------
+void BinaryStepFormatter::FormatHeader(std::string &buffer, Integer numPoints,
+                                       Real startJd, Real stepSize,
+                                       Integer numSteps)
+{
+   buffer.append(STEP_FILE_MAGIC, 4);
+   AppendBinary<int32_t>(buffer, STEP_FILE_VERSION);
+   AppendBinary<int32_t>(buffer, numPoints);
+   AppendBinary<int32_t>(buffer, numSteps);
+   AppendBinary<double>(buffer, startJd);
+   AppendBinary<double>(buffer, stepSize);
+}
+
+//------------------------------------------------------------------------------
+// void FormatStep(std::string &buffer, const CoverageStepRecord &step)
+//------------------------------------------------------------------------------
+/**
+ * Appends the record of a step (see the class description for the format).
+ *
+ */
+//------------------------------------------------------------------------------
+void BinaryStepFormatter::FormatStep(std::string &buffer,
+                                     const CoverageStepRecord &step)
+{
+   AppendBinary<int32_t>(buffer, step.stepIndex);
+   AppendBinary<double>(buffer, step.jd);
+   buffer.append((const char*) step.state.GetDataVector(), 6 * sizeof(double));
+   AppendBinary<int32_t>(buffer, step.coveredPoints.size());
+   if (!step.coveredPoints.empty())
+      buffer.append((const char*) step.coveredPoints.data(),
+                    step.coveredPoints.size() * sizeof(int32_t));
+}
+
+//------------------------------------------------------------------------------
+// LegacyStateFormatter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// LegacyStateFormatter(Real duration, bool keplerian)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param duration   duration of the run (days), written in the header
+ * @param keplerian  write the Keplerian elements instead of the Cartesian
+ *                   state?
+ *
+ */
+//------------------------------------------------------------------------------
+LegacyStateFormatter::LegacyStateFormatter(Real duration, bool keplerian) :
+   duration  (duration),
+   keplerian (keplerian)
+{
+}
+
+//------------------------------------------------------------------------------
+// void FormatHeader(std::string &buffer, Integer numPoints, Real startJd,
+//                   Real stepSize, Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Appends the header lines of the legacy state file.
+ *
+ */
+//------------------------------------------------------------------------------
+void LegacyStateFormatter::FormatHeader(std::string &buffer, Integer numPoints,
+                                        Real startJd, Real stepSize,
+                                        Integer numSteps)
+{
+   if (keplerian)
+      buffer += "Satellite states as Keplerian elements.\n";
+   else
+      buffer += "Satellite states are in Earth-Centered-Inertial "
+                "equatorial-plane frame.\n";
+   buffer += "Epoch[JDUT1] is ";
+   CsvEmitter::AppendFixed(buffer, startJd, LEGACY_PRECISION);
+   buffer += "\nStep size [s] is ";
+   CsvEmitter::AppendFixed(buffer, stepSize, LEGACY_PRECISION);
+   buffer += "\nMission Duration [Days] is ";
+   CsvEmitter::AppendFixed(buffer, duration, LEGACY_PRECISION);
+   if (keplerian)
+      buffer += "\nTimeIndex,SMA[km],ECC,INC[deg],RAAN[deg],AOP[deg],TA[deg]\n";
+   else
+      buffer += "\nTimeIndex,X[km],Y[km],Z[km],VX[km/s],VY[km/s],VZ[km/s]\n";
+}
+
+//------------------------------------------------------------------------------
+// void FormatStep(std::string &buffer, const CoverageStepRecord &step)
+//------------------------------------------------------------------------------
+/**
+ * Appends the state row of a step.
+ *
+ */
+//------------------------------------------------------------------------------
+void LegacyStateFormatter::FormatStep(std::string &buffer,
+                                      const CoverageStepRecord &step)
+{
+   Rvector6 values = step.state;
+   if (keplerian)
+   {
+      orbitState.SetCartesianState(step.state);
+      values = orbitState.GetKeplerianState();
+      for (Integer ii = 2; ii < 6; ii++)
+         values[ii] *= GmatMathConstants::DEG_PER_RAD;
+   }
+   CsvEmitter::AppendInteger(buffer, step.stepIndex);
+   for (Integer ii = 0; ii < 6; ii++)
+   {
+      buffer += ',';
+      CsvEmitter::AppendFixed(buffer, values[ii], LEGACY_PRECISION);
+   }
+   buffer += '\n';
+}
+
+//------------------------------------------------------------------------------
+// LegacyAccessFormatter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// LegacyAccessFormatter(Real duration)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param duration  duration of the run (days), written in the header
+ *
+ */
+//------------------------------------------------------------------------------
+LegacyAccessFormatter::LegacyAccessFormatter(Real duration) :
+   duration  (duration),
+   numPoints (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// void FormatHeader(std::string &buffer, Integer numPoints, Real startJd,
+//                   Real stepSize, Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Appends the header lines and the column names of the legacy access file.
+ *
+ */
+//------------------------------------------------------------------------------
+void LegacyAccessFormatter::FormatHeader(std::string &buffer,
+                                         Integer numPoints, Real startJd,
+                                         Real stepSize, Integer numSteps)
+{
+   this->numPoints = numPoints;
+   buffer += "Satellite states are in Earth-Centered-Inertial "
+             "equatorial-plane frame.\nEpoch[JDUT1] is ";
+   CsvEmitter::AppendFixed(buffer, startJd, LEGACY_PRECISION);
+   buffer += "\nStep size [s] is ";
+   CsvEmitter::AppendFixed(buffer, stepSize, LEGACY_PRECISION);
+   buffer += "\nMission Duration [Days] is ";
+   CsvEmitter::AppendFixed(buffer, duration, LEGACY_PRECISION);
+   buffer += ".\n";
+   CsvEmitter::AppendAccessHeader(buffer, numPoints);
+}
+
+//------------------------------------------------------------------------------
+// void FormatStep(std::string &buffer, const CoverageStepRecord &step)
+//------------------------------------------------------------------------------
+/**
+ * Appends the access row of a step (no row if no point is covered).
+ *
+ */
+//------------------------------------------------------------------------------
+void LegacyAccessFormatter::FormatStep(std::string &buffer,
+                                       const CoverageStepRecord &step)
+{
+   if (!step.coveredPoints.empty())
+      CsvEmitter::AppendAccessRow(buffer, step.stepIndex, step.coveredPoints,
+                                  numPoints);
+}
+
+//------------------------------------------------------------------------------
+// CoverageWriter
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// CoverageWriter(Integer maxQueuedSteps, Integer bufferSize)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param maxQueuedSteps  maximum number of steps queued for the writer thread
+ * @param bufferSize      size (bytes) from which a file buffer is written
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageWriter::CoverageWriter(Integer maxQueuedSteps, Integer bufferSize) :
+   maxQueuedSteps (maxQueuedSteps),
+   bufferSize     (bufferSize),
+   head           (0),
+   numQueued      (0),
+   stateStep      (-1),
+   numStepsWritten(0),
+   bytesWritten   (0),
+   running        (false),
+   finishing      (false)
+{
+   if (maxQueuedSteps < 1 || bufferSize < 1)
+      throw TATCException("CoverageWriter: queue and buffer sizes must be "
+                          "positive\n");
+}
+
+//------------------------------------------------------------------------------
+// CoverageWriter(const CoverageWriter &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor; copies the configuration (outputs, queue and buffer sizes),
+ * not the state of a run.
+ *
+ * @param copy  the CoverageWriter object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageWriter::CoverageWriter(const CoverageWriter &copy) :
+   CoverageSink   (copy),
+   maxQueuedSteps (copy.maxQueuedSteps),
+   bufferSize     (copy.bufferSize),
+   head           (0),
+   numQueued      (0),
+   stateStep      (-1),
+   numStepsWritten(0),
+   bytesWritten   (0),
+   running        (false),
+   finishing      (false)
+{
+   for (const Output &output : copy.outputs)
+      AddOutput(output.filename, output.formatter);
+}
+
+//------------------------------------------------------------------------------
+// CoverageWriter& operator=(const CoverageWriter &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for CoverageWriter; stops a run in progress and copies the
+ * configuration.
+ *
+ * @param copy  the CoverageWriter object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageWriter& CoverageWriter::operator=(const CoverageWriter &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   Stop();
+   CoverageSink::operator=(copy);
+   maxQueuedSteps = copy.maxQueuedSteps;
+   bufferSize     = copy.bufferSize;
+   outputs.clear();
+   for (const Output &output : copy.outputs)
+      AddOutput(output.filename, output.formatter);
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~CoverageWriter()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; stops a run in progress (e.g. after an error of the coverage
+ * loop), writing the steps already queued.
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageWriter::~CoverageWriter()
+{
+   Stop();
+}
+
+//------------------------------------------------------------------------------
+// void AddOutput(const std::string &filename, StepFormatter *formatter)
+//------------------------------------------------------------------------------
+/**
+ * Adds an output file, (re)written by each run.
+ *
+ * @param filename   path of the file
+ * @param formatter  the formatter of the steps (not owned)
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::AddOutput(const std::string &filename,
+                               StepFormatter *formatter)
+{
+   if (!formatter)
+      throw TATCException("CoverageWriter: NULL formatter\n");
+   if (running)
+      throw TATCException("CoverageWriter: cannot add an output during a "
+                          "run\n");
+   Output output;
+   output.filename  = filename;
+   output.formatter = formatter;
+   output.fd        = -1;
+   outputs.push_back(output);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumOutputs() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of output files.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageWriter::GetNumOutputs() const
+{
+   return outputs.size();
+}
+
+//------------------------------------------------------------------------------
+// Integer GetMaxQueuedSteps() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the maximum number of steps queued for the writer thread.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageWriter::GetMaxQueuedSteps() const
+{
+   return maxQueuedSteps;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetBufferSize() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the size (bytes) from which a file buffer is written.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageWriter::GetBufferSize() const
+{
+   return bufferSize;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumStepsWritten() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of steps written by the last (or current) run.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer CoverageWriter::GetNumStepsWritten() const
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   return numStepsWritten;
+}
+
+//------------------------------------------------------------------------------
+// long long GetBytesWritten() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of bytes written to the files by the last (or current)
+ * run.
+ *
+ */
+//------------------------------------------------------------------------------
+long long CoverageWriter::GetBytesWritten() const
+{
+   std::lock_guard<std::mutex> lock(mtx);
+   return bytesWritten;
+}
+
+//------------------------------------------------------------------------------
+// void BeginRun(Integer numPoints, Real startJd, Real stepSize,
+//               Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Opens (truncates) the output files, formats their headers and starts the
+ * writer thread.
+ *
+ * @param numPoints  number of points of the coverage grid
+ * @param startJd    time of the first step (JDUT1)
+ * @param stepSize   step size (s)
+ * @param numSteps   number of steps of the run
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::BeginRun(Integer numPoints, Real startJd, Real stepSize,
+                              Integer numSteps)
+{
+   Stop();
+   for (Output &output : outputs)
+   {
+      output.fd = open(output.filename.c_str(),
+                       O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (output.fd < 0)
+      {
+         std::string filename = output.filename;
+         Stop();
+         throw TATCException("CoverageWriter: unable to open " + filename +
+                             " for writing\n");
+      }
+      output.buffer.clear();
+      output.buffer.reserve(bufferSize);
+      output.formatter->FormatHeader(output.buffer, numPoints, startJd,
+                                     stepSize, numSteps);
+   }
+
+   #ifdef DEBUG_COVERAGE_WRITER
+      MessageInterface::ShowMessage("CoverageWriter: %d steps to %d files\n",
+                                    numSteps, (Integer) outputs.size());
+   #endif
+
+   // the records (and the capacity of their point arrays) are kept across runs
+   slots.resize(maxQueuedSteps);
+   head            = 0;
+   numQueued       = 0;
+   stateStep       = -1;
+   numStepsWritten = 0;
+   bytesWritten    = 0;
+   error           = nullptr;
+   finishing       = false;
+   running         = true;
+   writer          = std::thread(&CoverageWriter::Write, this);
+}
+
+//------------------------------------------------------------------------------
+// void ProcessState(Integer stepIndex, Real jd, const Rvector6 &cartState)
+//------------------------------------------------------------------------------
+/**
+ * Keeps the spacecraft state of the step being processed.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::ProcessState(Integer stepIndex, Real jd,
+                                  const Rvector6 &cartState)
+{
+   stateStep = stepIndex;
+   stepState = cartState;
+}
+
+//------------------------------------------------------------------------------
+// void ProcessStep(Integer stepIndex, Real jd,
+//                  const IntegerArray &coveredPoints)
+//------------------------------------------------------------------------------
+/**
+ * Queues a step for the writer thread, waiting while the queue is full (the
+ * errors of the writer thread are rethrown here).
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::ProcessStep(Integer stepIndex, Real jd,
+                                 const IntegerArray &coveredPoints)
+{
+   Integer slot;
+   {
+      std::unique_lock<std::mutex> lock(mtx);
+      if (!running)
+         throw TATCException("CoverageWriter: step processed outside of a "
+                             "run\n");
+      spaceReady.wait(lock, [this]{ return numQueued < maxQueuedSteps ||
+                                           error; });
+      if (error)
+         std::rethrow_exception(error);
+      slot = (head + numQueued) % maxQueuedSteps;
+   }
+
+   // the slot is not used by the writer thread until it is queued
+   CoverageStepRecord &step = slots[slot];
+   step.stepIndex = stepIndex;
+   step.jd        = jd;
+   if (stateStep == stepIndex)
+      step.state = stepState;
+   else
+      step.state.Set(0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+   step.coveredPoints.assign(coveredPoints.begin(), coveredPoints.end());
+
+   std::lock_guard<std::mutex> lock(mtx);
+   numQueued++;
+   stepReady.notify_one();
+}
+
+//------------------------------------------------------------------------------
+// void EndRun()
+//------------------------------------------------------------------------------
+/**
+ * Waits for the writer thread to write the queued steps and closes the files
+ * (the errors of the writer thread are rethrown here).
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::EndRun()
+{
+   Stop();
+   if (error)
+      std::rethrow_exception(error);
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void Write()
+//------------------------------------------------------------------------------
+/**
+ * The loop of the writer thread: formats the queued steps (all those queued
+ * at once, without holding the lock) and writes the full buffers, until the
+ * run ends and the queue is empty.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::Write()
+{
+   try
+   {
+      while (true)
+      {
+         Integer first, count;
+         {
+            std::unique_lock<std::mutex> lock(mtx);
+            stepReady.wait(lock, [this]{ return numQueued > 0 || finishing; });
+            if (numQueued == 0)
+               break;
+            first = head;
+            count = numQueued;
+         }
+
+         {
+            Profiler::Scope timer(Profiler::OUTPUT);
+            for (Integer kk = 0; kk < count; kk++)
+            {
+               const CoverageStepRecord &step =
+                  slots[(first + kk) % maxQueuedSteps];
+               for (Output &output : outputs)
+                  output.formatter->FormatStep(output.buffer, step);
+            }
+         }
+
+         {
+            std::lock_guard<std::mutex> lock(mtx);
+            head             = (head + count) % maxQueuedSteps;
+            numQueued       -= count;
+            numStepsWritten += count;
+            spaceReady.notify_one();
+         }
+
+         Profiler::Scope timer(Profiler::OUTPUT);
+         for (Output &output : outputs)
+            if ((Integer) output.buffer.size() >= bufferSize)
+               Flush(output);
+      }
+
+      Profiler::Scope timer(Profiler::OUTPUT);
+      for (Output &output : outputs)
+      {
+         output.formatter->FormatFooter(output.buffer);
+         Flush(output);
+      }
+   }
+   catch (...)
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      error = std::current_exception();
+      spaceReady.notify_all();
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Flush(Output &output)
+//------------------------------------------------------------------------------
+/**
+ * Writes the buffer of an output to its file and clears it (keeping its
+ * capacity).
+ *
+ * @param output  the output
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::Flush(Output &output)
+{
+   const char *data = output.buffer.data();
+   size_t     size  = output.buffer.size();
+   size_t     done  = 0;
+   while (done < size)
+   {
+      ssize_t written = write(output.fd, data + done, size - done);
+      if (written < 0)
+      {
+         if (errno == EINTR)
+            continue;
+         throw TATCException("CoverageWriter: error writing " +
+                             output.filename + ": " + strerror(errno) + "\n");
+      }
+      done += written;
+   }
+   output.buffer.clear();
+   Profiler::AddCount(Profiler::BYTES_WRITTEN, size);
+   std::lock_guard<std::mutex> lock(mtx);
+   bytesWritten += size;
+}
+
+//------------------------------------------------------------------------------
+// void Stop()
+//------------------------------------------------------------------------------
+/**
+ * Ends the writer thread (after it wrote the queued steps) and closes the
+ * files.
+ *
+ */
+//------------------------------------------------------------------------------
+void CoverageWriter::Stop()
+{
+   {
+      std::lock_guard<std::mutex> lock(mtx);
+      finishing = true;
+      stepReady.notify_one();
+   }
+   if (writer.joinable())
+      writer.join();
+   for (Output &output : outputs)
+   {
+      if (output.fd >= 0)
+         close(output.fd);
+      output.fd = -1;
+   }
+   running = false;
+}
@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+//                           CoverageWriter
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CoverageWriter class, a CoverageSink writing the per-step
+ * results of a coverage run to files on a writer thread, and of the
+ * StepFormatter classes formatting the steps (CSV state rows, CSV access rows,
+ * flat binary).
+ *
+ * The coverage loop hands each completed step (time, spacecraft state and
+ * covered points) to a bounded queue of maxQueuedSteps step records, which are
+ * reused from step to step. The writer thread formats the queued steps into one
+ * buffer per output file and writes a buffer once it holds bufferSize bytes,
+ * so the computation overlaps the formatting and the disk writes. When the
+ * queue is full the coverage loop waits for the writer (back-pressure), so the
+ * memory stays bounded whatever the length of the run. The steps are written
+ * in step order (the writer only supports sequential runs: a multi-threaded
+ * CoverageRunner falls back to one thread).
+ *
+ * The legacy formatters write the files of the orbitpropcov_grid driver,
+ * byte for byte: the state (Cartesian or Keplerian) and access matrix files
+ * with their header lines, the reals in fixed notation with 16 decimals.
+ *
+ * The flat binary format of BinaryStepFormatter (little-endian) is:
+ *    char[4]  magic "PCST"
+ *    int32    version
+ *    int32    number of points, int32 number of steps
+ *    float64  start time (JDUT1), float64 step size (s)
+ *    then, for each step:
+ *    int32    step index
+ *    float64  time (JDUT1)
+ *    float64  state [6] (MJ2000 Earth-centered inertial, km and km/s)
+ *    int32    number of covered points, followed by their int32 indices
+ */
+//------------------------------------------------------------------------------
+#ifndef CoverageWriter_hpp
+#define CoverageWriter_hpp
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "Rvector6.hpp"
+#include "OrbitState.hpp"
+#include "CoverageSink.hpp"
+
+/// The results of a step handed to the writer thread
+struct CoverageStepRecord
+{
+   Integer        stepIndex;
+   /// time of the step (JDUT1)
+   Real           jd;
+   /// Cartesian state of the spacecraft (MJ2000 Earth-centered inertial)
+   Rvector6       state;
+   /// indices of the covered points
+   IntegerArray   coveredPoints;
+};
+
+class StepFormatter
+{
+public:
+
+   /// class construction/destruction
+   StepFormatter();
+   virtual ~StepFormatter();
+
+   /// Append the start of the file to buffer
+   virtual void   FormatHeader(std::string &buffer, Integer numPoints,
+                               Real startJd, Real stepSize, Integer numSteps);
+   /// Append the rows of a step to buffer
+   virtual void   FormatStep(std::string &buffer,
+                             const CoverageStepRecord &step) = 0;
+   /// Append the end of the file to buffer
+   virtual void   FormatFooter(std::string &buffer);
+};
+
+/// CSV rows of the spacecraft state, one per step (the reals as the shortest
+/// text reading back to the same value)
+class CsvStateFormatter : public StepFormatter
+{
+public:
+   virtual void   FormatHeader(std::string &buffer, Integer numPoints,
+                               Real startJd, Real stepSize, Integer numSteps);
+   virtual void   FormatStep(std::string &buffer,
+                             const CoverageStepRecord &step);
+};
+
+/// CSV rows of the accesses, one per covered point and step
+class CsvAccessFormatter : public StepFormatter
+{
+public:
+   virtual void   FormatHeader(std::string &buffer, Integer numPoints,
+                               Real startJd, Real stepSize, Integer numSteps);
+   virtual void   FormatStep(std::string &buffer,
+                             const CoverageStepRecord &step);
+};
+
+/// Flat binary records of the steps (see the format above)
+class BinaryStepFormatter : public StepFormatter
+{
+public:
+   virtual void   FormatHeader(std::string &buffer, Integer numPoints,
+                               Real startJd, Real stepSize, Integer numSteps);
+   virtual void   FormatStep(std::string &buffer,
+                             const CoverageStepRecord &step);
+};
+
+/// Legacy state file: header lines, then one row of the Cartesian (km, km/s)
+/// or Keplerian (km, deg) state per step
+class LegacyStateFormatter : public StepFormatter
+{
+public:
+   LegacyStateFormatter(Real duration, bool keplerian = false);
+   virtual void   FormatHeader(std::string &buffer, Integer numPoints,
+                               Real startJd, Real stepSize, Integer numSteps);
+   virtual void   FormatStep(std::string &buffer,
+                             const CoverageStepRecord &step);
+protected:
+   /// duration of the run (days), written in the header
+   Real           duration;
+   bool           keplerian;
+   /// conversion of the states to Keplerian elements
+   OrbitState     orbitState;
+};
+
+/// Legacy access file: header lines, then one row per step with accesses and
+/// one column per grid point (see CsvEmitter)
+class LegacyAccessFormatter : public StepFormatter
+{
+public:
+   LegacyAccessFormatter(Real duration);
+   virtual void   FormatHeader(std::string &buffer, Integer numPoints,
+                               Real startJd, Real stepSize, Integer numSteps);
+   virtual void   FormatStep(std::string &buffer,
+                             const CoverageStepRecord &step);
+protected:
+   /// duration of the run (days), written in the header
+   Real           duration;
+   Integer        numPoints;
+};
+
+class CoverageWriter : public CoverageSink
+{
+public:
+
+   /// class construction/destruction
+   CoverageWriter(Integer maxQueuedSteps = 64, Integer bufferSize = 1 << 20);
+   CoverageWriter(const CoverageWriter &copy);
+   CoverageWriter& operator=(const CoverageWriter &copy);
+
+   virtual ~CoverageWriter();
+
+   /// Add an output file written with a formatter (not owned, must outlive the
+   /// runs)
+   void                    AddOutput(const std::string &filename,
+                                     StepFormatter *formatter);
+   Integer                 GetNumOutputs() const;
+   Integer                 GetMaxQueuedSteps() const;
+   Integer                 GetBufferSize() const;
+   /// Get the number of steps and bytes written by the last run
+   Integer                 GetNumStepsWritten() const;
+   long long               GetBytesWritten() const;
+
+   /// CoverageSink interface
+   virtual void            BeginRun(Integer numPoints, Real startJd,
+                                    Real stepSize, Integer numSteps);
+   virtual void            ProcessState(Integer stepIndex, Real jd,
+                                        const Rvector6 &cartState);
+   virtual void            ProcessStep(Integer stepIndex, Real jd,
+                                       const IntegerArray &coveredPoints);
+   virtual void            EndRun();
+
+protected:
+
+   /// An output file
+   struct Output
+   {
+      std::string          filename;
+      StepFormatter        *formatter;
+      /// file descriptor (-1 if closed)
+      int                  fd;
+      /// formatted bytes not written yet
+      std::string          buffer;
+   };
+
+   /// the output files
+   std::vector<Output>     outputs;
+   Integer                 maxQueuedSteps;
+   Integer                 bufferSize;
+
+   /// the step records: the queued steps are slots[head], ...,
+   /// slots[(head + numQueued - 1) % maxQueuedSteps]
+   std::vector<CoverageStepRecord> slots;
+   Integer                 head;
+   Integer                 numQueued;
+   /// state of the step being processed (from ProcessState)
+   Integer                 stateStep;
+   Rvector6                stepState;
+   /// steps and bytes written by the run
+   Integer                 numStepsWritten;
+   long long               bytesWritten;
+
+   /// the writer thread
+   std::thread             writer;
+   bool                    running;
+   bool                    finishing;
+   std::exception_ptr      error;
+   mutable std::mutex      mtx;
+   /// signaled when a step is queued or the run ends
+   std::condition_variable stepReady;
+   /// signaled when steps are written or the writer fails
+   std::condition_variable spaceReady;
+
+   /// The loop of the writer thread
+   virtual void            Write();
+   /// Write the buffer of an output
+   void                    Flush(Output &output);
+   /// Stop the writer thread and close the files
+   void                    Stop();
+};
+#endif // CoverageWriter_hpp
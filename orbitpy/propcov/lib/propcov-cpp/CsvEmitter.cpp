@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+//                           CsvEmitter
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the CsvEmitter class
+ */
+//------------------------------------------------------------------------------
+#include <charconv>
+#include "gmatdefs.hpp"
+#include "CsvEmitter.hpp"
+#include "TATCException.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Integer CsvEmitter::MAX_PRECISION = 40;
+
+/// size of the text of a real in fixed notation: 309 integer digits, the
+/// sign, the point and MAX_PRECISION decimals
+static const Integer MAX_FIXED_LENGTH = 352;
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// static void AppendInteger(std::string &buffer, Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Appends an integer.
+ *
+ * @param buffer  the buffer (appended to)
+ * @param value   the value
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvEmitter::AppendInteger(std::string &buffer, Integer value)
+{
+   char text[16];
+   std::to_chars_result result = std::to_chars(text, text + sizeof(text),
+                                               value);
+   buffer.append(text, result.ptr - text);
+}
+
+//------------------------------------------------------------------------------
+// static void AppendReal(std::string &buffer, Real value)
+//------------------------------------------------------------------------------
+/**
+ * Appends the shortest text which reads back to the value (e.g. 0.1, 7078,
+ * 1e-07).
+ *
+ * @param buffer  the buffer (appended to)
+ * @param value   the value
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvEmitter::AppendReal(std::string &buffer, Real value)
+{
+   char text[32];
+   std::to_chars_result result = std::to_chars(text, text + sizeof(text),
+                                               value);
+   buffer.append(text, result.ptr - text);
+}
+
+//------------------------------------------------------------------------------
+// static void AppendFixed(std::string &buffer, Real value, Integer precision)
+//------------------------------------------------------------------------------
+/**
+ * Appends a real in fixed notation, rounded to precision decimals (the text
+ * of an ostream with std::fixed and std::setprecision(precision)).
+ *
+ * @param buffer     the buffer (appended to)
+ * @param value      the value
+ * @param precision  number of decimals (0 to MAX_PRECISION)
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvEmitter::AppendFixed(std::string &buffer, Real value,
+                             Integer precision)
+{
+   if (precision < 0 || precision > MAX_PRECISION)
+      throw TATCException("CsvEmitter: precision out of range\n");
+   char text[MAX_FIXED_LENGTH];
+   std::to_chars_result result = std::to_chars(text, text + sizeof(text),
+                                               value, std::chars_format::fixed,
+                                               precision);
+   buffer.append(text, result.ptr - text);
+}
+
+//------------------------------------------------------------------------------
+// static void AppendCommas(std::string &buffer, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Appends count commas (a run of empty cells).
+ *
+ * @param buffer  the buffer (appended to)
+ * @param count   number of commas
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvEmitter::AppendCommas(std::string &buffer, Integer count)
+{
+   if (count > 0)
+      buffer.append(count, ',');
+}
+
+//------------------------------------------------------------------------------
+// static void AppendAccessHeader(std::string &buffer, Integer numPoints)
+//------------------------------------------------------------------------------
+/**
+ * Appends the header row of a legacy access file: "TimeIndex,GP0,GP1,...".
+ *
+ * @param buffer     the buffer (appended to)
+ * @param numPoints  number of grid points
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvEmitter::AppendAccessHeader(std::string &buffer, Integer numPoints)
+{
+   buffer.reserve(buffer.size() + 12 + 9 * (size_t) numPoints);
+   buffer += "TimeIndex,";
+   for (Integer ii = 0; ii < numPoints; ii++)
+   {
+      buffer += "GP";
+      AppendInteger(buffer, ii);
+      if (ii < numPoints - 1)
+         buffer += ',';
+   }
+   buffer += '\n';
+}
+
+//------------------------------------------------------------------------------
+// static void AppendAccessRow(std::string &buffer, Integer stepIndex,
+//                             const IntegerArray &coveredPoints,
+//                             Integer numPoints)
+//------------------------------------------------------------------------------
+/**
+ * Appends the row of a step of a legacy access file: the step index, then
+ * ",1" for each covered point and "," for each other point.
+ *
+ * @param buffer         the buffer (appended to)
+ * @param stepIndex      the step index
+ * @param coveredPoints  the covered points (in increasing order)
+ * @param numPoints      number of grid points
+ *
+ */
+//------------------------------------------------------------------------------
+void CsvEmitter::AppendAccessRow(std::string &buffer, Integer stepIndex,
+                                 const IntegerArray &coveredPoints,
+                                 Integer numPoints)
+{
+   buffer.reserve(buffer.size() + 12 + numPoints + coveredPoints.size());
+   AppendInteger(buffer, stepIndex);
+   Integer next = 0;   // first point not written yet
+   for (Integer ptIdx : coveredPoints)
+   {
+      if (ptIdx < next || ptIdx >= numPoints)
+         throw TATCException("CsvEmitter: covered points out of range or not "
+                             "in increasing order\n");
+      AppendCommas(buffer, ptIdx - next);
+      buffer += ",1";
+      next = ptIdx + 1;
+   }
+   AppendCommas(buffer, numPoints - next);
+   buffer += '\n';
+}
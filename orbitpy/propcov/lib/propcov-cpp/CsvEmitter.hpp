@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+//                           CsvEmitter
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the CsvEmitter class, the fast text formatting of the CSV
+ * output files.
+ *
+ * The values are appended to a (preallocated) string buffer with
+ * std::to_chars, without streams or locales. The reals are written either as
+ * the shortest text which reads back to the same value, or in fixed notation
+ * with a given number of decimals (the text of an ostream with std::fixed and
+ * std::setprecision, used by the legacy files).
+ *
+ * The legacy access files are a matrix with one row per step (with at least
+ * one access) and one column per grid point: "TimeIndex,GP0,GP1,...", then
+ * rows "step,,1,,,1,..." with 1 in the cells of the covered points and empty
+ * cells elsewhere. The runs of empty cells are appended in bulk.
+ *
+ * NOTE: This is a static class: No instances of this class may be declared.
+ */
+//------------------------------------------------------------------------------
+#ifndef CsvEmitter_hpp
+#define CsvEmitter_hpp
+
+#include <string>
+#include "gmatdefs.hpp"
+
+class CsvEmitter
+{
+public:
+
+   /// Append an integer
+   static void    AppendInteger(std::string &buffer, Integer value);
+   /// Append the shortest text reading back to the value
+   static void    AppendReal(std::string &buffer, Real value);
+   /// Append a real in fixed notation with precision decimals (as an ostream
+   /// with std::fixed and std::setprecision(precision))
+   static void    AppendFixed(std::string &buffer, Real value,
+                              Integer precision);
+   /// Append count commas (empty cells)
+   static void    AppendCommas(std::string &buffer, Integer count);
+
+   /// Append the header row of a legacy access file
+   static void    AppendAccessHeader(std::string &buffer, Integer numPoints);
+   /// Append the row of a step of a legacy access file (the covered points
+   /// in increasing order)
+   static void    AppendAccessRow(std::string &buffer, Integer stepIndex,
+                                  const IntegerArray &coveredPoints,
+                                  Integer numPoints);
+
+   /// Maximum number of decimals of AppendFixed
+   static const Integer MAX_PRECISION;
+
+private:
+
+   //------------------------------------------------------------------------------
+   // private constructors, destructor, operator=
+   //------------------------------------------------------------------------------
+
+   /// class methods (unimplemented, since this is a static class)
+   CsvEmitter();
+   CsvEmitter( const CsvEmitter &copy);
+   CsvEmitter& operator=(const CsvEmitter &copy);
+
+   ~CsvEmitter();
+
+};
+#endif // CsvEmitter_hpp
@@ -282,6 +282,30 @@ Real DiscretizedSensor::gethFOV()
 	return hFOV;
 }
 
+/**
+ *
+ * Returns the class member widthDetectors, the number of detectors in the row direction
+ *
+ * @return  The widthDetectors class member
+ *
+ */
+Integer DiscretizedSensor::getWidthDetectors()
+{
+	return widthDetectors;
+}
+
+/**
+ *
+ * Returns the class member heightDetectors, the number of detectors in the column direction
+ *
+ * @return  The heightDetectors class member
+ *
+ */
+Integer DiscretizedSensor::getHeightDetectors()
+{
+	return heightDetectors;
+}
+
 /**
  *
  * Returns a vector of unit vectors (Rvector3) of the pixel centers.
@@ -42,6 +42,8 @@ public:
 	// Getters and Setters
 	Real getwFOV();
 	Real gethFOV();
+	Integer getWidthDetectors();
+	Integer getHeightDetectors();
 	std::vector<Rvector3> getCenterHeadings();
 	std::vector<Rvector3> getCornerHeadings();
 	std::vector<Rvector3> getPoleHeadings();
@@ -33,7 +33,11 @@
 //------------------------------------------------------------------------------
 // static data
 //------------------------------------------------------------------------------
-// None
+const Real Earth::MU            = 3.986004415e+5;
+const Real Earth::RADIUS        = 6.3781363e+003;
+const Real Earth::FLATTENING    = 0.0033527;
+const Real Earth::J2_TERM       = 1.0826269e-003;
+const Real Earth::ROTATION_RATE = 7.292115146706979e-5;
 
 //------------------------------------------------------------------------------
 // public methods
@@ -48,11 +52,10 @@
  */
 //------------------------------------------------------------------------------
 Earth::Earth() :
-   J2               (1.0826269e-003),
-   mu               (3.986004415e+5),
-   radius           (6.3781363e+003),
-   flattening       (0.0033527),
-   lastRotationTime (0.0)
+   J2               (J2_TERM),
+   mu               (MU),
+   radius           (RADIUS),
+   flattening       (FLATTENING)
 {
 }
 
@@ -69,8 +72,7 @@ Earth::Earth(const Earth &copy) :
    J2               (copy.J2),
    mu               (copy.mu),
    radius           (copy.radius),
-   flattening       (copy.flattening),
-   lastRotationTime (copy.lastRotationTime)
+   flattening       (copy.flattening)
 {
 }
 
@@ -92,7 +94,6 @@ Earth& Earth::operator=(const Earth &copy)
    mu               = copy.mu;
    radius           = copy.radius;
    flattening       = copy.flattening;
-   lastRotationTime = copy.lastRotationTime;
    
    return *this;
 }
@@ -136,17 +137,13 @@ Real Earth::GetRadius()
 //------------------------------------------------------------------------------
 Rmatrix33 Earth::GetInertialToFixedRotation(Real jd)
 {
-   if (!GmatMathUtil::IsEqual(jd, lastRotationTime))
-   {
-      Real gmt = ComputeGMT(jd);
-      Real cG  = GmatMathUtil::Cos(gmt);
-      Real sG  = GmatMathUtil::Sin(gmt);
-      rotationResult.Set( cG,  sG, 0.0,
-                         -sG,  cG, 0.0,
-                         0.0, 0.0, 1.0);
-   }
-   lastRotationTime = jd;
-   return rotationResult;
+   // No cached result, so that an Earth object can be shared by threads
+   Real gmt = ComputeGMT(jd);
+   Real cG  = GmatMathUtil::Cos(gmt);
+   Real sG  = GmatMathUtil::Sin(gmt);
+   return Rmatrix33( cG,  sG, 0.0,
+                    -sG,  cG, 0.0,
+                    0.0, 0.0, 1.0);
 }
 
 //------------------------------------------------------------------------------
@@ -220,8 +217,9 @@ Rvector6 Earth::GetBodyFixedState(Rvector6 inertialState,
    // TODO.  Handle differences in units of points and states.
    // TODO.  This ignores omega cross r term in velocity, which is ok and 
    // perhaps desired for current use cases but is not always desired.
-   Rvector3 centralBodyFixedPos  = Earth::GetBodyFixedState(inertialPos, jd);
-   Rvector3 centralBodyFixedVel  = Earth::GetBodyFixedState(inertialVel, jd);
+   Rmatrix33 rotation            = GetInertialToFixedRotation(jd);
+   Rvector3 centralBodyFixedPos  = rotation * inertialPos;
+   Rvector3 centralBodyFixedVel  = rotation * inertialVel;
 
    Rvector6 earthFixedState(centralBodyFixedPos(0), centralBodyFixedPos(1),
                            centralBodyFixedPos(2),
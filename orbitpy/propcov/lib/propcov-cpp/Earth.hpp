@@ -29,6 +29,7 @@
  *    * Calculation of sun-vector in body-fixed frame.
  *    * Compute rotation matrix, or to rotate a vector from body-fixed to topocentric. 
  * 
+ * The methods do not modify the object, so an Earth object can be used by several threads.
  */
 //------------------------------------------------------------------------------
 #ifndef Earth_hpp
@@ -89,6 +90,13 @@ public:
                                                  Real &rtAsc, Real     &decl);
    /// Get the mean equatorial radius
    Real                     GetRadius();
+
+   /// Constants of the Earth model (also used by the array conversions)
+   static const Real        MU;             // km^3/s^2
+   static const Real        RADIUS;         // km
+   static const Real        FLATTENING;
+   static const Real        J2_TERM;
+   static const Real        ROTATION_RATE;  // rad/s
    
 protected:
    
@@ -100,10 +108,5 @@ protected:
    Real      radius;  // km
    /// Flattening of the Earth
    Real      flattening;
-   
-   /// Local class data for performance
-   Rmatrix33 rotationResult;
-   /// Save the last computd rotation time, for performance
-   Real      lastRotationTime;
 };
 #endif // Earth_hpp
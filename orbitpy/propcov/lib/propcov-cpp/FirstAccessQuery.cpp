@@ -0,0 +1,361 @@
+//------------------------------------------------------------------------------
+//                           FirstAccessQuery
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the FirstAccessQuery class
+ */
+//------------------------------------------------------------------------------
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "FirstAccessQuery.hpp"
+#include "CoverageChecker.hpp"
+#include "CoverageRunner.hpp"
+#include "Propagator.hpp"
+#include "AbsoluteDate.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_FIRST_ACCESS
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// FirstAccessQuery(PointGroup *ptGroup, Spacecraft *sat)
+//------------------------------------------------------------------------------
+/**
+ * Constructor.
+ *
+ * @param ptGroup  pointer to the PointGroup object to use
+ * @param sat      pointer to the (first) Spacecraft object to use
+ *
+ */
+//------------------------------------------------------------------------------
+FirstAccessQuery::FirstAccessQuery(PointGroup *ptGroup, Spacecraft *sat) :
+   pointGroup     (ptGroup),
+   coverageTime   (-1.0),
+   numStepsRun    (0)
+{
+   if (!pointGroup)
+      throw TATCException("FirstAccessQuery: NULL point group\n");
+   AddSpacecraft(sat);
+}
+
+//------------------------------------------------------------------------------
+// FirstAccessQuery(const FirstAccessQuery &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the FirstAccessQuery object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+FirstAccessQuery::FirstAccessQuery(const FirstAccessQuery &copy) :
+   pointGroup        (copy.pointGroup),
+   spacecraft        (copy.spacecraft),
+   firstAccessTimes  (copy.firstAccessTimes),
+   uncovered         (copy.uncovered),
+   uncoveredPos      (copy.uncoveredPos),
+   coverageTime      (copy.coverageTime),
+   numStepsRun       (copy.numStepsRun)
+{
+}
+
+//------------------------------------------------------------------------------
+// FirstAccessQuery& operator=(const FirstAccessQuery &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for FirstAccessQuery.
+ *
+ * @param copy  the FirstAccessQuery object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+FirstAccessQuery& FirstAccessQuery::operator=(const FirstAccessQuery &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   pointGroup        = copy.pointGroup;
+   spacecraft        = copy.spacecraft;
+   firstAccessTimes  = copy.firstAccessTimes;
+   uncovered         = copy.uncovered;
+   uncoveredPos      = copy.uncoveredPos;
+   coverageTime      = copy.coverageTime;
+   numStepsRun       = copy.numStepsRun;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~FirstAccessQuery()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+FirstAccessQuery::~FirstAccessQuery()
+{
+}
+
+//------------------------------------------------------------------------------
+// void AddSpacecraft(Spacecraft *sat)
+//------------------------------------------------------------------------------
+/**
+ * Adds a spacecraft; a point is accessed when it is covered by any of the
+ * spacecraft.
+ *
+ * @param sat  pointer to the Spacecraft object
+ *
+ */
+//------------------------------------------------------------------------------
+void FirstAccessQuery::AddSpacecraft(Spacecraft *sat)
+{
+   if (!sat)
+      throw TATCException("FirstAccessQuery: NULL spacecraft\n");
+   spacecraft.push_back(sat);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumSpacecraft() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of spacecraft.
+ *
+ * @return  number of spacecraft
+ *
+ */
+//------------------------------------------------------------------------------
+Integer FirstAccessQuery::GetNumSpacecraft() const
+{
+   return spacecraft.size();
+}
+
+//------------------------------------------------------------------------------
+// Integer Run(Real startJd, Real duration, Real stepSize,
+//             Real coverageFraction = 1.0)
+//------------------------------------------------------------------------------
+/**
+ * Runs the query.
+ *
+ * @param startJd           start time (JDUT1)
+ * @param duration          maximum duration (days)
+ * @param stepSize          step size (s)
+ * @param coverageFraction  fraction of the points, in (0, 1], after the
+ *                          coverage of which the run stops
+ *
+ * @return  number of steps run
+ *
+ */
+//------------------------------------------------------------------------------
+Integer FirstAccessQuery::Run(Real startJd, Real duration, Real stepSize,
+                              Real coverageFraction)
+{
+   if (coverageFraction <= 0.0 || coverageFraction > 1.0)
+      throw TATCException("FirstAccessQuery: coverage fraction must be in "
+                          "(0, 1]\n");
+   Integer numSteps = CoverageRunner::GetNumSteps(startJd, duration, stepSize);
+   Integer numPts   = pointGroup->GetNumPoints();
+   Integer target   = (Integer) std::ceil(coverageFraction * numPts - 1.0e-9);
+
+   firstAccessTimes.assign(numPts, -1.0);
+   uncovered.resize(numPts);
+   uncoveredPos.resize(numPts);
+   for (Integer ii = 0; ii < numPts; ii++)
+   {
+      uncovered[ii]    = ii;
+      uncoveredPos[ii] = ii;
+   }
+   coverageTime = -1.0;
+   numStepsRun  = 0;
+
+   // one copy, propagator and coverage checker per spacecraft
+   Integer numSats = spacecraft.size();
+   std::vector<Spacecraft*>      sats(numSats);
+   std::vector<Propagator*>      props(numSats);
+   std::vector<CoverageChecker*> checkers(numSats);
+   for (Integer ss = 0; ss < numSats; ss++)
+   {
+      sats[ss]     = new Spacecraft(*spacecraft[ss]);
+      props[ss]    = new Propagator(sats[ss]);
+      checkers[ss] = new CoverageChecker(pointGroup, sats[ss]);
+   }
+
+   AbsoluteDate date;
+   Real         stepDays = stepSize / GmatTimeConstants::SECS_PER_DAY;
+   try
+   {
+      for (Integer step = 0; step < numSteps && numPts - (Integer) uncovered.size() < target;
+           step++)
+      {
+         Real jd = startJd + step * stepDays;
+         date.SetJulianDate(jd);
+         for (Integer ss = 0; ss < numSats && !uncovered.empty(); ss++)
+         {
+            props[ss]->Propagate(date);
+            // the covered points are dropped after the check, so the array
+            // of uncovered points is not modified while it is being used
+            IntegerArray covered = checkers[ss]->CheckPointCoverage(uncovered);
+            for (Integer k = 0; k < (Integer) covered.size(); k++)
+               MarkCovered(covered[k], jd);
+         }
+         numStepsRun++;
+         if (coverageTime < 0.0 && numPts - (Integer) uncovered.size() >= target)
+            coverageTime = jd;
+
+         #ifdef DEBUG_FIRST_ACCESS
+            MessageInterface::ShowMessage("FirstAccessQuery: step %d, %d points "
+                                          "uncovered\n", step, (Integer) uncovered.size());
+         #endif
+      }
+   }
+   catch (...)
+   {
+      for (Integer ss = 0; ss < numSats; ss++)
+      {
+         delete checkers[ss];
+         delete props[ss];
+         delete sats[ss];
+      }
+      throw;
+   }
+   for (Integer ss = 0; ss < numSats; ss++)
+   {
+      delete checkers[ss];
+      delete props[ss];
+      delete sats[ss];
+   }
+   return numStepsRun;
+}
+
+//------------------------------------------------------------------------------
+// const RealArray& GetFirstAccessTimes() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the first access time of each point.
+ *
+ * @return  first access times (JDUT1), -1 for the points not accessed
+ *
+ */
+//------------------------------------------------------------------------------
+const RealArray& FirstAccessQuery::GetFirstAccessTimes() const
+{
+   return firstAccessTimes;
+}
+
+//------------------------------------------------------------------------------
+// Real GetCoverageTime() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the time at which the requested coverage fraction was reached.
+ *
+ * @return  time (JDUT1), -1 if the fraction was not reached
+ *
+ */
+//------------------------------------------------------------------------------
+Real FirstAccessQuery::GetCoverageTime() const
+{
+   return coverageTime;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumCovered() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of points accessed at least once.
+ *
+ * @return  number of points covered
+ *
+ */
+//------------------------------------------------------------------------------
+Integer FirstAccessQuery::GetNumCovered() const
+{
+   return firstAccessTimes.size() - uncovered.size();
+}
+
+//------------------------------------------------------------------------------
+// Real GetCoveredFraction() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the fraction of points accessed at least once.
+ *
+ * @return  fraction of points covered
+ *
+ */
+//------------------------------------------------------------------------------
+Real FirstAccessQuery::GetCoveredFraction() const
+{
+   if (firstAccessTimes.empty())
+      return 0.0;
+   return ((Real) GetNumCovered()) / firstAccessTimes.size();
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray GetUncoveredPoints() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the indices of the points not accessed during the last run.
+ *
+ * @return  indices of the uncovered points, in increasing order
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray FirstAccessQuery::GetUncoveredPoints() const
+{
+   IntegerArray result;
+   result.reserve(uncovered.size());
+   for (Integer ii = 0; ii < (Integer) firstAccessTimes.size(); ii++)
+      if (firstAccessTimes[ii] < 0.0)
+         result.push_back(ii);
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumStepsRun() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of steps run by the last run.
+ *
+ * @return  number of steps
+ *
+ */
+//------------------------------------------------------------------------------
+Integer FirstAccessQuery::GetNumStepsRun() const
+{
+   return numStepsRun;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void MarkCovered(Integer ptIdx, Real jd)
+//------------------------------------------------------------------------------
+/**
+ * Records the first access of a point and drops it from the uncovered points
+ * (swapping it with the last uncovered point).
+ *
+ * @param ptIdx  index of the point
+ * @param jd     time of the access (JDUT1)
+ *
+ */
+//------------------------------------------------------------------------------
+void FirstAccessQuery::MarkCovered(Integer ptIdx, Real jd)
+{
+   Integer pos = uncoveredPos[ptIdx];
+   if (pos < 0)
+      return;
+   firstAccessTimes[ptIdx] = jd;
+   Integer lastPt       = uncovered.back();
+   uncovered[pos]       = lastPt;
+   uncoveredPos[lastPt] = pos;
+   uncovered.pop_back();
+   uncoveredPos[ptIdx]  = -1;
+}
@@ -0,0 +1,84 @@
+//------------------------------------------------------------------------------
+//                           FirstAccessQuery
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the FirstAccessQuery class, which computes the time of the
+ * first access of each point of a point group by one or more spacecraft, and
+ * the time at which a requested fraction of the points has been accessed at
+ * least once.
+ *
+ * The query keeps the set of the points not yet covered: at each step only
+ * those points are checked for coverage, the points are dropped from the set
+ * as they are first covered, and the run stops as soon as the requested
+ * coverage fraction is reached. The cost of a step thus shrinks as the
+ * coverage fills in.
+ *
+ * The step times are the same as those of the CoverageRunner. The input
+ * spacecraft are not modified (copies of them are propagated).
+ */
+//------------------------------------------------------------------------------
+#ifndef FirstAccessQuery_hpp
+#define FirstAccessQuery_hpp
+
+#include <vector>
+#include "gmatdefs.hpp"
+#include "PointGroup.hpp"
+#include "Spacecraft.hpp"
+
+class FirstAccessQuery
+{
+public:
+
+   /// class construction/destruction
+   FirstAccessQuery(PointGroup *ptGroup, Spacecraft *sat);
+   FirstAccessQuery(const FirstAccessQuery &copy);
+   FirstAccessQuery& operator=(const FirstAccessQuery &copy);
+
+   virtual ~FirstAccessQuery();
+
+   /// Add a spacecraft (e.g. for a constellation)
+   void              AddSpacecraft(Spacecraft *sat);
+   /// Get the number of spacecraft
+   Integer           GetNumSpacecraft() const;
+
+   /// Run until the input fraction of the points is covered (or the end of
+   /// the duration) and return the number of steps run
+   virtual Integer   Run(Real startJd, Real duration, Real stepSize,
+                         Real coverageFraction = 1.0);
+
+   /// Get the first access time of each point (JDUT1, -1 if not accessed)
+   const RealArray&  GetFirstAccessTimes() const;
+   /// Get the time at which the coverage fraction was reached (-1 if not)
+   Real              GetCoverageTime() const;
+   /// Get the number/fraction of points accessed at least once
+   Integer           GetNumCovered() const;
+   Real              GetCoveredFraction() const;
+   /// Get the indices of the points never accessed during the run
+   IntegerArray      GetUncoveredPoints() const;
+   /// Get the number of steps run by the last run
+   Integer           GetNumStepsRun() const;
+
+protected:
+
+   /// the points to use for coverage
+   PointGroup                 *pointGroup;
+   /// the spacecraft (only copies of them are propagated)
+   std::vector<Spacecraft*>   spacecraft;
+
+   /// first access time of each point
+   RealArray                  firstAccessTimes;
+   /// the points not yet covered (unordered)
+   IntegerArray               uncovered;
+   /// position of each point in `uncovered` (-1 once covered)
+   IntegerArray               uncoveredPos;
+   /// time at which the coverage fraction was reached
+   Real                       coverageTime;
+   /// number of steps run
+   Integer                    numStepsRun;
+
+   /// Drop a point from the set of uncovered points
+   void                       MarkCovered(Integer ptIdx, Real jd);
+};
+#endif // FirstAccessQuery_hpp
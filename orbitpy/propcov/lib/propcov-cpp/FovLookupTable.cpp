@@ -0,0 +1,557 @@
+//------------------------------------------------------------------------------
+//                           FovLookupTable
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the FovLookupTable class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "gmatdefs.hpp"
+#include "GmatConstants.hpp"
+#include "FovLookupTable.hpp"
+#include "CoverageKernels.hpp"
+#include "GMATCustomSensor.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_FOV_LOOKUP
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// margin (rad) added to the cell ranges of the star-shaped classification,
+/// so the rounding of the cell index of a point is covered
+static const Real CELL_MARGIN = 1.0e-9;
+
+//------------------------------------------------------------------------------
+// static functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void ConeClockToStereographic(Real cone, Real clock, Real &x, Real &y)
+//------------------------------------------------------------------------------
+/**
+ * Stereographic projection of a cone and clock angle, computed as
+ * Sensor::ConeClockToStereographic.
+ */
+//------------------------------------------------------------------------------
+static void ConeClockToStereographic(Real cone, Real clock, Real &x, Real &y)
+{
+   Real dec    = GmatMathConstants::PI/2 - cone;
+   Real cosDec = cos(dec);
+   Real u0     = cosDec * cos(clock);
+   Real u1     = cosDec * sin(clock);
+   Real u2     = sin(dec);
+   x = u0 / (1 + u2);
+   y = u1 / (1 + u2);
+}
+
+//------------------------------------------------------------------------------
+// Real WrapClock(Real angle)
+//------------------------------------------------------------------------------
+/**
+ * Returns the angle in [0, 2pi).
+ */
+//------------------------------------------------------------------------------
+static Real WrapClock(Real angle)
+{
+   angle = fmod(angle, GmatMathConstants::TWO_PI);
+   if (angle < 0.0)
+      angle += GmatMathConstants::TWO_PI;
+   return (angle < GmatMathConstants::TWO_PI) ? angle : 0.0;
+}
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// FovLookupTable(Sensor *sensor, Integer coneCells, Integer clockCells)
+//------------------------------------------------------------------------------
+/**
+ * Constructor; classifies the cells of the sensor field of view.
+ *
+ * @param sensor      the sensor (not owned; must outlive the table)
+ * @param coneCells   number of cells over the cone angles [0, pi]
+ * @param clockCells  number of cells over the clock angles [0, 2pi)
+ *
+ */
+//------------------------------------------------------------------------------
+FovLookupTable::FovLookupTable(Sensor *sensor, Integer coneCells,
+                               Integer clockCells) :
+   sensor         (sensor),
+   numConeCells   (coneCells),
+   numClockCells  (clockCells),
+   coneScale      (coneCells / GmatMathConstants::PI),
+   clockScale     (clockCells / GmatMathConstants::TWO_PI)
+{
+   if (sensor == NULL)
+      throw TATCException("FovLookupTable: the sensor is NULL\n");
+   if (coneCells < 1 || clockCells < 1)
+      throw TATCException("FovLookupTable: the numbers of cells must be "
+                          "positive\n");
+   cells.resize(numConeCells * numClockCells);
+
+   bool star = false;
+   if (GetFovSensorKind(sensor) == GMAT_CUSTOM_SENSOR)
+   {
+      GMATCustomSensor *custom = (GMATCustomSensor*) sensor;
+      star = SetStarBoundary(custom->GetConeAngleVector(),
+                             custom->GetClockAngleVector());
+   }
+   if (star)
+      ClassifyStar();
+   else
+      ClassifySampled();
+
+   #ifdef DEBUG_FOV_LOOKUP
+      MessageInterface::ShowMessage(
+            "FovLookupTable: %d x %d cells, %d inside, %d boundary, star = %s\n",
+            numConeCells, numClockCells, GetNumCells(INSIDE_CELL),
+            GetNumCells(BOUNDARY_CELL), (star ? "true" : "false"));
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// FovLookupTable(const FovLookupTable &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor (the copy uses the same sensor).
+ *
+ * @param copy  the table to copy
+ *
+ */
+//------------------------------------------------------------------------------
+FovLookupTable::FovLookupTable(const FovLookupTable &copy) :
+   sensor         (copy.sensor),
+   numConeCells   (copy.numConeCells),
+   numClockCells  (copy.numClockCells),
+   coneScale      (copy.coneScale),
+   clockScale     (copy.clockScale),
+   cells          (copy.cells),
+   vertexClock    (copy.vertexClock),
+   vertexX        (copy.vertexX),
+   vertexY        (copy.vertexY)
+{
+}
+
+//------------------------------------------------------------------------------
+// FovLookupTable& operator=(const FovLookupTable &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for the FovLookupTable.
+ *
+ * @param copy  the table to copy
+ *
+ */
+//------------------------------------------------------------------------------
+FovLookupTable& FovLookupTable::operator=(const FovLookupTable &copy)
+{
+   if (&copy == this)
+      return *this;
+   sensor        = copy.sensor;
+   numConeCells  = copy.numConeCells;
+   numClockCells = copy.numClockCells;
+   coneScale     = copy.coneScale;
+   clockScale    = copy.clockScale;
+   cells         = copy.cells;
+   vertexClock   = copy.vertexClock;
+   vertexX       = copy.vertexX;
+   vertexY       = copy.vertexY;
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~FovLookupTable()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+FovLookupTable::~FovLookupTable()
+{
+}
+
+//------------------------------------------------------------------------------
+// Sensor* GetSensor() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the sensor of the table.
+ *
+ */
+//------------------------------------------------------------------------------
+Sensor* FovLookupTable::GetSensor() const
+{
+   return sensor;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumConeCells() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of cells over the cone angles.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer FovLookupTable::GetNumConeCells() const
+{
+   return numConeCells;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumClockCells() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of cells over the clock angles.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer FovLookupTable::GetNumClockCells() const
+{
+   return numClockCells;
+}
+
+//------------------------------------------------------------------------------
+// CellClass GetCellClass(Real viewConeAngle, Real viewClockAngle) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the class of the cell of a cone and clock angle; the angles out of
+ * the table are on the boundary (tested exactly).
+ *
+ * @param viewConeAngle  cone angle (rad)
+ * @param viewClockAngle clock angle (rad)
+ *
+ */
+//------------------------------------------------------------------------------
+FovLookupTable::CellClass FovLookupTable::GetCellClass(
+                                 Real viewConeAngle, Real viewClockAngle) const
+{
+   Real row = viewConeAngle * coneScale;
+   Real col = viewClockAngle * clockScale;
+   if (!(row >= 0.0 && row < numConeCells && col >= 0.0 &&
+         col < numClockCells))
+      return BOUNDARY_CELL;
+   return (CellClass) cells[(Integer) row * numClockCells + (Integer) col];
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumCells(CellClass cellClass) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of cells of a class.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer FovLookupTable::GetNumCells(CellClass cellClass) const
+{
+   return (Integer) std::count(cells.begin(), cells.end(),
+                               (unsigned char) cellClass);
+}
+
+//------------------------------------------------------------------------------
+// bool IsStarShaped() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the field of view is classified (and its boundary cells
+ * tested) with its exact star-shaped boundary.
+ *
+ */
+//------------------------------------------------------------------------------
+bool FovLookupTable::IsStarShaped() const
+{
+   return !vertexClock.empty();
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// bool CheckExact(Real viewConeAngle, Real viewClockAngle) const
+//------------------------------------------------------------------------------
+/**
+ * Exact test of a point of a boundary cell: the star-shaped boundary, or the
+ * sensor test.
+ *
+ * @param viewConeAngle  cone angle (rad)
+ * @param viewClockAngle clock angle (rad)
+ *
+ */
+//------------------------------------------------------------------------------
+bool FovLookupTable::CheckExact(Real viewConeAngle, Real viewClockAngle) const
+{
+   if (vertexClock.empty())
+      return sensor->CheckTargetVisibility(viewConeAngle, viewClockAngle);
+   if (!(viewConeAngle < GmatMathConstants::PI))
+      return false;
+   Real x, y;
+   ConeClockToStereographic(viewConeAngle, viewClockAngle, x, y);
+   return IsInsideStar(x, y, WrapClock(viewClockAngle));
+}
+
+//------------------------------------------------------------------------------
+// bool IsInsideStar(Real x, Real y, Real clock) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if a stereographic point is inside the star-shaped boundary: the
+ * edge crossing the clock angle of the point is found by binary search on the
+ * clock-sorted vertices, and the point is inside if it is on the boresight
+ * side of the edge.
+ *
+ * @param x      stereographic x coordinate
+ * @param y      stereographic y coordinate
+ * @param clock  clock angle of the point (rad, in [0, 2pi))
+ *
+ */
+//------------------------------------------------------------------------------
+bool FovLookupTable::IsInsideStar(Real x, Real y, Real clock) const
+{
+   Integer numVertices = (Integer) vertexClock.size();
+   Integer ii = (Integer) (std::upper_bound(vertexClock.begin(),
+                                            vertexClock.end(), clock) -
+                           vertexClock.begin()) - 1;
+   if (ii < 0)
+      ii = numVertices - 1;
+   Integer jj = (ii + 1) % numVertices;
+   // the vertices are counterclockwise: the boresight is left of the edges
+   Real ex = vertexX[jj] - vertexX[ii];
+   Real ey = vertexY[jj] - vertexY[ii];
+   return ex * (y - vertexY[ii]) - ey * (x - vertexX[ii]) > 0.0;
+}
+
+//------------------------------------------------------------------------------
+// bool SetStarBoundary(const Rvector &coneAngles, const Rvector &clockAngles)
+//------------------------------------------------------------------------------
+/**
+ * Sets the star-shaped boundary of a custom sensor: the stereographic
+ * projections of its vertices (repeated vertices removed), counterclockwise
+ * and starting from the smallest clock angle. The boundary is star-shaped
+ * around the boresight if the clock angles of the vertices turn once around
+ * it, in one direction, by less than pi per edge.
+ *
+ * @param coneAngles   cone angles of the vertices (rad)
+ * @param clockAngles  clock angles of the vertices (rad)
+ *
+ * @return  true if the boundary is star-shaped (and set)
+ *
+ */
+//------------------------------------------------------------------------------
+bool FovLookupTable::SetStarBoundary(const Rvector &coneAngles,
+                                     const Rvector &clockAngles)
+{
+   RealArray xs, ys;
+   for (Integer ii = 0; ii < coneAngles.GetSize(); ii++)
+   {
+      Real x, y;
+      ConeClockToStereographic(coneAngles[ii], clockAngles[ii], x, y);
+      if (!xs.empty() && x == xs.back() && y == ys.back())
+         continue;
+      xs.push_back(x);
+      ys.push_back(y);
+   }
+   while (xs.size() > 1 && xs.back() == xs.front() && ys.back() == ys.front())
+   {
+      xs.pop_back();
+      ys.pop_back();
+   }
+   Integer numVertices = (Integer) xs.size();
+   if (numVertices < 3)
+      return false;
+
+   RealArray angles(numVertices);
+   for (Integer ii = 0; ii < numVertices; ii++)
+   {
+      if (xs[ii] == 0.0 && ys[ii] == 0.0)
+         return false;
+      angles[ii] = WrapClock(atan2(ys[ii], xs[ii]));
+   }
+   Real total = 0.0, sign = 0.0;
+   for (Integer ii = 0; ii < numVertices; ii++)
+   {
+      Real delta = angles[(ii + 1) % numVertices] - angles[ii];
+      if (delta > GmatMathConstants::PI)
+         delta -= GmatMathConstants::TWO_PI;
+      else if (delta <= -GmatMathConstants::PI)
+         delta += GmatMathConstants::TWO_PI;
+      if (delta == 0.0 || fabs(delta) >= GmatMathConstants::PI ||
+          (sign != 0.0 && delta * sign < 0.0))
+         return false;
+      sign   = (delta > 0.0) ? 1.0 : -1.0;
+      total += delta;
+   }
+   if (fabs(fabs(total) - GmatMathConstants::TWO_PI) > 1.0e-9)
+      return false;
+
+   // counterclockwise, from the smallest clock angle
+   std::vector<Integer> order(numVertices);
+   for (Integer ii = 0; ii < numVertices; ii++)
+      order[ii] = (sign > 0.0) ? ii : numVertices - 1 - ii;
+   std::rotate(order.begin(),
+               std::min_element(order.begin(), order.end(),
+                                [&angles](Integer a, Integer b)
+                                { return angles[a] < angles[b]; }),
+               order.end());
+   vertexClock.resize(numVertices);
+   vertexX.resize(numVertices);
+   vertexY.resize(numVertices);
+   for (Integer ii = 0; ii < numVertices; ii++)
+   {
+      vertexClock[ii] = angles[order[ii]];
+      vertexX[ii]     = xs[order[ii]];
+      vertexY[ii]     = ys[order[ii]];
+   }
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Real GetBoundaryRadius(Integer ii, Real clock) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the stereographic radius of the point of the edge from vertex ii
+ * (to the next one) in the direction of a clock angle.
+ *
+ * @param ii     index of the first vertex of the edge
+ * @param clock  clock angle (rad)
+ *
+ */
+//------------------------------------------------------------------------------
+Real FovLookupTable::GetBoundaryRadius(Integer ii, Real clock) const
+{
+   Integer jj = (ii + 1) % (Integer) vertexClock.size();
+   Real ex = vertexX[jj] - vertexX[ii];
+   Real ey = vertexY[jj] - vertexY[ii];
+   // the ray r (cos, sin) meets the line of the edge where
+   // r (u x e) = a x b
+   return (vertexX[ii] * vertexY[jj] - vertexY[ii] * vertexX[jj]) /
+          (cos(clock) * ey - sin(clock) * ex);
+}
+
+//------------------------------------------------------------------------------
+// void ClassifyStar()
+//------------------------------------------------------------------------------
+/**
+ * Classifies the cells with the star-shaped boundary. For each clock column,
+ * the smallest and largest boundary radii over the column are those of its
+ * ends, of the vertices within it and of the points of the edges closest to
+ * the boresight (the radius along an edge is convex); the cells of the column
+ * below the smallest radius are inside, those above the largest outside. The
+ * cone angle maps to the stereographic radius tan(cone/2).
+ *
+ */
+//------------------------------------------------------------------------------
+void FovLookupTable::ClassifyStar()
+{
+   const Real TWO_PI      = GmatMathConstants::TWO_PI;
+   Integer    numVertices = (Integer) vertexClock.size();
+   for (Integer col = 0; col < numClockCells; col++)
+   {
+      Real colStart = col / clockScale - CELL_MARGIN;
+      Real colEnd   = (col + 1) / clockScale + CELL_MARGIN;
+      Real minRadius = std::numeric_limits<Real>::max();
+      Real maxRadius = 0.0;
+      for (Integer ii = 0; ii < numVertices; ii++)
+      {
+         Integer jj        = (ii + 1) % numVertices;
+         Real    edgeStart = vertexClock[ii];
+         Real    edgeEnd   = vertexClock[jj] + (jj == 0 ? TWO_PI : 0.0);
+         for (Real shift = -TWO_PI; shift <= TWO_PI; shift += TWO_PI)
+         {
+            Real lo = std::max(edgeStart, colStart + shift);
+            Real hi = std::min(edgeEnd, colEnd + shift);
+            if (lo > hi)
+               continue;
+            Real radiusLo = GetBoundaryRadius(ii, lo);
+            Real radiusHi = GetBoundaryRadius(ii, hi);
+            minRadius = std::min(minRadius, std::min(radiusLo, radiusHi));
+            maxRadius = std::max(maxRadius, std::max(radiusLo, radiusHi));
+            // point of the edge closest to the boresight
+            Real ex = vertexX[jj] - vertexX[ii];
+            Real ey = vertexY[jj] - vertexY[ii];
+            Real t  = -(vertexX[ii] * ex + vertexY[ii] * ey) /
+                      (ex * ex + ey * ey);
+            if (t > 0.0 && t < 1.0)
+            {
+               Real fx = vertexX[ii] + t * ex, fy = vertexY[ii] + t * ey;
+               Real footClock = WrapClock(atan2(fy, fx));
+               if (footClock < edgeStart)
+                  footClock += TWO_PI;
+               if (footClock >= lo && footClock <= hi)
+                  minRadius = std::min(minRadius, sqrt(fx * fx + fy * fy));
+            }
+         }
+      }
+      for (Integer row = 0; row < numConeCells; row++)
+      {
+         Real coneStart = std::max(row / coneScale - CELL_MARGIN, 0.0);
+         Real coneEnd   = (row + 1) / coneScale + CELL_MARGIN;
+         Real radiusStart = tan(coneStart / 2.0);
+         Real radiusEnd   = (coneEnd < GmatMathConstants::PI) ?
+                            tan(coneEnd / 2.0) :
+                            std::numeric_limits<Real>::max();
+         unsigned char cell = BOUNDARY_CELL;
+         if (radiusEnd < minRadius)
+            cell = INSIDE_CELL;
+         else if (radiusStart > maxRadius)
+            cell = OUTSIDE_CELL;
+         cells[row * numClockCells + col] = cell;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void ClassifySampled()
+//------------------------------------------------------------------------------
+/**
+ * Classifies the cells by sampling the sensor test on the corners and edge
+ * midpoints of the cells (a grid of half cells). The cells with all samples
+ * inside (outside) are inside (outside), the others on the boundary; the
+ * neighbours of the boundary cells are then also boundary cells.
+ *
+ */
+//------------------------------------------------------------------------------
+void FovLookupTable::ClassifySampled()
+{
+   Integer sampleRows = 2 * numConeCells + 1;
+   Integer sampleCols = 2 * numClockCells;   // the clock angles wrap
+   std::vector<unsigned char> samples(sampleRows * sampleCols);
+   for (Integer ii = 0; ii < sampleRows; ii++)
+   {
+      Real cone = ii / (2.0 * coneScale);
+      for (Integer jj = 0; jj < sampleCols; jj++)
+         samples[ii * sampleCols + jj] =
+               sensor->CheckTargetVisibility(cone, jj / (2.0 * clockScale));
+   }
+
+   std::vector<unsigned char> sampled(cells.size());
+   for (Integer row = 0; row < numConeCells; row++)
+      for (Integer col = 0; col < numClockCells; col++)
+      {
+         Integer numInside = 0;
+         for (Integer ii = 2*row; ii <= 2*row + 2; ii++)
+            for (Integer jj = 2*col; jj <= 2*col + 2; jj++)
+               numInside += samples[ii * sampleCols + jj % sampleCols];
+         sampled[row * numClockCells + col] =
+               (numInside == 9) ? INSIDE_CELL :
+               (numInside == 0) ? OUTSIDE_CELL : BOUNDARY_CELL;
+      }
+
+   for (Integer row = 0; row < numConeCells; row++)
+      for (Integer col = 0; col < numClockCells; col++)
+      {
+         unsigned char cell = sampled[row * numClockCells + col];
+         for (Integer ii = std::max(row - 1, 0);
+              ii <= std::min(row + 1, numConeCells - 1); ii++)
+            for (Integer dj = -1; dj <= 1; dj++)
+            {
+               Integer jj = (col + dj + numClockCells) % numClockCells;
+               if (sampled[ii * numClockCells + jj] == BOUNDARY_CELL)
+                  cell = BOUNDARY_CELL;
+            }
+         cells[row * numClockCells + col] = cell;
+      }
+}
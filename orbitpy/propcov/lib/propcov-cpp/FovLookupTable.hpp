@@ -0,0 +1,138 @@
+//------------------------------------------------------------------------------
+//                           FovLookupTable
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the FovLookupTable class, an optional acceleration structure
+ * of the field-of-view test of any Sensor (Sensor::CheckTargetVisibility).
+ *
+ * The cone/clock plane of the sensor, cone in [0, pi] and clock in [0, 2pi),
+ * is rasterized at construction into cells flagged as inside, outside or on
+ * the boundary of the field of view. A point in an inside or outside cell is
+ * answered with one table read; a point in a boundary cell falls through to
+ * the exact test.
+ *
+ * Custom sensors (GMATCustomSensor) whose field of view is star-shaped around
+ * the boresight, i.e. whose vertices are in clock order, are classified
+ * exactly: the polygon (straight edges in the stereographic plane) gives the
+ * boundary radius as a function of the clock angle, and its extremes over a
+ * clock column bound the cells. Their boundary cells are tested on the
+ * clock-sorted vertices (binary search of the edge crossing the clock angle
+ * and a side test) instead of the line-crossing test of the sensor.
+ *
+ * The cells of the other sensors are classified by sampling the sensor test
+ * on the corners and edge midpoints of the cells; the cells with mixed
+ * samples and their neighbours are boundary cells, so a boundary bulging
+ * between the samples of a cell into the next one is still tested exactly.
+ * Field-of-view features narrower than half a cell (e.g. a spike passing
+ * between the samples) are not resolved: the table resolution must be chosen
+ * accordingly.
+ *
+ * The table is built from the sensor parameters at construction; it must be
+ * rebuilt if they change. Its queries are const, so a table can be shared by
+ * threads (the boundary cells call the sensor test).
+ */
+//------------------------------------------------------------------------------
+#ifndef FovLookupTable_hpp
+#define FovLookupTable_hpp
+
+#include <vector>
+#include "gmatdefs.hpp"
+#include "Sensor.hpp"
+
+class FovLookupTable
+{
+public:
+
+   /// Classification of a cell
+   enum CellClass
+   {
+      OUTSIDE_CELL  = 0,
+      INSIDE_CELL   = 1,
+      BOUNDARY_CELL = 2
+   };
+
+   /// class construction/destruction
+   FovLookupTable(Sensor *sensor, Integer coneCells = 128,
+                  Integer clockCells = 256);
+   FovLookupTable(const FovLookupTable &copy);
+   FovLookupTable& operator=(const FovLookupTable &copy);
+
+   virtual ~FovLookupTable();
+
+   //---------------------------------------------------------------------------
+   // bool CheckTargetVisibility(Real viewConeAngle, Real viewClockAngle) const
+   //---------------------------------------------------------------------------
+   /**
+    * Checks the target visibility given the input cone and clock angles, with
+    * the result of Sensor::CheckTargetVisibility.
+    *
+    * @param viewConeAngle  cone angle (rad)
+    * @param viewClockAngle clock angle (rad, in [0, 2pi))
+    *
+    * @return true if the point is in the sensor FOV; false otherwise
+    */
+   //---------------------------------------------------------------------------
+   bool           CheckTargetVisibility(Real viewConeAngle,
+                                        Real viewClockAngle) const
+   {
+      Real    row = viewConeAngle * coneScale;
+      Real    col = viewClockAngle * clockScale;
+      if (row >= 0.0 && row < numConeCells && col >= 0.0 &&
+          col < numClockCells)
+      {
+         unsigned char cell = cells[(Integer) row * numClockCells +
+                                    (Integer) col];
+         if (cell != BOUNDARY_CELL)
+            return cell == INSIDE_CELL;
+      }
+      return CheckExact(viewConeAngle, viewClockAngle);
+   }
+
+   /// Get the sensor and the dimensions of the table
+   Sensor*        GetSensor() const;
+   Integer        GetNumConeCells() const;
+   Integer        GetNumClockCells() const;
+   /// Get the class of the cell of a cone and clock angle (rad)
+   CellClass      GetCellClass(Real viewConeAngle, Real viewClockAngle) const;
+   /// Get the number of cells of a class
+   Integer        GetNumCells(CellClass cellClass) const;
+   /// Is the field of view classified with its exact star-shaped boundary?
+   bool           IsStarShaped() const;
+
+protected:
+
+   /// the sensor (not owned)
+   Sensor                     *sensor;
+   /// number of cone (rows) and clock (columns) cells
+   Integer                    numConeCells;
+   Integer                    numClockCells;
+   /// cells per radian of cone and clock
+   Real                       coneScale;
+   Real                       clockScale;
+   /// class of each cell (row major, numConeCells x numClockCells)
+   std::vector<unsigned char> cells;
+   /// star-shaped boundary: stereographic coordinates of the vertices sorted
+   /// by clock angle (vertexClock, in [0, 2pi)); empty if not star-shaped
+   RealArray                  vertexClock;
+   RealArray                  vertexX;
+   RealArray                  vertexY;
+
+   /// Exact test of a point of a boundary cell
+   bool           CheckExact(Real viewConeAngle, Real viewClockAngle) const;
+   /// Is the stereographic point inside the star-shaped boundary?
+   bool           IsInsideStar(Real x, Real y, Real clock) const;
+   /// Set the star-shaped boundary of a custom sensor (false if its vertices
+   /// are not in clock order around the boresight)
+   bool           SetStarBoundary(const Rvector &coneAngles,
+                                  const Rvector &clockAngles);
+   /// Boundary radius (stereographic) of the edge from vertex ii in the
+   /// direction of a clock angle
+   Real           GetBoundaryRadius(Integer ii, Real clock) const;
+   /// Classify the cells with the star-shaped boundary
+   void           ClassifyStar();
+   /// Classify the cells by sampling the sensor test
+   void           ClassifySampled();
+};
+#endif // FovLookupTable_hpp
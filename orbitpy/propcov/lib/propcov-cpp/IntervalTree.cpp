@@ -0,0 +1,382 @@
+//------------------------------------------------------------------------------
+//                           IntervalTree
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the IntervalTree class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <numeric>
+#include <cmath>            // for INFINITY
+#include "gmatdefs.hpp"
+#include "IntervalTree.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+// None
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// IntervalTree()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor.
+ *
+ */
+//------------------------------------------------------------------------------
+IntervalTree::IntervalTree() :
+   isBuilt     (true)
+{
+}
+
+//------------------------------------------------------------------------------
+// IntervalTree(const IntervalTree &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the IntervalTree object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+IntervalTree::IntervalTree(const IntervalTree &copy) :
+   starts      (copy.starts),
+   stops       (copy.stops),
+   ids         (copy.ids),
+   maxStops    (copy.maxStops),
+   isBuilt     (copy.isBuilt)
+{
+}
+
+//------------------------------------------------------------------------------
+// IntervalTree& operator=(const IntervalTree &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for IntervalTree.
+ *
+ * @param copy  the IntervalTree object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+IntervalTree& IntervalTree::operator=(const IntervalTree &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   starts   = copy.starts;
+   stops    = copy.stops;
+   ids      = copy.ids;
+   maxStops = copy.maxStops;
+   isBuilt  = copy.isBuilt;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~IntervalTree()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+IntervalTree::~IntervalTree()
+{
+}
+
+//------------------------------------------------------------------------------
+// void Add(Real start, Real stop, Integer id)
+//------------------------------------------------------------------------------
+/**
+ * Adds an interval to the tree. The tree is to be rebuilt (Build()) before
+ * it is queried again.
+ *
+ * @param start  start of the interval
+ * @param stop   stop of the interval (must be >= start)
+ * @param id     id of the interval, reported by the queries
+ *
+ */
+//------------------------------------------------------------------------------
+void IntervalTree::Add(Real start, Real stop, Integer id)
+{
+   if (stop < start)
+      throw TATCException("IntervalTree: interval stop is before its start\n");
+   starts.push_back(start);
+   stops.push_back(stop);
+   ids.push_back(id);
+   isBuilt = false;
+}
+
+//------------------------------------------------------------------------------
+// void Build()
+//------------------------------------------------------------------------------
+/**
+ * Sorts the intervals by start time and computes the maximum stop time of
+ * each (implicit) subtree.
+ *
+ */
+//------------------------------------------------------------------------------
+void IntervalTree::Build()
+{
+   Integer numIntervals = starts.size();
+
+   IntegerArray order(numIntervals);
+   std::iota(order.begin(), order.end(), 0);
+   std::sort(order.begin(), order.end(),
+             [this](Integer a, Integer b)
+             {
+                if (starts[a] != starts[b])
+                   return starts[a] < starts[b];
+                return ids[a] < ids[b];
+             });
+
+   RealArray    sortedStarts(numIntervals);
+   RealArray    sortedStops(numIntervals);
+   IntegerArray sortedIds(numIntervals);
+   for (Integer ii = 0; ii < numIntervals; ii++)
+   {
+      sortedStarts[ii] = starts[order[ii]];
+      sortedStops[ii]  = stops[order[ii]];
+      sortedIds[ii]    = ids[order[ii]];
+   }
+   starts.swap(sortedStarts);
+   stops.swap(sortedStops);
+   ids.swap(sortedIds);
+
+   maxStops.assign(numIntervals, 0.0);
+   BuildMaxStops(0, numIntervals);
+   isBuilt = true;
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all the intervals from the tree.
+ *
+ */
+//------------------------------------------------------------------------------
+void IntervalTree::Clear()
+{
+   starts.clear();
+   stops.clear();
+   ids.clear();
+   maxStops.clear();
+   isBuilt = true;
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray Overlapping(Real qStart, Real qStop) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the ids of the intervals which overlap the closed query interval
+ * [qStart, qStop]. The ids are reported in increasing order of interval start.
+ *
+ * @param qStart  start of the query interval
+ * @param qStop   stop of the query interval
+ *
+ * @return  ids of the overlapping intervals
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray IntervalTree::Overlapping(Real qStart, Real qStop) const
+{
+   IntegerArray result;
+   Overlapping(qStart, qStop, result);
+   return result;
+}
+
+//------------------------------------------------------------------------------
+// void Overlapping(Real qStart, Real qStop, IntegerArray &result) const
+//------------------------------------------------------------------------------
+/**
+ * Appends the ids of the intervals which overlap the closed query interval
+ * [qStart, qStop] to the input array (which is not cleared).
+ *
+ * @param qStart  start of the query interval
+ * @param qStop   stop of the query interval
+ * @param result  array to which the ids are appended
+ *
+ */
+//------------------------------------------------------------------------------
+void IntervalTree::Overlapping(Real qStart, Real qStop,
+                               IntegerArray &result) const
+{
+   if (!isBuilt)
+      throw TATCException("IntervalTree: Build() must be called before "
+                          "querying the tree\n");
+   if (qStop < qStart)
+      return;
+   Query(0, starts.size(), qStart, qStop, result);
+}
+
+//------------------------------------------------------------------------------
+// IntegerArray Containing(Real t) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the ids of the intervals which contain the input time.
+ *
+ * @param t  query time
+ *
+ * @return  ids of the intervals containing the time
+ *
+ */
+//------------------------------------------------------------------------------
+IntegerArray IntervalTree::Containing(Real t) const
+{
+   return Overlapping(t, t);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumIntervals() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of intervals in the tree.
+ *
+ * @return  number of intervals
+ *
+ */
+//------------------------------------------------------------------------------
+Integer IntervalTree::GetNumIntervals() const
+{
+   return starts.size();
+}
+
+//------------------------------------------------------------------------------
+// Real GetStart(Integer idx) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the start of the idx-th interval (in order of start time, once built).
+ *
+ * @param idx  position of the interval
+ *
+ * @return  start of the interval
+ *
+ */
+//------------------------------------------------------------------------------
+Real IntervalTree::GetStart(Integer idx) const
+{
+   return starts.at(idx);
+}
+
+//------------------------------------------------------------------------------
+// Real GetStop(Integer idx) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the stop of the idx-th interval (in order of start time, once built).
+ *
+ * @param idx  position of the interval
+ *
+ * @return  stop of the interval
+ *
+ */
+//------------------------------------------------------------------------------
+Real IntervalTree::GetStop(Integer idx) const
+{
+   return stops.at(idx);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetId(Integer idx) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the id of the idx-th interval (in order of start time, once built).
+ *
+ * @param idx  position of the interval
+ *
+ * @return  id of the interval
+ *
+ */
+//------------------------------------------------------------------------------
+Integer IntervalTree::GetId(Integer idx) const
+{
+   return ids.at(idx);
+}
+
+//------------------------------------------------------------------------------
+// bool IsBuilt() const
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the tree has been built after the last interval was added.
+ *
+ * @return  flag indicating if the tree can be queried
+ *
+ */
+//------------------------------------------------------------------------------
+bool IntervalTree::IsBuilt() const
+{
+   return isBuilt;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Real BuildMaxStops(Integer lo, Integer hi)
+//------------------------------------------------------------------------------
+/**
+ * Computes the maximum stop time of the (implicit) subtree spanning the range
+ * [lo, hi) of the sorted arrays. The subtree root is the middle element.
+ *
+ * @param lo  first index of the range
+ * @param hi  one past the last index of the range
+ *
+ * @return  maximum stop time within the range
+ *
+ */
+//------------------------------------------------------------------------------
+Real IntervalTree::BuildMaxStops(Integer lo, Integer hi)
+{
+   if (lo >= hi)
+      return -INFINITY;
+   Integer mid    = lo + (hi - lo) / 2;
+   Real    maxVal = stops[mid];
+   maxVal = std::max(maxVal, BuildMaxStops(lo, mid));
+   maxVal = std::max(maxVal, BuildMaxStops(mid + 1, hi));
+   maxStops[mid] = maxVal;
+   return maxVal;
+}
+
+//------------------------------------------------------------------------------
+// void Query(Integer lo, Integer hi, Real qStart, Real qStop,
+//            IntegerArray &result) const
+//------------------------------------------------------------------------------
+/**
+ * Reports the intervals overlapping [qStart, qStop] within the (implicit)
+ * subtree spanning the range [lo, hi). Subtrees whose maximum stop time is before
+ * qStart, and right subtrees whose root starts after qStop, are pruned.
+ *
+ * @param lo      first index of the range
+ * @param hi      one past the last index of the range
+ * @param qStart  start of the query interval
+ * @param qStop   stop of the query interval
+ * @param result  array to which the ids are appended
+ *
+ */
+//------------------------------------------------------------------------------
+void IntervalTree::Query(Integer lo, Integer hi, Real qStart, Real qStop,
+                         IntegerArray &result) const
+{
+   while (lo < hi)
+   {
+      Integer mid = lo + (hi - lo) / 2;
+      if (maxStops[mid] < qStart)
+         return;
+      Query(lo, mid, qStart, qStop, result);
+      if (starts[mid] > qStop)
+         return;
+      if (stops[mid] >= qStart)
+         result.push_back(ids[mid]);
+      // continue with the right subtree (tail iteration)
+      lo = mid + 1;
+   }
+}
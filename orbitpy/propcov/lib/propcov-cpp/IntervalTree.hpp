@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+//                           IntervalTree
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the IntervalTree class. A static, augmented interval tree
+ * over closed intervals [start, stop], each tagged with an integer id.
+ *
+ * The intervals are sorted by start time and stored in a flat array. The array
+ * is treated as an implicit balanced binary search tree (the node of a range is
+ * its middle element) and each node stores the maximum stop time of its subtree.
+ * An overlap query visits only the subtrees which can contain overlapping intervals,
+ * i.e. it runs in O(log n + k) where k is the number of reported intervals.
+ *
+ * The tree is built once (Build(.)) after all the intervals have been added, and
+ * is immutable afterwards (queries are const and can be run concurrently).
+ */
+//------------------------------------------------------------------------------
+#ifndef IntervalTree_hpp
+#define IntervalTree_hpp
+
+#include "gmatdefs.hpp"
+
+class IntervalTree
+{
+public:
+
+   /// class construction/destruction
+   IntervalTree();
+   IntervalTree(const IntervalTree &copy);
+   IntervalTree& operator=(const IntervalTree &copy);
+
+   virtual ~IntervalTree();
+
+   /// Add an interval; the tree must be (re)built before querying
+   void          Add(Real start, Real stop, Integer id);
+   /// Sort the intervals and compute the subtree maximum stop times
+   void          Build();
+   /// Remove all the intervals
+   void          Clear();
+
+   /// Get the ids of the intervals overlapping [qStart, qStop]
+   IntegerArray  Overlapping(Real qStart, Real qStop) const;
+   /// Append the ids of the intervals overlapping [qStart, qStop] to the input array
+   void          Overlapping(Real qStart, Real qStop, IntegerArray &ids) const;
+   /// Get the ids of the intervals containing the input time
+   IntegerArray  Containing(Real t) const;
+
+   /// Get the number of intervals
+   Integer       GetNumIntervals() const;
+   /// Get the start/stop/id of the i-th interval (in start-sorted order)
+   Real          GetStart(Integer idx) const;
+   Real          GetStop(Integer idx) const;
+   Integer       GetId(Integer idx) const;
+   /// Has the tree been built since the last Add(.)?
+   bool          IsBuilt() const;
+
+protected:
+
+   /// Start times (sorted after Build())
+   RealArray     starts;
+   /// Stop times
+   RealArray     stops;
+   /// Ids of the intervals
+   IntegerArray  ids;
+   /// Maximum stop time of the subtree rooted at each node
+   RealArray     maxStops;
+   /// flag indicating if the tree is built
+   bool          isBuilt;
+
+   /// Compute the subtree maximum stop times of the range [lo, hi)
+   Real          BuildMaxStops(Integer lo, Integer hi);
+   /// Recursive overlap query over the range [lo, hi)
+   void          Query(Integer lo, Integer hi, Real qStart, Real qStop,
+                       IntegerArray &result) const;
+};
+#endif // IntervalTree_hpp
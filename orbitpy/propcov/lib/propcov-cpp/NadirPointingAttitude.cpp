@@ -141,27 +141,27 @@ Attitude* NadirPointingAttitude::Clone() const
 //------------------------------------------------------------------------------
 Rmatrix33 NadirPointingAttitude::InertialToReference(const Rvector6& centralBodyState)
 {
+   // only local data, so that the attitude can be shared by threads
+   Rvector3      centralInertialPos(centralBodyState[0],
+                                    centralBodyState[1],
+                                    centralBodyState[2]);
+   Rvector3      centralInertialVel(centralBodyState[3],
+                                    centralBodyState[4],
+                                    centralBodyState[5]);
    Rvector3      zHat;
    Rvector3      xHat;
    Rvector3      yHat;
 
-   centralInertialPos.Set(centralBodyState[0],
-                           centralBodyState[1],
-                           centralBodyState[2]);
-   centralInertialVel.Set(centralBodyState[3],
-                           centralBodyState[4],
-                           centralBodyState[5]);
    zHat = -centralInertialPos;
    zHat.Normalize();
    xHat = Cross(zHat, centralInertialVel);
    xHat = -xHat.Normalize();
    yHat = Cross(zHat, xHat);
    
-   R_inertial_to_nadir_transposed.Set(xHat[0], yHat[0], zHat[0],
-                        xHat[1], yHat[1], zHat[1],
-                        xHat[2], yHat[2], zHat[2]);
-   R_inertial_to_nadir = R_inertial_to_nadir_transposed.Transpose();
-   return R_inertial_to_nadir;
+   Rmatrix33 R_inertial_to_nadir_transposed(xHat[0], yHat[0], zHat[0],
+                                            xHat[1], yHat[1], zHat[1],
+                                            xHat[2], yHat[2], zHat[2]);
+   return R_inertial_to_nadir_transposed.Transpose();
 }
 
 //------------------------------------------------------------------------------
@@ -184,25 +184,25 @@ Rmatrix33 NadirPointingAttitude::InertialToReference(const Rvector6& centralBody
 //------------------------------------------------------------------------------
 Rmatrix33 NadirPointingAttitude::BodyFixedToReference(const Rvector6& centralBodyState)
 {
+   // only local data, so that the attitude can be shared by threads
+   Rvector3      centralBodyFixedPos(centralBodyState[0],
+                                     centralBodyState[1],
+                                     centralBodyState[2]);
+   Rvector3      centralBodyFixedVel(centralBodyState[3],
+                                     centralBodyState[4],
+                                     centralBodyState[5]);
    Rvector3      zHat;
    Rvector3      xHat;
    Rvector3      yHat;
 
-   centralBodyFixedPos.Set(centralBodyState[0],
-                           centralBodyState[1],
-                           centralBodyState[2]);
-   centralBodyFixedVel.Set(centralBodyState[3],
-                           centralBodyState[4],
-                           centralBodyState[5]);
    zHat = -centralBodyFixedPos;
    zHat.Normalize();
    xHat = Cross(zHat, centralBodyFixedVel);
    xHat = -xHat.Normalize();
    yHat = Cross(zHat, xHat);
    
-   R_fixed_to_nadir_transposed.Set(xHat[0], yHat[0], zHat[0],
-                        xHat[1], yHat[1], zHat[1],
-                        xHat[2], yHat[2], zHat[2]);
-   R_fixed_to_nadir = R_fixed_to_nadir_transposed.Transpose();
-   return R_fixed_to_nadir; 
+   Rmatrix33 R_fixed_to_nadir_transposed(xHat[0], yHat[0], zHat[0],
+                                         xHat[1], yHat[1], zHat[1],
+                                         xHat[2], yHat[2], zHat[2]);
+   return R_fixed_to_nadir_transposed.Transpose();
 }
\ No newline at end of file
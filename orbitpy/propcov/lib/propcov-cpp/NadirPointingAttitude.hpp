@@ -26,6 +26,7 @@
  * that models the Nadir-pointing coordinate frame. 
  * The main responsibility of this class is to compute the rotation from an inertial/body-fixed frame 
  * to the nadir pointing coordinate frame using the input (spacecraft) state-vector (position and velocity).
+ * The object has no state besides that of Attitude, so it can be shared by threads.
  */
 //------------------------------------------------------------------------------
 #ifndef NadirPointingAttitude_hpp
@@ -56,18 +57,5 @@ public:
    virtual Rmatrix33   BodyFixedToReference(const Rvector6& centralBodyState);
    
    
-protected:
-   
-   /// Local class data for performance
-   Rvector3      centralBodyFixedPos;
-   Rvector3      centralBodyFixedVel;
-   Rmatrix33     R_fixed_to_nadir;
-   Rmatrix33     R_fixed_to_nadir_transposed;
-
-   Rvector3      centralInertialPos;
-   Rvector3      centralInertialVel;
-   Rmatrix33     R_inertial_to_nadir;
-   Rmatrix33     R_inertial_to_nadir_transposed;  
-   
 };
 #endif // NadirPointingAttitude_hpp
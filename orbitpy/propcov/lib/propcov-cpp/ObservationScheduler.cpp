@@ -0,0 +1,825 @@
+//------------------------------------------------------------------------------
+//                           ObservationScheduler
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the ObservationScheduler class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <numeric>
+#include <iterator>
+#include <cmath>            // for INFINITY, nextafter
+#include "gmatdefs.hpp"
+#include "ObservationScheduler.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_SCHEDULER
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// tolerance (days, ~90 microseconds) on an observation fitting in its access
+/// window; Julian dates carry only ~40 microseconds of resolution
+static const Real TIME_TOLERANCE = 1.0e-9;
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// ObservationScheduler()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor. The default model has unit target priorities,
+ * zero-duration observations and instantaneous slews.
+ *
+ */
+//------------------------------------------------------------------------------
+ObservationScheduler::ObservationScheduler() :
+   defaultPriority   (1.0),
+   slewRate          (0.0),
+   settleTime        (0.0),
+   obsDuration       (0.0),
+   maxRepairPasses   (3),
+   numRepairs        (0),
+   maxSlewTime       (0.0),
+   numSlewOptions    (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ObservationScheduler(const ObservationScheduler &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor. The opportunities and the model are copied; the plan
+ * is not (call Schedule() on the copy).
+ *
+ * @param copy  the ObservationScheduler object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+ObservationScheduler::ObservationScheduler(const ObservationScheduler &copy) :
+   opportunities     (copy.opportunities),
+   targetPriority    (copy.targetPriority),
+   defaultPriority   (copy.defaultPriority),
+   pointingOptions   (copy.pointingOptions),
+   slewRate          (copy.slewRate),
+   settleTime        (copy.settleTime),
+   obsDuration       (copy.obsDuration),
+   maxRepairPasses   (copy.maxRepairPasses),
+   numRepairs        (0),
+   maxSlewTime       (0.0),
+   numSlewOptions    (0)
+{
+}
+
+//------------------------------------------------------------------------------
+// ObservationScheduler& operator=(const ObservationScheduler &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for ObservationScheduler.
+ *
+ * @param copy  the ObservationScheduler object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+ObservationScheduler& ObservationScheduler::operator=(
+                                          const ObservationScheduler &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   opportunities     = copy.opportunities;
+   targetPriority    = copy.targetPriority;
+   defaultPriority   = copy.defaultPriority;
+   pointingOptions   = copy.pointingOptions;
+   slewRate          = copy.slewRate;
+   settleTime        = copy.settleTime;
+   obsDuration       = copy.obsDuration;
+   maxRepairPasses   = copy.maxRepairPasses;
+   numRepairs        = 0;
+   maxSlewTime       = 0.0;
+   timelines.clear();
+   plan.clear();
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~ObservationScheduler()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+ObservationScheduler::~ObservationScheduler()
+{
+}
+
+//------------------------------------------------------------------------------
+// void AddOpportunity(const AccessInterval &acc)
+//------------------------------------------------------------------------------
+/**
+ * Adds an access opportunity.
+ *
+ * @param acc  the access interval (satellite, target, pointing option, window)
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::AddOpportunity(const AccessInterval &acc)
+{
+   if (acc.satIndex < 0 || acc.pointIndex < 0 || acc.optionIndex < 0)
+      throw TATCException("ObservationScheduler: opportunity indices must be "
+                          "non-negative\n");
+   if (acc.stopTime < acc.startTime)
+      throw TATCException("ObservationScheduler: opportunity stop time is "
+                          "before its start time\n");
+   opportunities.push_back(acc);
+}
+
+//------------------------------------------------------------------------------
+// void AddOpportunities(const std::vector<AccessInterval> &accs)
+//------------------------------------------------------------------------------
+/**
+ * Adds a list of access opportunities.
+ *
+ * @param accs  the access intervals
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::AddOpportunities(
+                           const std::vector<AccessInterval> &accs)
+{
+   opportunities.reserve(opportunities.size() + accs.size());
+   for (Integer ii = 0; ii < (Integer) accs.size(); ii++)
+      AddOpportunity(accs[ii]);
+}
+
+//------------------------------------------------------------------------------
+// void AddOpportunities(const IntegerArray &satIndices,
+//                       const IntegerArray &pointIndices,
+//                       const IntegerArray &optionIndices,
+//                       const RealArray    &startTimes,
+//                       const RealArray    &stopTimes)
+//------------------------------------------------------------------------------
+/**
+ * Adds access opportunities given as parallel arrays (convenient for bulk
+ * input from Python).
+ *
+ * @param satIndices     satellite indices
+ * @param pointIndices   target (point) indices
+ * @param optionIndices  pointing-option indices (may be empty, then all are 0)
+ * @param startTimes     window start times (JDUT1)
+ * @param stopTimes      window stop times (JDUT1)
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::AddOpportunities(const IntegerArray &satIndices,
+                                            const IntegerArray &pointIndices,
+                                            const IntegerArray &optionIndices,
+                                            const RealArray    &startTimes,
+                                            const RealArray    &stopTimes)
+{
+   Integer num = satIndices.size();
+   if ((Integer) pointIndices.size() != num ||
+       (Integer) startTimes.size()   != num ||
+       (Integer) stopTimes.size()    != num ||
+       (!optionIndices.empty() && (Integer) optionIndices.size() != num))
+      throw TATCException("ObservationScheduler: opportunity arrays must have "
+                          "the same length\n");
+
+   opportunities.reserve(opportunities.size() + num);
+   for (Integer ii = 0; ii < num; ii++)
+   {
+      AccessInterval acc = {satIndices[ii], pointIndices[ii],
+                            optionIndices.empty() ? 0 : optionIndices[ii],
+                            startTimes[ii], stopTimes[ii]};
+      AddOpportunity(acc);
+   }
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumOpportunities() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of opportunities.
+ *
+ * @return  number of opportunities
+ *
+ */
+//------------------------------------------------------------------------------
+Integer ObservationScheduler::GetNumOpportunities() const
+{
+   return opportunities.size();
+}
+
+//------------------------------------------------------------------------------
+// void ClearOpportunities()
+//------------------------------------------------------------------------------
+/**
+ * Removes all the opportunities and the plan. The model (priorities, pointing
+ * options, slew model, duration) is kept.
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::ClearOpportunities()
+{
+   opportunities.clear();
+   timelines.clear();
+   plan.clear();
+   numRepairs = 0;
+}
+
+//------------------------------------------------------------------------------
+// void SetTargetPriority(Integer pointIndex, Real priority)
+//------------------------------------------------------------------------------
+/**
+ * Sets the priority of a target.
+ *
+ * @param pointIndex  index of the target (point)
+ * @param priority    priority (> 0)
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::SetTargetPriority(Integer pointIndex, Real priority)
+{
+   if (priority <= 0.0)
+      throw TATCException("ObservationScheduler: priority must be positive\n");
+   targetPriority[pointIndex] = priority;
+}
+
+//------------------------------------------------------------------------------
+// Real GetTargetPriority(Integer pointIndex) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the priority of a target.
+ *
+ * @param pointIndex  index of the target (point)
+ *
+ * @return  the priority of the target
+ *
+ */
+//------------------------------------------------------------------------------
+Real ObservationScheduler::GetTargetPriority(Integer pointIndex) const
+{
+   std::map<Integer, Real>::const_iterator it = targetPriority.find(pointIndex);
+   if (it == targetPriority.end())
+      return defaultPriority;
+   return it->second;
+}
+
+//------------------------------------------------------------------------------
+// void SetDefaultPriority(Real priority)
+//------------------------------------------------------------------------------
+/**
+ * Sets the priority of the targets without an explicit priority.
+ *
+ * @param priority  default priority (> 0)
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::SetDefaultPriority(Real priority)
+{
+   if (priority <= 0.0)
+      throw TATCException("ObservationScheduler: priority must be positive\n");
+   defaultPriority = priority;
+}
+
+//------------------------------------------------------------------------------
+// Integer AddPointingOption(Real coneAngle, Real clockAngle)
+//------------------------------------------------------------------------------
+/**
+ * Adds a pointing option. The options are indexed in the order they are added,
+ * and the index is the optionIndex of the opportunities.
+ *
+ * @param coneAngle   cone angle (rad) of the pointing direction from nadir
+ * @param clockAngle  clock angle (rad) of the pointing direction in the nadir frame
+ *
+ * @return  index of the new pointing option
+ *
+ */
+//------------------------------------------------------------------------------
+Integer ObservationScheduler::AddPointingOption(Real coneAngle, Real clockAngle)
+{
+   pointingOptions.push_back(Rvector3(sin(coneAngle)*cos(clockAngle),
+                                      sin(coneAngle)*sin(clockAngle),
+                                      cos(coneAngle)));
+   return pointingOptions.size() - 1;
+}
+
+//------------------------------------------------------------------------------
+// void SetSlewModel(Real rate, Real settle)
+//------------------------------------------------------------------------------
+/**
+ * Sets the slew model. The time needed between an observation with option i and
+ * the next with option j (i != j) is settle + angle(i, j)/rate.
+ *
+ * @param rate    slew rate (rad/s); 0 for instantaneous slews
+ * @param settle  settle time (s) after a slew
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::SetSlewModel(Real rate, Real settle)
+{
+   if (rate < 0.0 || settle < 0.0)
+      throw TATCException("ObservationScheduler: slew rate and settle time "
+                          "must be non-negative\n");
+   slewRate   = rate;
+   settleTime = settle;
+}
+
+//------------------------------------------------------------------------------
+// Real GetSlewTime(Integer fromOption, Integer toOption) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the time needed to slew between two pointing options.
+ *
+ * @param fromOption  index of the pointing option of the earlier observation
+ * @param toOption    index of the pointing option of the later observation
+ *
+ * @return  slew time (s)
+ *
+ */
+//------------------------------------------------------------------------------
+Real ObservationScheduler::GetSlewTime(Integer fromOption,
+                                       Integer toOption) const
+{
+   if (fromOption == toOption)
+      return 0.0;
+   Real angle = 0.0;
+   if (fromOption < (Integer) pointingOptions.size() &&
+       toOption   < (Integer) pointingOptions.size())
+   {
+      Real dot = pointingOptions[fromOption] * pointingOptions[toOption];
+      angle = acos(std::max(-1.0, std::min(1.0, dot)));
+   }
+   Real slew = settleTime;
+   if (slewRate > 0.0)
+      slew += angle / slewRate;
+   return slew;
+}
+
+//------------------------------------------------------------------------------
+// void SetObservationDuration(Real duration)
+//------------------------------------------------------------------------------
+/**
+ * Sets the duration of an observation.
+ *
+ * @param duration  observation duration (s)
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::SetObservationDuration(Real duration)
+{
+   if (duration < 0.0)
+      throw TATCException("ObservationScheduler: observation duration must be "
+                          "non-negative\n");
+   obsDuration = duration / GmatTimeConstants::SECS_PER_DAY;
+}
+
+//------------------------------------------------------------------------------
+// void SetMaxRepairPasses(Integer passes)
+//------------------------------------------------------------------------------
+/**
+ * Sets the maximum number of local-repair passes.
+ *
+ * @param passes  maximum number of passes (0 gives the pure greedy plan)
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::SetMaxRepairPasses(Integer passes)
+{
+   maxRepairPasses = std::max(0, passes);
+}
+
+//------------------------------------------------------------------------------
+// std::vector<ScheduledObservation> Schedule()
+//------------------------------------------------------------------------------
+/**
+ * Computes the plan: greedy insertion by priority followed by local repair.
+ *
+ * @return  the plan, ordered by satellite and start time
+ *
+ */
+//------------------------------------------------------------------------------
+std::vector<ScheduledObservation> ObservationScheduler::Schedule()
+{
+   Integer numOpps    = opportunities.size();
+   Integer numSats    = 0;
+   Integer numTargets = 0;
+   Integer numOptions = pointingOptions.size();
+   for (Integer ii = 0; ii < numOpps; ii++)
+   {
+      numSats    = std::max(numSats,    opportunities[ii].satIndex + 1);
+      numTargets = std::max(numTargets, opportunities[ii].pointIndex + 1);
+      numOptions = std::max(numOptions, opportunities[ii].optionIndex + 1);
+   }
+
+   // slew times between the options
+   numSlewOptions = numOptions;
+   slewTable.assign(numOptions * numOptions, 0.0);
+   maxSlewTime = 0.0;
+   for (Integer ii = 0; ii < numOptions; ii++)
+      for (Integer jj = 0; jj < numOptions; jj++)
+      {
+         Real slew = GetSlewTime(ii, jj) / GmatTimeConstants::SECS_PER_DAY;
+         slewTable[ii * numOptions + jj] = slew;
+         maxSlewTime = std::max(maxSlewTime, slew);
+      }
+
+   // dense per-opportunity priorities and per-target opportunity lists
+   oppPriority.resize(numOpps);
+   RealArray priorities(numTargets, defaultPriority);
+   for (std::map<Integer, Real>::const_iterator it = targetPriority.begin();
+        it != targetPriority.end(); ++it)
+      if (it->first < numTargets)
+         priorities[it->first] = it->second;
+
+   targetOppOffsets.assign(numTargets + 1, 0);
+   for (Integer ii = 0; ii < numOpps; ii++)
+   {
+      oppPriority[ii] = priorities[opportunities[ii].pointIndex];
+      targetOppOffsets[opportunities[ii].pointIndex + 1]++;
+   }
+   std::partial_sum(targetOppOffsets.begin(), targetOppOffsets.end(),
+                    targetOppOffsets.begin());
+   targetOppIds.resize(numOpps);
+   IntegerArray fill(targetOppOffsets.begin(), targetOppOffsets.end() - 1);
+   for (Integer ii = 0; ii < numOpps; ii++)
+      targetOppIds[fill[opportunities[ii].pointIndex]++] = ii;
+
+   // per-satellite interval trees of the opportunities
+   satOpportunityTrees.assign(numSats, IntervalTree());
+   for (Integer ii = 0; ii < numOpps; ii++)
+      satOpportunityTrees[opportunities[ii].satIndex].Add(
+            opportunities[ii].startTime, opportunities[ii].stopTime, ii);
+   for (Integer ss = 0; ss < numSats; ss++)
+      satOpportunityTrees[ss].Build();
+
+   timelines.assign(numSats, Timeline());
+   plan.clear();
+   targetObservation.assign(numTargets, -1);
+   numRepairs = 0;
+
+   // greedy pass: highest priority first, then the most constrained window
+   IntegerArray order(numOpps);
+   std::iota(order.begin(), order.end(), 0);
+   std::sort(order.begin(), order.end(),
+             [this](Integer a, Integer b)
+             {
+                if (oppPriority[a] != oppPriority[b])
+                   return oppPriority[a] > oppPriority[b];
+                const AccessInterval &oa = opportunities[a];
+                const AccessInterval &ob = opportunities[b];
+                Real wa = oa.stopTime - oa.startTime;
+                Real wb = ob.stopTime - ob.startTime;
+                if (wa != wb)
+                   return wa < wb;
+                if (oa.startTime != ob.startTime)
+                   return oa.startTime < ob.startTime;
+                return a < b;
+             });
+
+   for (Integer ii = 0; ii < numOpps; ii++)
+   {
+      Integer oppIdx = order[ii];
+      if (targetObservation[opportunities[oppIdx].pointIndex] >= 0)
+         continue;
+      TryInsert(oppIdx);
+   }
+
+   #ifdef DEBUG_SCHEDULER
+      MessageInterface::ShowMessage(
+            "ObservationScheduler: greedy plan has %d observations\n",
+            (Integer) plan.size());
+   #endif
+
+   // local repair
+   for (Integer pass = 0; pass < maxRepairPasses; pass++)
+   {
+      Integer improved = RepairPass();
+      numRepairs += improved;
+      #ifdef DEBUG_SCHEDULER
+         MessageInterface::ShowMessage(
+               "ObservationScheduler: repair pass %d made %d improvements\n",
+               pass, improved);
+      #endif
+      if (improved == 0)
+         break;
+   }
+   CompactPlan();
+
+   return GetPlan();
+}
+
+//------------------------------------------------------------------------------
+// std::vector<ScheduledObservation> GetPlan() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the plan computed by the last call to Schedule().
+ *
+ * @return  the plan, ordered by satellite and start time
+ *
+ */
+//------------------------------------------------------------------------------
+std::vector<ScheduledObservation> ObservationScheduler::GetPlan() const
+{
+   return plan;
+}
+
+//------------------------------------------------------------------------------
+// Real GetTotalPriority() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the sum of the priorities of the observed targets.
+ *
+ * @return  total priority of the plan
+ *
+ */
+//------------------------------------------------------------------------------
+Real ObservationScheduler::GetTotalPriority() const
+{
+   Real total = 0.0;
+   for (Integer ss = 0; ss < (Integer) timelines.size(); ss++)
+      for (Timeline::const_iterator it = timelines[ss].begin();
+           it != timelines[ss].end(); ++it)
+         total += plan[it->second].priority;
+   return total;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumRepairs() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of improvements made by the local repair in the last
+ * call to Schedule().
+ *
+ * @return  number of repairs
+ *
+ */
+//------------------------------------------------------------------------------
+Integer ObservationScheduler::GetNumRepairs() const
+{
+   return numRepairs;
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Real SlewDays(Integer fromOption, Integer toOption) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the slew time (days) between two pointing options, from the table
+ * computed at the start of Schedule().
+ *
+ * @param fromOption  option of the earlier observation
+ * @param toOption    option of the later observation
+ *
+ * @return  slew time (days)
+ *
+ */
+//------------------------------------------------------------------------------
+Real ObservationScheduler::SlewDays(Integer fromOption, Integer toOption) const
+{
+   return slewTable[fromOption * numSlewOptions + toOption];
+}
+
+//------------------------------------------------------------------------------
+// Integer TryInsert(Integer oppIdx)
+//------------------------------------------------------------------------------
+/**
+ * Inserts an observation for the opportunity at the earliest feasible time of
+ * its window, considering the neighbouring observations of the satellite and
+ * the slew times to/from them.
+ *
+ * @param oppIdx  index of the opportunity
+ *
+ * @return  index into the plan of the new observation, -1 if it does not fit
+ *
+ */
+//------------------------------------------------------------------------------
+Integer ObservationScheduler::TryInsert(Integer oppIdx)
+{
+   const AccessInterval &opp = opportunities[oppIdx];
+   Timeline &timeline = timelines[opp.satIndex];
+
+   Real t      = opp.startTime;
+   Real latest = opp.stopTime - obsDuration + TIME_TOLERANCE;
+   while (t <= latest)
+   {
+      Timeline::iterator next = timeline.upper_bound(t);
+      if (next != timeline.begin())
+      {
+         Timeline::iterator          prev = std::prev(next);
+         const ScheduledObservation &p    = plan[prev->second];
+         Real earliest = p.stopTime + SlewDays(p.optionIndex, opp.optionIndex);
+         if (prev->first == t)
+         {
+            // the timeline is keyed by start time: never start two together
+            t = std::max(earliest, std::nextafter(t, INFINITY));
+            continue;
+         }
+         if (t < earliest)
+         {
+            t = earliest;
+            continue;
+         }
+      }
+      if (next != timeline.end())
+      {
+         const ScheduledObservation &n = plan[next->second];
+         if (t + obsDuration + SlewDays(opp.optionIndex, n.optionIndex) >
+             n.startTime)
+         {
+            t = n.stopTime + SlewDays(n.optionIndex, opp.optionIndex);
+            if (t <= n.startTime)
+               t = std::nextafter(n.startTime, INFINITY);
+            continue;
+         }
+      }
+
+      ScheduledObservation obs = {opp.satIndex, opp.pointIndex, opp.optionIndex,
+                                  t, t + obsDuration, oppPriority[oppIdx],
+                                  oppIdx};
+      plan.push_back(obs);
+      Integer planIdx = plan.size() - 1;
+      timeline[t] = planIdx;
+      targetObservation[opp.pointIndex] = planIdx;
+      return planIdx;
+   }
+   return -1;
+}
+
+//------------------------------------------------------------------------------
+// void RemoveObservation(Integer planIdx)
+//------------------------------------------------------------------------------
+/**
+ * Removes an observation from its satellite timeline.
+ *
+ * @param planIdx  index into the plan of the observation
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::RemoveObservation(Integer planIdx)
+{
+   ScheduledObservation &obs = plan[planIdx];
+   timelines[obs.satIndex].erase(obs.startTime);
+   targetObservation[obs.pointIndex] = -1;
+   obs.opportunityIndex = -1;
+}
+
+//------------------------------------------------------------------------------
+// void RestoreObservation(Integer planIdx, const ScheduledObservation &obs)
+//------------------------------------------------------------------------------
+/**
+ * Puts back (unchanged) an observation which was removed by the local repair,
+ * in the plan slot it was removed from.
+ *
+ * @param planIdx  index into the plan of the removed observation
+ * @param obs      the observation (a copy taken before it was removed)
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::RestoreObservation(Integer planIdx,
+                                              const ScheduledObservation &obs)
+{
+   plan[planIdx] = obs;
+   timelines[obs.satIndex][obs.startTime] = planIdx;
+   targetObservation[obs.pointIndex] = planIdx;
+}
+
+//------------------------------------------------------------------------------
+// Integer TryInsertTarget(Integer pointIndex, Integer excludeOpp)
+//------------------------------------------------------------------------------
+/**
+ * Tries to observe a target through any of its opportunities.
+ *
+ * @param pointIndex  index of the target
+ * @param excludeOpp  an opportunity not to be used (-1 for none)
+ *
+ * @return  index into the plan of the new observation, -1 if none fits
+ *
+ */
+//------------------------------------------------------------------------------
+Integer ObservationScheduler::TryInsertTarget(Integer pointIndex,
+                                              Integer excludeOpp)
+{
+   for (Integer k = targetOppOffsets[pointIndex];
+        k < targetOppOffsets[pointIndex + 1]; k++)
+   {
+      Integer oppIdx = targetOppIds[k];
+      if (oppIdx == excludeOpp)
+         continue;
+      Integer planIdx = TryInsert(oppIdx);
+      if (planIdx >= 0)
+         return planIdx;
+   }
+   return -1;
+}
+
+//------------------------------------------------------------------------------
+// Integer RepairPass()
+//------------------------------------------------------------------------------
+/**
+ * One pass of local repair. Each observation (lowest priority first) is
+ * tentatively removed and replaced by an unscheduled opportunity of the same
+ * satellite overlapping it. The swap is kept if it increases the total priority,
+ * or if the displaced target fits elsewhere (increasing the number of observed
+ * targets); otherwise it is undone.
+ *
+ * @return  number of improvements
+ *
+ */
+//------------------------------------------------------------------------------
+Integer ObservationScheduler::RepairPass()
+{
+   IntegerArray live;
+   for (Integer ss = 0; ss < (Integer) timelines.size(); ss++)
+      for (Timeline::const_iterator it = timelines[ss].begin();
+           it != timelines[ss].end(); ++it)
+         live.push_back(it->second);
+   std::stable_sort(live.begin(), live.end(),
+                    [this](Integer a, Integer b)
+                    { return plan[a].priority < plan[b].priority; });
+
+   Integer      improvements = 0;
+   IntegerArray candidates;
+   for (Integer ii = 0; ii < (Integer) live.size(); ii++)
+   {
+      if (plan[live[ii]].opportunityIndex < 0)
+         continue; // already replaced in this pass
+      ScheduledObservation obs = plan[live[ii]];
+
+      candidates.clear();
+      satOpportunityTrees[obs.satIndex].Overlapping(
+            obs.startTime - obsDuration - maxSlewTime,
+            obs.stopTime + obsDuration + maxSlewTime, candidates);
+      std::stable_sort(candidates.begin(), candidates.end(),
+                       [this](Integer a, Integer b)
+                       { return oppPriority[a] > oppPriority[b]; });
+
+      for (Integer k = 0; k < (Integer) candidates.size(); k++)
+      {
+         Integer oppIdx = candidates[k];
+         const AccessInterval &opp = opportunities[oppIdx];
+         if (targetObservation[opp.pointIndex] >= 0 ||
+             opp.stopTime - opp.startTime < obsDuration - TIME_TOLERANCE)
+            continue;
+
+         Integer obsIdx = targetObservation[obs.pointIndex];
+         RemoveObservation(obsIdx);
+         Integer newIdx = TryInsert(oppIdx);
+         if (newIdx < 0)
+         {
+            RestoreObservation(obsIdx, obs);
+            continue;
+         }
+         Integer reIdx = TryInsertTarget(obs.pointIndex, -1);
+         if (reIdx >= 0 || oppPriority[oppIdx] > obs.priority)
+         {
+            #ifdef DEBUG_SCHEDULER
+               MessageInterface::ShowMessage(
+                     "ObservationScheduler: target %d replaced by %d on sat %d\n",
+                     obs.pointIndex, opp.pointIndex, obs.satIndex);
+            #endif
+            improvements++;
+            break;
+         }
+         // equal priority and the displaced target does not fit: undo
+         RemoveObservation(newIdx);
+         RestoreObservation(obsIdx, obs);
+      }
+   }
+   return improvements;
+}
+
+//------------------------------------------------------------------------------
+// void CompactPlan()
+//------------------------------------------------------------------------------
+/**
+ * Drops the observations removed by the local repair from the plan and orders
+ * it by satellite and start time, updating the timelines and the observations
+ * of the targets.
+ *
+ */
+//------------------------------------------------------------------------------
+void ObservationScheduler::CompactPlan()
+{
+   std::vector<ScheduledObservation> compact;
+   for (Integer ss = 0; ss < (Integer) timelines.size(); ss++)
+      for (Timeline::iterator it = timelines[ss].begin();
+           it != timelines[ss].end(); ++it)
+      {
+         compact.push_back(plan[it->second]);
+         it->second = compact.size() - 1;
+         targetObservation[compact.back().pointIndex] = it->second;
+      }
+   plan.swap(compact);
+}
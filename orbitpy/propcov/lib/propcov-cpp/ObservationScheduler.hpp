@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+//                           ObservationScheduler
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the ObservationScheduler class. The scheduler builds an observation
+ * plan from access opportunities (AccessInterval objects, typically produced by the
+ * AccessIntervalBuilder from the CoverageChecker results).
+ *
+ * Model:
+ *  - Each target (point index) has a priority (default 1). A target is observed at most once,
+ *    and the plan maximizes the sum of the priorities of the observed targets.
+ *  - An observation lasts a fixed duration and has to lie within the access interval
+ *    of its opportunity.
+ *  - A satellite makes one observation at a time. Between two consecutive observations of
+ *    a satellite there must be enough time to slew from the pointing option of the first to
+ *    that of the second: settle time + (angle between the options)/(slew rate). Pointing
+ *    options are specified as (cone, clock) angles of the pointing direction in the nadir
+ *    frame; with no options specified, all the opportunities share the same pointing and
+ *    consecutive observations need only be separated by the settle time if the option
+ *    indices differ.
+ *
+ * Algorithm:
+ *  1. Greedy: the opportunities are visited in decreasing order of priority (ties broken by
+ *     the shorter access window, then the earlier start) and each is inserted at the earliest
+ *     feasible time of its window into the satellite timeline. The timeline is an ordered map of
+ *     the (disjoint) observations of the satellite, so that the neighbours of a candidate time
+ *     are found in O(log n).
+ *  2. Local repair: the observations are visited in increasing order of priority. The
+ *     unscheduled opportunities of the same satellite which overlap the observation (padded
+ *     with the maximum slew time) are found with a per-satellite IntervalTree. The observation
+ *     is replaced by a candidate if the candidate has a higher priority, or if the displaced
+ *     target can be re-inserted through another of its opportunities. The passes are repeated
+ *     until no improvement is found (or the maximum number of passes is reached).
+ */
+//------------------------------------------------------------------------------
+#ifndef ObservationScheduler_hpp
+#define ObservationScheduler_hpp
+
+#include <map>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "Rvector3.hpp"
+#include "AccessInterval.hpp"
+#include "IntervalTree.hpp"
+
+struct ScheduledObservation
+{
+   /// index of the satellite
+   Integer satIndex;
+   /// index of the observed point (target)
+   Integer pointIndex;
+   /// index of the pointing option used
+   Integer optionIndex;
+   /// start of the observation (JDUT1)
+   Real    startTime;
+   /// stop of the observation (JDUT1)
+   Real    stopTime;
+   /// priority of the target
+   Real    priority;
+   /// index of the opportunity (in the order of addition) the observation is taken from
+   Integer opportunityIndex;
+};
+
+class ObservationScheduler
+{
+public:
+
+   /// class construction/destruction
+   ObservationScheduler();
+   ObservationScheduler(const ObservationScheduler &copy);
+   ObservationScheduler& operator=(const ObservationScheduler &copy);
+
+   virtual ~ObservationScheduler();
+
+   /// Add an access opportunity
+   void           AddOpportunity(const AccessInterval &acc);
+   /// Add a list of access opportunities
+   void           AddOpportunities(const std::vector<AccessInterval> &accs);
+   /// Add access opportunities given as parallel arrays
+   void           AddOpportunities(const IntegerArray &satIndices,
+                                   const IntegerArray &pointIndices,
+                                   const IntegerArray &optionIndices,
+                                   const RealArray    &startTimes,
+                                   const RealArray    &stopTimes);
+   /// Get the number of opportunities
+   Integer        GetNumOpportunities() const;
+   /// Remove all the opportunities (and the plan)
+   void           ClearOpportunities();
+
+   /// Set/get the priority of a target
+   void           SetTargetPriority(Integer pointIndex, Real priority);
+   Real           GetTargetPriority(Integer pointIndex) const;
+   /// Set the default priority of the targets without an explicit priority
+   void           SetDefaultPriority(Real priority);
+
+   /// Add a pointing option as the cone, clock angles (rad) of the pointing in the nadir frame
+   Integer        AddPointingOption(Real coneAngle, Real clockAngle);
+   /// Set the slew model: rate (rad/s, 0 for instantaneous slews) and settle time (s)
+   void           SetSlewModel(Real slewRate, Real settleTime);
+   /// Get the slew time (s) between two pointing options
+   Real           GetSlewTime(Integer fromOption, Integer toOption) const;
+   /// Set the duration (s) of an observation
+   void           SetObservationDuration(Real duration);
+   /// Set the maximum number of local-repair passes (0 disables the repair)
+   void           SetMaxRepairPasses(Integer passes);
+
+   /// Compute the plan
+   virtual std::vector<ScheduledObservation> Schedule();
+   /// Get the plan computed by the last call to Schedule(), ordered by satellite and time
+   std::vector<ScheduledObservation> GetPlan() const;
+   /// Get the sum of the priorities of the observed targets
+   Real           GetTotalPriority() const;
+   /// Get the number of improvements made by the local repair in the last Schedule() call
+   Integer        GetNumRepairs() const;
+
+protected:
+
+   /// the access opportunities
+   std::vector<AccessInterval>   opportunities;
+   /// priorities of the targets with an explicit priority
+   std::map<Integer, Real>       targetPriority;
+   /// priority of the targets without an explicit priority
+   Real                          defaultPriority;
+   /// pointing directions (unit vectors in the nadir frame) of the pointing options
+   std::vector<Rvector3>         pointingOptions;
+   /// slew rate (rad/s)
+   Real                          slewRate;
+   /// settle time after a slew (s)
+   Real                          settleTime;
+   /// duration of an observation (days, internally)
+   Real                          obsDuration;
+   /// maximum number of local-repair passes
+   Integer                       maxRepairPasses;
+
+   /// timeline of a satellite: observation start time -> index into `plan`
+   typedef std::map<Real, Integer> Timeline;
+   /// per-satellite timelines (indexed by satellite index)
+   std::vector<Timeline>         timelines;
+   /// observations; during the local repair the removed observations are flagged with
+   /// opportunityIndex = -1, after Schedule() only the plan remains (by satellite and time)
+   std::vector<ScheduledObservation> plan;
+   /// priority of each opportunity (computed at the start of Schedule())
+   RealArray                     oppPriority;
+   /// index into `plan` of the observation of each target (-1 if unobserved)
+   IntegerArray                  targetObservation;
+   /// per-target opportunity lists in compressed form: the opportunities of target p
+   /// are targetOppIds[targetOppOffsets[p] .. targetOppOffsets[p+1])
+   IntegerArray                  targetOppOffsets;
+   IntegerArray                  targetOppIds;
+   /// per-satellite interval trees of the opportunities (indexed by satellite index)
+   std::vector<IntervalTree>     satOpportunityTrees;
+   /// number of improvements made by the local repair
+   Integer                       numRepairs;
+   /// maximum slew time (days) over all pairs of pointing options
+   Real                          maxSlewTime;
+   /// slew times (days) between the pointing options, row-major
+   RealArray                     slewTable;
+   /// number of rows (and columns) of the slew table
+   Integer                       numSlewOptions;
+
+   /// Slew time in days between two pointing options
+   Real           SlewDays(Integer fromOption, Integer toOption) const;
+   /// Try to insert an opportunity in its satellite timeline; returns the plan index or -1
+   Integer        TryInsert(Integer oppIdx);
+   /// Remove an observation from its satellite timeline
+   void           RemoveObservation(Integer planIdx);
+   /// Try to re-insert a target through any of its opportunities (except one)
+   Integer        TryInsertTarget(Integer pointIndex, Integer excludeOpp);
+   /// Put back an observation removed by the local repair, in its plan slot
+   void           RestoreObservation(Integer planIdx, const ScheduledObservation &obs);
+   /// One local-repair pass; returns the number of improvements
+   Integer        RepairPass();
+   /// Drop the removed observations from `plan` and order it by satellite and time
+   void           CompactPlan();
+};
+#endif // ObservationScheduler_hpp
@@ -29,6 +29,7 @@
 #include "RealUtilities.hpp"
 #include "GmatConstants.hpp"
 #include "Rmatrix33.hpp"
+#include "Profiler.hpp"
 #include "TATCException.hpp"
 #include "MessageInterface.hpp"
 
@@ -63,7 +64,8 @@ PointGroup::PointGroup() :
    latUpper           (PI_OVER_TWO),
    latLower           (-PI_OVER_TWO),
    lonUpper           (PI), //Vinay TODO: CORRECT THIS. LEADS TO VALID POINTS NOT BEING ADDED.
-   lonLower           (-PI) //Vinay TODO: CORRECT THIS. LEADS TO VALID POINTS NOT BEING ADDED.
+   lonLower           (-PI), //Vinay TODO: CORRECT THIS. LEADS TO VALID POINTS NOT BEING ADDED.
+   accountedMemory    (0)
 {
    // lat, lon, and coords are all empty at the start
 }
@@ -84,7 +86,8 @@ PointGroup::PointGroup(const PointGroup &copy) :
    latUpper           (copy.latUpper),
    latLower           (copy.latLower),
    lonUpper           (copy.lonUpper),
-   lonLower           (copy.lonLower)
+   lonLower           (copy.lonLower),
+   accountedMemory    (0)
 {
    lat.clear();
    lon.clear();
@@ -97,6 +100,36 @@ PointGroup::PointGroup(const PointGroup &copy) :
       Rvector3 *newCoord  = new Rvector3(*copyCoord);
       coords.push_back(newCoord);
    }
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+// PointGroup(BinaryReader &in)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data (see Serialize).
+ * 
+ * @param in  the reader of the data
+ *
+ */
+//------------------------------------------------------------------------------
+PointGroup::PointGroup(BinaryReader &in) :
+   accountedMemory    (0)
+{
+   in.ReadHeader("PointGroup", 1);
+   numRequestedPoints = in.ReadInt();
+   latUpper           = in.ReadReal();
+   latLower           = in.ReadReal();
+   lonUpper           = in.ReadReal();
+   lonLower           = in.ReadReal();
+   lat                = in.ReadRealArray();
+   lon                = in.ReadRealArray();
+   numPoints          = lat.size();
+   if ((Integer) lon.size() != numPoints || in.ReadInt() != numPoints)
+      throw TATCException("Invalid serialized PointGroup\n");
+   for (Integer ii = 0; ii < numPoints; ii++)
+      coords.push_back(new Rvector3(in.ReadRvector3()));
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -132,6 +165,7 @@ PointGroup& PointGroup::operator=(const PointGroup &copy)
       Rvector3 *newCoord  = new Rvector3(*copyCoord);
       coords.push_back(newCoord);
    }
+   AccountMemory();
    
    return *this;
 }
@@ -151,6 +185,7 @@ PointGroup::~PointGroup()
    for (Integer ii = 0; ii < numPoints; ii++)
       delete coords.at(ii);
    coords.clear();
+   Profiler::UpdateMemory(Profiler::POINT_MEMORY, accountedMemory, 0);
 }
 
       
@@ -179,6 +214,7 @@ void PointGroup::AddUserDefinedPoints(const RealArray& lats,
    Integer sz = (Integer) lats.size();
    for (Integer ptIdx = 0; ptIdx < sz; ptIdx++)
       AccumulatePoints(lats.at(ptIdx),lons.at(ptIdx));
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -500,6 +536,7 @@ void PointGroup::ComputeTestPoints(const std::string &modelName,
       if (modelName == "Helical")
          ComputeHelicalPoints(numGridPts-2);
    }
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -606,3 +643,46 @@ void PointGroup::ComputeHelicalPoints(Integer numReqPts)
       }
    }
 }
+
+//------------------------------------------------------------------------------
+// void AccountMemory()
+//------------------------------------------------------------------------------
+/**
+ * Accounts the memory of the latitudes, longitudes and coordinates
+ * (Profiler::POINT_MEMORY).
+ *
+ */
+//------------------------------------------------------------------------------
+void PointGroup::AccountMemory()
+{
+   long long bytes = (lat.capacity() + lon.capacity()) * sizeof(Real) +
+                     coords.capacity() * sizeof(Rvector3*) +
+                     coords.size() * sizeof(Rvector3);  // elements in the object
+   Profiler::UpdateMemory(Profiler::POINT_MEMORY, accountedMemory, bytes);
+}
+
+//------------------------------------------------------------------------------
+// void Serialize(BinaryWriter &out) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the state of the group: the bounds, the latitudes and longitudes and
+ * the (body-fixed) coordinates of the points.
+ * 
+ * @param out  the writer
+ *
+ */
+//------------------------------------------------------------------------------
+void PointGroup::Serialize(BinaryWriter &out) const
+{
+   out.WriteHeader("PointGroup", 1);
+   out.WriteInt(numRequestedPoints);
+   out.WriteReal(latUpper);
+   out.WriteReal(latLower);
+   out.WriteReal(lonUpper);
+   out.WriteReal(lonLower);
+   out.WriteRealArray(lat);
+   out.WriteRealArray(lon);
+   out.WriteInt(numPoints);
+   for (Integer ii = 0; ii < numPoints; ii++)
+      out.WriteRvector3(*coords[ii]);
+}
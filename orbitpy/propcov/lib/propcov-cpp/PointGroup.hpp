@@ -44,6 +44,7 @@
 #include "Spacecraft.hpp"
 #include "OrbitState.hpp"
 #include "Rvector6.hpp"
+#include "BinaryStream.hpp"
 
 class PointGroup
 {
@@ -52,6 +53,8 @@ public:
    /// class construction/destruction
    PointGroup();
    PointGroup(const PointGroup &copy);
+   /// Construct from the data written by Serialize
+   PointGroup(BinaryReader &in);
    PointGroup& operator=(const PointGroup &copy);
    
    virtual ~PointGroup();
@@ -78,6 +81,8 @@ public:
    /// Set the latitude and longitude bounds values
    virtual void      SetLatLonBounds(Real latUp, Real latLow,
                                      Real lonUp, Real lonLow);
+   /// Write the state of the group (points, coordinates and bounds)
+   virtual void      Serialize(BinaryWriter &out) const;
    
    
 protected:
@@ -100,12 +105,15 @@ protected:
    Real                   lonUpper;
    /// Upper bound on allowable longitude
    Real                   lonLower;
+   /// Memory accounted for the points (Profiler::POINT_MEMORY)
+   long long              accountedMemory;
    
    /// Protected methods for managing points
    bool    CheckHasPoints();
    void    AccumulatePoints(Real lat1, Real lon1);
    void    ComputeTestPoints(const std::string &modelName, Integer numGridPts);
    void    ComputeHelicalPoints(Integer numReqPts);
+   void    AccountMemory();
    
 };
 #endif // PointGroup_hpp
@@ -0,0 +1,469 @@
+//------------------------------------------------------------------------------
+//                           PointingIntersectionEngine
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the PointingIntersectionEngine class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+#include "gmatdefs.hpp"
+#include "PointingIntersectionEngine.hpp"
+#include "BatchConversions.hpp"
+#include "Earth.hpp"
+#include "AttitudeConversionUtility.hpp"
+#include "Rmatrix33.hpp"
+#include "Profiler.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Integer PointingIntersectionEngine::CHUNK_SIZE = 1024;
+
+/// file signature and format version of the binary table
+static const char    TABLE_MAGIC[4] = {'P', 'C', 'P', 'I'};
+static const int32_t TABLE_VERSION  = 1;
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// PointingIntersectionEngine(const RealArray &angles1,
+//                            const RealArray &angles2,
+//                            const RealArray &angles3,
+//                            Integer seq1, Integer seq2, Integer seq3)
+//------------------------------------------------------------------------------
+/**
+ * Constructor; computes the pointing axes of the options in the nadir frame.
+ *
+ * @param angles1  first Euler angle of each option (deg)
+ * @param angles2  second Euler angle of each option (deg)
+ * @param angles3  third Euler angle of each option (deg)
+ * @param seq1     first axis of the Euler sequence
+ * @param seq2     second axis of the Euler sequence
+ * @param seq3     third axis of the Euler sequence
+ *
+ */
+//------------------------------------------------------------------------------
+PointingIntersectionEngine::PointingIntersectionEngine(
+                                 const RealArray &angles1,
+                                 const RealArray &angles2,
+                                 const RealArray &angles3,
+                                 Integer seq1, Integer seq2, Integer seq3) :
+   angles1     (angles1),
+   angles2     (angles2),
+   angles3     (angles3),
+   radius      (Earth::RADIUS),
+   flattening  (0.0)
+{
+   if (angles1.size() != angles2.size() || angles1.size() != angles3.size())
+      throw TATCException("PointingIntersectionEngine: the Euler angle "
+                          "arrays must have the same length\n");
+   seq[0] = seq1;
+   seq[1] = seq2;
+   seq[2] = seq3;
+
+   Integer numOptions = (Integer) angles1.size();
+   axisX.resize(numOptions);
+   axisY.resize(numOptions);
+   axisZ.resize(numOptions);
+   for (Integer jj = 0; jj < numOptions; jj++)
+   {
+      // body z axis in the nadir frame: third row of the nadir-to-body matrix
+      Rvector3  angles(angles1[jj] * GmatMathConstants::RAD_PER_DEG,
+                       angles2[jj] * GmatMathConstants::RAD_PER_DEG,
+                       angles3[jj] * GmatMathConstants::RAD_PER_DEG);
+      Rmatrix33 nadirToBody = AttitudeConversionUtility::ToCosineMatrix(
+                                    angles, seq1, seq2, seq3);
+      axisX[jj] = nadirToBody(2, 0);
+      axisY[jj] = nadirToBody(2, 1);
+      axisZ[jj] = nadirToBody(2, 2);
+   }
+}
+
+//------------------------------------------------------------------------------
+// PointingIntersectionEngine(const PointingIntersectionEngine &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the engine to copy
+ *
+ */
+//------------------------------------------------------------------------------
+PointingIntersectionEngine::PointingIntersectionEngine(
+                                 const PointingIntersectionEngine &copy) :
+   angles1     (copy.angles1),
+   angles2     (copy.angles2),
+   angles3     (copy.angles3),
+   axisX       (copy.axisX),
+   axisY       (copy.axisY),
+   axisZ       (copy.axisZ),
+   radius      (copy.radius),
+   flattening  (copy.flattening)
+{
+   std::copy(copy.seq, copy.seq + 3, seq);
+}
+
+//------------------------------------------------------------------------------
+// PointingIntersectionEngine& operator=(
+//                               const PointingIntersectionEngine &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for the PointingIntersectionEngine.
+ *
+ * @param copy  the engine to copy
+ *
+ */
+//------------------------------------------------------------------------------
+PointingIntersectionEngine& PointingIntersectionEngine::operator=(
+                                 const PointingIntersectionEngine &copy)
+{
+   if (&copy == this)
+      return *this;
+   angles1    = copy.angles1;
+   angles2    = copy.angles2;
+   angles3    = copy.angles3;
+   std::copy(copy.seq, copy.seq + 3, seq);
+   axisX      = copy.axisX;
+   axisY      = copy.axisY;
+   axisZ      = copy.axisZ;
+   radius     = copy.radius;
+   flattening = copy.flattening;
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~PointingIntersectionEngine()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+PointingIntersectionEngine::~PointingIntersectionEngine()
+{
+}
+
+//------------------------------------------------------------------------------
+// void SetEllipsoid(Real equatorialRadius, Real flattening)
+//------------------------------------------------------------------------------
+/**
+ * Sets the ellipsoid the rays are intersected with.
+ *
+ * @param equatorialRadius  equatorial radius (km)
+ * @param flattening        flattening (0 for a sphere)
+ *
+ */
+//------------------------------------------------------------------------------
+void PointingIntersectionEngine::SetEllipsoid(Real equatorialRadius,
+                                              Real flattening)
+{
+   if (equatorialRadius <= 0.0 || flattening < 0.0 || flattening >= 1.0)
+      throw TATCException("PointingIntersectionEngine: invalid ellipsoid\n");
+   radius           = equatorialRadius;
+   this->flattening = flattening;
+}
+
+//------------------------------------------------------------------------------
+// Real GetEquatorialRadius() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the equatorial radius (km) of the ellipsoid.
+ *
+ */
+//------------------------------------------------------------------------------
+Real PointingIntersectionEngine::GetEquatorialRadius() const
+{
+   return radius;
+}
+
+//------------------------------------------------------------------------------
+// Real GetFlattening() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the flattening of the ellipsoid.
+ *
+ */
+//------------------------------------------------------------------------------
+Real PointingIntersectionEngine::GetFlattening() const
+{
+   return flattening;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumOptions() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of pointing options.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer PointingIntersectionEngine::GetNumOptions() const
+{
+   return (Integer) axisX.size();
+}
+
+//------------------------------------------------------------------------------
+// Rvector3 GetPointingAxis(Integer option) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the pointing axis (body z axis) of an option in the nadir frame.
+ *
+ * @param option  index of the option
+ *
+ * @return  the unit vector of the axis
+ *
+ */
+//------------------------------------------------------------------------------
+Rvector3 PointingIntersectionEngine::GetPointingAxis(Integer option) const
+{
+   if (option < 0 || option >= GetNumOptions())
+      throw TATCException("PointingIntersectionEngine: option index out of "
+                          "range\n");
+   return Rvector3(axisX[option], axisY[option], axisZ[option]);
+}
+
+//------------------------------------------------------------------------------
+// void IntersectBodyFixed(const Real *bfStates, Integer n,
+//                         Real *latLon) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the ground points of the options for Earth-fixed states.
+ *
+ * @param bfStates  Earth-fixed states (n x 6, km and km/s)
+ * @param n         number of states
+ * @param latLon    latitude and longitude (rad) of the ground point of each
+ *                  state and option (n x options x 2, output; NaN for the
+ *                  rays missing the ellipsoid)
+ *
+ */
+//------------------------------------------------------------------------------
+void PointingIntersectionEngine::IntersectBodyFixed(const Real *bfStates,
+                                                    Integer n,
+                                                    Real *latLon) const
+{
+   const Integer numOptions = GetNumOptions();
+   const Real    *ax        = axisX.data();
+   const Real    *ay        = axisY.data();
+   const Real    *az        = axisZ.data();
+   const Real    k          = 1.0 / (1.0 - flattening);  // z scale to sphere
+   const Real    k2         = k * k;
+   const Real    oneMinusF2 = (1.0 - flattening) * (1.0 - flattening);
+   const Real    a2         = radius * radius;
+   const Real    nan        = std::numeric_limits<Real>::quiet_NaN();
+
+   for (Integer ii = 0; ii < n; ii++)
+   {
+      const Real *s   = bfStates + 6*ii;
+      Real       *res = latLon + 2*ii*numOptions;
+
+      // nadir frame (as NadirPointingAttitude::BodyFixedToReference)
+      Real rMag = sqrt(s[0]*s[0] + s[1]*s[1] + s[2]*s[2]);
+      Real zx = -s[0] / rMag, zy = -s[1] / rMag, zz = -s[2] / rMag;
+      Real xx = -(zy*s[5] - zz*s[4]);
+      Real xy = -(zz*s[3] - zx*s[5]);
+      Real xz = -(zx*s[4] - zy*s[3]);
+      Real xMag = sqrt(xx*xx + xy*xy + xz*xz);
+      xx /= xMag;
+      xy /= xMag;
+      xz /= xMag;
+      Real yx = zy*xz - zz*xy;
+      Real yy = zz*xx - zx*xz;
+      Real yz = zx*xy - zy*xx;
+
+      // ray p + t d against the ellipsoid, scaled in z to the sphere
+      Real px = s[0], py = s[1], pz = s[2];
+      Real cc = px*px + py*py + pz*pz*k2 - a2;
+      for (Integer jj = 0; jj < numOptions; jj++)
+      {
+         Real dx = xx*ax[jj] + yx*ay[jj] + zx*az[jj];
+         Real dy = xy*ax[jj] + yy*ay[jj] + zy*az[jj];
+         Real dz = xz*ax[jj] + yz*ay[jj] + zz*az[jj];
+         Real aa   = dx*dx + dy*dy + dz*dz*k2;
+         Real bb   = px*dx + py*dy + pz*dz*k2;
+         Real disc = bb*bb - aa*cc;
+         Real root = sqrt(std::max(disc, 0.0));
+         Real tNear = (-bb - root) / aa;
+         Real tFar  = (-bb + root) / aa;
+         Real t     = (tNear >= 0.0) ? tNear : tFar;
+         bool hit   = (disc >= 0.0) && (t >= 0.0);
+         Real qx = px + t*dx, qy = py + t*dy, qz = pz + t*dz;
+         Real lon = atan2(qy, qx);
+         lon = (lon < 0.0) ? lon + GmatMathConstants::TWO_PI : lon;
+         Real lat = atan2(qz, oneMinusF2 * sqrt(qx*qx + qy*qy));
+         res[2*jj]     = hit ? lat : nan;
+         res[2*jj + 1] = hit ? lon : nan;
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void Intersect(const Real *jd, const Real *states, Integer n,
+//                Real *latLon) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the ground points of the options for inertial states.
+ *
+ * @param jd      times of the states (JDUT1, n)
+ * @param states  Earth inertial states (n x 6, km and km/s)
+ * @param n       number of states
+ * @param latLon  latitude and longitude (rad) of the ground point of each
+ *                state and option (n x options x 2, output)
+ *
+ */
+//------------------------------------------------------------------------------
+void PointingIntersectionEngine::Intersect(const Real *jd, const Real *states,
+                                           Integer n, Real *latLon) const
+{
+   std::vector<Real> bfStates(6 * std::min(n, CHUNK_SIZE));
+   for (Integer first = 0; first < n; first += CHUNK_SIZE)
+   {
+      Integer count = std::min(CHUNK_SIZE, n - first);
+      {
+         Profiler::Scope timer(Profiler::FRAME_CONVERSION);
+         BatchConversions::InertialToBodyFixed(jd + first, states + 6*first,
+                                               count, bfStates.data());
+      }
+      IntersectBodyFixed(bfStates.data(), count,
+                         latLon + 2*first*GetNumOptions());
+   }
+}
+
+//------------------------------------------------------------------------------
+// void WriteTable(const std::string &filename, const Real *jd,
+//                 const Real *states, Integer n) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the ground points of the options for inertial states and writes
+ * them to a binary table (see the class description for the layout).
+ *
+ * @param filename  name of the file
+ * @param jd        times of the states (JDUT1, n)
+ * @param states    Earth inertial states (n x 6, km and km/s)
+ * @param n         number of states
+ *
+ */
+//------------------------------------------------------------------------------
+void PointingIntersectionEngine::WriteTable(const std::string &filename,
+                                            const Real *jd, const Real *states,
+                                            Integer n) const
+{
+   std::ofstream out(filename.c_str(), std::ios::out | std::ios::binary);
+   if (!out)
+      throw TATCException("PointingIntersectionEngine: unable to open " +
+                          filename + " for writing\n");
+
+   Integer numOptions = GetNumOptions();
+   {
+      Profiler::Scope timer(Profiler::OUTPUT);
+      int32_t dims[2]      = {numOptions, n};
+      double  ellipsoid[2] = {radius, flattening};
+      int32_t sequence[3]  = {seq[0], seq[1], seq[2]};
+      out.write(TABLE_MAGIC, 4);
+      out.write((const char*) &TABLE_VERSION, sizeof(int32_t));
+      out.write((const char*) dims, sizeof(dims));
+      out.write((const char*) ellipsoid, sizeof(ellipsoid));
+      for (Integer jj = 0; jj < numOptions; jj++)
+      {
+         double angles[3] = {angles1[jj], angles2[jj], angles3[jj]};
+         out.write((const char*) angles, sizeof(angles));
+      }
+      out.write((const char*) sequence, sizeof(sequence));
+   }
+
+   Integer           rowSize = 1 + 2*numOptions;
+   std::vector<Real> latLon(2 * numOptions * std::min(n, CHUNK_SIZE));
+   std::vector<Real> rows(rowSize * std::min(n, CHUNK_SIZE));
+   for (Integer first = 0; first < n; first += CHUNK_SIZE)
+   {
+      Integer count = std::min(CHUNK_SIZE, n - first);
+      Intersect(jd + first, states + 6*first, count, latLon.data());
+
+      Profiler::Scope timer(Profiler::OUTPUT);
+      for (Integer ii = 0; ii < count; ii++)
+      {
+         rows[ii*rowSize] = jd[first + ii];
+         std::memcpy(&rows[ii*rowSize + 1], &latLon[2*ii*numOptions],
+                     2 * numOptions * sizeof(Real));
+      }
+      out.write((const char*) rows.data(), count * rowSize * sizeof(Real));
+   }
+   if (!out)
+      throw TATCException("PointingIntersectionEngine: error writing " +
+                          filename + "\n");
+   Profiler::AddCount(Profiler::BYTES_WRITTEN, out.tellp());
+}
+
+//------------------------------------------------------------------------------
+// static Integer ReadTable(const std::string &filename, RealArray &jd,
+//                          RealArray &latLon)
+//------------------------------------------------------------------------------
+/**
+ * Reads a binary table written by WriteTable.
+ *
+ * @param filename  name of the file
+ * @param jd        times of the steps (JDUT1, output)
+ * @param latLon    latitude and longitude (rad) of the ground points
+ *                  (steps x options x 2, output)
+ *
+ * @return  the number of options
+ *
+ */
+//------------------------------------------------------------------------------
+Integer PointingIntersectionEngine::ReadTable(const std::string &filename,
+                                              RealArray &jd, RealArray &latLon)
+{
+   std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+   if (!in)
+      throw TATCException("PointingIntersectionEngine: unable to open " +
+                          filename + "\n");
+
+   char    magic[4];
+   int32_t version = 0;
+   int32_t dims[2] = {0, 0};
+   in.read(magic, 4);
+   in.read((char*) &version, sizeof(int32_t));
+   in.read((char*) dims, sizeof(dims));
+   if (!in || std::memcmp(magic, TABLE_MAGIC, 4) != 0)
+      throw TATCException("PointingIntersectionEngine: " + filename +
+                          " is not a pointing intersection table\n");
+   if (version != TABLE_VERSION)
+      throw TATCException("PointingIntersectionEngine: unsupported file "
+                          "version in " + filename + "\n");
+   Integer numOptions = dims[0];
+   Integer numSteps   = dims[1];
+   if (numOptions < 0 || numSteps < 0)
+      throw TATCException("PointingIntersectionEngine: corrupt header in " +
+                          filename + "\n");
+   // ellipsoid, option angles and Euler sequence
+   in.seekg(2*sizeof(double) + 3*numOptions*sizeof(double) +
+            3*sizeof(int32_t), std::ios::cur);
+
+   Integer   rowSize = 1 + 2*numOptions;
+   RealArray row(rowSize);
+   jd.resize(numSteps);
+   latLon.resize(2 * (size_t) numSteps * numOptions);
+   for (Integer ii = 0; ii < numSteps; ii++)
+   {
+      in.read((char*) row.data(), rowSize * sizeof(Real));
+      jd[ii] = row[0];
+      std::copy(row.begin() + 1, row.end(),
+                latLon.begin() + 2 * (size_t) ii * numOptions);
+   }
+   if (!in)
+      throw TATCException("PointingIntersectionEngine: truncated file " +
+                          filename + "\n");
+   return numOptions;
+}
@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+//                           PointingIntersectionEngine
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the PointingIntersectionEngine class, which computes the
+ * ground points of the pointing axis of a spacecraft for a set of pointing
+ * options (e.g. the roll angles of an agile spacecraft), for arrays of states.
+ *
+ * Each pointing option is a set of Euler angles of the spacecraft body with
+ * respect to the nadir frame (as Spacecraft::SetBodyNadirOffsetAngles); the
+ * pointing axis is the z axis of the body. The directions of the axes in the
+ * nadir frame are computed once, at construction. For each state, the states
+ * are converted to the Earth-fixed frame (BatchConversions, all the states at
+ * once), the nadir frame of the state (NadirPointingAttitude) is built once,
+ * and the rays of all the options are intersected with the Earth ellipsoid
+ * in a branch-free loop over the options.
+ *
+ * The ground point of an option is the nearest intersection in front of the
+ * spacecraft (the ray, not the line, is intersected); it is given by its
+ * geodetic latitude (the geocentric latitude on a sphere) and its longitude
+ * in [0, 2pi), in radians. A ray missing the ellipsoid gives NaN.
+ *
+ * The results can be written as a flat binary table (little-endian):
+ *    char[4]  magic "PCPI"
+ *    int32    version
+ *    int32    number of options, int32 number of steps
+ *    float64  equatorial radius (km), float64 flattening
+ *    float64  Euler angles (deg) of each option (number of options x 3)
+ *    int32    Euler sequence (3)
+ *    then, for each step: float64 time (JDUT1), then for each option
+ *    float64 latitude, float64 longitude (rad)
+ */
+//------------------------------------------------------------------------------
+#ifndef PointingIntersectionEngine_hpp
+#define PointingIntersectionEngine_hpp
+
+#include <string>
+#include "gmatdefs.hpp"
+#include "Rvector3.hpp"
+
+class PointingIntersectionEngine
+{
+public:
+
+   /// class construction/destruction
+   PointingIntersectionEngine(const RealArray &angles1,
+                              const RealArray &angles2,
+                              const RealArray &angles3,
+                              Integer seq1 = 1, Integer seq2 = 2,
+                              Integer seq3 = 3);
+   PointingIntersectionEngine(const PointingIntersectionEngine &copy);
+   PointingIntersectionEngine& operator=(
+                              const PointingIntersectionEngine &copy);
+
+   virtual ~PointingIntersectionEngine();
+
+   /// Set the ellipsoid (the default is the sphere of the Earth equatorial
+   /// radius)
+   void              SetEllipsoid(Real equatorialRadius, Real flattening);
+   Real              GetEquatorialRadius() const;
+   Real              GetFlattening() const;
+   /// Get the number of pointing options
+   Integer           GetNumOptions() const;
+   /// Get the pointing axis of an option in the nadir frame
+   Rvector3          GetPointingAxis(Integer option) const;
+
+   /// Ground points (n x options x 2: latitude, longitude) of the Earth-fixed
+   /// states (n x 6)
+   void              IntersectBodyFixed(const Real *bfStates, Integer n,
+                                        Real *latLon) const;
+   /// Ground points (n x options x 2) of the inertial states (n x 6) at the
+   /// times jd (n)
+   void              Intersect(const Real *jd, const Real *states, Integer n,
+                               Real *latLon) const;
+   /// Write the ground points of the inertial states at the times jd to a
+   /// binary table
+   void              WriteTable(const std::string &filename, const Real *jd,
+                                const Real *states, Integer n) const;
+   /// Read a binary table: the times (n) and the ground points
+   /// (n x options x 2); returns the number of options
+   static Integer    ReadTable(const std::string &filename, RealArray &jd,
+                               RealArray &latLon);
+
+protected:
+
+   /// Euler angles (deg) and sequence of the options
+   RealArray         angles1;
+   RealArray         angles2;
+   RealArray         angles3;
+   Integer           seq[3];
+   /// pointing axes in the nadir frame (one array per component)
+   RealArray         axisX;
+   RealArray         axisY;
+   RealArray         axisZ;
+   /// equatorial radius (km) and flattening of the ellipsoid
+   Real              radius;
+   Real              flattening;
+
+   /// Number of states converted and intersected at a time
+   static const Integer CHUNK_SIZE;
+};
+#endif // PointingIntersectionEngine_hpp
@@ -0,0 +1,547 @@
+//------------------------------------------------------------------------------
+//                           Profiler
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the Profiler class
+ */
+//------------------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "gmatdefs.hpp"
+#include "Profiler.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+const Integer Profiler::MAX_TRACE_EVENTS = 1000000;
+
+std::atomic<bool>                 Profiler::enabled(false);
+std::atomic<bool>                 Profiler::tracing(false);
+std::atomic<long long>            Profiler::stageTimes[NUM_STAGES];
+std::atomic<long long>            Profiler::stageCalls[NUM_STAGES];
+std::atomic<long long>            Profiler::stageAllocations[NUM_STAGES];
+std::atomic<long long>            Profiler::counters[NUM_COUNTERS];
+std::atomic<long long>            Profiler::currentMemory[NUM_SUBSYSTEMS];
+std::atomic<long long>            Profiler::peakMemory[NUM_SUBSYSTEMS];
+std::atomic<long long>            Profiler::totalMemory(0);
+std::atomic<long long>            Profiler::totalPeakMemory(0);
+thread_local long long            Profiler::threadAllocations = 0;
+bool                              Profiler::countingAllocations = false;
+std::vector<Profiler::TraceEvent> Profiler::traceEvents;
+std::atomic<long long>            Profiler::droppedEvents(0);
+std::mutex                        Profiler::traceMutex;
+std::atomic<long long>            Profiler::traceOrigin(0);
+
+static const char *STAGE_NAMES[Profiler::NUM_STAGES] =
+{
+   "Propagation", "FrameConversion", "Feasibility", "FovTest",
+   "IntervalBuilding", "Output"
+};
+
+static const char *COUNTER_NAMES[Profiler::NUM_COUNTERS] =
+{
+   "PointsTested", "FeasiblePoints", "VisiblePoints", "BytesWritten",
+   "PrecisionFallbacks"
+};
+
+static const char *SUBSYSTEM_NAMES[Profiler::NUM_SUBSYSTEMS] =
+{
+   "Points", "Checker", "TimeSeries", "Interpolator", "Accesses"
+};
+
+//------------------------------------------------------------------------------
+// public static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void Enable(bool withTrace = false)
+//------------------------------------------------------------------------------
+/**
+ * Enables the profiler. The times and counters add to those recorded so far.
+ *
+ * @param withTrace  record each timed scope as a trace event
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::Enable(bool withTrace)
+{
+   if (!enabled && traceEvents.empty())
+      traceOrigin = Now();
+   tracing = withTrace;
+   enabled = true;
+}
+
+//------------------------------------------------------------------------------
+// void Disable()
+//------------------------------------------------------------------------------
+/**
+ * Disables the profiler. The recorded data are kept.
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::Disable()
+{
+   enabled = false;
+   tracing = false;
+}
+
+//------------------------------------------------------------------------------
+// bool IsTracing()
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the trace events are recorded.
+ *
+ */
+//------------------------------------------------------------------------------
+bool Profiler::IsTracing()
+{
+   return tracing;
+}
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Clears the times, calls, counters and trace events. The peak memory is
+ * reset to the current memory (which is not changed).
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::Reset()
+{
+   for (Integer ii = 0; ii < NUM_STAGES; ii++)
+   {
+      stageTimes[ii]       = 0;
+      stageCalls[ii]       = 0;
+      stageAllocations[ii] = 0;
+   }
+   for (Integer ii = 0; ii < NUM_COUNTERS; ii++)
+      counters[ii] = 0;
+   for (Integer ii = 0; ii < NUM_SUBSYSTEMS; ii++)
+      peakMemory[ii] = currentMemory[ii].load();
+   totalPeakMemory = totalMemory.load();
+   std::lock_guard<std::mutex> lock(traceMutex);
+   traceEvents.clear();
+   droppedEvents = 0;
+   traceOrigin   = Now();
+}
+
+//------------------------------------------------------------------------------
+// void RecordStage(Stage stage, long long start, long long duration,
+//                  long long numAllocations = 0)
+//------------------------------------------------------------------------------
+/**
+ * Adds a call of a stage (normally through a Profiler::Scope).
+ *
+ * @param stage           the stage
+ * @param start           start time (ns, from Now())
+ * @param duration        duration (ns)
+ * @param numAllocations  heap allocations made by the call
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::RecordStage(Stage stage, long long start, long long duration,
+                           long long numAllocations)
+{
+   stageTimes[stage] += duration;
+   stageCalls[stage]++;
+   if (numAllocations > 0)
+      stageAllocations[stage] += numAllocations;
+   if (tracing.load(std::memory_order_relaxed))
+   {
+      TraceEvent event = {stage, GetThreadId(), start, duration};
+      std::lock_guard<std::mutex> lock(traceMutex);
+      if ((Integer) traceEvents.size() < MAX_TRACE_EVENTS)
+         traceEvents.push_back(event);
+      else
+         droppedEvents++;
+   }
+}
+
+//------------------------------------------------------------------------------
+// long long Now()
+//------------------------------------------------------------------------------
+/**
+ * Returns the time (ns) of the monotonic clock.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::Now()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//------------------------------------------------------------------------------
+// Real GetStageTime(Stage stage)
+//------------------------------------------------------------------------------
+/**
+ * Returns the total wall time of a stage (s), summed over the threads.
+ *
+ */
+//------------------------------------------------------------------------------
+Real Profiler::GetStageTime(Stage stage)
+{
+   return stageTimes[stage]*1.0e-9;
+}
+
+//------------------------------------------------------------------------------
+// long long GetStageCalls(Stage stage)
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of calls of a stage.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetStageCalls(Stage stage)
+{
+   return stageCalls[stage];
+}
+
+//------------------------------------------------------------------------------
+// long long GetStageAllocations(Stage stage)
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of heap allocations made in a stage (0 unless the
+ * allocations are counted, see AllocationCounter.cpp).
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetStageAllocations(Stage stage)
+{
+   return stageAllocations[stage];
+}
+
+//------------------------------------------------------------------------------
+// long long GetCounter(Counter counter)
+//------------------------------------------------------------------------------
+/**
+ * Returns the value of a counter.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetCounter(Counter counter)
+{
+   return counters[counter];
+}
+
+//------------------------------------------------------------------------------
+// std::string GetStageName(Stage stage)
+//------------------------------------------------------------------------------
+/**
+ * Returns the name of a stage.
+ *
+ */
+//------------------------------------------------------------------------------
+std::string Profiler::GetStageName(Stage stage)
+{
+   return STAGE_NAMES[stage];
+}
+
+//------------------------------------------------------------------------------
+// std::string GetCounterName(Counter counter)
+//------------------------------------------------------------------------------
+/**
+ * Returns the name of a counter.
+ *
+ */
+//------------------------------------------------------------------------------
+std::string Profiler::GetCounterName(Counter counter)
+{
+   return COUNTER_NAMES[counter];
+}
+
+//------------------------------------------------------------------------------
+// std::string GetSubsystemName(Subsystem subsystem)
+//------------------------------------------------------------------------------
+/**
+ * Returns the name of a memory subsystem.
+ *
+ */
+//------------------------------------------------------------------------------
+std::string Profiler::GetSubsystemName(Subsystem subsystem)
+{
+   return SUBSYSTEM_NAMES[subsystem];
+}
+
+//------------------------------------------------------------------------------
+// std::string GetReport()
+//------------------------------------------------------------------------------
+/**
+ * Returns a text table of the stages (calls, total and mean time, heap
+ * allocations if counted), of the counters and of the memory (current and
+ * peak).
+ *
+ */
+//------------------------------------------------------------------------------
+std::string Profiler::GetReport()
+{
+   std::stringstream report;
+   char line[128];
+   snprintf(line, sizeof(line), "%-18s %12s %14s %14s %12s\n", "Stage", "Calls",
+            "Time (s)", "Mean (us)", "Allocs");
+   report << line;
+   for (Integer ii = 0; ii < NUM_STAGES; ii++)
+   {
+      long long calls = stageCalls[ii];
+      Real      time  = stageTimes[ii]*1.0e-9;
+      snprintf(line, sizeof(line), "%-18s %12lld %14.6f %14.3f %12s\n",
+               STAGE_NAMES[ii], calls, time,
+               calls > 0 ? time*1.0e6/calls : 0.0,
+               countingAllocations ?
+               std::to_string(stageAllocations[ii]).c_str() : "-");
+      report << line;
+   }
+   for (Integer ii = 0; ii < NUM_COUNTERS; ii++)
+   {
+      snprintf(line, sizeof(line), "%-18s %12lld\n", COUNTER_NAMES[ii],
+               (long long) counters[ii]);
+      report << line;
+   }
+   snprintf(line, sizeof(line), "%-18s %12s %14s\n", "Memory", "Current (B)",
+            "Peak (B)");
+   report << line;
+   for (Integer ii = 0; ii < NUM_SUBSYSTEMS; ii++)
+   {
+      snprintf(line, sizeof(line), "%-18s %12lld %14lld\n", SUBSYSTEM_NAMES[ii],
+               (long long) currentMemory[ii], (long long) peakMemory[ii]);
+      report << line;
+   }
+   snprintf(line, sizeof(line), "%-18s %12lld %14lld\n", "Total",
+            (long long) totalMemory, (long long) totalPeakMemory);
+   report << line;
+   return report.str();
+}
+
+//------------------------------------------------------------------------------
+// void UpdateMemory(Subsystem subsystem, long long &accounted, long long bytes)
+//------------------------------------------------------------------------------
+/**
+ * Accounts the memory of a container (or of the containers of an object),
+ * whether or not the profiler is enabled. The object keeps the size accounted
+ * for it, which is updated to the new size; its destructor accounts size 0.
+ *
+ * @param subsystem  the subsystem of the container
+ * @param accounted  size accounted so far (bytes, updated)
+ * @param bytes      new size (bytes)
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::UpdateMemory(Subsystem subsystem, long long &accounted,
+                            long long bytes)
+{
+   long long delta = bytes - accounted;
+   if (delta == 0)
+      return;
+   accounted = bytes;
+   UpdatePeak(peakMemory[subsystem], currentMemory[subsystem] += delta);
+   UpdatePeak(totalPeakMemory, totalMemory += delta);
+}
+
+//------------------------------------------------------------------------------
+// long long GetCurrentMemory(Subsystem subsystem)
+//------------------------------------------------------------------------------
+/**
+ * Returns the memory (bytes) currently accounted for a subsystem.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetCurrentMemory(Subsystem subsystem)
+{
+   return currentMemory[subsystem];
+}
+
+//------------------------------------------------------------------------------
+// long long GetPeakMemory(Subsystem subsystem)
+//------------------------------------------------------------------------------
+/**
+ * Returns the peak memory (bytes) of a subsystem since the start or the last
+ * Reset.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetPeakMemory(Subsystem subsystem)
+{
+   return peakMemory[subsystem];
+}
+
+//------------------------------------------------------------------------------
+// long long GetTotalCurrentMemory()
+//------------------------------------------------------------------------------
+/**
+ * Returns the memory (bytes) currently accounted for all the subsystems.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetTotalCurrentMemory()
+{
+   return totalMemory;
+}
+
+//------------------------------------------------------------------------------
+// long long GetTotalPeakMemory()
+//------------------------------------------------------------------------------
+/**
+ * Returns the peak of the memory of all the subsystems (not the sum of their
+ * peaks) since the start or the last Reset.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetTotalPeakMemory()
+{
+   return totalPeakMemory;
+}
+
+//------------------------------------------------------------------------------
+// void SetCountingAllocations(bool counting)
+//------------------------------------------------------------------------------
+/**
+ * Sets whether the heap allocations are counted (set by AllocationCounter.cpp).
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::SetCountingAllocations(bool counting)
+{
+   countingAllocations = counting;
+}
+
+//------------------------------------------------------------------------------
+// bool IsCountingAllocations()
+//------------------------------------------------------------------------------
+/**
+ * Returns true if the heap allocations are counted.
+ *
+ */
+//------------------------------------------------------------------------------
+bool Profiler::IsCountingAllocations()
+{
+   return countingAllocations;
+}
+
+//------------------------------------------------------------------------------
+// long long GetThreadAllocations()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of heap allocations made by the calling thread so far
+ * (0 unless the allocations are counted).
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetThreadAllocations()
+{
+   return threadAllocations;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumTraceEvents()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of recorded trace events.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer Profiler::GetNumTraceEvents()
+{
+   std::lock_guard<std::mutex> lock(traceMutex);
+   return traceEvents.size();
+}
+
+//------------------------------------------------------------------------------
+// long long GetNumDroppedTraceEvents()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of trace events not recorded because MAX_TRACE_EVENTS
+ * was reached.
+ *
+ */
+//------------------------------------------------------------------------------
+long long Profiler::GetNumDroppedTraceEvents()
+{
+   return droppedEvents;
+}
+
+//------------------------------------------------------------------------------
+// void WriteChromeTrace(const std::string &filename)
+//------------------------------------------------------------------------------
+/**
+ * Writes the trace events (complete events, in us from the trace origin) and
+ * the final counter values as a Chrome trace (JSON).
+ *
+ * @param filename  name of the file
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::WriteChromeTrace(const std::string &filename)
+{
+   std::ofstream out(filename.c_str(), std::ios::out);
+   if (!out.is_open())
+      throw TATCException("Profiler: cannot open file " + filename + "\n");
+
+   std::lock_guard<std::mutex> lock(traceMutex);
+   long long origin = traceOrigin;
+   long long last   = origin;
+   char      event[256];
+   out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+   for (const TraceEvent &ev : traceEvents)
+   {
+      snprintf(event, sizeof(event),
+               "{\"name\":\"%s\",\"cat\":\"propcov\",\"ph\":\"X\","
+               "\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d},\n",
+               STAGE_NAMES[ev.stage], (ev.start - origin)*1.0e-3,
+               ev.duration*1.0e-3, ev.threadId);
+      out << event;
+      if (ev.start + ev.duration > last)
+         last = ev.start + ev.duration;
+   }
+   snprintf(event, sizeof(event),
+            "{\"name\":\"Counters\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,"
+            "\"args\":{", (last - origin)*1.0e-3);
+   out << event;
+   for (Integer ii = 0; ii < NUM_COUNTERS; ii++)
+      out << (ii > 0 ? "," : "") << "\"" << COUNTER_NAMES[ii] << "\":"
+          << (long long) counters[ii];
+   out << "}}\n]}\n";
+   if (!out.good())
+      throw TATCException("Profiler: error writing file " + filename + "\n");
+}
+
+//------------------------------------------------------------------------------
+// protected static methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Integer GetThreadId()
+//------------------------------------------------------------------------------
+/**
+ * Returns a small id of the calling thread (0, 1, ... in order of first use),
+ * the "tid" of its trace events.
+ *
+ */
+//------------------------------------------------------------------------------
+Integer Profiler::GetThreadId()
+{
+   static std::atomic<Integer> nextId(0);
+   thread_local Integer        id = nextId++;
+   return id;
+}
+
+//------------------------------------------------------------------------------
+// void UpdatePeak(std::atomic<long long> &peak, long long value)
+//------------------------------------------------------------------------------
+/**
+ * Raises a peak to the input value if it is lower.
+ *
+ */
+//------------------------------------------------------------------------------
+void Profiler::UpdatePeak(std::atomic<long long> &peak, long long value)
+{
+   long long prev = peak;
+   while (prev < value && !peak.compare_exchange_weak(prev, value))
+      ;
+}
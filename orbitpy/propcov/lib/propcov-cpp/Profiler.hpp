@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+//                           Profiler
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the Profiler class, the stage timers and counters of the
+ * coverage computations.
+ *
+ * The instrumentation is always compiled in and is enabled at run time. While
+ * the profiler is disabled (the default), a timed scope or a counter update
+ * costs a single (relaxed atomic) flag test. While it is enabled, each timed
+ * scope adds its wall time and one call to its stage, and the counters are
+ * incremented. The totals are shared by all the threads (atomic updates, once
+ * per call, not per point).
+ *
+ * With tracing enabled, each timed scope is also recorded as an event (up to
+ * MAX_TRACE_EVENTS events) which can be written as a Chrome trace (JSON, to be
+ * opened in chrome://tracing or Perfetto).
+ *
+ * The memory of the main containers (points, coverage checker arrays,
+ * interpolator buffers, accesses) is accounted per subsystem, whether or not
+ * the profiler is enabled, with the current and peak usage. The heap
+ * allocations are counted only in executables linked with
+ * tests/support-cpp/AllocationCounter.cpp (replacing the global operator new);
+ * the allocations made within the timed scopes are then added to their stage.
+ *
+ * NOTE: This is a static class: No instances of this class may be declared.
+ */
+//------------------------------------------------------------------------------
+#ifndef Profiler_hpp
+#define Profiler_hpp
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "gmatdefs.hpp"
+
+class Profiler
+{
+public:
+
+   /// Timed stages
+   enum Stage
+   {
+      PROPAGATION = 0,     ///< Propagator::Propagate
+      FRAME_CONVERSION,    ///< inertial to Earth-fixed state
+      FEASIBILITY,         ///< line of sight/horizon test of the points
+      FOV_TEST,            ///< sensor field-of-view test of the feasible points
+      INTERVAL_BUILDING,   ///< access intervals and statistics from the steps
+      OUTPUT,              ///< writing of the results to files
+      NUM_STAGES
+   };
+
+   /// Counters
+   enum Counter
+   {
+      POINTS_TESTED = 0,   ///< points checked for coverage
+      FEASIBLE_POINTS,     ///< points passing the feasibility test
+      VISIBLE_POINTS,      ///< points in the sensor field of view
+      BYTES_WRITTEN,       ///< bytes of the output files
+      PRECISION_FALLBACKS, ///< single precision tests re-checked in double
+      NUM_COUNTERS
+   };
+
+   /// Memory subsystems
+   enum Subsystem
+   {
+      POINT_MEMORY = 0,    ///< PointGroup coordinates
+      CHECKER_MEMORY,      ///< CoverageChecker point vectors and feasibility flags
+      TIME_SERIES_MEMORY,  ///< legacy coverage checker time series data
+      INTERPOLATOR_MEMORY, ///< interpolator buffers of the spacecraft
+      ACCESS_MEMORY,       ///< access intervals and access stores
+      NUM_SUBSYSTEMS
+   };
+
+   /// Timer of a stage from construction to destruction
+   class Scope
+   {
+   public:
+      Scope(Stage stage) : stage(stage), start(IsEnabled() ? Now() : -1),
+                           allocations(start >= 0 ? threadAllocations : 0) {}
+      ~Scope() { if (start >= 0) RecordStage(stage, start, Now() - start,
+                                             threadAllocations - allocations); }
+   private:
+      Stage      stage;
+      long long  start;
+      long long  allocations;
+      Scope(const Scope &copy);
+      Scope& operator=(const Scope &copy);
+   };
+
+   /// Enable the profiler, optionally with the recording of trace events
+   static void        Enable(bool withTrace = false);
+   /// Disable the profiler (the data are kept)
+   static void        Disable();
+   /// Is the profiler enabled?
+   static bool        IsEnabled()
+                      { return enabled.load(std::memory_order_relaxed); }
+   /// Are the trace events recorded?
+   static bool        IsTracing();
+   /// Clear the times, calls, counters and trace events
+   static void        Reset();
+
+   /// Add n to a counter (if enabled)
+   static void        AddCount(Counter counter, long long n)
+                      { if (IsEnabled()) counters[counter] += n; }
+   /// Add a call of a stage which started at start (ns), lasted duration (ns)
+   /// and made numAllocations heap allocations
+   static void        RecordStage(Stage stage, long long start,
+                                  long long duration,
+                                  long long numAllocations = 0);
+   /// Time (ns) of the monotonic clock
+   static long long   Now();
+
+   /// Get the total wall time (s) of a stage
+   static Real        GetStageTime(Stage stage);
+   /// Get the number of calls of a stage
+   static long long   GetStageCalls(Stage stage);
+   /// Get the number of heap allocations in a stage (if counted)
+   static long long   GetStageAllocations(Stage stage);
+   /// Get the value of a counter
+   static long long   GetCounter(Counter counter);
+   /// Get the name of a stage / counter
+   static std::string GetStageName(Stage stage);
+   static std::string GetCounterName(Counter counter);
+   static std::string GetSubsystemName(Subsystem subsystem);
+   /// Get a text table of the stages, counters and memory
+   static std::string GetReport();
+
+   /// Account the memory of a container: bytes is its new size and accounted
+   /// the size accounted so far (updated)
+   static void        UpdateMemory(Subsystem subsystem, long long &accounted,
+                                   long long bytes);
+   /// Get the current / peak memory (bytes) of a subsystem or of all of them
+   static long long   GetCurrentMemory(Subsystem subsystem);
+   static long long   GetPeakMemory(Subsystem subsystem);
+   static long long   GetTotalCurrentMemory();
+   static long long   GetTotalPeakMemory();
+
+   /// Count a heap allocation of the calling thread (AllocationCounter.cpp)
+   static void        CountAllocation() { threadAllocations++; }
+   /// Is the counting operator new used? (AllocationCounter.cpp)
+   static void        SetCountingAllocations(bool counting);
+   static bool        IsCountingAllocations();
+   /// Get the number of heap allocations of the calling thread so far
+   static long long   GetThreadAllocations();
+
+   /// Get the number of recorded (and dropped) trace events
+   static Integer     GetNumTraceEvents();
+   static long long   GetNumDroppedTraceEvents();
+   /// Write the trace events and the counters as a Chrome trace (JSON)
+   static void        WriteChromeTrace(const std::string &filename);
+
+   /// Maximum number of recorded trace events
+   static const Integer MAX_TRACE_EVENTS;
+
+protected:
+
+   /// A timed scope (times in ns)
+   struct TraceEvent
+   {
+      Stage      stage;
+      Integer    threadId;
+      long long  start;
+      long long  duration;
+   };
+
+   /// Is the profiler / tracing enabled?
+   static std::atomic<bool>       enabled;
+   static std::atomic<bool>       tracing;
+   /// Total time (ns) and number of calls of each stage
+   static std::atomic<long long>  stageTimes[NUM_STAGES];
+   static std::atomic<long long>  stageCalls[NUM_STAGES];
+   static std::atomic<long long>  stageAllocations[NUM_STAGES];
+   /// Counters
+   static std::atomic<long long>  counters[NUM_COUNTERS];
+   /// Current and peak memory of each subsystem and of all of them
+   static std::atomic<long long>  currentMemory[NUM_SUBSYSTEMS];
+   static std::atomic<long long>  peakMemory[NUM_SUBSYSTEMS];
+   static std::atomic<long long>  totalMemory;
+   static std::atomic<long long>  totalPeakMemory;
+   /// Heap allocations of the calling thread, and are they counted?
+   static thread_local long long  threadAllocations;
+   static bool                    countingAllocations;
+   /// Trace events (guarded by traceMutex) and the number of dropped events
+   static std::vector<TraceEvent> traceEvents;
+   static std::atomic<long long>  droppedEvents;
+   static std::mutex              traceMutex;
+   /// Time (ns) of the trace origin (the last Enable or Reset)
+   static std::atomic<long long>  traceOrigin;
+
+   /// Small id of the calling thread (in order of first use)
+   static Integer     GetThreadId();
+   /// Raise peak to value if it is lower
+   static void        UpdatePeak(std::atomic<long long> &peak, long long value);
+
+private:
+
+   //------------------------------------------------------------------------------
+   // private constructors, destructor, operator=
+   //------------------------------------------------------------------------------
+
+   /// class methods (unimplemented, since this is a static class)
+   Profiler();
+   Profiler( const Profiler &copy);
+   Profiler& operator=(const Profiler &copy);
+
+   ~Profiler();
+
+};
+#endif // Profiler_hpp
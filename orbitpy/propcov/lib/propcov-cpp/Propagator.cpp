@@ -37,6 +37,7 @@
 // #include "bessel.hpp"
 #include "ExponentialAtmosphere.hpp"
 #include "Earth.hpp"
+#include "Profiler.hpp"
 
 //#define DEBUG_DRAG
 
@@ -131,6 +132,45 @@ Propagator::Propagator(const Propagator &copy) :
 	densityModel = new ExponentialAtmosphere("ExpDensity");
 }
 
+//------------------------------------------------------------------------------
+//  Propagator(Spacecraft *sat, BinaryReader &in)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data (see Serialize).
+ *
+ * @param sat  the spacecraft to propagate
+ * @param in   the reader of the data
+ * 
+ */
+//------------------------------------------------------------------------------
+Propagator::Propagator(Spacecraft *sat, BinaryReader &in) :
+   sc                     (sat)
+{
+   in.ReadHeader("Propagator", 1);
+   J2                     = in.ReadReal();
+   mu                     = in.ReadReal();
+   eqRadius               = in.ReadReal();
+   applyDrag              = in.ReadBool();
+   refJd                  = in.ReadReal();
+   propStart.SetJulianDate(in.ReadReal());
+   propEnd.SetJulianDate(in.ReadReal());
+   lastDragUpdateEpoch    = in.ReadReal();
+   orbitPeriod            = in.ReadReal();
+   SMA                    = in.ReadReal();
+   ECC                    = in.ReadReal();
+   INC                    = in.ReadReal();
+   RAAN                   = in.ReadReal();
+   AOP                    = in.ReadReal();
+   TA                     = in.ReadReal();
+   MA                     = in.ReadReal();
+   meanMotionRate         = in.ReadReal();
+   argPeriapsisRate       = in.ReadReal();
+   rightAscensionNodeRate = in.ReadReal();
+   semiLatusRectum        = in.ReadReal();
+   meanMotion             = in.ReadReal();
+   densityModel = new ExponentialAtmosphere("ExpDensity");
+}
+
 //------------------------------------------------------------------------------
 //  Propagator& operator=(const Propagator &copy)
 //------------------------------------------------------------------------------
@@ -227,6 +267,7 @@ void Propagator::SetPhysicalConstants(Real bodyMu, Real bodyJ2,
 //------------------------------------------------------------------------------
 Rvector6 Propagator::Propagate(const AbsoluteDate &toDate)
 {
+   Profiler::Scope timer(Profiler::PROPAGATION);
    // Propgate and return cartesian state given AbsoluteDate
    Real propDuration = (toDate.GetJulianDate() -
                         refJd) * GmatTimeConstants::SECS_PER_DAY;
@@ -272,6 +313,26 @@ Rvector6 Propagator::Propagate(const AbsoluteDate &toDate)
    return sc->GetCartesianState();
 }
 
+//------------------------------------------------------------------------------
+// Rvector6 GetOrbitalElementsAt(Real julianDate) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the Keplerian elements at the input time, as Propagate would set
+ * them on the spacecraft with the drag disabled. Neither the propagator nor
+ * the spacecraft is modified, so the method can be called concurrently.
+ *
+ * @param julianDate  time (JDUT1)
+ *
+ * @return the Keplerian elements (SMA [km], ECC, INC, RAAN, AOP, TA [rad])
+ * 
+ */
+//------------------------------------------------------------------------------
+Rvector6 Propagator::GetOrbitalElementsAt(Real julianDate) const
+{
+   Real propDuration = (julianDate - refJd) * GmatTimeConstants::SECS_PER_DAY;
+   return PropagateOrbitalElements(propDuration);
+}
+
 //------------------------------------------------------------------------------
 // void GetPropStartEnd(AbsoluteDate &pStart, AbsoluteDate &pEnd)
 //------------------------------------------------------------------------------
@@ -320,6 +381,57 @@ bool Propagator::GetApplyDrag()
 	return applyDrag;
 }
 
+//------------------------------------------------------------------------------
+// Spacecraft* GetSpacecraft()
+//------------------------------------------------------------------------------
+/**
+ * Returns the propagated spacecraft.
+ *
+ */
+//------------------------------------------------------------------------------
+Spacecraft* Propagator::GetSpacecraft()
+{
+   return sc;
+}
+
+//------------------------------------------------------------------------------
+// void Serialize(BinaryWriter &out) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the state of the propagator: physical constants, drag flag,
+ * reference epoch, propagation span and the current orbital elements and
+ * rates. The spacecraft is not included.
+ *
+ * @param out  the writer
+ * 
+ */
+//------------------------------------------------------------------------------
+void Propagator::Serialize(BinaryWriter &out) const
+{
+   out.WriteHeader("Propagator", 1);
+   out.WriteReal(J2);
+   out.WriteReal(mu);
+   out.WriteReal(eqRadius);
+   out.WriteBool(applyDrag);
+   out.WriteReal(refJd);
+   out.WriteReal(propStart.GetJulianDate());
+   out.WriteReal(propEnd.GetJulianDate());
+   out.WriteReal(lastDragUpdateEpoch);
+   out.WriteReal(orbitPeriod);
+   out.WriteReal(SMA);
+   out.WriteReal(ECC);
+   out.WriteReal(INC);
+   out.WriteReal(RAAN);
+   out.WriteReal(AOP);
+   out.WriteReal(TA);
+   out.WriteReal(MA);
+   out.WriteReal(meanMotionRate);
+   out.WriteReal(argPeriapsisRate);
+   out.WriteReal(rightAscensionNodeRate);
+   out.WriteReal(semiLatusRectum);
+   out.WriteReal(meanMotion);
+}
+
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
@@ -401,7 +513,7 @@ Real Propagator::ComputePeriapsisAltitude(Rvector6 orbElem, Real julianDate)
 
 
 //------------------------------------------------------------------------------
-// Rvector6 PropagateOrbitalElements(Real propDuration)
+// Rvector6 PropagateOrbitalElements(Real propDuration) const
 //------------------------------------------------------------------------------
 /**
  * Propagates the orbital elements for the specificed duration.
@@ -411,7 +523,7 @@ Real Propagator::ComputePeriapsisAltitude(Rvector6 orbElem, Real julianDate)
  * @return  the propagated orbital elements
  */
 //------------------------------------------------------------------------------
-Rvector6 Propagator::PropagateOrbitalElements(Real propDuration)
+Rvector6 Propagator::PropagateOrbitalElements(Real propDuration) const
 {
    // Propagate and return orbital elements
    Rvector6 orbElements; // all zeros by default
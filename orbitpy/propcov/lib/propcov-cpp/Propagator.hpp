@@ -38,6 +38,7 @@
 #include "OrbitState.hpp"
 #include "Rvector6.hpp"
 #include "ExponentialAtmosphere.hpp"
+#include "BinaryStream.hpp"
 
 class Propagator
 {
@@ -46,6 +47,8 @@ public:
    /// class construction/destruction
    Propagator(Spacecraft *sat);
    Propagator( const Propagator &copy);
+   /// Construct from the data written by Serialize, for the input spacecraft
+   Propagator(Spacecraft *sat, BinaryReader &in);
    Propagator& operator=(const Propagator &copy);
    
    virtual ~Propagator();
@@ -55,6 +58,9 @@ public:
                                           Real bodyRadius);
    /// Propagate the spacecraft
    virtual Rvector6  Propagate(const AbsoluteDate &toDate);
+   /// Get the Keplerian elements at the input time (JDUT1) without drag and
+   /// without modifying the propagator or the spacecraft
+   Rvector6          GetOrbitalElementsAt(Real julianDate) const;
    
    /// Get the propagation start and end times
    virtual void      GetPropStartEnd(AbsoluteDate &pStart, AbsoluteDate &pEnd);
@@ -63,6 +69,11 @@ public:
    void              SetApplyDrag(bool applyDrag);
    /// Get the flag indicating whether or not to apply drag
    bool              GetApplyDrag();
+   /// Get the propagated spacecraft
+   Spacecraft*       GetSpacecraft();
+   
+   /// Write the state of the propagator (not including the spacecraft)
+   virtual void      Serialize(BinaryWriter &out) const;
    
 protected:
    
@@ -130,7 +141,7 @@ protected:
    /// Compute the periapsis altitude
    Real         ComputePeriapsisAltitude(Rvector6 orbElem, Real julianDate);
    /// Propagate the orbital elements
-   Rvector6     PropagateOrbitalElements(Real propDuration);
+   Rvector6     PropagateOrbitalElements(Real propDuration) const;
    /// Compute the drag effects
    void         ComputeDragEffects(Real sma, Real ecc, Real altitude,
 	                                Real &deltaSMAperRev, Real &deltaECCperRev);
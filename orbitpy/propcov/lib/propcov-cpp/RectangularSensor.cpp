@@ -82,10 +82,30 @@ RectangularSensor::RectangularSensor(Real angleHeightIn, Real angleWidthIn) :
 RectangularSensor::RectangularSensor(const RectangularSensor &copy) :
    Sensor(copy),
    angleWidth (copy.angleWidth),
-   angleHeight(copy.angleHeight)
+   angleHeight(copy.angleHeight),
+   poles      (copy.poles)
 {
 }
 
+//------------------------------------------------------------------------------
+// RectangularSensor(BinaryReader &in)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data (see Serialize)
+ * 
+ * @param in the reader of the data
+ */
+//------------------------------------------------------------------------------
+RectangularSensor::RectangularSensor(BinaryReader &in) :
+   Sensor(in, "RectangularSensor")
+{
+   angleHeight = in.ReadReal();
+   angleWidth  = in.ReadReal();
+   Integer numPoles = in.ReadInt();
+   for (Integer ii = 0; ii < numPoles; ii++)
+      poles.push_back(in.ReadRvector3());
+}
+
 //------------------------------------------------------------------------------
 // RectangularSensor& operator=(const RectangularSensor &copy)
 //------------------------------------------------------------------------------
@@ -102,6 +122,7 @@ RectangularSensor& RectangularSensor::operator=(const RectangularSensor &copy)
       Sensor::operator=(copy);
       angleHeight = copy.angleHeight;
       angleWidth  = copy.angleWidth;
+      poles       = copy.poles;
    }
    return *this;
 }
@@ -144,13 +165,20 @@ bool RectangularSensor::CheckTargetVisibility(Real viewConeAngle,
         inView = false;
    else{
       Real viewDec = PI/2.0 - viewConeAngle;
-      Rvector3 viewVector = RADECtoUnitVec(viewClockAngle,viewDec);
+      // unit view vector (as RADECtoUnitVec(viewClockAngle,viewDec)), on the
+      // components so that the test makes no heap allocation
+      Real cosDec  = cos(viewDec);
+      Real viewVector[3] = {cosDec * cos(viewClockAngle),
+                            cosDec * sin(viewClockAngle), sin(viewDec)};
       
       // Below condition works only when the corners (from which the poles are built) are specified in anti-clockwise order. 
-      if( poles[0]*viewVector > 0.0 && poles[1]*viewVector > 0.0 && 
-         poles[2]*viewVector > 0.0 && poles[3]*viewVector > 0.0 )
+      inView = true;
+      for (Integer ii = 0; ii < 4 && inView; ii++)
       {
-         inView = true;
+         const Real *pole = poles[ii].GetDataVector();
+         if (pole[0]*viewVector[0] + pole[1]*viewVector[1] +
+             pole[2]*viewVector[2] <= 0.0)
+            inView = false;
       }
    }
    
@@ -213,6 +241,40 @@ Real RectangularSensor::GetAngleWidth()
    return angleWidth;
 }
 
+//------------------------------------------------------------------------------
+//  const std::vector<Rvector3>& GetPoles() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the poles of the four sides of the FOV, used by
+ * CheckTargetVisibility.
+ *
+ * @return the pole vectors (sensor frame)
+ */
+//------------------------------------------------------------------------------
+const std::vector<Rvector3>& RectangularSensor::GetPoles() const
+{
+   return poles;
+}
+
+//------------------------------------------------------------------------------
+//  void Serialize(BinaryWriter &out) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the state of the sensor (including the pole headings of the sides)
+ *
+ * @param out  the writer
+ */
+//------------------------------------------------------------------------------
+void RectangularSensor::Serialize(BinaryWriter &out) const
+{
+   WriteSensorData(out, "RectangularSensor");
+   out.WriteReal(angleHeight);
+   out.WriteReal(angleWidth);
+   out.WriteInt(poles.size());
+   for (Integer ii = 0; ii < (Integer) poles.size(); ii++)
+      out.WriteRvector3(poles[ii]);
+}
+
 std::vector<Real> RectangularSensor::getClockAngles()
 {
 	std::vector<Real> clocks(4);
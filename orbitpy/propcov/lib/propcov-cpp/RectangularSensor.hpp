@@ -48,6 +48,8 @@ public:
    /// class construction/destruction
    RectangularSensor(Real angleHeightIn, Real angleWidthIn);
    RectangularSensor( const RectangularSensor &copy);
+   /// Construct from the data written by Serialize
+   RectangularSensor(BinaryReader &in);
    RectangularSensor& operator=(const RectangularSensor &copy);
    
    virtual ~RectangularSensor();
@@ -65,6 +67,13 @@ public:
    virtual void  SetAngleWidth(Real angleWidthIn);
    virtual Real  GetAngleWidth();  
    
+   /// Get the poles of the four sides of the FOV (unit vectors in the
+   /// sensor frame; a target is in view if it is on the positive side of all)
+   const std::vector<Rvector3>& GetPoles() const;
+   
+   /// Write the state of the sensor
+   virtual void  Serialize(BinaryWriter &out) const;
+   
    
    /// New Functions
    std::vector<Real> getClockAngles();
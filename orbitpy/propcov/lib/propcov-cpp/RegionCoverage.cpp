@@ -0,0 +1,776 @@
+//------------------------------------------------------------------------------
+//                           RegionCoverage
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the RegionCoverage class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include "gmatdefs.hpp"
+#include "GmatConstants.hpp"
+#include "RegionCoverage.hpp"
+#include "Profiler.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+#include "polygon/SlicedPolygon.hpp"
+#include "polygon/SliceArray.hpp"
+
+//#define DEBUG_REGION_COVERAGE
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// samples farther than this factor times the mean nearest-neighbour spacing
+/// of the grid from any grid point are outside the grid
+static const Real MAX_SPACING_FACTOR = 2.0;
+
+//------------------------------------------------------------------------------
+// static functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// struct PointBuckets
+//------------------------------------------------------------------------------
+/**
+ * Unit vectors of the grid points bucketed on a regular grid of cubes, for the
+ * nearest point searches of the Voronoi weights.
+ */
+//------------------------------------------------------------------------------
+struct PointBuckets
+{
+   const RealArray *xyz;
+   Real             cellSize;
+   Integer          numCells;
+   /// offset and count in indices of each non-empty cube
+   std::unordered_map<long long, std::pair<Integer, Integer> > cells;
+   IntegerArray     indices;
+
+   PointBuckets(const RealArray &points, Real size) :
+      xyz      (&points),
+      cellSize (size),
+      numCells (std::max(1, (Integer) std::ceil(2.0 / size)))
+   {
+      Integer numPts = points.size() / 3;
+      std::vector<std::pair<long long, Integer> > keys(numPts);
+      for (Integer ii = 0; ii < numPts; ii++)
+         keys[ii] = std::make_pair(GetKey(Cell(points[3*ii]),
+                                          Cell(points[3*ii + 1]),
+                                          Cell(points[3*ii + 2])), ii);
+      std::sort(keys.begin(), keys.end());
+      indices.resize(numPts);
+      for (Integer ii = 0; ii < numPts; ii++)
+      {
+         indices[ii] = keys[ii].second;
+         std::pair<Integer, Integer> &cell = cells[keys[ii].first];
+         if (cell.second == 0)
+            cell.first = ii;
+         cell.second++;
+      }
+   }
+
+   Integer Cell(Real x) const
+   {
+      return std::min(numCells - 1,
+                      std::max(0, (Integer) std::floor((x + 1.0) / cellSize)));
+   }
+
+   long long GetKey(Integer cx, Integer cy, Integer cz) const
+   {
+      return ((long long) cx * numCells + cy) * numCells + cz;
+   }
+
+   /// Nearest point (other than exclude) closer than maxDist (chord) to the
+   /// unit vector v, -1 if none; dist is set to its distance
+   Integer Nearest(const Real *v, Real maxDist, Integer exclude,
+                   Real &dist) const
+   {
+      Integer cx = Cell(v[0]), cy = Cell(v[1]), cz = Cell(v[2]);
+      Real    bestDist2 = maxDist * maxDist;
+      Integer best = -1;
+      for (Integer r = 0; r <= numCells; r++)
+      {
+         for (Integer dx = -r; dx <= r; dx++)
+         {
+            Integer x = cx + dx;
+            if (x < 0 || x >= numCells)
+               continue;
+            for (Integer dy = -r; dy <= r; dy++)
+            {
+               Integer y = cy + dy;
+               if (y < 0 || y >= numCells)
+                  continue;
+               // only the shell of the cubes at distance r
+               bool    face = (std::abs(dx) == r || std::abs(dy) == r);
+               Integer dzStep = face ? 1 : std::max(1, 2 * r);
+               for (Integer dz = -r; dz <= r; dz += dzStep)
+               {
+                  Integer z = cz + dz;
+                  if (z < 0 || z >= numCells)
+                     continue;
+                  auto cell = cells.find(GetKey(x, y, z));
+                  if (cell == cells.end())
+                     continue;
+                  for (Integer kk = cell->second.first;
+                       kk < cell->second.first + cell->second.second; kk++)
+                  {
+                     Integer idx = indices[kk];
+                     if (idx == exclude)
+                        continue;
+                     const Real *p = &(*xyz)[3*idx];
+                     Real d2 = (p[0] - v[0]) * (p[0] - v[0]) +
+                               (p[1] - v[1]) * (p[1] - v[1]) +
+                               (p[2] - v[2]) * (p[2] - v[2]);
+                     if (d2 < bestDist2 || (d2 == bestDist2 && best >= 0 &&
+                                            idx < best))
+                     {
+                        bestDist2 = d2;
+                        best = idx;
+                     }
+                  }
+               }
+            }
+         }
+         // the points of the cubes not searched yet are farther than r cubes
+         if (r * cellSize * r * cellSize >= bestDist2)
+            break;
+      }
+      dist = std::sqrt(bestDist2);
+      return best;
+   }
+};
+
+//------------------------------------------------------------------------------
+// void ComputeVoronoiWeights(const RealArray &lats, const RealArray &lons,
+//                            Integer samplesPerPoint, RealArray &weights)
+//------------------------------------------------------------------------------
+/**
+ * Computes the areas of the spherical Voronoi cells of the points, by
+ * assigning equal-area Fibonacci samples of the sphere to their nearest point.
+ * About samplesPerPoint samples fall in the cell of each point.
+ */
+//------------------------------------------------------------------------------
+static void ComputeVoronoiWeights(const RealArray &lats, const RealArray &lons,
+                                  Integer samplesPerPoint, RealArray &weights)
+{
+   const Real PI = GmatMathConstants::PI;
+   Integer numPts = lats.size();
+   weights.assign(numPts, 0.0);
+   if (numPts == 0)
+      return;
+   if (numPts == 1)
+   {
+      weights[0] = 4.0 * PI;
+      return;
+   }
+
+   RealArray xyz(3 * numPts);
+   Real      zMin = 1.0, zMax = -1.0;
+   for (Integer ii = 0; ii < numPts; ii++)
+   {
+      xyz[3*ii]     = cos(lats[ii]) * cos(lons[ii]);
+      xyz[3*ii + 1] = cos(lats[ii]) * sin(lons[ii]);
+      xyz[3*ii + 2] = sin(lats[ii]);
+      zMin = std::min(zMin, xyz[3*ii + 2]);
+      zMax = std::max(zMax, xyz[3*ii + 2]);
+   }
+   PointBuckets buckets(xyz, std::sqrt(4.0 * PI / numPts));
+
+   // mean nearest-neighbour spacing (chord), without the repeated points
+   Real    sumSpacing = 0.0;
+   Integer numSpacings = 0;
+   for (Integer ii = 0; ii < numPts; ii++)
+   {
+      Real dist;
+      if (buckets.Nearest(&xyz[3*ii], 2.0, ii, dist) >= 0 && dist > 0.0)
+      {
+         sumSpacing += dist;
+         numSpacings++;
+      }
+   }
+   if (numSpacings == 0)
+   {
+      weights[0] = 4.0 * PI;
+      return;
+   }
+   Real spacing = sumSpacing / numSpacings;
+   Real maxDist = std::min(2.0, MAX_SPACING_FACTOR * spacing);
+
+   // samples of the z band of the grid (a sample k is at z = 1 - (2k+1)/M)
+   Real      cellArea = std::sqrt(3.0) / 2.0 * spacing * spacing;
+   long long numSamples = std::max((long long) samplesPerPoint * numPts,
+                       (long long) std::ceil(samplesPerPoint * 4.0 * PI / cellArea));
+   Real      sampleArea = 4.0 * PI / numSamples;
+   Real      golden = PI * (3.0 - std::sqrt(5.0));
+   long long first = std::max(0LL,
+                     (long long) std::floor((1.0 - zMax - maxDist) * numSamples / 2.0 - 1.0));
+   long long last  = std::min(numSamples - 1,
+                     (long long) std::ceil((1.0 - zMin + maxDist) * numSamples / 2.0));
+   for (long long kk = first; kk <= last; kk++)
+   {
+      Real z = 1.0 - (2.0 * kk + 1.0) / numSamples;
+      Real r = std::sqrt(std::max(0.0, 1.0 - z * z));
+      Real lon = std::fmod(kk * golden, 2.0 * PI);
+      Real v[3] = {r * cos(lon), r * sin(lon), z};
+      Real dist;
+      Integer nearest = buckets.Nearest(v, maxDist, -1, dist);
+      if (nearest >= 0)
+         weights[nearest] += sampleArea;
+   }
+
+   #ifdef DEBUG_REGION_COVERAGE
+      MessageInterface::ShowMessage("RegionCoverage: spacing %f, %lld of %lld "
+                                    "samples\n", spacing, last - first + 1,
+                                    numSamples);
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// RegionCoverage(PointGroup *ptGroup, Integer samplesPerPoint)
+//------------------------------------------------------------------------------
+/**
+ * Constructor; computes the Voronoi weights of the points of the point group.
+ *
+ * @param ptGroup          pointer to the PointGroup object of the coverage
+ *                         runs
+ * @param samplesPerPoint  mean number of samples of the Voronoi cell of a
+ *                         point (accuracy of the weights)
+ *
+ */
+//------------------------------------------------------------------------------
+RegionCoverage::RegionCoverage(PointGroup *ptGroup, Integer samplesPerPoint) :
+   CoverageSink      (),
+   numSteps          (0),
+   seriesFirstStep   (-1),
+   lastStep          (-1)
+{
+   if (!ptGroup)
+      throw TATCException("RegionCoverage: NULL point group\n");
+   if (samplesPerPoint <= 0)
+      throw TATCException("RegionCoverage: the number of samples per point "
+                          "must be positive\n");
+
+   ptGroup->GetLatLonVectors(pointLats, pointLons);
+   ComputeVoronoiWeights(pointLats, pointLons, samplesPerPoint, pointWeights);
+   BuildPointRegions();
+   Reset();
+}
+
+//------------------------------------------------------------------------------
+// RegionCoverage(const RegionCoverage &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor.
+ *
+ * @param copy  the RegionCoverage object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+RegionCoverage::RegionCoverage(const RegionCoverage &copy) :
+   CoverageSink         (copy),
+   pointLats            (copy.pointLats),
+   pointLons            (copy.pointLons),
+   pointWeights         (copy.pointWeights),
+   regionPoints         (copy.regionPoints),
+   regionAreas          (copy.regionAreas),
+   pointRegionOffsets   (copy.pointRegionOffsets),
+   pointRegionIds       (copy.pointRegionIds),
+   numSteps             (copy.numSteps),
+   seriesFirstStep      (copy.seriesFirstStep),
+   lastStep             (copy.lastStep),
+   coveredAreas         (copy.coveredAreas),
+   firstCoveredSteps    (copy.firstCoveredSteps)
+{
+}
+
+//------------------------------------------------------------------------------
+// RegionCoverage& operator=(const RegionCoverage &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for RegionCoverage.
+ *
+ * @param copy  the RegionCoverage object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+RegionCoverage& RegionCoverage::operator=(const RegionCoverage &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   CoverageSink::operator=(copy);
+   pointLats            = copy.pointLats;
+   pointLons            = copy.pointLons;
+   pointWeights         = copy.pointWeights;
+   regionPoints         = copy.regionPoints;
+   regionAreas          = copy.regionAreas;
+   pointRegionOffsets   = copy.pointRegionOffsets;
+   pointRegionIds       = copy.pointRegionIds;
+   numSteps             = copy.numSteps;
+   seriesFirstStep      = copy.seriesFirstStep;
+   lastStep             = copy.lastStep;
+   coveredAreas         = copy.coveredAreas;
+   firstCoveredSteps    = copy.firstCoveredSteps;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~RegionCoverage()
+//------------------------------------------------------------------------------
+/**
+ * Destructor.
+ *
+ */
+//------------------------------------------------------------------------------
+RegionCoverage::~RegionCoverage()
+{
+}
+
+//------------------------------------------------------------------------------
+// Integer AddRegion(const RealArray &lats, const RealArray &lons,
+//                   Real interiorLat, Real interiorLon)
+//------------------------------------------------------------------------------
+/**
+ * Adds a region and classifies the grid points in it. The accumulated
+ * coverage is cleared.
+ *
+ * @param lats         latitudes of the vertices (rad)
+ * @param lons         longitudes of the vertices (rad)
+ * @param interiorLat  latitude of a point inside the region (rad)
+ * @param interiorLon  longitude of a point inside the region (rad)
+ *
+ * @return  index of the region
+ *
+ */
+//------------------------------------------------------------------------------
+Integer RegionCoverage::AddRegion(const RealArray &lats, const RealArray &lons,
+                                  Real interiorLat, Real interiorLon)
+{
+   const Real PI = GmatMathConstants::PI;
+   if (lats.size() != lons.size())
+      throw TATCException("RegionCoverage: the vertex latitude and longitude "
+                          "arrays must have the same size\n");
+   std::vector<AnglePair> vertices;
+   for (Integer ii = 0; ii < (Integer) lats.size(); ii++)
+      vertices.push_back(AnglePair{PI/2 - lats[ii], lons[ii]});
+   if (!vertices.empty() && (lats.front() != lats.back() ||
+                             lons.front() != lons.back()))
+      vertices.push_back(vertices.front());
+   if (vertices.size() < 4)
+      throw TATCException("RegionCoverage: a region needs at least 3 "
+                          "vertices\n");
+
+   SlicedPolygon poly(vertices, AnglePair{PI/2 - interiorLat, interiorLon});
+   SliceArray   *sliceArray = new SliceArray(poly.getLonArray(),
+                                             poly.getEdgeArray());
+   sliceArray->preprocess();
+   poly.addPreprocessor(sliceArray);
+
+   // the points on the boundary are inside
+   IntegerArray points;
+   for (Integer ii = 0; ii < (Integer) pointLats.size(); ii++)
+      if (poly.contains(AnglePair{PI/2 - pointLats[ii], pointLons[ii]}) != 0)
+         points.push_back(ii);
+   regionPoints.push_back(points);
+
+   BuildPointRegions();
+   ComputeRegionAreas();
+   Reset();
+   return regionPoints.size() - 1;
+}
+
+//------------------------------------------------------------------------------
+// void SetPointWeights(const RealArray &weights)
+//------------------------------------------------------------------------------
+/**
+ * Sets the area weights of the grid points (instead of the Voronoi weights).
+ *
+ * @param weights  weight of each point (sr)
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::SetPointWeights(const RealArray &weights)
+{
+   if (weights.size() != pointLats.size())
+      throw TATCException("RegionCoverage: one weight per grid point is "
+                          "required\n");
+   for (Integer ii = 0; ii < (Integer) weights.size(); ii++)
+      if (weights[ii] < 0.0)
+         throw TATCException("RegionCoverage: the weights must not be "
+                             "negative\n");
+   pointWeights = weights;
+   ComputeRegionAreas();
+}
+
+//------------------------------------------------------------------------------
+// const RealArray& GetPointWeights() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the area weights of the grid points.
+ *
+ * @return  weight of each point (sr)
+ *
+ */
+//------------------------------------------------------------------------------
+const RealArray& RegionCoverage::GetPointWeights() const
+{
+   return pointWeights;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumRegions() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of regions.
+ *
+ * @return  number of regions
+ *
+ */
+//------------------------------------------------------------------------------
+Integer RegionCoverage::GetNumRegions() const
+{
+   return regionPoints.size();
+}
+
+//------------------------------------------------------------------------------
+// Real GetRegionArea(Integer region) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the area of a region, the sum of the weights of its points.
+ *
+ * @param region  index of the region
+ *
+ * @return  area (sr)
+ *
+ */
+//------------------------------------------------------------------------------
+Real RegionCoverage::GetRegionArea(Integer region) const
+{
+   CheckRegion(region);
+   return regionAreas[region];
+}
+
+//------------------------------------------------------------------------------
+// const IntegerArray& GetRegionPoints(Integer region) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the grid points of a region.
+ *
+ * @param region  index of the region
+ *
+ * @return  indices of the points (increasing)
+ *
+ */
+//------------------------------------------------------------------------------
+const IntegerArray& RegionCoverage::GetRegionPoints(Integer region) const
+{
+   CheckRegion(region);
+   return regionPoints[region];
+}
+
+//------------------------------------------------------------------------------
+// void BeginRun(Integer numPoints, Real startJd, Real stepSize,
+//               Integer numSteps)
+//------------------------------------------------------------------------------
+/**
+ * Prepares the sink for a run (the accumulated coverage is cleared).
+ *
+ * @param numPoints  number of points of the coverage grid
+ * @param startJd    time of the first step (JDUT1)
+ * @param stepSize   step size (s)
+ * @param numSteps   number of steps of the run
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::BeginRun(Integer numPoints, Real startJd, Real stepSize,
+                              Integer numSteps)
+{
+   if (numPoints != (Integer) pointLats.size())
+      throw TATCException("RegionCoverage: the run point group does not "
+                          "match the region point group\n");
+   Reset();
+   this->numSteps = numSteps;
+   coveredAreas.reserve((size_t) numSteps * regionPoints.size());
+}
+
+//------------------------------------------------------------------------------
+// void ProcessStep(Integer stepIndex, Real jd,
+//                  const IntegerArray &coveredPoints)
+//------------------------------------------------------------------------------
+/**
+ * Accumulates the covered area of each region at a step. The steps must be
+ * processed in increasing order.
+ *
+ * @param stepIndex      index of the step
+ * @param jd             time of the step (JDUT1)
+ * @param coveredPoints  indices of the points covered at the step
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::ProcessStep(Integer stepIndex, Real jd,
+                                 const IntegerArray &coveredPoints)
+{
+   Profiler::Scope timer(Profiler::INTERVAL_BUILDING);
+   if (stepIndex <= lastStep)
+      throw TATCException("RegionCoverage: steps must be processed in "
+                          "increasing order\n");
+   if (seriesFirstStep < 0)
+      seriesFirstStep = stepIndex;
+   numSteps = std::max(numSteps, stepIndex + 1);
+
+   Integer numRegions = regionPoints.size();
+   size_t  base = (size_t) (stepIndex - seriesFirstStep) * numRegions;
+   coveredAreas.resize(base + numRegions, 0.0);
+   Integer numPts = pointLats.size();
+   for (Integer ii = 0; ii < (Integer) coveredPoints.size(); ii++)
+   {
+      Integer pt = coveredPoints[ii];
+      if (pt < 0 || pt >= numPts)
+         throw TATCException("RegionCoverage: point index out of range\n");
+      Real weight = pointWeights[pt];
+      for (Integer jj = pointRegionOffsets[pt]; jj < pointRegionOffsets[pt + 1];
+           jj++)
+         coveredAreas[base + pointRegionIds[jj]] += weight;
+      if (firstCoveredSteps[pt] < 0)
+         firstCoveredSteps[pt] = stepIndex;
+   }
+   lastStep = stepIndex;
+}
+
+//------------------------------------------------------------------------------
+// CoverageSink* CreatePartial() const
+//------------------------------------------------------------------------------
+/**
+ * Creates an empty sink with the same regions and weights.
+ *
+ * @return  the new partial sink (owned by the caller)
+ *
+ */
+//------------------------------------------------------------------------------
+CoverageSink* RegionCoverage::CreatePartial() const
+{
+   RegionCoverage *partial = new RegionCoverage(*this);
+   partial->Reset();
+   return partial;
+}
+
+//------------------------------------------------------------------------------
+// void MergePartial(const CoverageSink &partial)
+//------------------------------------------------------------------------------
+/**
+ * Merges a partial sink which accumulated the steps following those of this
+ * sink.
+ *
+ * @param partial  the partial sink
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::MergePartial(const CoverageSink &partial)
+{
+   const RegionCoverage *other = dynamic_cast<const RegionCoverage*>(&partial);
+   if (!other || other->pointLats.size() != pointLats.size() ||
+       other->regionPoints.size() != regionPoints.size())
+      throw TATCException("RegionCoverage: incompatible partial sink\n");
+   if (other->lastStep < 0)
+      return;
+   if (lastStep >= other->seriesFirstStep)
+      throw TATCException("RegionCoverage: partial sinks must be merged in "
+                          "step order\n");
+
+   Integer numRegions = regionPoints.size();
+   if (seriesFirstStep < 0)
+      seriesFirstStep = other->seriesFirstStep;
+   coveredAreas.resize((size_t) (other->seriesFirstStep - seriesFirstStep) *
+                       numRegions, 0.0);
+   coveredAreas.insert(coveredAreas.end(), other->coveredAreas.begin(),
+                       other->coveredAreas.end());
+   for (Integer ii = 0; ii < (Integer) firstCoveredSteps.size(); ii++)
+      if (firstCoveredSteps[ii] < 0)
+         firstCoveredSteps[ii] = other->firstCoveredSteps[ii];
+   lastStep = other->lastStep;
+   numSteps = std::max(numSteps, other->numSteps);
+}
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Clears the accumulated coverage.
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::Reset()
+{
+   seriesFirstStep = -1;
+   lastStep        = -1;
+   coveredAreas.clear();
+   firstCoveredSteps.assign(pointLats.size(), -1);
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumSteps() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of steps of the time series (those of the run).
+ *
+ * @return  number of steps
+ *
+ */
+//------------------------------------------------------------------------------
+Integer RegionCoverage::GetNumSteps() const
+{
+   return numSteps;
+}
+
+//------------------------------------------------------------------------------
+// RealArray GetCoveredFractions(Integer region) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the covered fraction of a region at each step (0 for a region
+ * without points).
+ *
+ * @param region  index of the region
+ *
+ * @return  covered fraction per step
+ *
+ */
+//------------------------------------------------------------------------------
+RealArray RegionCoverage::GetCoveredFractions(Integer region) const
+{
+   CheckRegion(region);
+   RealArray fractions(numSteps, 0.0);
+   if (seriesFirstStep < 0 || regionAreas[region] <= 0.0)
+      return fractions;
+   Integer numRegions = regionPoints.size();
+   Integer numSeries  = coveredAreas.size() / numRegions;
+   for (Integer ii = 0; ii < numSeries; ii++)
+      fractions[seriesFirstStep + ii] =
+         coveredAreas[(size_t) ii * numRegions + region] / regionAreas[region];
+   return fractions;
+}
+
+//------------------------------------------------------------------------------
+// RealArray GetCumulativeFractions(Integer region) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the fraction of a region covered at least once up to each step (0
+ * for a region without points).
+ *
+ * @param region  index of the region
+ *
+ * @return  cumulative covered fraction per step
+ *
+ */
+//------------------------------------------------------------------------------
+RealArray RegionCoverage::GetCumulativeFractions(Integer region) const
+{
+   CheckRegion(region);
+   RealArray fractions(numSteps, 0.0);
+   if (regionAreas[region] <= 0.0)
+      return fractions;
+   const IntegerArray &points = regionPoints[region];
+   for (Integer ii = 0; ii < (Integer) points.size(); ii++)
+      if (firstCoveredSteps[points[ii]] >= 0)
+         fractions[firstCoveredSteps[points[ii]]] += pointWeights[points[ii]];
+   Real area = 0.0;
+   for (Integer ii = 0; ii < numSteps; ii++)
+   {
+      area += fractions[ii];
+      fractions[ii] = area / regionAreas[region];
+   }
+   return fractions;
+}
+
+//------------------------------------------------------------------------------
+// Real GetTotalCoveredFraction(Integer region) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the fraction of a region covered at least once during the run (0
+ * for a region without points).
+ *
+ * @param region  index of the region
+ *
+ * @return  covered fraction
+ *
+ */
+//------------------------------------------------------------------------------
+Real RegionCoverage::GetTotalCoveredFraction(Integer region) const
+{
+   CheckRegion(region);
+   if (regionAreas[region] <= 0.0)
+      return 0.0;
+   const IntegerArray &points = regionPoints[region];
+   Real area = 0.0;
+   for (Integer ii = 0; ii < (Integer) points.size(); ii++)
+      if (firstCoveredSteps[points[ii]] >= 0)
+         area += pointWeights[points[ii]];
+   return area / regionAreas[region];
+}
+
+//------------------------------------------------------------------------------
+// protected methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// void CheckRegion(Integer region) const
+//------------------------------------------------------------------------------
+/**
+ * Throws if the region index is out of range.
+ *
+ * @param region  index of the region
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::CheckRegion(Integer region) const
+{
+   if (region < 0 || region >= (Integer) regionPoints.size())
+      throw TATCException("RegionCoverage: region index out of range\n");
+}
+
+//------------------------------------------------------------------------------
+// void BuildPointRegions()
+//------------------------------------------------------------------------------
+/**
+ * Builds the regions of each grid point from the points of each region.
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::BuildPointRegions()
+{
+   Integer numPts = pointLats.size();
+   pointRegionOffsets.assign(numPts + 1, 0);
+   for (Integer rr = 0; rr < (Integer) regionPoints.size(); rr++)
+      for (Integer ii = 0; ii < (Integer) regionPoints[rr].size(); ii++)
+         pointRegionOffsets[regionPoints[rr][ii] + 1]++;
+   for (Integer ii = 0; ii < numPts; ii++)
+      pointRegionOffsets[ii + 1] += pointRegionOffsets[ii];
+   pointRegionIds.resize(pointRegionOffsets[numPts]);
+   IntegerArray next(pointRegionOffsets.begin(), pointRegionOffsets.end() - 1);
+   for (Integer rr = 0; rr < (Integer) regionPoints.size(); rr++)
+      for (Integer ii = 0; ii < (Integer) regionPoints[rr].size(); ii++)
+         pointRegionIds[next[regionPoints[rr][ii]]++] = rr;
+}
+
+//------------------------------------------------------------------------------
+// void ComputeRegionAreas()
+//------------------------------------------------------------------------------
+/**
+ * Computes the area of each region from the weights of its points.
+ *
+ */
+//------------------------------------------------------------------------------
+void RegionCoverage::ComputeRegionAreas()
+{
+   regionAreas.assign(regionPoints.size(), 0.0);
+   for (Integer rr = 0; rr < (Integer) regionPoints.size(); rr++)
+      for (Integer ii = 0; ii < (Integer) regionPoints[rr].size(); ii++)
+         regionAreas[rr] += pointWeights[regionPoints[rr][ii]];
+}
@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+//                           RegionCoverage
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the RegionCoverage class, a CoverageSink accumulating the
+ * area-weighted coverage of polygon regions at each step of a run.
+ *
+ * Each grid point is given an area weight (sr), by default the area of its
+ * spherical Voronoi cell: the sphere is sampled with equal-area (Fibonacci)
+ * samples, each sample is assigned to its nearest grid point, and the weight
+ * of a point is the area of its samples. Samples farther than the mean
+ * nearest-neighbour spacing of the grid from any point are outside the grid
+ * (regional grids), so the border points are not given the rest of the
+ * sphere. The weights can also be set by the caller.
+ *
+ * A region is a spherical polygon (great-circle edges) given by its vertex
+ * latitudes and longitudes and an interior point. Its points are classified
+ * once with a SlicedPolygon (the points on the boundary are inside), and its
+ * area is the sum of the weights of its points.
+ *
+ * At each step, the covered area of each region is the sum of the weights of
+ * its covered points; the sink reports per region:
+ *  - the covered fraction of the region at each step,
+ *  - the cumulative fraction, i.e. the fraction covered at least once up to
+ *    each step (from the first covered step of each point).
+ *
+ * For multi-threaded runs each thread accumulates a contiguous range of steps
+ * in a partial sink; the partial sinks are merged in step order.
+ */
+//------------------------------------------------------------------------------
+#ifndef RegionCoverage_hpp
+#define RegionCoverage_hpp
+
+#include "gmatdefs.hpp"
+#include "PointGroup.hpp"
+#include "CoverageSink.hpp"
+
+class RegionCoverage : public CoverageSink
+{
+public:
+
+   /// class construction/destruction
+   RegionCoverage(PointGroup *ptGroup, Integer samplesPerPoint = 16);
+   RegionCoverage(const RegionCoverage &copy);
+   RegionCoverage& operator=(const RegionCoverage &copy);
+
+   virtual ~RegionCoverage();
+
+   /// Add a region (lat/lon in radians, the polygon is closed if needed);
+   /// returns the index of the region
+   Integer                 AddRegion(const RealArray &lats,
+                                     const RealArray &lons,
+                                     Real interiorLat, Real interiorLon);
+   /// Set the area weights of the grid points (sr)
+   void                    SetPointWeights(const RealArray &weights);
+   const RealArray&        GetPointWeights() const;
+
+   Integer                 GetNumRegions() const;
+   /// Get the area of a region (sum of the weights of its points, sr)
+   Real                    GetRegionArea(Integer region) const;
+   /// Get the indices of the grid points of a region
+   const IntegerArray&     GetRegionPoints(Integer region) const;
+
+   /// CoverageSink interface
+   virtual void            BeginRun(Integer numPoints, Real startJd,
+                                    Real stepSize, Integer numSteps);
+   virtual void            ProcessStep(Integer stepIndex, Real jd,
+                                       const IntegerArray &coveredPoints);
+   virtual CoverageSink*   CreatePartial() const;
+   virtual void            MergePartial(const CoverageSink &partial);
+
+   /// Clear the accumulated coverage
+   void                    Reset();
+
+   /// Get the number of steps of the time series
+   Integer                 GetNumSteps() const;
+   /// Get the covered fraction of a region at each step
+   RealArray               GetCoveredFractions(Integer region) const;
+   /// Get the fraction of a region covered at least once up to each step
+   RealArray               GetCumulativeFractions(Integer region) const;
+   /// Get the fraction of a region covered at least once during the run
+   Real                    GetTotalCoveredFraction(Integer region) const;
+
+protected:
+
+   /// latitude and longitude of each grid point (rad)
+   RealArray               pointLats;
+   RealArray               pointLons;
+   /// area weight of each grid point (sr)
+   RealArray               pointWeights;
+   /// grid points and area of each region
+   std::vector<IntegerArray> regionPoints;
+   RealArray               regionAreas;
+   /// regions of each grid point (compressed sparse rows)
+   IntegerArray            pointRegionOffsets;
+   IntegerArray            pointRegionIds;
+
+   /// number of steps of the run, first step of the series and last
+   /// processed step (-1 if none)
+   Integer                 numSteps;
+   Integer                 seriesFirstStep;
+   Integer                 lastStep;
+   /// covered area of each region at the steps from seriesFirstStep
+   /// (step-major)
+   RealArray               coveredAreas;
+   /// first covered step of each grid point (-1 if none)
+   IntegerArray            firstCoveredSteps;
+
+   void                    CheckRegion(Integer region) const;
+   void                    BuildPointRegions();
+   void                    ComputeRegionAreas();
+};
+#endif // RegionCoverage_hpp
@@ -29,6 +29,7 @@
 #include "Sensor.hpp"
 #include "GmatConstants.hpp"
 #include "AttitudeConversionUtility.hpp"
+#include "TATCException.hpp"
 #include "GmatConstants.hpp"
 
 //#define DEBUG_SENSOR
@@ -90,6 +91,30 @@ Sensor::Sensor(const Sensor &copy) :
 {
 }
 
+//------------------------------------------------------------------------------
+// Sensor(BinaryReader &in, const std::string &className)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data: reads the header of the object and the
+ * data of the Sensor class (see WriteSensorData)
+ * 
+ * @param in         the reader of the data
+ * @param className  the class name expected in the header
+ */
+//------------------------------------------------------------------------------
+Sensor::Sensor(BinaryReader &in, const std::string &className)
+{
+   in.ReadHeader(className, 1);
+   maxExcursionAngle = in.ReadReal();
+   offsetAngle1      = in.ReadReal();
+   offsetAngle2      = in.ReadReal();
+   offsetAngle3      = in.ReadReal();
+   eulerSeq1         = in.ReadInt();
+   eulerSeq2         = in.ReadInt();
+   eulerSeq3         = in.ReadInt();
+   R_SB              = in.ReadRmatrix33();
+}
+
 //------------------------------------------------------------------------------
 // Sensor& operator=(const Sensor &copy)
 //------------------------------------------------------------------------------
@@ -176,10 +201,64 @@ Rmatrix33 Sensor::GetBodyToSensorMatrix(Real forTime)
    return R_SB;
 }
 
+//------------------------------------------------------------------------------
+//  Real GetMaxExcursionAngle() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the maximum excursion angle: the largest cone angle of the points
+ * in the sensor FOV.
+ *
+ * @return the maximum excursion angle (rad)
+ */
+//------------------------------------------------------------------------------
+Real Sensor::GetMaxExcursionAngle() const
+{
+   return maxExcursionAngle;
+}
+
+//------------------------------------------------------------------------------
+//  void Serialize(BinaryWriter &out) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the state of the sensor; the sensor types supporting serialization
+ * override this method (and provide a constructor from a BinaryReader).
+ *
+ * @param out  the writer
+ */
+//------------------------------------------------------------------------------
+void Sensor::Serialize(BinaryWriter &out) const
+{
+   throw TATCException("Serialization is not supported for this sensor type\n");
+}
+
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
 
+//------------------------------------------------------------------------------
+//  void WriteSensorData(BinaryWriter &out, const std::string &className) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the header of the object and the data of the Sensor class (read by
+ * the Sensor(BinaryReader&, const std::string&) constructor).
+ *
+ * @param out        the writer
+ * @param className  the class name of the object
+ */
+//------------------------------------------------------------------------------
+void Sensor::WriteSensorData(BinaryWriter &out,
+                             const std::string &className) const
+{
+   out.WriteHeader(className, 1);
+   out.WriteReal(maxExcursionAngle);
+   out.WriteReal(offsetAngle1);
+   out.WriteReal(offsetAngle2);
+   out.WriteReal(offsetAngle3);
+   out.WriteInt(eulerSeq1);
+   out.WriteInt(eulerSeq2);
+   out.WriteInt(eulerSeq3);
+   out.WriteRmatrix33(R_SB);
+}
 
 //------------------------------------------------------------------------------
 //  bool CheckTargetMaxExcursionAngle(Real viewConeAngle)
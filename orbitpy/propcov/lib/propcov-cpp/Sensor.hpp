@@ -55,6 +55,7 @@
 #include "Rmatrix33.hpp"
 #include "Rvector.hpp"
 #include "Rvector3.hpp"
+#include "BinaryStream.hpp"
 
 class Sensor
 {
@@ -74,6 +75,11 @@ public:
                         Integer seq1 = 1, Integer seq2 = 2,   Integer seq3 = 3);
    /// Get the spacecraft-body-to-sensor matrix
    virtual Rmatrix33 GetBodyToSensorMatrix(Real forTime);
+   /// Get the maximum excursion angle (rad)
+   Real          GetMaxExcursionAngle() const;
+   /// Write the state of the sensor (throws for the sensor types without
+   /// serialization support)
+   virtual void  Serialize(BinaryWriter &out) const;
    
    //------------------------------------------------------------------------------
    // bool CheckTargetVisibility(Real viewConeAngle, Real viewClockAngle = 0.0)
@@ -96,6 +102,12 @@ public:
    
 protected:
    
+   /// Construct from serialized data (reads the header and the Sensor data)
+   Sensor(BinaryReader &in, const std::string &className);
+   /// Write the header and the Sensor data (for Serialize)
+   void          WriteSensorData(BinaryWriter &out,
+                                 const std::string &className) const;
+   
    /// The maximum excursion angle
    Real          maxExcursionAngle;
    
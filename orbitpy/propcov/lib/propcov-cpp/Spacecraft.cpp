@@ -27,6 +27,8 @@
 
 #include "gmatdefs.hpp"
 #include "Spacecraft.hpp"
+#include "NadirPointingAttitude.hpp"
+#include "Profiler.hpp"
 #include "TATCException.hpp"
 #include "MessageInterface.hpp"
 #include "AttitudeConversionUtility.hpp"
@@ -79,7 +81,9 @@ Spacecraft::Spacecraft(AbsoluteDate *epoch, OrbitState *state, Attitude *att,
    orbitEpoch       (epoch),
    numSensors       (0),
    attitude         (att),
-   interpolator     (interp)
+   interpolator     (interp),
+   ownsComponents   (false),
+   accountedMemory  (0)
 {
    // sensorList is empty at start
    // R_Nadir2ScBody is identity if default angles are used
@@ -93,6 +97,7 @@ Spacecraft::Spacecraft(AbsoluteDate *epoch, OrbitState *state, Attitude *att,
    eulerSeq3    = seq3;
    
    ComputeNadirToBodyMatrix();
+   AccountMemory();
 }
 
 
@@ -113,13 +118,17 @@ Spacecraft::Spacecraft(const Spacecraft &copy) :
    orbitState       ((copy.orbitState)->Clone()), // TODO: Clone this? Probably yes because the object can be changed by the Spacecraft class.
    orbitEpoch       ((copy.orbitEpoch)->Clone()), // TODO: Clone this? Probably yes because the object can be changed by the Spacecraft class.
    numSensors       (copy.numSensors),
+   attitude         (NULL),
+   interpolator     (NULL),
    offsetAngle1     (copy.offsetAngle1),
    offsetAngle2     (copy.offsetAngle2),
    offsetAngle3     (copy.offsetAngle3),
    eulerSeq1        (copy.eulerSeq1),
    eulerSeq2        (copy.eulerSeq2),
    eulerSeq3        (copy.eulerSeq3),
-   R_Nadir2ScBody   (copy.R_Nadir2ScBody)
+   R_Nadir2ScBody   (copy.R_Nadir2ScBody),
+   ownsComponents   (true),
+   accountedMemory  (0)
 {
    if (copy.numSensors > 0)
    {
@@ -135,6 +144,73 @@ Spacecraft::Spacecraft(const Spacecraft &copy) :
    {
       attitude = (Attitude*) (copy.attitude)->Clone(); // TODO: Clone this? Probably yes because the object can be changed by the Spacecraft class.
    }
+   AccountMemory();
+}
+
+//------------------------------------------------------------------------------
+//  Spacecraft(BinaryReader &in)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data (see Serialize). The orbit state, epoch,
+ * attitude and interpolator are created (and owned) by the spacecraft; the
+ * sensors are not part of the data and are to be added with AddSensor.
+ *
+ * @param in  the reader of the data
+ *
+ * @note  throws TATCException on truncated or invalid data
+ *
+ */
+//------------------------------------------------------------------------------
+Spacecraft::Spacecraft(BinaryReader &in) :
+   orbitState       (NULL),
+   orbitEpoch       (NULL),
+   numSensors       (0),
+   attitude         (NULL),
+   interpolator     (NULL),
+   ownsComponents   (true),
+   accountedMemory  (0)
+{
+   // the components created before a read fails are deleted (the destructor
+   // is not called)
+   try
+   {
+      in.ReadHeader("Spacecraft", 1);
+      dragCoefficient = in.ReadReal();
+      dragArea        = in.ReadReal();
+      totalMass       = in.ReadReal();
+      orbitEpoch      = new AbsoluteDate();
+      orbitEpoch->SetJulianDate(in.ReadReal());
+      orbitState      = new OrbitState();
+      orbitState->SetCartesianState(in.ReadRvector6());
+      if (in.ReadBool())
+         attitude     = new NadirPointingAttitude();
+      if (in.ReadBool())
+      {
+         std::string name  = in.ReadString();
+         Integer     dim   = in.ReadInt();
+         Integer     order = in.ReadInt();
+         interpolator      = new LagrangeInterpolator(name, dim, order);
+         RealArray   ind   = in.ReadRealArray();
+         RealArray   data  = in.ReadRealArray();
+         if ((Integer) data.size() != (Integer) ind.size() * dim)
+            throw TATCException("Invalid serialized Spacecraft\n");
+         for (Integer ii = 0; ii < (Integer) ind.size(); ii++)
+            interpolator->AddPoint(ind[ii], &data[ii * dim]);
+      }
+      offsetAngle1    = in.ReadReal();
+      offsetAngle2    = in.ReadReal();
+      offsetAngle3    = in.ReadReal();
+      eulerSeq1       = in.ReadInt();
+      eulerSeq2       = in.ReadInt();
+      eulerSeq3       = in.ReadInt();
+      R_Nadir2ScBody  = in.ReadRmatrix33();
+   }
+   catch (...)
+   {
+      DeleteComponents();
+      throw;
+   }
+   AccountMemory();
 }
 
 //------------------------------------------------------------------------------
@@ -152,6 +228,9 @@ Spacecraft& Spacecraft::operator=(const Spacecraft &copy)
    if (&copy == this)
       return *this;
    
+   if (ownsComponents)
+      DeleteComponents();
+
    dragCoefficient  = copy.dragCoefficient;
    dragArea         = copy.dragArea;
    totalMass        = copy.totalMass;
@@ -171,6 +250,8 @@ Spacecraft& Spacecraft::operator=(const Spacecraft &copy)
    for (Integer ii = 0; ii < copy.numSensors; ii++)
       sensorList.push_back(copy.sensorList.at(ii));
    
+   interpolator     = NULL;
+   attitude         = NULL;
    if (copy.interpolator)
    {
       interpolator = (LagrangeInterpolator*) (copy.interpolator)->Clone(); // TODO: Clone this? Probably yes because the object can be changed by the Spacecraft class.
@@ -179,6 +260,8 @@ Spacecraft& Spacecraft::operator=(const Spacecraft &copy)
    {
       attitude = (Attitude*) (copy.attitude)->Clone(); // TODO: Clone this? Probably yes because the object can be changed by the Spacecraft class.
    }
+   ownsComponents   = true;
+   AccountMemory();
 
    return *this;
 }
@@ -209,6 +292,9 @@ Spacecraft::~Spacecraft()
    if (attitude)
       delete attitude;
    */   
+   if (ownsComponents)
+      DeleteComponents();
+   Profiler::UpdateMemory(Profiler::INTERPOLATOR_MEMORY, accountedMemory, 0);
 }
 
 //------------------------------------------------------------------------------
@@ -318,6 +404,21 @@ void Spacecraft::AddSensor(Sensor* sensor)
    numSensors++;
 }
 
+//------------------------------------------------------------------------------
+//  void RemoveSensors()
+//------------------------------------------------------------------------------
+/**
+ * Removes all the sensors from the Spacecraft's sensor list (the sensors are
+ * not deleted).
+ * 
+ */
+//------------------------------------------------------------------------------
+void Spacecraft::RemoveSensors()
+{
+   sensorList.clear();
+   numSensors = 0;
+}
+
 //------------------------------------------------------------------------------
 //  bool HasSensors()
 //------------------------------------------------------------------------------
@@ -333,6 +434,40 @@ bool Spacecraft::HasSensors()
    return (numSensors > 0);
 }
 
+//------------------------------------------------------------------------------
+//  Integer GetNumSensors()
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of sensors attached to the spacecraft.
+ *
+ * @return  the number of sensors
+ * 
+ */
+//------------------------------------------------------------------------------
+Integer Spacecraft::GetNumSensors()
+{
+   return numSensors;
+}
+
+//------------------------------------------------------------------------------
+//  Sensor* GetSensor(Integer sensorNumber)
+//------------------------------------------------------------------------------
+/**
+ * Returns a sensor attached to the spacecraft.
+ *
+ * @param sensorNumber  index of the sensor
+ *
+ * @return  the sensor
+ * 
+ */
+//------------------------------------------------------------------------------
+Sensor* Spacecraft::GetSensor(Integer sensorNumber)
+{
+   if (sensorNumber < 0 || sensorNumber >= numSensors)
+      throw TATCException("ERROR - Spacecraft: invalid sensor number\n");
+   return sensorList.at(sensorNumber);
+}
+
 //------------------------------------------------------------------------------
 //  void SetDragArea(Real area)
 //------------------------------------------------------------------------------
@@ -768,6 +903,51 @@ Rvector6 Spacecraft::Interpolate(Real toTime)
 
 
 
+//------------------------------------------------------------------------------
+//  void Serialize(BinaryWriter &out) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the state of the spacecraft: drag parameters, epoch, Cartesian
+ * state, attitude (nadir-pointing only), interpolator (including the buffered
+ * points), and body offset angles. The sensors are not included (they may be
+ * shared with other spacecraft) and are to be serialized separately.
+ *
+ * @param out  the writer
+ *
+ */
+//------------------------------------------------------------------------------
+void Spacecraft::Serialize(BinaryWriter &out) const
+{
+   if (attitude && !dynamic_cast<NadirPointingAttitude*>(attitude))
+      throw TATCException(
+            "Serialization is only supported for a nadir-pointing attitude\n");
+   out.WriteHeader("Spacecraft", 1);
+   out.WriteReal(dragCoefficient);
+   out.WriteReal(dragArea);
+   out.WriteReal(totalMass);
+   out.WriteReal(orbitEpoch->GetJulianDate());
+   out.WriteRvector6(orbitState->GetCartesianState());
+   out.WriteBool(attitude != NULL);
+   out.WriteBool(interpolator != NULL);
+   if (interpolator)
+   {
+      RealArray ind, data;
+      interpolator->GetBufferedPoints(ind, data);
+      out.WriteString(interpolator->GetName());
+      out.WriteInt(interpolator->GetDimension());
+      out.WriteInt(interpolator->GetOrder());
+      out.WriteRealArray(ind);
+      out.WriteRealArray(data);
+   }
+   out.WriteReal(offsetAngle1);
+   out.WriteReal(offsetAngle2);
+   out.WriteReal(offsetAngle3);
+   out.WriteInt(eulerSeq1);
+   out.WriteInt(eulerSeq2);
+   out.WriteInt(eulerSeq3);
+   out.WriteRmatrix33(R_Nadir2ScBody);
+}
+
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
@@ -820,3 +1000,50 @@ void Spacecraft::ComputeNadirToBodyMatrix()
 Rmatrix33 Spacecraft::GetNadirToBodyMatrix(){
    return R_Nadir2ScBody;
 }
+
+//------------------------------------------------------------------------------
+// void DeleteComponents()
+//------------------------------------------------------------------------------
+/**
+ * Deletes the orbit state, epoch, attitude and interpolator objects. Only
+ * called for the objects cloned by the copy constructor / operator= (the
+ * sensors are shared with the copied spacecraft and are not deleted).
+ *
+ */
+//------------------------------------------------------------------------------
+void Spacecraft::DeleteComponents()
+{
+   delete orbitState;
+   delete orbitEpoch;
+   if (interpolator)
+      delete interpolator;
+   if (attitude)
+      delete attitude;
+   orbitState   = NULL;
+   orbitEpoch   = NULL;
+   interpolator = NULL;
+   attitude     = NULL;
+}
+
+//------------------------------------------------------------------------------
+// void AccountMemory()
+//------------------------------------------------------------------------------
+/**
+ * Accounts the memory of the buffers of the interpolator (ring buffer of the
+ * base class and Lagrange buffers) used by the spacecraft
+ * (Profiler::INTERPOLATOR_MEMORY).
+ *
+ */
+//------------------------------------------------------------------------------
+void Spacecraft::AccountMemory()
+{
+   long long bytes = 0;
+   if (interpolator)
+   {
+      long long bufSize = interpolator->GetBufferSize();
+      long long dim     = interpolator->GetDimension();
+      bytes = (2 * bufSize + 1) * ((dim + 1) * sizeof(Real) + sizeof(Real*));
+   }
+   Profiler::UpdateMemory(Profiler::INTERPOLATOR_MEMORY, accountedMemory,
+                          bytes);
+}
@@ -50,6 +50,7 @@
 #include "Attitude.hpp"
 #include "LagrangeInterpolator.hpp"
 #include "Rvector6.hpp"
+#include "BinaryStream.hpp"
 
 class Spacecraft
 {
@@ -62,6 +63,8 @@ public:
               Real angle1 = 0.0, Real angle2 = 0.0, Real angle3 = 0.0,
               Integer seq1 = 1, Integer seq2 = 2, Integer seq3 = 3); // angles in degrees
    Spacecraft( const Spacecraft &copy);
+   /// Construct from the data written by Serialize (owning new components)
+   Spacecraft(BinaryReader &in);
    Spacecraft& operator=(const Spacecraft &copy);
    
    virtual ~Spacecraft();
@@ -80,8 +83,13 @@ public:
    virtual Rvector6 GetKeplerianState();
    /// Add a sensor to the spacecraft
    virtual void           AddSensor(Sensor* sensor);
+   /// Remove the sensors from the spacecraft (they are not deleted)
+   virtual void           RemoveSensors();
    /// Does this spacecraft have sensors?
    virtual bool           HasSensors();
+   /// Get the number of sensors and a sensor by index
+   virtual Integer        GetNumSensors();
+   virtual Sensor*        GetSensor(Integer sensorNumber);
    /// Set the drag area
    virtual void           SetDragArea(Real area);
    /// Set the drag coefficient
@@ -144,6 +152,9 @@ public:
    // Get the rotation matrix from Nadir pointing frame to Spacecraft body frame.
    Rmatrix33 GetNadirToBodyMatrix();
    
+   /// Write the state of the spacecraft (not including the sensors)
+   virtual void           Serialize(BinaryWriter &out) const;
+   
 protected:
    
    /// Drag coefficient
@@ -176,6 +187,12 @@ protected:
    
    /// The rotation matrix from the nadir-pointing frame to the spacecraft-body frame
    Rmatrix33            R_Nadir2ScBody;   
+   /// true if the orbit state, epoch, attitude and interpolator were cloned
+   /// by this object (copy construction) and are to be deleted by it
+   bool                 ownsComponents;
+   /// Memory accounted for the interpolator buffers
+   /// (Profiler::INTERPOLATOR_MEMORY)
+   long long            accountedMemory;
    
    /// @todo - do we need to buffer states here as well??
    
@@ -185,6 +202,10 @@ protected:
                                      Real &clock);
    /// Compute the nadir-pointing-to-spacecraft-body-matrix
    virtual void  ComputeNadirToBodyMatrix();
+   /// Delete the (owned) orbit state, epoch, attitude and interpolator
+   void          DeleteComponents();
+   /// Account the memory of the interpolator buffers
+   void          AccountMemory();
 
 };
 #endif // Spacecraft_hpp
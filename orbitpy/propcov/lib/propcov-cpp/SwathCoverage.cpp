@@ -0,0 +1,678 @@
+//------------------------------------------------------------------------------
+//                           SwathCoverage
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Implementation of the SwathCoverage class
+ */
+//------------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "GmatConstants.hpp"
+#include "SwathCoverage.hpp"
+#include "Earth.hpp"
+#include "CompiledScenario.hpp"
+#include "Profiler.hpp"
+#include "TATCException.hpp"
+#include "MessageInterface.hpp"
+#include "polygon/SlicedPolygon.hpp"
+#include "polygon/SliceArray.hpp"
+
+//#define DEBUG_SWATH_COVERAGE
+
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+/// consecutive boundary vertices closer than this (rad) are merged
+static const Real VERTEX_TOLERANCE = 1.0e-12;
+/// the segments are at most this fraction of the orbital period, so that the
+/// strip of a segment neither wraps around the Earth nor crosses itself
+static const Real MAX_SEGMENT_ORBIT_FRACTION = 0.25;
+
+//------------------------------------------------------------------------------
+// static functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// struct FootprintSample
+//------------------------------------------------------------------------------
+/**
+ * A sampled footprint: its perimeter (unit vectors, Earth-fixed) and the
+ * cross-track (x) and along-track (a) angles of the perimeter in the local
+ * frame of the footprint center.
+ */
+//------------------------------------------------------------------------------
+struct FootprintSample
+{
+   Real                  jd;
+   /// spacecraft velocity relative to the ground (Earth-fixed)
+   Real                  velocity[3];
+   /// center, along-track and cross-track (left) axes
+   Real                  center[3];
+   Real                  along[3];
+   Real                  cross[3];
+   std::vector<Rvector3> perimeter;
+   RealArray             x;
+   RealArray             a;
+   Real                  xMin, xMax, aMin, aMax;
+   /// index of the left-most and right-most perimeter vertices
+   Integer               left, right;
+};
+
+//------------------------------------------------------------------------------
+// Real Dot(const Real *u, const Real *v)
+//------------------------------------------------------------------------------
+static Real Dot(const Real *u, const Real *v)
+{
+   return u[0] * v[0] + u[1] * v[1] + u[2] * v[2];
+}
+
+//------------------------------------------------------------------------------
+// void Normalize(Real *v)
+//------------------------------------------------------------------------------
+static void Normalize(Real *v)
+{
+   Real norm = std::sqrt(Dot(v, v));
+   v[0] /= norm;
+   v[1] /= norm;
+   v[2] /= norm;
+}
+
+//------------------------------------------------------------------------------
+// void ToFrame(const FootprintSample &sample, const Real *q, Real &x, Real &a)
+//------------------------------------------------------------------------------
+/**
+ * Cross-track and along-track angles of a unit vector in the frame of a
+ * sample; returns false if the vector is more than 90 deg from the center.
+ */
+//------------------------------------------------------------------------------
+static bool ToFrame(const FootprintSample &sample, const Real *q,
+                    Real &x, Real &a)
+{
+   Real qn = Dot(q, sample.center);
+   if (qn <= 0.0)
+      return false;
+   x = std::asin(std::max(-1.0, std::min(1.0, Dot(q, sample.cross))));
+   a = std::atan2(Dot(q, sample.along), qn);
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Real GetMargin(const FootprintSample &sample, const Real *q)
+//------------------------------------------------------------------------------
+/**
+ * Along-track margin (rad) of a point in a sampled footprint: the distance to
+ * the nearest of the rear and front edges at the cross-track position of the
+ * point, negative if the point is not in the footprint.
+ */
+//------------------------------------------------------------------------------
+static Real GetMargin(const FootprintSample &sample, const Real *q)
+{
+   Real x, a;
+   if (!ToFrame(sample, q, x, a))
+      return -1.0;
+   if (a < sample.aMin)
+      return a - sample.aMin;
+   if (a > sample.aMax)
+      return sample.aMax - a;
+   if (x < sample.xMin)
+      return x - sample.xMin;
+   if (x > sample.xMax)
+      return sample.xMax - x;
+
+   // rear and front edges at x
+   Real    rear = sample.aMax, front = sample.aMin;
+   Integer numVerts = sample.x.size();
+   for (Integer ii = 0; ii < numVerts; ii++)
+   {
+      Integer jj = (ii + 1) % numVerts;
+      Real x1 = sample.x[ii], x2 = sample.x[jj];
+      if ((x1 - x) * (x2 - x) > 0.0)
+         continue;
+      Real a1 = sample.a[ii], a2 = sample.a[jj], edgeA;
+      if (x1 == x2)
+      {
+         rear  = std::min(rear, std::min(a1, a2));
+         front = std::max(front, std::max(a1, a2));
+         continue;
+      }
+      edgeA = a1 + (x - x1) / (x2 - x1) * (a2 - a1);
+      rear  = std::min(rear, edgeA);
+      front = std::max(front, edgeA);
+   }
+   return std::min(a - rear, front - a);
+}
+
+//------------------------------------------------------------------------------
+// void AppendArc(const FootprintSample &sample, Integer from, Integer to,
+//                bool rear, std::vector<Rvector3> &vertices)
+//------------------------------------------------------------------------------
+/**
+ * Appends the perimeter vertices of a sample from one index to another, along
+ * the rear (smaller along-track angles) or front side of the perimeter.
+ */
+//------------------------------------------------------------------------------
+static void AppendArc(const FootprintSample &sample, Integer from, Integer to,
+                      bool rear, std::vector<Rvector3> &vertices)
+{
+   Integer numVerts = sample.perimeter.size();
+   Integer forwardLen  = (to - from + numVerts) % numVerts;
+   Integer backwardLen = (from - to + numVerts) % numVerts;
+   Real    forwardSum = 0.0, backwardSum = 0.0;
+   for (Integer ii = 0; ii <= forwardLen; ii++)
+      forwardSum += sample.a[(from + ii) % numVerts];
+   for (Integer ii = 0; ii <= backwardLen; ii++)
+      backwardSum += sample.a[(from - ii + numVerts) % numVerts];
+   bool forward = (forwardSum / (forwardLen + 1) <
+                   backwardSum / (backwardLen + 1)) == rear;
+   Integer len = forward ? forwardLen : backwardLen;
+   for (Integer ii = 0; ii <= len; ii++)
+   {
+      Integer idx = forward ? (from + ii) % numVerts
+                            : (from - ii + numVerts) % numVerts;
+      vertices.push_back(sample.perimeter[idx]);
+   }
+}
+
+//------------------------------------------------------------------------------
+// public methods
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// SwathCoverage(PointGroup *ptGroup, Spacecraft *sat,
+//               DiscretizedSensor *sensor)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param ptGroup  the points
+ * @param sat      the spacecraft
+ * @param sensor   the sensor whose footprint sweeps the swath
+ *
+ */
+//------------------------------------------------------------------------------
+SwathCoverage::SwathCoverage(PointGroup *ptGroup, Spacecraft *sat,
+                             DiscretizedSensor *sens) :
+   pointGroup      (ptGroup),
+   spacecraft      (sat),
+   sensor          (sens),
+   projector       (sat, sens),
+   segmentDuration (600.0),
+   sampleStep      (10.0)
+{
+   if (!pointGroup || !spacecraft || !sensor)
+      throw TATCException("SwathCoverage: the point group, spacecraft and "
+                          "sensor must be set\n");
+
+   Integer numPts = pointGroup->GetNumPoints();
+   pointLats.resize(numPts);
+   pointLons.resize(numPts);
+   pointVectors.resize(3 * numPts);
+   for (Integer ii = 0; ii < numPts; ii++)
+   {
+      pointGroup->GetLatAndLon(ii, pointLats[ii], pointLons[ii]);
+      pointVectors[3*ii]     = std::cos(pointLats[ii]) * std::cos(pointLons[ii]);
+      pointVectors[3*ii + 1] = std::cos(pointLats[ii]) * std::sin(pointLons[ii]);
+      pointVectors[3*ii + 2] = std::sin(pointLats[ii]);
+   }
+}
+
+//------------------------------------------------------------------------------
+// SwathCoverage(const SwathCoverage &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param copy  the object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+SwathCoverage::SwathCoverage(const SwathCoverage &copy) :
+   pointGroup      (copy.pointGroup),
+   spacecraft      (copy.spacecraft),
+   sensor          (copy.sensor),
+   projector       (copy.spacecraft, copy.sensor),
+   segmentDuration (copy.segmentDuration),
+   sampleStep      (copy.sampleStep),
+   pointLats       (copy.pointLats),
+   pointLons       (copy.pointLons),
+   pointVectors    (copy.pointVectors),
+   intervals       (copy.intervals),
+   swathPoints     (copy.swathPoints),
+   boundaryLats    (copy.boundaryLats),
+   boundaryLons    (copy.boundaryLons)
+{
+}
+
+//------------------------------------------------------------------------------
+// SwathCoverage& operator=(const SwathCoverage &copy)
+//------------------------------------------------------------------------------
+/**
+ * The operator= for SwathCoverage
+ *
+ * @param copy  the object to copy
+ *
+ */
+//------------------------------------------------------------------------------
+SwathCoverage& SwathCoverage::operator=(const SwathCoverage &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   pointGroup      = copy.pointGroup;
+   spacecraft      = copy.spacecraft;
+   sensor          = copy.sensor;
+   projector       = Projector(copy.spacecraft, copy.sensor);
+   segmentDuration = copy.segmentDuration;
+   sampleStep      = copy.sampleStep;
+   pointLats       = copy.pointLats;
+   pointLons       = copy.pointLons;
+   pointVectors    = copy.pointVectors;
+   intervals       = copy.intervals;
+   swathPoints     = copy.swathPoints;
+   boundaryLats    = copy.boundaryLats;
+   boundaryLons    = copy.boundaryLons;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~SwathCoverage()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ *
+ */
+//------------------------------------------------------------------------------
+SwathCoverage::~SwathCoverage()
+{
+}
+
+//------------------------------------------------------------------------------
+// void SetSegmentDuration(Real duration)
+//------------------------------------------------------------------------------
+/**
+ * Sets the duration of the orbit segments. Run(.) splits longer segments to a
+ * quarter of the orbital period.
+ *
+ * @param duration  duration of a segment (s)
+ *
+ */
+//------------------------------------------------------------------------------
+void SwathCoverage::SetSegmentDuration(Real duration)
+{
+   if (duration <= 0.0)
+      throw TATCException("SwathCoverage: the segment duration must be "
+                          "positive\n");
+   segmentDuration = duration;
+}
+
+//------------------------------------------------------------------------------
+// Real GetSegmentDuration() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the duration of the orbit segments.
+ *
+ * @return  duration of a segment (s)
+ *
+ */
+//------------------------------------------------------------------------------
+Real SwathCoverage::GetSegmentDuration() const
+{
+   return segmentDuration;
+}
+
+//------------------------------------------------------------------------------
+// void SetSampleStep(Real step)
+//------------------------------------------------------------------------------
+/**
+ * Sets the time between the footprint samples of a segment (the step is
+ * shortened to divide the segment evenly).
+ *
+ * @param step  time between the samples (s)
+ *
+ */
+//------------------------------------------------------------------------------
+void SwathCoverage::SetSampleStep(Real step)
+{
+   if (step <= 0.0)
+      throw TATCException("SwathCoverage: the sample step must be "
+                          "positive\n");
+   sampleStep = step;
+}
+
+//------------------------------------------------------------------------------
+// Real GetSampleStep() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the time between the footprint samples of a segment.
+ *
+ * @return  time between the samples (s)
+ *
+ */
+//------------------------------------------------------------------------------
+Real SwathCoverage::GetSampleStep() const
+{
+   return sampleStep;
+}
+
+//------------------------------------------------------------------------------
+// Integer Run(Real startJd, Real duration)
+//------------------------------------------------------------------------------
+/**
+ * Computes the strips of the segments and the access intervals of the points
+ * inside them. The segments are shortened to a quarter of the orbital period
+ * (at the start time) if they are longer.
+ *
+ * @param startJd   start time (JDUT1)
+ * @param duration  duration of the run (days)
+ *
+ * @return  number of segments
+ *
+ */
+//------------------------------------------------------------------------------
+Integer SwathCoverage::Run(Real startJd, Real duration)
+{
+   if (duration <= 0.0)
+      throw TATCException("SwathCoverage: the duration must be positive\n");
+
+   const Real PI      = GmatMathConstants::PI;
+   const Real SEC_DAY = GmatTimeConstants::SECS_PER_DAY;
+   Integer numPts  = pointLats.size();
+   Integer width   = sensor->getWidthDetectors();
+   Integer height  = sensor->getHeightDetectors();
+   Real    totalSec = duration * SEC_DAY;
+
+   CompiledScenario scenario(pointGroup, spacecraft);
+   Real    sma      = scenario.GetOrbitalElements(startJd)[0];
+   Real    segDuration = segmentDuration;
+   if (sma > 0.0)
+      segDuration = std::min(segDuration, MAX_SEGMENT_ORBIT_FRACTION *
+                             2.0 * PI * std::sqrt(sma * sma * sma / Earth::MU));
+   Integer numSegments = std::max(1,
+                         (Integer) std::ceil(totalSec / segDuration - 1.0e-9));
+
+   intervals.clear();
+   swathPoints.clear();
+   boundaryLats.assign(numSegments, RealArray());
+   boundaryLons.assign(numSegments, RealArray());
+
+   std::vector<bool> inSwath(numPts, false);
+   /// last interval of each point (-1 if none), to merge across segments
+   IntegerArray      lastInterval(numPts, -1);
+   std::vector<FootprintSample> samples;
+
+   for (Integer seg = 0; seg < numSegments; seg++)
+   {
+      Real    t0 = seg * segDuration;
+      Real    t1 = std::min(totalSec, (seg + 1) * segDuration);
+      Integer numSteps = std::max(1,
+                         (Integer) std::ceil((t1 - t0) / sampleStep - 1.0e-9));
+      Real    segStartJd = startJd + t0 / SEC_DAY;
+
+      // footprints of the samples
+      samples.assign(numSteps + 1, FootprintSample());
+      {
+         Profiler::Scope timer(Profiler::FRAME_CONVERSION);
+         for (Integer kk = 0; kk <= numSteps; kk++)
+         {
+            FootprintSample &sample = samples[kk];
+            Real tt = (kk == numSteps) ? t1 : t0 + (t1 - t0) * kk / numSteps;
+            sample.jd = startJd + tt / SEC_DAY;
+            Rvector6 stateECF = projector.getEarthFixedState(sample.jd,
+                                   scenario.GetCartesianState(sample.jd));
+            CoordsPair corners = projector.checkCornerIntersection(stateECF);
+            sample.velocity[0] = stateECF[3] + Earth::ROTATION_RATE * stateECF[1];
+            sample.velocity[1] = stateECF[4] - Earth::ROTATION_RATE * stateECF[0];
+            sample.velocity[2] = stateECF[5];
+
+            // outer corners: first row, last column, last row and first
+            // column (corner (i,j) at i*(height+1) + j)
+            IntegerArray outer;
+            for (Integer ii = 0; ii < width; ii++)
+               outer.push_back(ii * (height + 1));
+            for (Integer jj = 0; jj < height; jj++)
+               outer.push_back(width * (height + 1) + jj);
+            for (Integer ii = width; ii > 0; ii--)
+               outer.push_back(ii * (height + 1) + height);
+            for (Integer jj = height; jj > 0; jj--)
+               outer.push_back(jj);
+            sample.center[0] = sample.center[1] = sample.center[2] = 0.0;
+            for (Integer idx : outer)
+            {
+               if (std::isnan(corners.first[idx][0]) ||
+                   std::isnan(corners.first[idx][1]))
+                  throw TATCException("SwathCoverage: the footprint of the "
+                                      "sensor is not on the Earth\n");
+               Rvector3 vertex = corners.second[idx].GetUnitVector();
+               sample.perimeter.push_back(vertex);
+               for (Integer cc = 0; cc < 3; cc++)
+                  sample.center[cc] += vertex[cc];
+            }
+            Normalize(sample.center);
+         }
+
+         // local frames, the along-track axis along the ground velocity
+         for (Integer kk = 0; kk <= numSteps; kk++)
+         {
+            FootprintSample &sample = samples[kk];
+            Real radial = Dot(sample.velocity, sample.center);
+            for (Integer cc = 0; cc < 3; cc++)
+               sample.along[cc] = sample.velocity[cc] -
+                                  radial * sample.center[cc];
+            Normalize(sample.along);
+            sample.cross[0] = sample.center[1] * sample.along[2] -
+                              sample.center[2] * sample.along[1];
+            sample.cross[1] = sample.center[2] * sample.along[0] -
+                              sample.center[0] * sample.along[2];
+            sample.cross[2] = sample.center[0] * sample.along[1] -
+                              sample.center[1] * sample.along[0];
+
+            Integer numVerts = sample.perimeter.size();
+            sample.x.resize(numVerts);
+            sample.a.resize(numVerts);
+            sample.left = sample.right = 0;
+            for (Integer ii = 0; ii < numVerts; ii++)
+            {
+               if (!ToFrame(sample, sample.perimeter[ii].GetDataVector(),
+                            sample.x[ii], sample.a[ii]))
+                  throw TATCException("SwathCoverage: the footprint of the "
+                                      "sensor is too large\n");
+               if (sample.x[ii] > sample.x[sample.left])
+                  sample.left = ii;
+               if (sample.x[ii] < sample.x[sample.right])
+                  sample.right = ii;
+            }
+            sample.xMin = *std::min_element(sample.x.begin(), sample.x.end());
+            sample.xMax = *std::max_element(sample.x.begin(), sample.x.end());
+            sample.aMin = *std::min_element(sample.a.begin(), sample.a.end());
+            sample.aMax = *std::max_element(sample.a.begin(), sample.a.end());
+         }
+      }
+
+      // boundary of the strip: rear of the first footprint, left side, front
+      // of the last footprint and right side back to the start
+      std::vector<Rvector3> boundary, vertices;
+      AppendArc(samples[0], samples[0].right, samples[0].left, true, boundary);
+      for (Integer kk = 1; kk < numSteps; kk++)
+         boundary.push_back(samples[kk].perimeter[samples[kk].left]);
+      AppendArc(samples[numSteps], samples[numSteps].left,
+                samples[numSteps].right, false, boundary);
+      for (Integer kk = numSteps - 1; kk > 0; kk--)
+         boundary.push_back(samples[kk].perimeter[samples[kk].right]);
+      for (const Rvector3 &vertex : boundary)
+         if (vertices.empty() ||
+             (vertex - vertices.back()).GetMagnitude() > VERTEX_TOLERANCE)
+            vertices.push_back(vertex);
+      if ((vertices.back() - vertices.front()).GetMagnitude() <=
+          VERTEX_TOLERANCE)
+         vertices.pop_back();
+      vertices.push_back(vertices.front());
+      for (const Rvector3 &vertex : vertices)
+      {
+         boundaryLats[seg].push_back(std::asin(vertex[2]));
+         boundaryLons[seg].push_back(std::atan2(vertex[1], vertex[0]));
+      }
+
+      // points inside the strip; the strip is inside the cap of its
+      // vertices around the middle footprint (if smaller than a hemisphere)
+      IntegerArray stripPoints;
+      {
+         Profiler::Scope timer(Profiler::FOV_TEST);
+         const Real *mid = samples[numSteps / 2].center;
+         Real cosCap = 1.0;
+         for (const Rvector3 &vertex : vertices)
+            cosCap = std::min(cosCap, Dot(vertex.GetDataVector(), mid));
+         cosCap = (cosCap > 0.0) ? cosCap - VERTEX_TOLERANCE : -2.0;
+
+         SlicedPolygon poly(vertices, Rvector3(mid[0], mid[1], mid[2]));
+         SliceArray   *sliceArray = new SliceArray(poly.getLonArray(),
+                                                   poly.getEdgeArray());
+         sliceArray->preprocess();
+         poly.addPreprocessor(sliceArray);
+         for (Integer ii = 0; ii < numPts; ii++)
+         {
+            if (Dot(&pointVectors[3*ii], mid) < cosCap)
+               continue;
+            if (poly.contains(AnglePair{PI/2 - pointLats[ii],
+                                        pointLons[ii]}) != 0)
+               stripPoints.push_back(ii);
+         }
+         Profiler::AddCount(Profiler::POINTS_TESTED, stripPoints.size());
+      }
+
+      // access intervals of the strip points from their along-track margins
+      Profiler::Scope timer(Profiler::INTERVAL_BUILDING);
+      for (Integer ii : stripPoints)
+      {
+         inSwath[ii] = true;
+         const Real *q = &pointVectors[3*ii];
+         bool    open = false;
+         Real    prevMargin = 0.0, accessStart = 0.0;
+         /// interval of the previous segment continued by the access
+         Integer continued = -1;
+         for (Integer kk = 0; kk <= numSteps + 1; kk++)
+         {
+            // the access still open at the end of the segment stops there
+            Real margin  = (kk <= numSteps) ? GetMargin(samples[kk], q) : -1.0;
+            bool covered = (margin >= 0.0);
+            Real crossing = samples[std::min(kk, numSteps)].jd;
+            if (kk > 0 && kk <= numSteps && covered != open)
+               crossing = samples[kk - 1].jd + (samples[kk].jd -
+                          samples[kk - 1].jd) * prevMargin /
+                          (prevMargin - margin);
+            prevMargin = margin;
+            if (covered && !open)
+            {
+               open = true;
+               accessStart = crossing;
+               if (kk == 0 && lastInterval[ii] >= 0 &&
+                   intervals[lastInterval[ii]].stopTime == segStartJd)
+                  continued = lastInterval[ii];
+            }
+            else if (!covered && open)
+            {
+               open = false;
+               if (continued >= 0)
+               {
+                  intervals[continued].stopTime = crossing;
+                  continued = -1;
+                  continue;
+               }
+               AccessInterval access = {0, ii, 0, accessStart, crossing};
+               intervals.push_back(access);
+               lastInterval[ii] = intervals.size() - 1;
+            }
+         }
+      }
+      #ifdef DEBUG_SWATH_COVERAGE
+         MessageInterface::ShowMessage(
+            "SwathCoverage: segment %d, %d boundary vertices, %d points\n",
+            seg, (Integer) vertices.size(), (Integer) stripPoints.size());
+      #endif
+   }
+
+   for (Integer ii = 0; ii < numPts; ii++)
+      if (inSwath[ii])
+         swathPoints.push_back(ii);
+   std::sort(intervals.begin(), intervals.end(),
+             [](const AccessInterval &x, const AccessInterval &y)
+             {
+                if (x.startTime != y.startTime)
+                   return x.startTime < y.startTime;
+                return x.pointIndex < y.pointIndex;
+             });
+   return numSegments;
+}
+
+//------------------------------------------------------------------------------
+// const std::vector<AccessInterval>& GetIntervals() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the access intervals of the last run, sorted by start time and
+ * point index.
+ *
+ * @return  the access intervals
+ *
+ */
+//------------------------------------------------------------------------------
+const std::vector<AccessInterval>& SwathCoverage::GetIntervals() const
+{
+   return intervals;
+}
+
+//------------------------------------------------------------------------------
+// const IntegerArray& GetSwathPoints() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the indices (sorted) of the points inside the strip of any segment
+ * of the last run.
+ *
+ * @return  the indices of the points
+ *
+ */
+//------------------------------------------------------------------------------
+const IntegerArray& SwathCoverage::GetSwathPoints() const
+{
+   return swathPoints;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNumSegments() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the number of segments of the last run.
+ *
+ * @return  number of segments
+ *
+ */
+//------------------------------------------------------------------------------
+Integer SwathCoverage::GetNumSegments() const
+{
+   return boundaryLats.size();
+}
+
+//------------------------------------------------------------------------------
+// void GetSegmentBoundary(Integer segment, RealArray &lats,
+//                         RealArray &lons) const
+//------------------------------------------------------------------------------
+/**
+ * Returns the vertices of the boundary of a segment of the last run (the
+ * first vertex is repeated at the end).
+ *
+ * @param segment  index of the segment
+ * @param lats     output latitudes of the vertices (rad)
+ * @param lons     output longitudes of the vertices (rad)
+ *
+ */
+//------------------------------------------------------------------------------
+void SwathCoverage::GetSegmentBoundary(Integer segment, RealArray &lats,
+                                       RealArray &lons) const
+{
+   if (segment < 0 || segment >= (Integer) boundaryLats.size())
+      throw TATCException("SwathCoverage: segment index out of range\n");
+   lats = boundaryLats[segment];
+   lons = boundaryLons[segment];
+}
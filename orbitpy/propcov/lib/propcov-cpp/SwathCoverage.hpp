@@ -0,0 +1,107 @@
+//------------------------------------------------------------------------------
+//                           SwathCoverage
+//------------------------------------------------------------------------------
+// Created: 2026.10.17
+//
+/**
+ * Definition of the SwathCoverage class, computing the coverage of a grid by
+ * the strip swept by the footprint of a DiscretizedSensor over orbit
+ * segments, instead of testing every point at every propagation step.
+ *
+ * The run is split into segments (default 600 s, at most a quarter of the
+ * orbital period so that the strip of a segment neither wraps around the
+ * Earth nor crosses itself; longer segments are split). In each segment the
+ * footprint is sampled (default every 10 s): the pixel corners of the sensor
+ * are projected on the (spherical) Earth with a Projector and the outer
+ * corners form the footprint perimeter. Each sample has a local frame
+ * centered on the footprint: the along-track axis follows the velocity of the
+ * spacecraft relative to the ground and the cross-track axis points to its
+ * left.
+ *
+ * The swath boundary of a segment is the polygon of the left-most footprint
+ * points of the samples, the front of the last footprint, the right-most
+ * points back to the first sample and the rear of the first footprint. The
+ * grid points are classified against it with a SlicedPolygon preprocessed by
+ * a SliceArray; the points outside the strip are not looked at again.
+ *
+ * For a point inside the strip, its along-track position relative to the
+ * rear and front edges of each sampled footprint (at its cross-track
+ * position) gives whether it is in view at the sample; the access intervals
+ * are built from the sign changes of that margin, the crossing times being
+ * interpolated between the samples. The accesses running over a segment
+ * boundary are merged.
+ *
+ * The sensor must see only the Earth: a footprint corner off the Earth is an
+ * error.
+ */
+//------------------------------------------------------------------------------
+#ifndef SwathCoverage_hpp
+#define SwathCoverage_hpp
+
+#include "gmatdefs.hpp"
+#include "PointGroup.hpp"
+#include "Spacecraft.hpp"
+#include "DiscretizedSensor.hpp"
+#include "Projector.hpp"
+#include "AccessInterval.hpp"
+
+class SwathCoverage
+{
+public:
+
+   /// class construction/destruction
+   SwathCoverage(PointGroup *ptGroup, Spacecraft *sat,
+                 DiscretizedSensor *sensor);
+   SwathCoverage(const SwathCoverage &copy);
+   SwathCoverage& operator=(const SwathCoverage &copy);
+
+   virtual ~SwathCoverage();
+
+   /// Set/get the duration of the orbit segments (s; split to a quarter of
+   /// the orbital period in Run)
+   void              SetSegmentDuration(Real duration);
+   Real              GetSegmentDuration() const;
+   /// Set/get the time between the footprint samples of a segment (s)
+   void              SetSampleStep(Real step);
+   Real              GetSampleStep() const;
+
+   /// Compute the accesses from the start time (JDUT1) over the duration
+   /// (days); returns the number of segments
+   Integer           Run(Real startJd, Real duration);
+
+   /// Get the access intervals of the last run, by start time and point
+   const std::vector<AccessInterval>& GetIntervals() const;
+   /// Get the indices of the points inside the strip of any segment
+   const IntegerArray& GetSwathPoints() const;
+   /// Get the number of segments of the last run
+   Integer           GetNumSegments() const;
+   /// Get the vertices (lat/lon in radians, closed) of the boundary of a
+   /// segment
+   void              GetSegmentBoundary(Integer segment, RealArray &lats,
+                                        RealArray &lons) const;
+
+protected:
+
+   /// the points
+   PointGroup               *pointGroup;
+   /// the spacecraft and its sensor
+   Spacecraft               *spacecraft;
+   DiscretizedSensor        *sensor;
+   /// the projection of the sensor corners on the Earth
+   Projector                projector;
+   /// duration of the segments and time between the samples (s)
+   Real                     segmentDuration;
+   Real                     sampleStep;
+   /// latitude, longitude (rad) and unit vector (Earth-fixed, 3 per point)
+   /// of each grid point
+   RealArray                pointLats;
+   RealArray                pointLons;
+   RealArray                pointVectors;
+
+   /// the results of the last run
+   std::vector<AccessInterval> intervals;
+   IntegerArray             swathPoints;
+   std::vector<RealArray>   boundaryLats;
+   std::vector<RealArray>   boundaryLons;
+};
+#endif // SwathCoverage_hpp
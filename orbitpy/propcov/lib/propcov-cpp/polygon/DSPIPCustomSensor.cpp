@@ -82,6 +82,33 @@ Sensor()
 
 }
 
+//------------------------------------------------------------------------------
+// DSPIPCustomSensor(BinaryReader &in)
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data (see Serialize). The sliced polygon and its
+ * preprocessed slice array are read back, not recomputed.
+ *
+ * @param in the reader of the data
+ */
+//------------------------------------------------------------------------------
+DSPIPCustomSensor::DSPIPCustomSensor(BinaryReader &in) :
+Sensor(in, "DSPIPCustomSensor")
+{
+    poly = new SlicedPolygon(in);
+    QI = in.ReadRmatrix33();
+    Rot_ScBody2SensorQuery = in.ReadRmatrix33();
+
+   #ifdef ENABLE_STEREOGRAPHIC_BOUNDING_BOX
+   xProjectionCoordArray = in.ReadRvector();
+   yProjectionCoordArray = in.ReadRvector();
+   maxXExcursion = in.ReadReal();
+   minXExcursion = in.ReadReal();
+   maxYExcursion = in.ReadReal();
+   minYExcursion = in.ReadReal();
+   #endif
+}
+
 DSPIPCustomSensor::~DSPIPCustomSensor()
 {
     delete(poly);
@@ -175,6 +202,33 @@ Rmatrix33 DSPIPCustomSensor::getQI()
 	return QI;
 }
 
+//------------------------------------------------------------------------------
+// void Serialize(BinaryWriter &out) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the state of the sensor, including the sliced polygon and its
+ * preprocessed slice array.
+ *
+ * @param out the writer
+ */
+//------------------------------------------------------------------------------
+void DSPIPCustomSensor::Serialize(BinaryWriter &out) const
+{
+    WriteSensorData(out, "DSPIPCustomSensor");
+    poly->serialize(out);
+    out.WriteRmatrix33(QI);
+    out.WriteRmatrix33(Rot_ScBody2SensorQuery);
+
+   #ifdef ENABLE_STEREOGRAPHIC_BOUNDING_BOX
+   out.WriteRvector(xProjectionCoordArray);
+   out.WriteRvector(yProjectionCoordArray);
+   out.WriteReal(maxXExcursion);
+   out.WriteReal(minXExcursion);
+   out.WriteReal(maxYExcursion);
+   out.WriteReal(minYExcursion);
+   #endif
+}
+
 //------------------------------------------------------------------------------
 // bool CheckTargetMaxExcursionCoordinates(Real xCoord, Real yCoord)
 //------------------------------------------------------------------------------
@@ -203,4 +257,4 @@ bool DSPIPCustomSensor::CheckTargetMaxExcursionCoordinates(Real xCoord, Real yCo
       possiblyInView = false;
    
    return possiblyInView;
-}
\ No newline at end of file
+}
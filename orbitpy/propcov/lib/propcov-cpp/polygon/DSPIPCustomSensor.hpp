@@ -28,6 +28,8 @@ class DSPIPCustomSensor : public Sensor
     
         /// class construction/destruction
         DSPIPCustomSensor(const Rvector& coneAngleVecIn, const Rvector& clockAngleVecIn, AnglePair interiorIn);
+        /// Construct from the data written by Serialize (the preprocessed polygon is restored, not recomputed)
+        DSPIPCustomSensor(BinaryReader &in);
         ~DSPIPCustomSensor();
 
         bool CheckTargetVisibility(Real viewConeAngle, Real viewClockAngle) override;
@@ -42,6 +44,9 @@ class DSPIPCustomSensor : public Sensor
 
         Rmatrix33 getQI();
 
+        /// Write the state of the sensor, including the sliced polygon and its preprocessed slice array
+        void Serialize(BinaryWriter &out) const override;
+
     protected:
 
         SlicedPolygon* poly;
@@ -61,6 +61,19 @@ Edge::Edge(AnglePair node1in, AnglePair node2in)
 	shooterDotPole = shooter*pole;
 }
 
+// Constructor from serialized data (see serialize)
+Edge::Edge(BinaryReader &in)
+{
+	pole = in.ReadRvector3();
+	bound1 = in.ReadReal();
+	bound2 = in.ReadReal();
+	shooterDotPole = in.ReadReal();
+	node1[0] = in.ReadReal();
+	node1[1] = in.ReadReal();
+	node2[0] = in.ReadReal();
+	node2[1] = in.ReadReal();
+}
+
 // Destructor
 Edge::~Edge()
 {
@@ -144,4 +157,17 @@ std::ostream& operator<<(std::ostream& os, const Edge& edge)
 {
     os << "Bound 1: " << edge.bound1 << "\n" << "Bound 2: " << edge.bound2 << "\n";
     return os;
-}
\ No newline at end of file
+}
+
+// Writes the pole, bounds and nodes of the edge
+void Edge::serialize(BinaryWriter &out) const
+{
+	out.WriteRvector3(pole);
+	out.WriteReal(bound1);
+	out.WriteReal(bound2);
+	out.WriteReal(shooterDotPole);
+	out.WriteReal(node1[0]);
+	out.WriteReal(node1[1]);
+	out.WriteReal(node2[0]);
+	out.WriteReal(node2[1]);
+}
@@ -3,6 +3,7 @@
 
 #include "Polygon.hpp"
 #include "Preprocessor.hpp"
+#include "../BinaryStream.hpp"
 #include <limits>
 
 class Edge
@@ -13,6 +14,8 @@ class Edge
 		Edge();
 		Edge(Rvector3 node1, Rvector3 node2);
 		Edge(AnglePair node1, AnglePair node2);
+		// Constructor from the data written by serialize
+		Edge(BinaryReader &in);
 
 		// Destructor
 		~Edge();
@@ -28,6 +31,8 @@ class Edge
 		Rvector3 getPole();
 		Real getBound1();
 		Real getBound2();
+		// Write the state of the edge
+		void serialize(BinaryWriter &out) const;
 
 		// Print function override
 		friend std::ostream& operator<<(std::ostream& os, const Edge& edge);
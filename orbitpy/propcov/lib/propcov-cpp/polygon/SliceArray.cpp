@@ -1,4 +1,9 @@
 #include "SliceArray.hpp"
+#include <atomic>
+#include <exception>
+#include <thread>
+
+const int SliceArray::PARALLEL_MIN_EDGES = 4096;
 
 SliceArray::SliceArray(std::vector<Real> lonArray, const std::vector<Edge> &edgeArray)
 {
@@ -7,63 +12,199 @@ SliceArray::SliceArray(std::vector<Real> lonArray, const std::vector<Edge> &edge
 
     this->lonArray = lonArray;
     this->edgeArray = edgeArray;
+    this->numThreads = 0;
+}
+
+SliceArray::SliceArray(BinaryReader &in)
+{
+    this->numThreads = 0;
+    this->lonArray = in.ReadRealArray();
+    int numEdges = in.ReadInt();
+    for (int i = 0; i < numEdges; i++)
+        this->edgeArray.push_back(Edge(in));
+    int numSlices = in.ReadInt();
+    this->sliceOffsets.resize(numSlices + 1, 0);
+    for (int i = 0; i < numSlices; i++)
+    {
+        std::vector<int> indices = in.ReadIntArray();
+        this->sliceEdges.insert(this->sliceEdges.end(),indices.begin(),indices.end());
+        this->sliceOffsets[i + 1] = this->sliceEdges.size();
+    }
 }
 
 void SliceArray::preprocess()
 {
     std::sort(this->lonArray.begin(),this->lonArray.end());
+    int numSlices = lonArray.size() - 1;
 
-    std::vector<int> parentIndices;
-    for (int i = 0; i < edgeArray.size(); i++)
+    // The bounds are read once, not through a copy of each edge per level
+    int numEdges = edgeArray.size();
+    edgeBound1.resize(numEdges);
+    edgeBound2.resize(numEdges);
+    for (int i = 0; i < numEdges; i++)
     {
-        parentIndices.push_back(i);
+        edgeBound1[i] = edgeArray[i].getBound1();
+        edgeBound2[i] = edgeArray[i].getBound2();
     }
 
-    this->classified.resize(lonArray.size() - 1);
-    preprocess(parentIndices,0,lonArray.size() - 1);
+    int nThreads = numThreads;
+    if (nThreads == 0)
+        nThreads = std::max(1u,std::thread::hardware_concurrency());
+    if (numEdges < PARALLEL_MIN_EDGES)
+        nThreads = 1;
+
+    // The root task has all the edges as parent
+    taskParents.assign(1,std::vector<int>(numEdges));
+    for (int i = 0; i < numEdges; i++)
+        taskParents[0][i] = i;
+    std::vector<Task> tasks(1,Task{0,numSlices,0});
+    if (nThreads > 1)
+        splitTasks(4*nThreads,tasks);
+    int numTasks = tasks.size();
+    nThreads = std::min(nThreads,numTasks);
+
+    // Each task writes the sizes of its slices and their edges
+    std::vector<std::vector<int>> taskCounts(numTasks), taskEdges(numTasks);
+    if (nThreads <= 1)
+    {
+        std::vector<std::vector<int>> levels;
+        for (int t = 0; t < numTasks; t++)
+            runTask(tasks[t],levels,taskCounts[t],taskEdges[t]);
+    }
+    else
+    {
+        std::atomic<int> nextTask(0);
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(nThreads);
+        for (int tt = 0; tt < nThreads; tt++)
+        {
+            threads.push_back(std::thread([this,&tasks,&taskCounts,&taskEdges,&nextTask,&errors,numTasks,tt]()
+            {
+                try
+                {
+                    std::vector<std::vector<int>> levels;
+                    for (int t = nextTask++; t < numTasks; t = nextTask++)
+                        runTask(tasks[t],levels,taskCounts[t],taskEdges[t]);
+                }
+                catch (...)
+                {
+                    errors[tt] = std::current_exception();
+                }
+            }));
+        }
+        for (std::thread &thread : threads)
+            thread.join();
+        for (std::exception_ptr &error : errors)
+            if (error)
+                std::rethrow_exception(error);
+    }
+
+    // Single CSR output, the tasks being in slice order
+    size_t total = 0;
+    for (const std::vector<int> &edges : taskEdges)
+        total += edges.size();
+    sliceOffsets.assign(numSlices + 1,0);
+    sliceEdges.clear();
+    sliceEdges.reserve(total);
+    for (int t = 0; t < numTasks; t++)
+    {
+        for (int i = 0; i < (int) taskCounts[t].size(); i++)
+            sliceOffsets[tasks[t].start + i + 1] = sliceOffsets[tasks[t].start + i] + taskCounts[t][i];
+        sliceEdges.insert(sliceEdges.end(),taskEdges[t].begin(),taskEdges[t].end());
+    }
+
+    std::vector<Real>().swap(edgeBound1);
+    std::vector<Real>().swap(edgeBound2);
+    std::vector<std::vector<int>>().swap(taskParents);
 }
 
 SliceArray::~SliceArray(){}
 
-void SliceArray::preprocess(std::vector<int> parentIndices,int start,int end)
+// Splits the top of the bisection into subtrees (in slice order) until there
+// are at least minTasks of them, or only leaves. The edge list of each split
+// node is kept in taskParents for its two children.
+void SliceArray::splitTasks(int minTasks, std::vector<Task> &tasks)
 {
-    std::vector<int> childIndices = classifyEdges(parentIndices,start,end);
-
-    if ((end - start) == 1)
+    bool split = true;
+    while (split && (int) tasks.size() < minTasks)
     {
-        this->classified[start] = childIndices;
-        return;
+        split = false;
+        std::vector<Task> children;
+        for (const Task &task : tasks)
+        {
+            if ((task.end - task.start) == 1)
+            {
+                children.push_back(task);
+                continue;
+            }
+            taskParents.push_back(std::vector<int>());
+            classifyEdges(taskParents[task.parent],task.start,task.end,taskParents.back());
+            int parent = taskParents.size() - 1;
+            int mid = task.start + (task.end - task.start)/2;
+            children.push_back(Task{task.start,mid,parent});
+            children.push_back(Task{mid,task.end,parent});
+            split = true;
+        }
+        tasks.swap(children);
     }
+}
 
-    int mid = start + (end - start)/2;
+// Runs the bisection of a subtree, depth first and without recursion. The
+// edges of a node at depth d are classified from those of its parent into
+// levels[d]; the buffers are reused by the following nodes of the same depth
+// (a node's list is kept until both of its children are done, since only
+// deeper levels are written in between).
+void SliceArray::runTask(const Task &task, std::vector<std::vector<int>> &levels,
+                         std::vector<int> &counts, std::vector<int> &edges) const
+{
+    struct Node
+    {
+        int start;
+        int end;
+        int depth;
+    };
+    counts.assign(task.end - task.start,0);
+    edges.clear();
+    std::vector<Node> stack(1,Node{task.start,task.end,0});
+    while (!stack.empty())
+    {
+        Node node = stack.back();
+        stack.pop_back();
+        if ((int) levels.size() <= node.depth)
+            levels.resize(node.depth + 1);
+        const std::vector<int> &parent = (node.depth == 0) ? taskParents[task.parent] : levels[node.depth - 1];
+        std::vector<int> &childIndices = levels[node.depth];
+        classifyEdges(parent,node.start,node.end,childIndices);
 
-    preprocess(childIndices,start,mid);
-    preprocess(childIndices,mid,end);
+        if ((node.end - node.start) == 1)
+        {
+            counts[node.start - task.start] = childIndices.size();
+            edges.insert(edges.end(),childIndices.begin(),childIndices.end());
+            continue;
+        }
+
+        int mid = node.start + (node.end - node.start)/2;
+        stack.push_back(Node{mid,node.end,node.depth + 1});
+        stack.push_back(Node{node.start,mid,node.depth + 1});
+    }
 }
 
-std::vector<int> SliceArray::classifyEdges(const std::vector<int> &parentIndices, int start, int end)
+void SliceArray::classifyEdges(const std::vector<int> &parentIndices, int start, int end,
+                               std::vector<int> &childIndices) const
 {
     Real bound1 = this->lonArray[start];
     Real bound2 = this->lonArray[end];
 
-    std::vector<int> childIndices;
-
+    childIndices.clear();
     for (int index : parentIndices)
     {
-        Edge edge = this->edgeArray[index];
-
-        if (contains(edge,bound1,bound2))
+        if (contains(edgeBound1[index],edgeBound2[index],bound1,bound2))
             childIndices.push_back(index);
     }
-
-    return childIndices;
 }
 
-bool SliceArray::contains(Edge edge, Real bound1, Real bound2)
+bool SliceArray::contains(Real vertex1, Real vertex2, Real bound1, Real bound2)
 {
-    Real vertex1 = edge.getBound1();
-	Real vertex2 = edge.getBound2();
-
     bool condition1_1 = (vertex1 >= bound1) && (vertex1 <= bound2);
 	bool condition1_2 = (vertex2 >= bound1) && (vertex2 <= bound2);
 
@@ -71,7 +212,7 @@ bool SliceArray::contains(Edge edge, Real bound1, Real bound2)
 	bool condition2_1 = (bound1 >= vertex1) && (bound1 <= vertex2);
 	bool condition2_2 = (bound2 >= vertex1) && (bound2 <= vertex2);
     */
-    
+
     bool condition2_1 = util::lonBounded(vertex1,vertex2,bound1);
 	bool condition2_2 = util::lonBounded(vertex1,vertex2,bound2);
 
@@ -79,6 +220,13 @@ bool SliceArray::contains(Edge edge, Real bound1, Real bound2)
 }
 
 std::vector<int> SliceArray::getEdges(AnglePair query)
+{
+    int count;
+    const int *first = getEdgeRange(query,count);
+    return std::vector<int>(first,first + count);
+}
+
+const int* SliceArray::getEdgeRange(AnglePair query, int &count) const
 {
     int start = 0,mid,end = this->lonArray.size();
     Real lon = query[1];
@@ -95,10 +243,43 @@ std::vector<int> SliceArray::getEdges(AnglePair query)
             start = mid;
     }
 
-    return this->classified[start];
+    count = this->sliceOffsets[start + 1] - this->sliceOffsets[start];
+    return this->sliceEdges.data() + this->sliceOffsets[start];
 }
 
 std::vector<Real> SliceArray::getLonArray()
 {
     return this->lonArray;
-}
\ No newline at end of file
+}
+
+int SliceArray::getNumSlices() const
+{
+    return this->lonArray.size() - 1;
+}
+
+void SliceArray::setNumThreads(int numThreads)
+{
+    this->numThreads = std::max(numThreads,0);
+}
+
+int SliceArray::getNumThreads() const
+{
+    return this->numThreads;
+}
+
+void SliceArray::serialize(BinaryWriter &out) const
+{
+    out.WriteRealArray(this->lonArray);
+    out.WriteInt(this->edgeArray.size());
+    for (const Edge &edge : this->edgeArray)
+        edge.serialize(out);
+    // Same layout as one int array per slice
+    int numSlices = this->sliceOffsets.empty() ? 0 : this->sliceOffsets.size() - 1;
+    out.WriteInt(numSlices);
+    for (int i = 0; i < numSlices; i++)
+    {
+        out.WriteInt(this->sliceOffsets[i + 1] - this->sliceOffsets[i]);
+        for (int j = this->sliceOffsets[i]; j < this->sliceOffsets[i + 1]; j++)
+            out.WriteInt(this->sliceEdges[j]);
+    }
+}
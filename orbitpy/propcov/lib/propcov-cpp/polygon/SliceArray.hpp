@@ -4,12 +4,22 @@
 #include <algorithm>
 #include "SlicedPolygon.hpp"
 
+// Array of longitude slices of a polygon, each with the indices of the edges
+// that could contain a query in the slice. The slices are classified by
+// recursive bisection of the longitude range, each half keeping the edges of
+// its parent that touch it. The result is stored in compressed sparse row
+// form: the edges of slice i are sliceEdges[sliceOffsets[i] .. sliceOffsets[i+1]).
+//
+// The bisection runs iteratively, with one reused index buffer per tree level,
+// and its subtrees are run as tasks on several threads for large polygons.
 class SliceArray : public Preprocessor
 {
     public:
 
         // Constructor
         SliceArray(std::vector<Real>,const std::vector<Edge> &);
+        // Constructor from the data written by serialize (already preprocessed)
+        SliceArray(BinaryReader &in);
         // Destructor
         ~SliceArray();
 
@@ -18,19 +28,49 @@ class SliceArray : public Preprocessor
 
         // Get the subset of edges that could contain query
         std::vector<int> getEdges(AnglePair query);
+        // Same as getEdges, without copy: returns the first of the count
+        // indices of the edges
+        const int* getEdgeRange(AnglePair query, int &count) const;
 
         // Getters
         std::vector<Real> getLonArray();
+        int getNumSlices() const;
+        // Number of threads of the preprocessing (0: the hardware concurrency)
+        void setNumThreads(int numThreads);
+        int getNumThreads() const;
+        // Write the state of the preprocessor, including the classified edges
+        void serialize(BinaryWriter &out) const;
+
+        // Polygons with fewer edges are preprocessed on one thread
+        static const int PARALLEL_MIN_EDGES;
 
     protected:
 
-        void preprocess(std::vector<int>,int,int);
-        bool contains(Edge,Real,Real);
-        std::vector<int> classifyEdges(const std::vector<int> &,int,int);
+        // A subtree of the bisection: the slices [start, end) and the index
+        // of the edge list of its parent in taskParents
+        struct Task
+        {
+            int start;
+            int end;
+            int parent;
+        };
+
+        void classifyEdges(const std::vector<int> &,int,int,std::vector<int> &) const;
+        static bool contains(Real,Real,Real,Real);
+        void runTask(const Task &,std::vector<std::vector<int>> &,std::vector<int> &,std::vector<int> &) const;
+        void splitTasks(int,std::vector<Task> &);
 
         std::vector<Real> lonArray;
         std::vector<Edge> edgeArray;
-        std::vector<std::vector<int>> classified;
+        // Longitude bounds of the edges (preprocessing only)
+        std::vector<Real> edgeBound1;
+        std::vector<Real> edgeBound2;
+        // Edge lists of the parents of the tasks (preprocessing only)
+        std::vector<std::vector<int>> taskParents;
+        // Classified edges (compressed sparse rows, one row per slice)
+        std::vector<int> sliceOffsets;
+        std::vector<int> sliceEdges;
+        int numThreads;
 };
 
-#endif /* SliceArray_hpp */
\ No newline at end of file
+#endif /* SliceArray_hpp */
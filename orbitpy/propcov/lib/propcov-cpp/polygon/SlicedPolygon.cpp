@@ -1,5 +1,6 @@
 #include "SlicedPolygon.hpp"
 #include "SliceTree.hpp"
+#include "SliceArray.hpp"
 #include <iostream>
 
 // Sliced Polygon Class
@@ -39,6 +40,30 @@ SlicedPolygon::SlicedPolygon(std::vector<AnglePair> &verticesIn, AnglePair inter
 	init(cartVertices,cartInterior);
 }
 
+//------------------------------------------------------------------------------
+/**
+ * Constructor from serialized data (see serialize).
+ *
+ * @param in  the reader of the data
+ * 
+ */
+//------------------------------------------------------------------------------
+SlicedPolygon::SlicedPolygon(BinaryReader &in)
+{
+	interior = in.ReadRvector3();
+	QI = in.ReadRmatrix33();
+	int numVertices = in.ReadInt();
+	for (int i = 0; i < numVertices; i++)
+		vertices.push_back(in.ReadRvector3());
+	int numEdges = in.ReadInt();
+	for (int i = 0; i < numEdges; i++)
+		edgeArray.push_back(Edge(in));
+	indexArray = in.ReadIntArray();
+	processed = in.ReadBool();
+	if (processed)
+		preprocessor = new SliceArray(in);
+}
+
 // Common initializer for constructors
 void SlicedPolygon::init(std::vector<Rvector3> &verticesIn, Rvector3 interiorIn)
 {
@@ -330,4 +355,27 @@ std::ostream& operator<<(std::ostream& os, const SlicedPolygon& poly)
 	os << "----------------\n";
 
     return os;
-}
\ No newline at end of file
+}
+
+// Writes the state of the polygon. The preprocessed data is included for a SliceArray
+// preprocessor; other preprocessors are not supported.
+void SlicedPolygon::serialize(BinaryWriter &out) const
+{
+	out.WriteRvector3(interior);
+	out.WriteRmatrix33(QI);
+	out.WriteInt(vertices.size());
+	for (const Rvector3 &vertex : vertices)
+		out.WriteRvector3(vertex);
+	out.WriteInt(edgeArray.size());
+	for (const Edge &edge : edgeArray)
+		edge.serialize(out);
+	out.WriteIntArray(indexArray);
+	out.WriteBool(processed);
+	if (processed)
+	{
+		SliceArray *sliceArray = dynamic_cast<SliceArray*>(preprocessor);
+		if (!sliceArray)
+			throw TATCException("Serialization is only supported for a SliceArray preprocessor\n");
+		sliceArray->serialize(out);
+	}
+}
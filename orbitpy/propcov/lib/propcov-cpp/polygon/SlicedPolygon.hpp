@@ -17,6 +17,8 @@ class SlicedPolygon : public Polygon
 		// Constructors
 		SlicedPolygon(std::vector<Rvector3>& verticesIn, Rvector3 interior);
 		SlicedPolygon(std::vector<AnglePair>& verticesIn, AnglePair interior);
+		// Constructor from the data written by serialize
+		SlicedPolygon(BinaryReader &in);
 		// Init function for constructors 
 		void init(std::vector<Rvector3>& verticesIn, Rvector3 interior);
 		// Function to generate array of Edge objects used by constructor
@@ -52,6 +54,8 @@ class SlicedPolygon : public Polygon
 		std::vector<Real> getLatArray();
 		void getVerticesConeClock(Rvector& coneAngleInQ, Rvector& clockAngleInQ);
 		Rmatrix33 getQI();
+		// Write the state of the polygon, including the preprocessed data (SliceArray only)
+		void serialize(BinaryWriter &out) const;
 
 		// Overide print function 
 		friend std::ostream& operator<<(std::ostream& os, const SlicedPolygon& poly);
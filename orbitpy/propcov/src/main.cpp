@@ -2,6 +2,7 @@
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/numpy.h>
 #include <pybind11/operators.h> // In operator overloading, to use the more convenient py::self notation, the additional header file pybind11/operators.h must be included.
 #include "../extern/gmatutil/util/Rvector.hpp"
 #include "../extern/gmatutil/util/TableTemplate.hpp"
@@ -21,8 +22,29 @@
 #include "../lib/propcov-cpp/RectangularSensor.hpp"
 #include "../lib/propcov-cpp/polygon/DSPIPCustomSensor.hpp"
 #include "../lib/propcov-cpp/Propagator.hpp"
+#include "../lib/propcov-cpp/BinaryStream.hpp"
 #include "../lib/propcov-cpp/CoverageChecker.hpp"
+#include "../lib/propcov-cpp/FovLookupTable.hpp"
 #include "../lib/propcov-cpp/PointGroup.hpp"
+#include "../lib/propcov-cpp/AccessInterval.hpp"
+#include "../lib/propcov-cpp/ObservationScheduler.hpp"
+#include "../lib/propcov-cpp/AccessStore.hpp"
+#include "../lib/propcov-cpp/CoverageBitmap.hpp"
+#include "../lib/propcov-cpp/CoverageSink.hpp"
+#include "../lib/propcov-cpp/CoverageRunner.hpp"
+#include "../lib/propcov-cpp/CompiledScenario.hpp"
+#include "../lib/propcov-cpp/CoverageCache.hpp"
+#include "../lib/propcov-cpp/CoverageRaster.hpp"
+#include "../lib/propcov-cpp/RegionCoverage.hpp"
+#include "../lib/propcov-cpp/FirstAccessQuery.hpp"
+#include "../lib/propcov-cpp/CoverageStream.hpp"
+#include "../lib/propcov-cpp/CoverageWriter.hpp"
+#include "../lib/propcov-cpp/BatchConversions.hpp"
+#include "../lib/propcov-cpp/PointingIntersectionEngine.hpp"
+#include "../lib/propcov-cpp/Profiler.hpp"
+#include "../lib/propcov-cpp/CoverageProtocol.hpp"
+#include "../lib/propcov-cpp/CoverageService.hpp"
+#include "../lib/propcov-cpp/CoverageClient.hpp"
 
 #include "../lib/propcov-cpp/testclass.hpp"
 
@@ -41,6 +63,39 @@ std::string vector_to_string(std::vector<T,A> const& v){
     return s;
 }
 
+// Move a vector into a NumPy array (no copy, the array owns the data)
+template<typename T>
+py::array_t<T> vector_to_array(std::vector<T> &&v){
+    std::vector<T> *data = new std::vector<T>(std::move(v));
+    py::capsule owner(data, [](void *p){ delete reinterpret_cast<std::vector<T>*>(p); });
+    return py::array_t<T>(data->size(), data->data(), owner);
+}
+
+// NumPy input of the batch conversions (converted to contiguous doubles if needed)
+typedef py::array_t<Real, py::array::c_style | py::array::forcecast> real_array_in;
+
+// Number of rows of an (n x cols) batch input (an n-vector for cols = 0)
+Integer batch_rows(const real_array_in &a, py::ssize_t cols, const char *name){
+    bool ok = (cols == 0) ? (a.ndim() == 1) : (a.ndim() == 2 && a.shape(1) == cols);
+    if (!ok)
+        throw py::value_error(std::string(name) + " must be an " + (cols == 0 ? "n-vector" : "(n x " + std::to_string(cols) + ") array"));
+    return (Integer) a.shape(0);
+}
+
+// Apply a batch conversion from an (n x inCols) array to a new (n x outCols) array (n-vectors for 0 columns)
+template<typename F>
+py::array_t<Real> batch_convert(const real_array_in &in, py::ssize_t inCols, py::ssize_t outCols, F conversion){
+    Integer n = batch_rows(in, inCols, "input");
+    py::array_t<Real> out = (outCols == 0) ? py::array_t<Real>(n) : py::array_t<Real>({(py::ssize_t) n, outCols});
+    const Real *src = in.data();
+    Real *dst = out.mutable_data();
+    {
+        py::gil_scoped_release release;
+        conversion(src, n, dst);
+    }
+    return out;
+}
+
 PYBIND11_MODULE(propcov, m)
 {
     py::class_<Rvector>(m, "Rvector")
@@ -235,6 +290,15 @@ PYBIND11_MODULE(propcov, m)
                         py::arg("epoch"), py::arg("state"), py::arg("att"),py::arg("interp"), 
                         py::arg("angle1"), py::arg("angle2"), py::arg("angle3"), 
                         py::arg("seq1"), py::arg("seq2"), py::arg("seq3"))
+        .def(py::init([](py::bytes state, py::list sensors){
+                std::string data = state;
+                BinaryReader in(data);
+                Spacecraft *x = new Spacecraft(in);
+                for (py::handle sensor : sensors)
+                    x->AddSensor(sensor.cast<Sensor*>());
+                return x;
+                }), py::arg("state"), py::arg("sensors"), py::keep_alive<1, 3>(),
+                "Initialize from the serialized state (as pickled) and the sensors.")
         .def("GetCartesianState", &Spacecraft::GetCartesianState)
         .def("GetKeplerianState", &Spacecraft::GetKeplerianState)
         .def("AddSensor", &Spacecraft::AddSensor)
@@ -244,6 +308,16 @@ PYBIND11_MODULE(propcov, m)
         .def("SetBodyNadirOffsetAngles", &Spacecraft::SetBodyNadirOffsetAngles, py::arg("angle1"), py::arg("angle2"), py::arg("angle3"), py::arg("seq1"), py::arg("seq2"), py::arg("seq3"))
         .def("SetOrbitEpochOrbitStateCartesian", &Spacecraft::SetOrbitEpochOrbitStateCartesian, py::arg("t"), py::arg("cart"))
         .def("HasSensors", &Spacecraft::HasSensors)
+        .def("GetNumSensors", &Spacecraft::GetNumSensors)
+        .def("GetSensor", &Spacecraft::GetSensor, py::arg("sensorNumber"), py::return_value_policy::reference)
+        .def("__reduce__", [](Spacecraft &x){ // the sensors are pickled as separate objects (they may be shared)
+                BinaryWriter out;
+                x.Serialize(out);
+                py::list sensors;
+                for (Integer ii = 0; ii < x.GetNumSensors(); ii++)
+                    sensors.append(py::cast(x.GetSensor(ii), py::return_value_policy::reference));
+                return py::make_tuple(py::type::of<Spacecraft>(), py::make_tuple(py::bytes(out.GetBuffer()), sensors));
+                })
 
         /// @todo write __repr__
         ;
@@ -256,6 +330,17 @@ PYBIND11_MODULE(propcov, m)
         .def(py::init<Real>(), py::arg("halfAngle"), "Initialize Conical Sensor with half-angle in radians.")
         .def("SetFieldOfView", &ConicalSensor::SetFieldOfView)
         .def("GetFieldOfView", &ConicalSensor::GetFieldOfView)
+        .def(py::pickle(
+                [](const ConicalSensor &x){
+                    BinaryWriter out;
+                    x.Serialize(out);
+                    return py::bytes(out.GetBuffer());
+                },
+                [](py::bytes state){
+                    std::string data = state;
+                    BinaryReader in(data);
+                    return new ConicalSensor(in);
+                }))
         .def("__repr__",
               [](ConicalSensor &x){ 
                   std::string r("ConicalSensor(");
@@ -285,44 +370,664 @@ PYBIND11_MODULE(propcov, m)
 
     py::class_<DSPIPCustomSensor, Sensor>(m, "DSPIPCustomSensor")
         .def(py::init<Rvector&, Rvector&, AnglePair>(), py::arg("coneAngleVecIn"), py::arg("clockAngleVecIn"), py::arg("contained"), "Initialize Custom Sensor with cone, clock angles in radians. A point known to be 'contained' within the sensor FOV (in the Sensor frame) is also to be provided.")
+        .def(py::pickle(
+                [](const DSPIPCustomSensor &x){
+                    BinaryWriter out;
+                    x.Serialize(out);
+                    return py::bytes(out.GetBuffer());
+                },
+                [](py::bytes state){
+                    std::string data = state;
+                    BinaryReader in(data);
+                    return new DSPIPCustomSensor(in);
+                }))
 
         ;
     
     py::class_<RectangularSensor, Sensor>(m, "RectangularSensor")
         .def(py::init<Real, Real>(), py::arg("angleHeightIn"), py::arg("angleWidthIn"), "Initialize Rectangular Sensor with width and height angles in radians.")
+        .def(py::pickle(
+                [](const RectangularSensor &x){
+                    BinaryWriter out;
+                    x.Serialize(out);
+                    return py::bytes(out.GetBuffer());
+                },
+                [](py::bytes state){
+                    std::string data = state;
+                    BinaryReader in(data);
+                    return new RectangularSensor(in);
+                }))
 
         ;
 
-    py::class_<Propagator>(m, "Propagator")
-        .def(py::init<Spacecraft*>(),py::arg("spacecraft"))
-        .def("Propagate", &Propagator::Propagate)
+    py::class_<Propagator>(m, "Propagator", R"pbdoc(Propagate releases the GIL; use one propagator (and spacecraft) per thread.)pbdoc")
+        .def(py::init<Spacecraft*>(),py::arg("spacecraft"), py::keep_alive<1, 2>())
+        .def(py::init([](Spacecraft *sat, py::bytes state){
+                std::string data = state;
+                BinaryReader in(data);
+                return new Propagator(sat, in);
+                }), py::arg("spacecraft"), py::arg("state"), py::keep_alive<1, 2>(),
+                "Initialize from the serialized state (as pickled) for the spacecraft.")
+        .def("Propagate", &Propagator::Propagate, py::call_guard<py::gil_scoped_release>())
         .def("GetPropStartEnd", &Propagator::GetPropStartEnd)
         .def("SetApplyDrag", &Propagator::SetApplyDrag)
         .def("GetApplyDrag", &Propagator::GetApplyDrag)
+        .def("__reduce__", [](Propagator &x){
+                BinaryWriter out;
+                x.Serialize(out);
+                return py::make_tuple(py::type::of<Propagator>(),
+                                      py::make_tuple(py::cast(x.GetSpacecraft(), py::return_value_policy::reference),
+                                                     py::bytes(out.GetBuffer())));
+                })
         /// @todo write __repr__
         ;
 
     py::class_<PointGroup>(m, "PointGroup", R"pbdoc(Lat, lons are in radians. Lat range is between -90 to +90 and lon range is between -180 to 180.)pbdoc")
         .def(py::init())
         .def("AddUserDefinedPoints", &PointGroup::AddUserDefinedPoints, py::arg("lats"), py::arg("lons"), "Add user defined latitude and longitude points in radians.")
-        .def("AddHelicalPointsByAngle", &PointGroup::AddHelicalPointsByAngle, py::arg("angleBetweenPoints"))
+        .def("AddHelicalPointsByAngle", &PointGroup::AddHelicalPointsByAngle, py::arg("angleBetweenPoints"), py::call_guard<py::gil_scoped_release>())
         .def("GetPointPositionVector", &PointGroup::GetPointPositionVector, py::arg("index"))
         .def("GetLatAndLon", py::overload_cast<int>(&PointGroup::GetLatAndLon), py::arg("index"))
         .def("GetNumPoints", &PointGroup::GetNumPoints)
         .def("GetLatLonVectors", py::overload_cast<>(&PointGroup::GetLatLonVectors))
         .def("SetLatLonBounds", &PointGroup::SetLatLonBounds, py::arg("latUp"), py::arg("latLow"), py::arg("lonUp"), py::arg("lonLow"))
+        .def(py::pickle(
+                [](const PointGroup &x){
+                    BinaryWriter out;
+                    x.Serialize(out);
+                    return py::bytes(out.GetBuffer());
+                },
+                [](py::bytes state){
+                    std::string data = state;
+                    BinaryReader in(data);
+                    return new PointGroup(in);
+                }))
         ///@todo write __repr__
         ;
 
-    py::class_<CoverageChecker>(m, "CoverageChecker")
-        .def(py::init<PointGroup*, Spacecraft*>(), py::arg("ptGroup"), py::arg("sat"))
-        .def("CheckPointCoverage", py::overload_cast<>(&CoverageChecker::CheckPointCoverage))
-        .def("CheckPointCoverage", py::overload_cast<IntegerArray>(&CoverageChecker::CheckPointCoverage), py::arg("PointIndices"))
+    py::class_<CoverageBitmap>(m, "CoverageBitmap", R"pbdoc(Compressed bitmap of (non-negative) point indices.)pbdoc")
+        .def(py::init<>())
+        .def(py::init<const IntegerArray&>(), py::arg("indices"))
+        .def(py::init<const CoverageBitmap&>(), py::arg("copy"))
+        .def("Add", &CoverageBitmap::Add, py::arg("idx"))
+        .def("AddIndices", &CoverageBitmap::AddIndices, py::arg("indices"))
+        .def("Remove", &CoverageBitmap::Remove, py::arg("idx"))
+        .def("Contains", &CoverageBitmap::Contains, py::arg("idx"))
+        .def("GetCardinality", &CoverageBitmap::GetCardinality)
+        .def("IsEmpty", &CoverageBitmap::IsEmpty)
+        .def("Clear", &CoverageBitmap::Clear)
+        .def("ToIndices", &CoverageBitmap::ToIndices)
+        .def("Union", &CoverageBitmap::Union, py::arg("other"))
+        .def("Intersection", &CoverageBitmap::Intersection, py::arg("other"))
+        .def("Difference", &CoverageBitmap::Difference, py::arg("other"))
+        .def("UnionWith", &CoverageBitmap::UnionWith, py::arg("other"))
+        .def("IntersectionCardinality", &CoverageBitmap::IntersectionCardinality, py::arg("other"))
+        .def("UnionCardinality", &CoverageBitmap::UnionCardinality, py::arg("other"))
+        .def("GetNumContainers", &CoverageBitmap::GetNumContainers)
+        .def("GetNumBitmapContainers", &CoverageBitmap::GetNumBitmapContainers)
+        .def("__or__", &CoverageBitmap::Union)
+        .def("__and__", &CoverageBitmap::Intersection)
+        .def("__sub__", &CoverageBitmap::Difference)
+        .def("__ior__", [](CoverageBitmap &x, const CoverageBitmap &y) -> CoverageBitmap& { x.UnionWith(y); return x; })
+        .def("__len__", &CoverageBitmap::GetCardinality)
+        .def("__contains__", &CoverageBitmap::Contains)
+        .def(py::self == py::self)
+        .def(py::self != py::self)
+        .def("__repr__",
+              [](const CoverageBitmap &x){
+                  return "CoverageBitmap(cardinality=" + std::to_string(x.GetCardinality()) + ")";
+              }
+        )
+        ;
+
+    py::class_<CoverageChecker>(m, "CoverageChecker", R"pbdoc(The coverage checks release the GIL; use one checker per thread (the point group, sensors and attitude can be shared).)pbdoc")
+        .def(py::init([](PointGroup *ptGroup, Spacecraft *sat, bool singlePrec, bool useFovTable, Integer coneCells, Integer clockCells){
+                 CoverageChecker *x = new CoverageChecker(ptGroup, sat);
+                 x->SetSinglePrecision(singlePrec);
+                 x->SetUseFovLookupTable(useFovTable, coneCells, clockCells);
+                 return x;
+             }), py::arg("ptGroup"), py::arg("sat"), py::arg("singlePrec") = false, py::arg("useFovTable") = false,
+             py::arg("coneCells") = 128, py::arg("clockCells") = 256, py::keep_alive<1, 2>(), py::keep_alive<1, 3>())
+        .def("CheckPointCoverage", py::overload_cast<>(&CoverageChecker::CheckPointCoverage), py::call_guard<py::gil_scoped_release>())
+        .def("CheckPointCoverage", py::overload_cast<IntegerArray>(&CoverageChecker::CheckPointCoverage), py::arg("PointIndices"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("CheckPointCoverageBitmap", py::overload_cast<>(&CoverageChecker::CheckPointCoverageBitmap), py::call_guard<py::gil_scoped_release>())
+        .def("SetSinglePrecision", &CoverageChecker::SetSinglePrecision, py::arg("singlePrec"),
+             "Use the single precision feasibility test (with a double precision re-check near the boundary: same results).")
+        .def("GetSinglePrecision", &CoverageChecker::GetSinglePrecision)
+        .def("SetUseFovLookupTable", &CoverageChecker::SetUseFovLookupTable, py::arg("useTable"), py::arg("coneCells") = 128,
+             py::arg("clockCells") = 256, "Use a field-of-view lookup table for the custom and other sensors (built at the next step).")
+        .def("GetUseFovLookupTable", &CoverageChecker::GetUseFovLookupTable)
+        .def("GetFovTableConeCells", &CoverageChecker::GetFovTableConeCells)
+        .def("GetFovTableClockCells", &CoverageChecker::GetFovTableClockCells)
+        .def("__reduce__", [](CoverageChecker &x){
+                return py::make_tuple(py::type::of<CoverageChecker>(),
+                                      py::make_tuple(py::cast(x.GetPointGroup(), py::return_value_policy::reference),
+                                                     py::cast(x.GetSpacecraft(), py::return_value_policy::reference),
+                                                     x.GetSinglePrecision(), x.GetUseFovLookupTable(),
+                                                     x.GetFovTableConeCells(), x.GetFovTableClockCells()));
+                })
         //.def("AccumulateCoverageData", py::overload_cast<>(&CoverageChecker::AccumulateCoverageData))
         //.def("AccumulateCoverageData", py::overload_cast<Real>(&CoverageChecker::AccumulateCoverageData), py::arg("atTime"))
         //.def("AccumulateCoverageDataAtPreviousTimeIndex", &CoverageChecker::AccumulateCoverageDataAtPreviousTimeIndex)
         ;
 
+    py::class_<FovLookupTable> fovLookupTable(m, "FovLookupTable", R"pbdoc(Field-of-view mask of a sensor over the cone/clock plane: the inside and outside cells
+are answered from the table, the boundary cells with the exact test.)pbdoc");
+
+    py::enum_<FovLookupTable::CellClass>(fovLookupTable, "CellClass")
+        .value("OUTSIDE_CELL", FovLookupTable::OUTSIDE_CELL)
+        .value("INSIDE_CELL", FovLookupTable::INSIDE_CELL)
+        .value("BOUNDARY_CELL", FovLookupTable::BOUNDARY_CELL)
+        .export_values()
+        ;
+
+    fovLookupTable
+        .def(py::init<Sensor*, Integer, Integer>(), py::arg("sensor"), py::arg("coneCells") = 128, py::arg("clockCells") = 256,
+             py::keep_alive<1, 2>())
+        .def("CheckTargetVisibility", &FovLookupTable::CheckTargetVisibility, py::arg("viewConeAngle"), py::arg("viewClockAngle"))
+        .def("GetNumConeCells", &FovLookupTable::GetNumConeCells)
+        .def("GetNumClockCells", &FovLookupTable::GetNumClockCells)
+        .def("GetCellClass", &FovLookupTable::GetCellClass, py::arg("viewConeAngle"), py::arg("viewClockAngle"))
+        .def("GetNumCells", &FovLookupTable::GetNumCells, py::arg("cellClass"))
+        .def("IsStarShaped", &FovLookupTable::IsStarShaped)
+        ;
+
+    py::class_<CoverageSink>(m, "CoverageSink", R"pbdoc(Base class of the consumers of the per-step results of a CoverageRunner.)pbdoc")
+        ;
+
+    py::class_<CoverageRaster, CoverageSink>(m, "CoverageRaster", R"pbdoc(Coverage statistics (access count, dwell time, max gap) accumulated on a lat/lon raster.)pbdoc")
+        .def(py::init<PointGroup*, Real>(), py::arg("ptGroup"), py::arg("cellSize"), "Initialize with the point group and the cell size in degrees.")
+        .def("Reset", &CoverageRaster::Reset)
+        .def("GetNumRows", &CoverageRaster::GetNumRows)
+        .def("GetNumColumns", &CoverageRaster::GetNumColumns)
+        .def("GetCellSize", &CoverageRaster::GetCellSize)
+        .def("GetCellIndex", &CoverageRaster::GetCellIndex, py::arg("pointIndex"))
+        .def("GetNumPointsPerCell", &CoverageRaster::GetNumPointsPerCell)
+        .def("GetAccessCounts", &CoverageRaster::GetAccessCounts)
+        .def("GetDwellTimes", &CoverageRaster::GetDwellTimes)
+        .def("GetMaxGaps", &CoverageRaster::GetMaxGaps)
+        .def("Write", &CoverageRaster::Write, py::arg("filename"))
+        ;
+
+    py::class_<RegionCoverage, CoverageSink>(m, "RegionCoverage", R"pbdoc(Area-weighted coverage of polygon regions (covered and cumulative fraction per region and step),
+with Voronoi area weights of the grid points.)pbdoc")
+        .def(py::init<PointGroup*, Integer>(), py::arg("ptGroup"), py::arg("samplesPerPoint") = 16,
+             "Initialize with the point group and the number of samples per Voronoi cell of the weights.")
+        .def("AddRegion", &RegionCoverage::AddRegion, py::arg("lats"), py::arg("lons"), py::arg("interiorLat"),
+             py::arg("interiorLon"), "Add a polygon region (radians) and return its index.")
+        .def("SetPointWeights", &RegionCoverage::SetPointWeights, py::arg("weights"))
+        .def("GetPointWeights", &RegionCoverage::GetPointWeights)
+        .def("GetNumRegions", &RegionCoverage::GetNumRegions)
+        .def("GetRegionArea", &RegionCoverage::GetRegionArea, py::arg("region"))
+        .def("GetRegionPoints", &RegionCoverage::GetRegionPoints, py::arg("region"))
+        .def("Reset", &RegionCoverage::Reset)
+        .def("GetNumSteps", &RegionCoverage::GetNumSteps)
+        .def("GetCoveredFractions", &RegionCoverage::GetCoveredFractions, py::arg("region"))
+        .def("GetCumulativeFractions", &RegionCoverage::GetCumulativeFractions, py::arg("region"))
+        .def("GetTotalCoveredFraction", &RegionCoverage::GetTotalCoveredFraction, py::arg("region"))
+        ;
+
+    py::class_<StepFormatter>(m, "StepFormatter", R"pbdoc(Base class of the formatters of the steps written by a CoverageWriter.)pbdoc")
+        ;
+
+    py::class_<CsvStateFormatter, StepFormatter>(m, "CsvStateFormatter", R"pbdoc(CSV rows of the spacecraft state (time index, JDUT1, ECI position and velocity), one per step.)pbdoc")
+        .def(py::init<>())
+        ;
+
+    py::class_<CsvAccessFormatter, StepFormatter>(m, "CsvAccessFormatter", R"pbdoc(CSV rows (time index, GP index), one per covered point and step.)pbdoc")
+        .def(py::init<>())
+        ;
+
+    py::class_<BinaryStepFormatter, StepFormatter>(m, "BinaryStepFormatter", R"pbdoc(Flat binary records of the steps (time, state and covered points).)pbdoc")
+        .def(py::init<>())
+        ;
+
+    py::class_<LegacyStateFormatter, StepFormatter>(m, "LegacyStateFormatter", R"pbdoc(State file of the orbitpropcov_grid driver (Cartesian, or Keplerian elements in km and deg).)pbdoc")
+        .def(py::init<Real, bool>(), py::arg("duration"), py::arg("keplerian") = false, "Initialize with the duration (days) written in the header.")
+        ;
+
+    py::class_<LegacyAccessFormatter, StepFormatter>(m, "LegacyAccessFormatter", R"pbdoc(Access matrix file of the orbitpropcov_grid driver (one row per step with access, one column per grid point).)pbdoc")
+        .def(py::init<Real>(), py::arg("duration"), "Initialize with the duration (days) written in the header.")
+        ;
+
+    py::class_<CoverageWriter, CoverageSink>(m, "CoverageWriter", R"pbdoc(Sink writing the steps of a coverage run to files on a writer thread, in step order,
+with a bounded queue of steps (the coverage loop waits for the writer when it is full).)pbdoc")
+        .def(py::init<Integer, Integer>(), py::arg("maxQueuedSteps") = 64, py::arg("bufferSize") = 1 << 20)
+        .def("AddOutput", &CoverageWriter::AddOutput, py::arg("filename"), py::arg("formatter"), py::keep_alive<1, 3>())
+        .def("GetNumOutputs", &CoverageWriter::GetNumOutputs)
+        .def("GetMaxQueuedSteps", &CoverageWriter::GetMaxQueuedSteps)
+        .def("GetBufferSize", &CoverageWriter::GetBufferSize)
+        .def("GetNumStepsWritten", &CoverageWriter::GetNumStepsWritten)
+        .def("GetBytesWritten", &CoverageWriter::GetBytesWritten)
+        ;
+
+    py::class_<CompiledScenario>(m, "CompiledScenario", R"pbdoc(Immutable snapshot of a point group and a spacecraft (orbit, attitude offsets, sensors), shareable by threads.)pbdoc")
+        .def(py::init<PointGroup*, Spacecraft*>(), py::arg("ptGroup"), py::arg("sat"), py::keep_alive<1, 3>())
+        .def("GetNumPoints", &CompiledScenario::GetNumPoints)
+        .def("GetNumSensors", &CompiledScenario::GetNumSensors)
+        .def("GetEpoch", &CompiledScenario::GetEpoch)
+        .def("GetNadirToBodyMatrix", &CompiledScenario::GetNadirToBodyMatrix)
+        .def("GetOrbitalElements", &CompiledScenario::GetOrbitalElements, py::arg("jd"))
+        .def("GetCartesianState", &CompiledScenario::GetCartesianState, py::arg("jd"))
+        ;
+
+    py::class_<ScenarioEvaluator>(m, "ScenarioEvaluator", R"pbdoc(Per-thread evaluator of a CompiledScenario (spacecraft state and point coverage at a time).)pbdoc")
+        .def(py::init<const CompiledScenario*>(), py::arg("scenario"), py::keep_alive<1, 2>())
+        .def("SetSinglePrecision", &ScenarioEvaluator::SetSinglePrecision, py::arg("single"))
+        .def("GetSinglePrecision", &ScenarioEvaluator::GetSinglePrecision)
+        .def("SetUseFovLookupTable", &ScenarioEvaluator::SetUseFovLookupTable, py::arg("useTable"), py::arg("coneCells") = 128,
+             py::arg("clockCells") = 256)
+        .def("GetUseFovLookupTable", &ScenarioEvaluator::GetUseFovLookupTable)
+        .def("GetCartesianState", &ScenarioEvaluator::GetCartesianState, py::arg("jd"))
+        .def("GetBodyFixedState", &ScenarioEvaluator::GetBodyFixedState, py::arg("jd"), py::arg("cartState"))
+        .def("CheckPointCoverage", &ScenarioEvaluator::CheckPointCoverage, py::arg("jd"),
+             py::call_guard<py::gil_scoped_release>())
+        ;
+
+    py::class_<CoverageRunner>(m, "CoverageRunner", R"pbdoc(Runs the coverage loop of a spacecraft over a point group and feeds the results to a sink.)pbdoc")
+        .def(py::init<PointGroup*, Spacecraft*>(), py::arg("ptGroup"), py::arg("sat"), py::keep_alive<1, 2>(), py::keep_alive<1, 3>())
+        .def("SetNumThreads", &CoverageRunner::SetNumThreads, py::arg("nThreads"))
+        .def("GetNumThreads", &CoverageRunner::GetNumThreads)
+        .def("SetSinglePrecision", &CoverageRunner::SetSinglePrecision, py::arg("single"))
+        .def("GetSinglePrecision", &CoverageRunner::GetSinglePrecision)
+        .def_static("GetNumSteps", &CoverageRunner::GetNumSteps, py::arg("startJd"), py::arg("duration"), py::arg("stepSize"))
+        .def("Run", &CoverageRunner::Run, py::arg("sink"), py::arg("startJd"), py::arg("duration"), py::arg("stepSize"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Run from startJd (JDUT1) for duration (days) with the step size in seconds; returns the number of steps.")
+        ;
+
+    py::class_<CoverageResults>(m, "CoverageResults", R"pbdoc(Access intervals and per-point statistics (number of accesses, dwell time and maximum gap in seconds) of a coverage run.)pbdoc")
+        .def(py::init<>())
+        .def_readonly("numPoints", &CoverageResults::numPoints)
+        .def_readonly("numSteps", &CoverageResults::numSteps)
+        .def_readonly("startJd", &CoverageResults::startJd)
+        .def_readonly("stepSize", &CoverageResults::stepSize)
+        .def_readonly("intervals", &CoverageResults::intervals)
+        .def_readonly("numAccesses", &CoverageResults::numAccesses)
+        .def_readonly("dwellTimes", &CoverageResults::dwellTimes)
+        .def_readonly("maxGaps", &CoverageResults::maxGaps)
+        ;
+
+    py::class_<CoverageCache>(m, "CoverageCache", R"pbdoc(On-disk cache of coverage results keyed by the content of the run inputs, with LRU eviction beyond a size limit.)pbdoc")
+        .def(py::init<const std::string&, long long>(), py::arg("directory"), py::arg("maxBytes") = 1LL << 30)
+        .def_static("GetKey", &CoverageCache::GetKey, py::arg("ptGroup"), py::arg("sat"), py::arg("startJd"), py::arg("duration"), py::arg("stepSize"),
+                    "Key of a run (empty if it cannot be cached).")
+        .def("Lookup", [](CoverageCache &cache, PointGroup *ptGroup, Spacecraft *sat, Real startJd, Real duration, Real stepSize)
+             {
+                 CoverageResults results;
+                 bool hit;
+                 {
+                     py::gil_scoped_release release;
+                     hit = cache.Lookup(ptGroup, sat, startJd, duration, stepSize, results);
+                 }
+                 return hit ? py::cast(results) : py::object(py::none());
+             }, py::arg("ptGroup"), py::arg("sat"), py::arg("startJd"), py::arg("duration"), py::arg("stepSize"),
+             "Results of a run from the cache, None on a miss.")
+        .def("Store", &CoverageCache::Store, py::arg("ptGroup"), py::arg("sat"), py::arg("startJd"), py::arg("duration"), py::arg("stepSize"),
+             py::arg("results"), py::call_guard<py::gil_scoped_release>())
+        .def("Run", &CoverageCache::Run, py::arg("ptGroup"), py::arg("sat"), py::arg("startJd"), py::arg("duration"), py::arg("stepSize"),
+             py::call_guard<py::gil_scoped_release>(),
+             "Results of a run from the cache, or computed (startJd JDUT1, duration days, step size s) and stored.")
+        .def_static("Compute", &CoverageCache::Compute, py::arg("ptGroup"), py::arg("sat"), py::arg("startJd"), py::arg("duration"), py::arg("stepSize"),
+                    py::arg("singlePrecision") = false, py::call_guard<py::gil_scoped_release>())
+        .def("SetSinglePrecision", &CoverageCache::SetSinglePrecision, py::arg("single"))
+        .def("GetSinglePrecision", &CoverageCache::GetSinglePrecision)
+        .def("SetMaxBytes", &CoverageCache::SetMaxBytes, py::arg("bytes"))
+        .def("GetMaxBytes", &CoverageCache::GetMaxBytes)
+        .def("GetDirectory", &CoverageCache::GetDirectory)
+        .def("GetNumHits", &CoverageCache::GetNumHits)
+        .def("GetNumMisses", &CoverageCache::GetNumMisses)
+        .def("GetNumEvictions", &CoverageCache::GetNumEvictions)
+        .def("GetNumEntries", &CoverageCache::GetNumEntries)
+        .def("GetTotalBytes", &CoverageCache::GetTotalBytes)
+        .def("Clear", &CoverageCache::Clear)
+        ;
+
+    py::class_<FirstAccessQuery>(m, "FirstAccessQuery", R"pbdoc(First access time per point and time to reach a coverage fraction, with early termination.)pbdoc")
+        .def(py::init<PointGroup*, Spacecraft*>(), py::arg("ptGroup"), py::arg("sat"), py::keep_alive<1, 2>(), py::keep_alive<1, 3>())
+        .def("AddSpacecraft", &FirstAccessQuery::AddSpacecraft, py::arg("sat"), py::keep_alive<1, 2>())
+        .def("GetNumSpacecraft", &FirstAccessQuery::GetNumSpacecraft)
+        .def("Run", &FirstAccessQuery::Run, py::arg("startJd"), py::arg("duration"), py::arg("stepSize"), py::arg("coverageFraction") = 1.0,
+             py::call_guard<py::gil_scoped_release>(),
+             "Run from startJd (JDUT1) for at most duration (days) with the step size in seconds; returns the number of steps run.")
+        .def("GetFirstAccessTimes", &FirstAccessQuery::GetFirstAccessTimes)
+        .def("GetCoverageTime", &FirstAccessQuery::GetCoverageTime)
+        .def("GetNumCovered", &FirstAccessQuery::GetNumCovered)
+        .def("GetCoveredFraction", &FirstAccessQuery::GetCoveredFraction)
+        .def("GetUncoveredPoints", &FirstAccessQuery::GetUncoveredPoints)
+        .def("GetNumStepsRun", &FirstAccessQuery::GetNumStepsRun)
+        ;
+
+    py::class_<CoverageStream>(m, "CoverageStream", R"pbdoc(Iterator over the results of a coverage run computed ahead on a background thread, in chunks of NumPy arrays
+(step index, point index[, range (km), elevation (rad)]) with a bounded number of buffered chunks.)pbdoc")
+        .def(py::init<PointGroup*, Spacecraft*, Real, Real, Real, Integer, Integer, bool>(), py::arg("ptGroup"), py::arg("sat"),
+             py::arg("startJd"), py::arg("duration"), py::arg("stepSize"), py::arg("chunkSize") = 100000, py::arg("maxChunks") = 4,
+             py::arg("withGeometry") = false, py::keep_alive<1, 2>(), py::keep_alive<1, 3>(),
+             "Run from startJd (JDUT1) for duration (days) with the step size in seconds (the spacecraft is copied, its sensors are shared).")
+        .def("__iter__", [](CoverageStream &x) -> CoverageStream& { return x; })
+        .def("__next__", [](CoverageStream &x){
+                CoverageStream::Chunk chunk;
+                bool more;
+                {
+                    py::gil_scoped_release release;
+                    more = x.Next(chunk);
+                }
+                if (!more)
+                    throw py::stop_iteration();
+                py::tuple result(x.HasGeometry() ? 4 : 2);
+                result[0] = vector_to_array(std::move(chunk.stepIndices));
+                result[1] = vector_to_array(std::move(chunk.pointIndices));
+                if (x.HasGeometry()){
+                    result[2] = vector_to_array(std::move(chunk.ranges));
+                    result[3] = vector_to_array(std::move(chunk.elevations));
+                }
+                return result;
+                })
+        .def("Start", &CoverageStream::Start)
+        .def("Cancel", &CoverageStream::Cancel, py::call_guard<py::gil_scoped_release>())
+        .def("GetNumSteps", &CoverageStream::GetNumSteps)
+        .def("GetNumStepsDone", &CoverageStream::GetNumStepsDone)
+        .def("HasGeometry", &CoverageStream::HasGeometry)
+        .def("GetStepTime", &CoverageStream::GetStepTime, py::arg("stepIndex"))
+        ;
+
+    py::class_<BatchConversions, std::unique_ptr<BatchConversions, py::nodelete>>(m, "BatchConversions", R"pbdoc(Array versions of the frame, state and date conversions (NumPy in, NumPy out).
+Angles in radians, distances in km, Julian dates (UT1).)pbdoc")
+        .def_static("InertialToBodyFixed", [](const real_array_in &jd, const real_array_in &states){
+                if (batch_rows(jd, 0, "jd") != batch_rows(states, 6, "states"))
+                    throw py::value_error("jd and states must have the same number of rows");
+                const Real *t = jd.data();
+                return batch_convert(states, 6, 6, [t](const Real *in, Integer n, Real *out){ BatchConversions::InertialToBodyFixed(t, in, n, out); });
+                }, py::arg("jd"), py::arg("states"), "Earth inertial states (n x 6) at the Julian dates (n) to Earth-fixed states.")
+        .def_static("BodyFixedToInertial", [](const real_array_in &jd, const real_array_in &states){
+                if (batch_rows(jd, 0, "jd") != batch_rows(states, 6, "states"))
+                    throw py::value_error("jd and states must have the same number of rows");
+                const Real *t = jd.data();
+                return batch_convert(states, 6, 6, [t](const Real *in, Integer n, Real *out){ BatchConversions::BodyFixedToInertial(t, in, n, out); });
+                }, py::arg("jd"), py::arg("states"), "Earth-fixed states (n x 6) at the Julian dates (n) to Earth inertial states.")
+        .def_static("CartesianToKeplerian", [](const real_array_in &cart, Real mu){
+                return batch_convert(cart, 6, 6, [mu](const Real *in, Integer n, Real *out){ BatchConversions::CartesianToKeplerian(in, n, out, mu); });
+                }, py::arg("cart"), py::arg("mu") = Earth::MU, "Cartesian states (n x 6) to Keplerian elements (n x 6: SMA, ECC, INC, RAAN, AOP, TA).")
+        .def_static("KeplerianToCartesian", [](const real_array_in &kepl, Real mu){
+                return batch_convert(kepl, 6, 6, [mu](const Real *in, Integer n, Real *out){ BatchConversions::KeplerianToCartesian(in, n, out, mu); });
+                }, py::arg("kepl"), py::arg("mu") = Earth::MU, "Keplerian elements (n x 6: SMA, ECC, INC, RAAN, AOP, TA) to Cartesian states (n x 6).")
+        .def_static("CartesianToGeodetic", [](const real_array_in &cart){
+                return batch_convert(cart, 3, 3, &BatchConversions::CartesianToGeodetic);
+                }, py::arg("cart"), "Earth-fixed positions (n x 3) to geodetic latitude, longitude and height (n x 3).")
+        .def_static("GeodeticToCartesian", [](const real_array_in &geo){
+                return batch_convert(geo, 3, 3, &BatchConversions::GeodeticToCartesian);
+                }, py::arg("geo"), "Geodetic latitude, longitude and height (n x 3) to Earth-fixed positions (n x 3).")
+        .def_static("GeocentricToGeodeticLat", [](const real_array_in &gcLat){
+                return batch_convert(gcLat, 0, 0, &BatchConversions::GeocentricToGeodeticLat);
+                }, py::arg("gcLat"), "Geocentric latitudes (n) to geodetic latitudes (n).")
+        .def_static("JulianToGregorian", [](const real_array_in &jd){
+                return batch_convert(jd, 0, 6, &BatchConversions::JulianToGregorian);
+                }, py::arg("jd"), "Julian dates (n) to Gregorian dates (n x 6: year, month, day, hour, minute, second).")
+        .def_static("GregorianToJulian", [](const real_array_in &greg){
+                return batch_convert(greg, 6, 0, &BatchConversions::GregorianToJulian);
+                }, py::arg("greg"), "Gregorian dates (n x 6: year, month, day, hour, minute, second) to Julian dates (n).")
+        ;
+
+    py::class_<PointingIntersectionEngine>(m, "PointingIntersectionEngine", R"pbdoc(Ground points (latitude, longitude in radians, NaN on a miss) of the pointing axes of a set of
+attitude options (Euler angles in degrees from the nadir frame) for arrays of states.)pbdoc")
+        .def(py::init<const RealArray&, const RealArray&, const RealArray&, Integer, Integer, Integer>(),
+             py::arg("angles1"), py::arg("angles2"), py::arg("angles3"), py::arg("seq1") = 1, py::arg("seq2") = 2, py::arg("seq3") = 3)
+        .def("SetEllipsoid", &PointingIntersectionEngine::SetEllipsoid, py::arg("equatorialRadius"), py::arg("flattening"))
+        .def("GetEquatorialRadius", &PointingIntersectionEngine::GetEquatorialRadius)
+        .def("GetFlattening", &PointingIntersectionEngine::GetFlattening)
+        .def("GetNumOptions", &PointingIntersectionEngine::GetNumOptions)
+        .def("GetPointingAxis", &PointingIntersectionEngine::GetPointingAxis, py::arg("option"))
+        .def("Intersect", [](const PointingIntersectionEngine &engine, const real_array_in &jd, const real_array_in &states){
+                Integer n = batch_rows(states, 6, "states");
+                if (batch_rows(jd, 0, "jd") != n)
+                    throw py::value_error("jd and states must have the same number of rows");
+                py::array_t<Real> latLon({(py::ssize_t) n, (py::ssize_t) engine.GetNumOptions(), (py::ssize_t) 2});
+                const Real *t = jd.data(), *in = states.data();
+                Real *out = latLon.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    engine.Intersect(t, in, n, out);
+                }
+                return latLon;
+                }, py::arg("jd"), py::arg("states"), "Earth inertial states (n x 6) at the Julian dates (n) to ground points (n x options x 2).")
+        .def("IntersectBodyFixed", [](const PointingIntersectionEngine &engine, const real_array_in &states){
+                Integer n = batch_rows(states, 6, "states");
+                py::array_t<Real> latLon({(py::ssize_t) n, (py::ssize_t) engine.GetNumOptions(), (py::ssize_t) 2});
+                const Real *in = states.data();
+                Real *out = latLon.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    engine.IntersectBodyFixed(in, n, out);
+                }
+                return latLon;
+                }, py::arg("states"), "Earth-fixed states (n x 6) to ground points (n x options x 2).")
+        .def("WriteTable", [](const PointingIntersectionEngine &engine, const std::string &filename, const real_array_in &jd, const real_array_in &states){
+                Integer n = batch_rows(states, 6, "states");
+                if (batch_rows(jd, 0, "jd") != n)
+                    throw py::value_error("jd and states must have the same number of rows");
+                py::gil_scoped_release release;
+                engine.WriteTable(filename, jd.data(), states.data(), n);
+                }, py::arg("filename"), py::arg("jd"), py::arg("states"), "Write the ground points of the states to a binary table.")
+        .def_static("ReadTable", [](const std::string &filename){
+                RealArray jd, latLon;
+                Integer numOptions = PointingIntersectionEngine::ReadTable(filename, jd, latLon);
+                py::array_t<Real> ground({(py::ssize_t) jd.size(), (py::ssize_t) numOptions, (py::ssize_t) 2});
+                std::copy(latLon.begin(), latLon.end(), ground.mutable_data());
+                return py::make_tuple(vector_to_array(std::move(jd)), ground);
+                }, py::arg("filename"), "Times (n) and ground points (n x options x 2) of a binary table.")
+        ;
+
+    py::class_<Profiler, std::unique_ptr<Profiler, py::nodelete>> profiler(m, "Profiler", R"pbdoc(Stage times and counters of the coverage computations, enabled at run time (disabled by default).
+The totals are summed over all threads; with tracing, the timed calls can be written as a Chrome trace.
+The memory of the main containers is accounted per subsystem (current and peak bytes), whether or not the profiler is enabled.)pbdoc");
+
+    py::enum_<Profiler::Stage>(profiler, "Stage")
+        .value("PROPAGATION", Profiler::PROPAGATION)
+        .value("FRAME_CONVERSION", Profiler::FRAME_CONVERSION)
+        .value("FEASIBILITY", Profiler::FEASIBILITY)
+        .value("FOV_TEST", Profiler::FOV_TEST)
+        .value("INTERVAL_BUILDING", Profiler::INTERVAL_BUILDING)
+        .value("OUTPUT", Profiler::OUTPUT)
+        .export_values()
+        ;
+
+    py::enum_<Profiler::Counter>(profiler, "Counter")
+        .value("POINTS_TESTED", Profiler::POINTS_TESTED)
+        .value("FEASIBLE_POINTS", Profiler::FEASIBLE_POINTS)
+        .value("VISIBLE_POINTS", Profiler::VISIBLE_POINTS)
+        .value("BYTES_WRITTEN", Profiler::BYTES_WRITTEN)
+        .value("PRECISION_FALLBACKS", Profiler::PRECISION_FALLBACKS)
+        .export_values()
+        ;
+
+    py::enum_<Profiler::Subsystem>(profiler, "Subsystem")
+        .value("POINT_MEMORY", Profiler::POINT_MEMORY)
+        .value("CHECKER_MEMORY", Profiler::CHECKER_MEMORY)
+        .value("TIME_SERIES_MEMORY", Profiler::TIME_SERIES_MEMORY)
+        .value("INTERPOLATOR_MEMORY", Profiler::INTERPOLATOR_MEMORY)
+        .value("ACCESS_MEMORY", Profiler::ACCESS_MEMORY)
+        .export_values()
+        ;
+
+    profiler
+        .def_static("Enable", &Profiler::Enable, py::arg("withTrace") = false)
+        .def_static("Disable", &Profiler::Disable)
+        .def_static("IsEnabled", &Profiler::IsEnabled)
+        .def_static("IsTracing", &Profiler::IsTracing)
+        .def_static("Reset", &Profiler::Reset)
+        .def_static("GetStageTime", &Profiler::GetStageTime, py::arg("stage"), "Total wall time of the stage in seconds.")
+        .def_static("GetStageCalls", &Profiler::GetStageCalls, py::arg("stage"))
+        .def_static("GetCounter", &Profiler::GetCounter, py::arg("counter"))
+        .def_static("GetStageAllocations", &Profiler::GetStageAllocations, py::arg("stage"),
+                    "Heap allocations of the stage (counted only in executables replacing operator new, see tests/support-cpp/AllocationCounter.cpp).")
+        .def_static("GetCurrentMemory", &Profiler::GetCurrentMemory, py::arg("subsystem"), "Bytes currently accounted for the subsystem.")
+        .def_static("GetPeakMemory", &Profiler::GetPeakMemory, py::arg("subsystem"), "Peak bytes accounted for the subsystem.")
+        .def_static("GetTotalCurrentMemory", &Profiler::GetTotalCurrentMemory)
+        .def_static("GetTotalPeakMemory", &Profiler::GetTotalPeakMemory)
+        .def_static("GetStats", [](){
+                py::dict stages, counters;
+                for (int ii = 0; ii < Profiler::NUM_STAGES; ii++){
+                    Profiler::Stage stage = (Profiler::Stage) ii;
+                    stages[py::str(Profiler::GetStageName(stage))] =
+                        py::make_tuple(Profiler::GetStageCalls(stage), Profiler::GetStageTime(stage));
+                }
+                for (int ii = 0; ii < Profiler::NUM_COUNTERS; ii++){
+                    Profiler::Counter counter = (Profiler::Counter) ii;
+                    counters[py::str(Profiler::GetCounterName(counter))] = Profiler::GetCounter(counter);
+                }
+                py::dict memory;
+                for (int ii = 0; ii < Profiler::NUM_SUBSYSTEMS; ii++){
+                    Profiler::Subsystem subsystem = (Profiler::Subsystem) ii;
+                    memory[py::str(Profiler::GetSubsystemName(subsystem))] =
+                        py::make_tuple(Profiler::GetCurrentMemory(subsystem), Profiler::GetPeakMemory(subsystem));
+                }
+                py::dict stats;
+                stats["stages"] = stages;
+                stats["counters"] = counters;
+                stats["memory"] = memory;
+                return stats;
+                }, "Dict with 'stages' (name: (calls, time in seconds)), 'counters' (name: value) and 'memory' (name: (current, peak bytes)).")
+        .def_static("GetReport", &Profiler::GetReport)
+        .def_static("GetNumTraceEvents", &Profiler::GetNumTraceEvents)
+        .def_static("GetNumDroppedTraceEvents", &Profiler::GetNumDroppedTraceEvents)
+        .def_static("WriteChromeTrace", &Profiler::WriteChromeTrace, py::arg("filename"))
+        ;
+
+    py::class_<CoverageRequest>(m, "CoverageRequest", R"pbdoc(Coverage request of a CoverageClient: a spacecraft (with an optional sensor) over a registered grid.)pbdoc")
+        .def(py::init([](Integer gridId, Integer sensorType, const RealArray &sensorParams, Real epoch,
+                         const RealArray &keplerianState, Real duration, Real stepSize) {
+                CoverageRequest x = {gridId, sensorType, sensorParams, epoch, keplerianState, duration, stepSize};
+                return x;
+                }),
+                py::arg("gridId"), py::arg("sensorType"), py::arg("sensorParams"), py::arg("epoch"),
+                py::arg("keplerianState"), py::arg("duration"), py::arg("stepSize"),
+                "sensorType: 0 none, 1 conical (half angle), 2 rectangular (angle height, angle width), 3 custom (cone angles then clock angles); angles in radians. "
+                "keplerianState: SMA (km), ECC, INC, RAAN, AOP, TA (rad). The run starts at the epoch (JDUT1), duration in days and step size in seconds.")
+        .def_readwrite("gridId", &CoverageRequest::gridId)
+        .def_readwrite("sensorType", &CoverageRequest::sensorType)
+        .def_readwrite("sensorParams", &CoverageRequest::sensorParams)
+        .def_readwrite("epoch", &CoverageRequest::epoch)
+        .def_readwrite("keplerianState", &CoverageRequest::keplerianState)
+        .def_readwrite("duration", &CoverageRequest::duration)
+        .def_readwrite("stepSize", &CoverageRequest::stepSize)
+        ;
+
+    py::class_<CoverageService>(m, "CoverageService", R"pbdoc(Long-lived coverage service on a Unix domain socket, keeping the grids and the spacecraft/sensor contexts warm across requests.)pbdoc")
+        .def(py::init<const std::string&>(), py::arg("socketPath"))
+        .def("Start", &CoverageService::Start)
+        .def("Serve", &CoverageService::Serve, py::call_guard<py::gil_scoped_release>(),
+             "Serve the connections until Stop() or a shutdown request (blocking).")
+        .def("Stop", &CoverageService::Stop)
+        .def("IsRunning", &CoverageService::IsRunning)
+        .def("GetSocketPath", &CoverageService::GetSocketPath)
+        .def("GetNumCachedGrids", &CoverageService::GetNumCachedGrids)
+        .def("GetNumCachedContexts", &CoverageService::GetNumCachedContexts)
+        .def("SetMaxCachedGrids", &CoverageService::SetMaxCachedGrids, py::arg("maxGrids"),
+             "Set the largest number of cached grids; beyond it, the least recently used grid not in use is evicted.")
+        .def("GetMaxCachedGrids", &CoverageService::GetMaxCachedGrids)
+        .def("GetNumEvictedGrids", &CoverageService::GetNumEvictedGrids)
+        ;
+
+    py::class_<CoverageClient>(m, "CoverageClient", R"pbdoc(Client of a CoverageService.)pbdoc")
+        .def(py::init<const std::string&>(), py::arg("socketPath"))
+        .def("Ping", &CoverageClient::Ping, py::call_guard<py::gil_scoped_release>())
+        .def("RegisterGrid", &CoverageClient::RegisterGrid, py::arg("lats"), py::arg("lons"), py::call_guard<py::gil_scoped_release>(),
+             "Register a grid (lat/lon in radians); returns its id.")
+        .def("RunCoverage", &CoverageClient::RunCoverage, py::arg("req"), py::arg("sink"), py::call_guard<py::gil_scoped_release>(),
+             "Run a request, feeding the results to the sink; returns the number of steps.")
+        .def("Shutdown", &CoverageClient::Shutdown)
+        .def("Close", &CoverageClient::Close)
+        .def("IsConnected", &CoverageClient::IsConnected)
+        ;
+
+    py::class_<AccessInterval>(m, "AccessInterval", R"pbdoc(Access of a point by a satellite (through a pointing option) over [startTime, stopTime] (JDUT1).)pbdoc")
+        .def(py::init([](Integer satIndex, Integer pointIndex, Integer optionIndex, Real startTime, Real stopTime) {
+                AccessInterval x = {satIndex, pointIndex, optionIndex, startTime, stopTime};
+                return x;
+                }),
+                py::arg("satIndex"), py::arg("pointIndex"), py::arg("optionIndex"), py::arg("startTime"), py::arg("stopTime"))
+        .def_readwrite("satIndex", &AccessInterval::satIndex)
+        .def_readwrite("pointIndex", &AccessInterval::pointIndex)
+        .def_readwrite("optionIndex", &AccessInterval::optionIndex)
+        .def_readwrite("startTime", &AccessInterval::startTime)
+        .def_readwrite("stopTime", &AccessInterval::stopTime)
+        .def("__repr__",
+              [](const AccessInterval &x){
+                  std::string r("AccessInterval(");
+                  r += std::to_string(x.satIndex) + "," + std::to_string(x.pointIndex) + "," + std::to_string(x.optionIndex) + "," +
+                       std::to_string(x.startTime) + "," + std::to_string(x.stopTime);
+                  r += ")";
+                  return r;
+              }
+            )
+        ;
+
+    py::class_<AccessIntervalBuilder>(m, "AccessIntervalBuilder")
+        .def(py::init<Integer, Integer, Integer>(), py::arg("numPoints"), py::arg("satIdx") = 0, py::arg("optionIdx") = 0)
+        .def("AddCoverage", &AccessIntervalBuilder::AddCoverage, py::arg("jd"), py::arg("coveredPoints"), "Add the indices of the points in view at the input time (JDUT1).")
+        .def("Finalize", &AccessIntervalBuilder::Finalize)
+        .def("GetIntervals", &AccessIntervalBuilder::GetIntervals)
+        .def("GetNumPoints", &AccessIntervalBuilder::GetNumPoints)
+        .def("Reset", &AccessIntervalBuilder::Reset)
+        ;
+
+    py::class_<AccessStore>(m, "AccessStore", R"pbdoc(Queryable store of access intervals, with per-point and time indices. Times are JDUT1.)pbdoc")
+        .def(py::init())
+        .def(py::init<const std::vector<AccessInterval>&, Integer>(), py::arg("accesses"), py::arg("numPts") = -1)
+        .def("Build", &AccessStore::Build, py::arg("accesses"), py::arg("numPts") = -1)
+        .def("GetPointAccesses", &AccessStore::GetPointAccesses, py::arg("pointIndex"), py::arg("t1"), py::arg("t2"))
+        .def("GetSatellitesSeeingPoint", &AccessStore::GetSatellitesSeeingPoint, py::arg("pointIndex"), py::arg("t1"), py::arg("t2"))
+        .def("GetAccessesDuring", &AccessStore::GetAccessesDuring, py::arg("t1"), py::arg("t2"))
+        .def("GetPointsCoveredDuring", &AccessStore::GetPointsCoveredDuring, py::arg("t1"), py::arg("t2"))
+        .def("GetNumPoints", &AccessStore::GetNumPoints)
+        .def("GetNumAccesses", &AccessStore::GetNumAccesses)
+        .def("GetAccesses", &AccessStore::GetAccesses)
+        .def("Save", &AccessStore::Save, py::arg("filename"))
+        .def_static("Load", &AccessStore::Load, py::arg("filename"))
+        ;
+
+    py::class_<ScheduledObservation>(m, "ScheduledObservation")
+        .def_readonly("satIndex", &ScheduledObservation::satIndex)
+        .def_readonly("pointIndex", &ScheduledObservation::pointIndex)
+        .def_readonly("optionIndex", &ScheduledObservation::optionIndex)
+        .def_readonly("startTime", &ScheduledObservation::startTime)
+        .def_readonly("stopTime", &ScheduledObservation::stopTime)
+        .def_readonly("priority", &ScheduledObservation::priority)
+        .def_readonly("opportunityIndex", &ScheduledObservation::opportunityIndex)
+        .def("__repr__",
+              [](const ScheduledObservation &x){
+                  std::string r("ScheduledObservation(");
+                  r += std::to_string(x.satIndex) + "," + std::to_string(x.pointIndex) + "," + std::to_string(x.optionIndex) + "," +
+                       std::to_string(x.startTime) + "," + std::to_string(x.stopTime) + "," + std::to_string(x.priority);
+                  r += ")";
+                  return r;
+              }
+            )
+        ;
+
+    py::class_<ObservationScheduler>(m, "ObservationScheduler", R"pbdoc(Greedy-plus-local-repair observation scheduler over access opportunities.)pbdoc")
+        .def(py::init())
+        .def("AddOpportunity", &ObservationScheduler::AddOpportunity, py::arg("acc"))
+        .def("AddOpportunities", py::overload_cast<const std::vector<AccessInterval>&>(&ObservationScheduler::AddOpportunities), py::arg("accs"))
+        .def("AddOpportunities", py::overload_cast<const IntegerArray&, const IntegerArray&, const IntegerArray&, const RealArray&, const RealArray&>(&ObservationScheduler::AddOpportunities),
+                py::arg("satIndices"), py::arg("pointIndices"), py::arg("optionIndices"), py::arg("startTimes"), py::arg("stopTimes"))
+        .def("GetNumOpportunities", &ObservationScheduler::GetNumOpportunities)
+        .def("ClearOpportunities", &ObservationScheduler::ClearOpportunities)
+        .def("SetTargetPriority", &ObservationScheduler::SetTargetPriority, py::arg("pointIndex"), py::arg("priority"))
+        .def("GetTargetPriority", &ObservationScheduler::GetTargetPriority, py::arg("pointIndex"))
+        .def("SetDefaultPriority", &ObservationScheduler::SetDefaultPriority, py::arg("priority"))
+        .def("AddPointingOption", &ObservationScheduler::AddPointingOption, py::arg("coneAngle"), py::arg("clockAngle"), "Add a pointing option given by the cone, clock angles (radians) in the nadir frame.")
+        .def("SetSlewModel", &ObservationScheduler::SetSlewModel, py::arg("slewRate"), py::arg("settleTime"), "Slew rate in rad/s (0 for instantaneous slews), settle time in seconds.")
+        .def("GetSlewTime", &ObservationScheduler::GetSlewTime, py::arg("fromOption"), py::arg("toOption"))
+        .def("SetObservationDuration", &ObservationScheduler::SetObservationDuration, py::arg("duration"), "Observation duration in seconds.")
+        .def("SetMaxRepairPasses", &ObservationScheduler::SetMaxRepairPasses, py::arg("passes"))
+        .def("Schedule", &ObservationScheduler::Schedule)
+        .def("GetPlan", &ObservationScheduler::GetPlan)
+        .def("GetTotalPriority", &ObservationScheduler::GetTotalPriority)
+        .def("GetNumRepairs", &ObservationScheduler::GetNumRepairs)
+        ;
+
 
     
 
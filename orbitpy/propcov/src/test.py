@@ -24,4 +24,13 @@ print(pg.GetNumPoints())
 lats = [1,2,3]
 lons = [1,2,3]
 pg.GetLatLonVectors(lats=lats, lons=lons)
-print(lats, lons)
\ No newline at end of file
+print(lats, lons)
+
+# pickling keeps the coverage checker settings
+import pickle
+cc = p.CoverageChecker(pg, sc)
+cc.SetUseFovLookupTable(True, 64, 96)
+cc2 = pickle.loads(pickle.dumps(cc))
+assert cc2.GetUseFovLookupTable()
+assert cc2.GetFovTableConeCells() == 64 and cc2.GetFovTableClockCells() == 96
+assert cc2.GetSinglePrecision() == cc.GetSinglePrecision()
@@ -0,0 +1,356 @@
+/**
+ * End-to-end coverage benchmark: standard scenarios (grids, constellation, sensors, step sizes) run through
+ * CoverageRunner, with the throughput (point-steps per second), the peak memory and the per-stage breakdown of
+ * the Profiler written as JSON.
+ *
+ * Usage: CoverageBenchmark.out [--list] [--scenario name[,name...]] [--scale s] [--threads n]
+ *                              [--output file.json] [--baseline file.json] [--tolerance t]
+ *
+ * The peak memory is reported as the peak of the memory accounted by the Profiler during the scenario
+ * (accountedPeakBytes) and as the maximum resident set size of the process so far (maxRssBytes, which only grows
+ * from one scenario to the next; run a scenario alone for its own value).
+ *
+ * --scale multiplies the simulated durations (e.g. 0.1 for a quick run). With --baseline, the results are compared
+ * to those of a previous run (same scale): the run fails (exit code 1) if the throughput of a scenario dropped by
+ * more than the tolerance (default 0.2) or if its coverage result (number of covered point-steps) changed.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+
+#include "Profiler.hpp"   // the heap allocations are counted (linked with support-cpp/AllocationCounter.cpp)
+#include "AbsoluteDate.hpp"
+#include "OrbitState.hpp"
+#include "Spacecraft.hpp"
+#include "CoverageRunner.hpp"
+#include "CoverageSink.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "polygon/DSPIPCustomSensor.hpp"
+#include "NadirPointingAttitude.hpp"
+#include "LagrangeInterpolator.hpp"
+#include "PointGroup.hpp"
+#include "Rvector.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+static const Real START_JD = 2458265.0;
+
+enum SensorType { NO_SENSOR, CONICAL, RECTANGULAR, DSPIP };
+
+struct Scenario
+{
+    std::string name;
+    std::string description;
+    Real        gridAngle;     // angle between the grid points (deg)
+    bool        regional;      // grid restricted to a region (contiguous US)
+    SensorType  sensor;
+    Integer     numSats;       // satellites of a Walker constellation (1: a single satellite)
+    Real        stepSize;      // s
+    Real        duration;      // s, multiplied by the scale
+    bool        singlePrecision = false;  // single precision feasibility test
+};
+
+static const Scenario SCENARIOS[] = {
+    {"single_1deg",      "1 satellite, 1 deg global grid, conical sensor, 60 s steps",  1.0, false, CONICAL,     1,   60.0, 86400.0},
+    {"single_0.1deg",    "1 satellite, 0.1 deg global grid, conical sensor, 60 s steps", 0.1, false, CONICAL,     1,   60.0, 3600.0},
+    {"single_0.1deg_f32", "single_0.1deg with the single precision feasibility test",   0.1, false, CONICAL,     1,   60.0, 3600.0, true},
+    {"walker_100",       "100-satellite Walker constellation, 1 deg global grid",       1.0, false, CONICAL,     100, 60.0, 3600.0},
+    {"regional_0.1deg",  "1 satellite, 0.1 deg regional grid, conical sensor",           0.1, true,  CONICAL,     1,   60.0, 86400.0},
+    {"sensor_conical",   "1 satellite, 1 deg global grid, conical sensor",               1.0, false, CONICAL,     1,   60.0, 43200.0},
+    {"sensor_rectangular", "1 satellite, 1 deg global grid, rectangular sensor",         1.0, false, RECTANGULAR, 1,   60.0, 43200.0},
+    {"sensor_dspip",     "1 satellite, 1 deg global grid, DSPIP custom (polygon) sensor", 1.0, false, DSPIP,      1,   60.0, 43200.0},
+    {"step_1s",          "1 satellite, 1 deg global grid, conical sensor, 1 s steps",    1.0, false, CONICAL,     1,   1.0,  3600.0},
+    {"step_60s",         "1 satellite, 1 deg global grid, conical sensor, 60 s steps",   1.0, false, CONICAL,     1,   60.0, 216000.0},
+};
+
+/// Sink counting the covered point-steps
+class CountingSink : public CoverageSink
+{
+public:
+    CountingSink() : numCovered(0) {}
+    void ProcessStep(Integer stepIndex, Real jd, const IntegerArray &coveredPoints) override{
+        numCovered += coveredPoints.size();
+    }
+    CoverageSink* CreatePartial() const override{
+        return new CountingSink();
+    }
+    void MergePartial(const CoverageSink &partial) override{
+        numCovered += ((const CountingSink&) partial).numCovered;
+    }
+    long long numCovered;
+};
+
+/// Result of a scenario
+struct Result
+{
+    std::string name;
+    Integer     numSats;
+    Integer     numPoints;
+    Integer     numSteps;
+    long long   pointSteps;
+    long long   coveredPointSteps;
+    Real        seconds;
+    Real        pointStepsPerSecond;
+    long long   accountedPeakBytes;
+    long long   maxRssBytes;
+    std::string stages;
+    std::string counters;
+};
+
+static Sensor* CreateSensor(SensorType type){
+    switch (type){
+        case CONICAL:
+            return new ConicalSensor(30.0*PI/180);
+        case RECTANGULAR:
+            return new RectangularSensor(10.0*PI/180, 30.0*PI/180);
+        case DSPIP:{
+            // 30 deg x 10 deg rectangle as a polygon
+            Real cone = 15.79322415135941*PI/180;
+            Rvector cones(5, cone, cone, cone, cone, cone);
+            Rvector clocks(5, 71.98186515628623*PI/180, 108.01813484371377*PI/180, 251.98186515628623*PI/180,
+                           288.01813484371377*PI/180, 71.98186515628623*PI/180);
+            return new DSPIPCustomSensor(cones, clocks, AnglePair{0, 0});
+        }
+        default:
+            return NULL;
+    }
+}
+
+static long long MaxRssBytes(){
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    return usage.ru_maxrss * 1024LL;
+#endif
+}
+
+static Result RunScenario(const Scenario &sc, Real scale, Integer numThreads){
+    Profiler::Disable();
+    Profiler::Reset();
+    Result res;
+    res.name    = sc.name;
+    res.numSats = sc.numSats;
+
+    PointGroup pg;
+    if (sc.regional)
+        pg.SetLatLonBounds(50.0*PI/180, 25.0*PI/180, -65.0*PI/180, -125.0*PI/180);
+    pg.AddHelicalPointsByAngle(sc.gridAngle*PI/180);
+    res.numPoints = pg.GetNumPoints();
+
+    Sensor *sensor = CreateSensor(sc.sensor);
+    NadirPointingAttitude attitude;
+    Real duration = sc.duration*scale/86400.0;
+    res.numSteps  = CoverageRunner::GetNumSteps(START_JD, duration, sc.stepSize);
+    CountingSink sink;
+
+    // Walker delta constellation 53 deg: planes of 10 satellites (phasing 1), or a sun-synchronous satellite
+    Integer numPlanes = (sc.numSats >= 10) ? sc.numSats/10 : 1;
+    Integer perPlane  = sc.numSats/numPlanes;
+    Real    inc       = (sc.numSats > 1) ? 53.0*PI/180 : 98.0*PI/180;
+    Real    sma       = (sc.numSats > 1) ? 6928.0 : 7078.0;
+
+    Profiler::Enable();
+    long long start = Profiler::Now();
+    for (Integer ss = 0; ss < sc.numSats; ss++){
+        Integer plane = ss/perPlane, slot = ss % perPlane;
+        AbsoluteDate date;
+        date.SetJulianDate(START_JD);
+        OrbitState state;
+        state.SetKeplerianState(sma, 0.001, inc, 2*PI*plane/numPlanes, 0.0,
+                                2*PI*slot/perPlane + 2*PI*plane/sc.numSats);
+        LagrangeInterpolator interp("PropcovCppLagrangeInterpolator", 6, 7);
+        Spacecraft sat(&date, &state, &attitude, &interp);
+        if (sensor)
+            sat.AddSensor(sensor);
+        CoverageRunner runner(&pg, &sat);
+        runner.SetNumThreads(numThreads);
+        runner.SetSinglePrecision(sc.singlePrecision);
+        runner.Run(sink, START_JD, duration, sc.stepSize);
+    }
+    res.seconds = (Profiler::Now() - start)*1e-9;
+    Profiler::Disable();
+
+    res.pointSteps          = (long long) res.numPoints*res.numSteps*res.numSats;
+    res.coveredPointSteps   = sink.numCovered;
+    res.pointStepsPerSecond = res.pointSteps/res.seconds;
+    res.accountedPeakBytes  = Profiler::GetTotalPeakMemory();
+    res.maxRssBytes         = MaxRssBytes();
+
+    std::ostringstream stages, counters;
+    stages.precision(9);
+    for (int ii = 0; ii < Profiler::NUM_STAGES; ii++){
+        Profiler::Stage stage = (Profiler::Stage) ii;
+        stages << (ii ? ", " : "") << "\"" << Profiler::GetStageName(stage) << "\": {\"calls\": "
+               << Profiler::GetStageCalls(stage) << ", \"seconds\": " << Profiler::GetStageTime(stage)
+               << ", \"allocations\": " << Profiler::GetStageAllocations(stage) << "}";
+    }
+    for (int ii = 0; ii < Profiler::NUM_COUNTERS; ii++){
+        Profiler::Counter counter = (Profiler::Counter) ii;
+        counters << (ii ? ", " : "") << "\"" << Profiler::GetCounterName(counter) << "\": "
+                 << Profiler::GetCounter(counter);
+    }
+    res.stages   = stages.str();
+    res.counters = counters.str();
+    delete sensor;
+    return res;
+}
+
+/// Write the results as JSON, one scenario per line
+static void WriteJson(std::ostream &out, const std::vector<Result> &results, Real scale, Integer numThreads){
+    out.precision(9);
+    out << "{\"benchmark\": \"propcov-coverage\", \"version\": 1, \"scale\": " << scale
+        << ", \"threads\": " << numThreads << ", \"scenarios\": [\n";
+    for (size_t ii = 0; ii < results.size(); ii++){
+        const Result &r = results[ii];
+        out << "{\"name\": \"" << r.name << "\", \"satellites\": " << r.numSats << ", \"points\": " << r.numPoints
+            << ", \"steps\": " << r.numSteps << ", \"pointSteps\": " << r.pointSteps
+            << ", \"coveredPointSteps\": " << r.coveredPointSteps << ", \"seconds\": " << r.seconds
+            << ", \"pointStepsPerSecond\": " << r.pointStepsPerSecond
+            << ", \"accountedPeakBytes\": " << r.accountedPeakBytes << ", \"maxRssBytes\": " << r.maxRssBytes
+            << ", \"stages\": {" << r.stages << "}, \"counters\": {" << r.counters << "}}"
+            << (ii + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]}\n";
+}
+
+/// Get the number following "key": in a line of the JSON output (NaN if absent)
+static double GetNumber(const std::string &line, const std::string &key){
+    size_t pos = line.find("\"" + key + "\": ");
+    if (pos == std::string::npos)
+        return std::nan("");
+    return std::strtod(line.c_str() + pos + key.size() + 4, NULL);
+}
+
+/// Read the scenario lines of a JSON output: name -> (point-steps per second, covered point-steps)
+static std::map<std::string, std::pair<double, double>> ReadBaseline(const std::string &filename){
+    std::map<std::string, std::pair<double, double>> baseline;
+    std::ifstream in(filename);
+    if (!in)
+        throw std::runtime_error("cannot open the baseline " + filename);
+    std::string line, prefix = "{\"name\": \"";
+    while (std::getline(in, line)){
+        if (line.compare(0, prefix.size(), prefix) != 0)
+            continue;
+        std::string name = line.substr(prefix.size(), line.find('"', prefix.size()) - prefix.size());
+        baseline[name] = std::make_pair(GetNumber(line, "pointStepsPerSecond"),
+                                        GetNumber(line, "coveredPointSteps"));
+    }
+    return baseline;
+}
+
+/// Compare the results to the baseline; return the number of regressions
+static int CompareToBaseline(const std::vector<Result> &results, const std::string &filename, Real tolerance){
+    std::map<std::string, std::pair<double, double>> baseline = ReadBaseline(filename);
+    int numRegressions = 0;
+    std::fprintf(stderr, "%-20s %16s %16s %9s  %s\n", "Scenario", "Baseline (pt/s)", "Current (pt/s)",
+                 "Change", "Status");
+    for (const Result &r : results){
+        if (baseline.find(r.name) == baseline.end()){
+            std::fprintf(stderr, "%-20s %16s %16.4g %9s  %s\n", r.name.c_str(), "-", r.pointStepsPerSecond, "-",
+                         "NEW");
+            continue;
+        }
+        double base   = baseline[r.name].first;
+        double change = r.pointStepsPerSecond/base - 1.0;
+        const char *status = "OK";
+        if (baseline[r.name].second != (double) r.coveredPointSteps)
+            status = "RESULT CHANGED";
+        else if (change < -tolerance)
+            status = "REGRESSION";
+        if (std::strcmp(status, "OK") != 0)
+            numRegressions++;
+        std::fprintf(stderr, "%-20s %16.4g %16.4g %+8.1f%%  %s\n", r.name.c_str(), base, r.pointStepsPerSecond,
+                     100*change, status);
+    }
+    return numRegressions;
+}
+
+int main(int argc, char **argv){
+    std::vector<std::string> selected;
+    std::string output, baselineFile;
+    Real scale = 1.0, tolerance = 0.2;
+    Integer numThreads = 1;
+    for (int ii = 1; ii < argc; ii++){
+        std::string arg = argv[ii];
+        bool hasValue = (ii + 1 < argc);
+        if (arg == "--list"){
+            for (const Scenario &sc : SCENARIOS)
+                std::printf("%-20s %s\n", sc.name.c_str(), sc.description.c_str());
+            return 0;
+        }
+        else if (arg == "--scenario" && hasValue){
+            std::stringstream names(argv[++ii]);
+            std::string name;
+            while (std::getline(names, name, ','))
+                selected.push_back(name);
+        }
+        else if (arg == "--scale" && hasValue)
+            scale = std::atof(argv[++ii]);
+        else if (arg == "--threads" && hasValue)
+            numThreads = std::atoi(argv[++ii]);
+        else if (arg == "--output" && hasValue)
+            output = argv[++ii];
+        else if (arg == "--baseline" && hasValue)
+            baselineFile = argv[++ii];
+        else if (arg == "--tolerance" && hasValue)
+            tolerance = std::atof(argv[++ii]);
+        else{
+            std::fprintf(stderr, "Usage: %s [--list] [--scenario name[,name...]] [--scale s] [--threads n] "
+                         "[--output file.json] [--baseline file.json] [--tolerance t]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (scale <= 0.0 || tolerance < 0.0){
+        std::fprintf(stderr, "The scale must be positive and the tolerance non-negative\n");
+        return 2;
+    }
+
+    std::vector<Result> results;
+    for (const Scenario &sc : SCENARIOS){
+        bool run = selected.empty();
+        for (const std::string &name : selected)
+            run = run || (name == sc.name);
+        if (!run)
+            continue;
+        std::fprintf(stderr, "Running %s ...\n", sc.name.c_str());
+        results.push_back(RunScenario(sc, scale, numThreads));
+        std::fprintf(stderr, "   %.4g point-steps/s (%.3f s)\n", results.back().pointStepsPerSecond,
+                     results.back().seconds);
+    }
+    if (results.empty()){
+        std::fprintf(stderr, "No scenario selected (see --list)\n");
+        return 2;
+    }
+
+    if (output.empty())
+        WriteJson(std::cout, results, scale, numThreads);
+    else{
+        std::ofstream out(output);
+        WriteJson(out, results, scale, numThreads);
+    }
+
+    if (!baselineFile.empty()){
+        try{
+            if (CompareToBaseline(results, baselineFile, tolerance) > 0)
+                return 1;
+        }
+        catch (const std::exception &ex){
+            std::fprintf(stderr, "%s\n", ex.what());
+            return 2;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * Counting replacement of the global operator new/delete, for the allocation counts of the Profiler class.
+ *
+ * The library does not replace the global allocation functions; a test or benchmark executable which wants the
+ * heap allocations counted is linked with this source (see COUNTING_EXES in the Makefile). Every allocation,
+ * aligned or not, then increments the allocation count of the calling thread, and the allocations made within the
+ * timed scopes of the Profiler are added to their stage (while the profiler is enabled).
+ */
+
+#include <cstdlib>
+#include <new>
+
+#include "Profiler.hpp"
+
+namespace
+{
+    // Allocate (and count) size bytes; NULL on failure
+    void* CountedMalloc(std::size_t size)
+    {
+        Profiler::CountAllocation();
+        return std::malloc(size > 0 ? size : 1);
+    }
+
+    // Allocate (and count) size bytes aligned to alignment; NULL on failure
+    void* CountedAlignedMalloc(std::size_t size, std::align_val_t alignment)
+    {
+        Profiler::CountAllocation();
+        std::size_t align = static_cast<std::size_t>(alignment);
+        // aligned_alloc requires a size multiple of the alignment
+        std::size_t rounded = (size > 0 ? size + align - 1 : align) / align * align;
+        return std::aligned_alloc(align, rounded);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    void *ptr = CountedMalloc(size);
+    if (ptr == NULL)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    void *ptr = CountedMalloc(size);
+    if (ptr == NULL)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedMalloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedMalloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    void *ptr = CountedAlignedMalloc(size, alignment);
+    if (ptr == NULL)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    void *ptr = CountedAlignedMalloc(size, alignment);
+    if (ptr == NULL)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return CountedAlignedMalloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return CountedAlignedMalloc(size, alignment);
+}
+
+// All the blocks come from malloc or aligned_alloc: free releases every form.
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+/// Tell the profiler that the allocations are counted
+static const bool ALLOCATIONS_COUNTED = (Profiler::SetCountingAllocations(true), true);
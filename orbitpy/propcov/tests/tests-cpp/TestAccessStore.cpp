@@ -0,0 +1,142 @@
+/** Tests for the AccessStore class. */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <set>
+
+#include "AccessStore.hpp"
+#include "TATCException.hpp"
+
+// Random intervals for 50 points, 5 satellites
+std::vector<AccessInterval> RandomAccesses(int num, unsigned seed){
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> ptDist(0, 49);
+    std::uniform_int_distribution<int> satDist(0, 4);
+    std::uniform_real_distribution<double> startDist(0.0, 10.0);
+    std::uniform_real_distribution<double> lenDist(0.0, 0.2);
+    std::vector<AccessInterval> acc;
+    for (int i = 0; i < num; i++){
+        double s = 2459000.0 + startDist(gen);
+        acc.push_back({satDist(gen), ptDist(gen), 0, s, s + lenDist(gen)});
+    }
+    return acc;
+}
+
+TEST(AccessStoreTest, PointQueriesMatchBruteForce){
+    std::vector<AccessInterval> acc = RandomAccesses(5000, 3);
+    AccessStore store(acc, 60);
+    EXPECT_EQ(store.GetNumPoints(), 60);
+    EXPECT_EQ(store.GetNumAccesses(), 5000);
+
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> tDist(2459000.0, 2459010.0);
+    for (int q = 0; q < 300; q++){
+        int p = q % 60;
+        double t1 = tDist(gen);
+        double t2 = t1 + 0.5;
+        std::set<int> expectedSats;
+        int expectedCount = 0;
+        for (size_t i = 0; i < acc.size(); i++)
+            if (acc[i].pointIndex == p && acc[i].startTime <= t2 && acc[i].stopTime >= t1){
+                expectedSats.insert(acc[i].satIndex);
+                expectedCount++;
+            }
+        EXPECT_EQ((int) store.GetPointAccesses(p, t1, t2).size(), expectedCount);
+        IntegerArray sats = store.GetSatellitesSeeingPoint(p, t1, t2);
+        EXPECT_EQ(sats, IntegerArray(expectedSats.begin(), expectedSats.end()));
+    }
+}
+
+TEST(AccessStoreTest, WindowQueriesMatchBruteForce){
+    std::vector<AccessInterval> acc = RandomAccesses(5000, 5);
+    AccessStore store(acc);
+    std::mt19937 gen(13);
+    std::uniform_real_distribution<double> tDist(2459000.0, 2459010.0);
+    for (int q = 0; q < 100; q++){
+        double t1 = tDist(gen);
+        double t2 = t1 + 0.01;
+        std::set<int> expected;
+        int expectedCount = 0;
+        for (size_t i = 0; i < acc.size(); i++)
+            if (acc[i].startTime <= t2 && acc[i].stopTime >= t1){
+                expected.insert(acc[i].pointIndex);
+                expectedCount++;
+            }
+        EXPECT_EQ(store.GetPointsCoveredDuring(t1, t2), IntegerArray(expected.begin(), expected.end()));
+        EXPECT_EQ((int) store.GetAccessesDuring(t1, t2).size(), expectedCount);
+    }
+}
+
+TEST(AccessStoreTest, SaveAndLoad){
+    std::vector<AccessInterval> acc = RandomAccesses(1000, 7);
+    AccessStore store(acc, 50);
+    std::string filename = "TestAccessStore.pcas";
+    store.Save(filename);
+    AccessStore loaded = AccessStore::Load(filename);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(loaded.GetNumPoints(), store.GetNumPoints());
+    ASSERT_EQ(loaded.GetNumAccesses(), store.GetNumAccesses());
+    for (int i = 0; i < store.GetNumAccesses(); i++){
+        EXPECT_EQ(loaded.GetAccesses()[i].satIndex, store.GetAccesses()[i].satIndex);
+        EXPECT_EQ(loaded.GetAccesses()[i].pointIndex, store.GetAccesses()[i].pointIndex);
+        EXPECT_DOUBLE_EQ(loaded.GetAccesses()[i].startTime, store.GetAccesses()[i].startTime);
+        EXPECT_DOUBLE_EQ(loaded.GetAccesses()[i].stopTime, store.GetAccesses()[i].stopTime);
+    }
+    EXPECT_EQ(loaded.GetPointsCoveredDuring(2459001.0, 2459002.0), store.GetPointsCoveredDuring(2459001.0, 2459002.0));
+    EXPECT_EQ(loaded.GetSatellitesSeeingPoint(3, 2459000.0, 2459010.0), store.GetSatellitesSeeingPoint(3, 2459000.0, 2459010.0));
+}
+
+TEST(AccessStoreTest, InvalidInputThrows){
+    std::vector<AccessInterval> acc = {{0, 4, 0, 1.0, 2.0}};
+    EXPECT_THROW(AccessStore(acc, 3), TATCException);
+    AccessStore store(acc);
+    EXPECT_THROW(store.GetPointAccesses(5, 0.0, 1.0), TATCException);
+    EXPECT_THROW(AccessStore::Load("does_not_exist.pcas"), TATCException);
+}
+
+// Overwrite a value at a byte offset of a file
+template <typename T>
+void PatchFile(const std::string &filename, std::streamoff pos, T value){
+    std::fstream f(filename.c_str(), std::ios::in | std::ios::out | std::ios::binary);
+    f.seekp(pos);
+    f.write((const char*) &value, sizeof(T));
+}
+
+// Header: magic, version, number of points (4 bytes each), number of records (8 bytes), then the point offsets.
+TEST(AccessStoreTest, CorruptFileThrows){
+    std::vector<AccessInterval> acc = RandomAccesses(200, 11);
+    AccessStore store(acc, 50);
+    std::string filename = "TestAccessStoreCorrupt.pcas";
+
+    // number of records beyond the file size
+    store.Save(filename);
+    PatchFile(filename, 12, (int64_t) 1 << 40);
+    EXPECT_THROW(AccessStore::Load(filename), TATCException);
+
+    // number of points beyond the file size
+    store.Save(filename);
+    PatchFile(filename, 8, (int32_t) 0x7fffffff);
+    EXPECT_THROW(AccessStore::Load(filename), TATCException);
+
+    // intermediate offsets out of range or decreasing
+    store.Save(filename);
+    PatchFile(filename, 20 + 4, (int32_t) 1000000);
+    EXPECT_THROW(AccessStore::Load(filename), TATCException);
+    store.Save(filename);
+    PatchFile(filename, 20 + 4, (int32_t) -5);
+    EXPECT_THROW(AccessStore::Load(filename), TATCException);
+
+    store.Save(filename);
+    EXPECT_EQ(AccessStore::Load(filename).GetNumAccesses(), 200);
+    std::remove(filename.c_str());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+/** Tests for the BatchConversions class: the results agree with the one-element conversions. */
+
+#include <gtest/gtest.h>
+#include <random>
+
+#include "BatchConversions.hpp"
+#include "Earth.hpp"
+#include "OrbitState.hpp"
+#include "AbsoluteDate.hpp"
+#include "BodyFixedStateConverter.hpp"
+#include "TATCException.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class BatchConversionsTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            std::mt19937 gen(5);
+            std::uniform_real_distribution<double> u(0.0, 1.0);
+            for (int i = 0; i < N; i++){
+                // elliptic orbits, including circular and equatorial ones
+                double ecc = (i % 7 == 0) ? 0.0 : 0.3*u(gen);
+                double inc = (i % 11 == 0) ? 0.0 : ((i % 13 == 0) ? PI : PI*u(gen));
+                double kepl[6] = {6800.0 + 30000.0*u(gen), ecc, inc, 2*PI*u(gen), 2*PI*u(gen), 2*PI*u(gen)};
+                OrbitState state;
+                state.SetKeplerianState(kepl[0], kepl[1], kepl[2], kepl[3], kepl[4], kepl[5]);
+                Rvector6 cart = state.GetCartesianState();
+                for (int k = 0; k < 6; k++){
+                    keplerian.push_back(kepl[k]);
+                    cartesian.push_back(cart[k]);
+                }
+                jds.push_back(2451545.0 + 20000.0*u(gen));
+            }
+        }
+        static const int N = 1000;
+        RealArray keplerian, cartesian, jds;
+};
+
+TEST_F(BatchConversionsTest, FrameTransforms){
+    RealArray fixed(6*N), inertial(6*N);
+    BatchConversions::InertialToBodyFixed(jds.data(), cartesian.data(), N, fixed.data());
+    BatchConversions::BodyFixedToInertial(jds.data(), fixed.data(), N, inertial.data());
+    Earth earth;
+    for (int i = 0; i < N; i++){
+        Rvector6 in(&cartesian[6*i]);
+        Rvector6 expected = earth.GetBodyFixedState(in, jds[i]);
+        for (int k = 0; k < 6; k++){
+            EXPECT_NEAR(fixed[6*i + k], expected[k], 1e-12*std::max(1.0, fabs(expected[k])));
+            EXPECT_NEAR(inertial[6*i + k], cartesian[6*i + k], 1e-12*std::max(1.0, fabs(cartesian[6*i + k])));
+        }
+    }
+}
+
+TEST_F(BatchConversionsTest, KeplerianCartesian){
+    RealArray cart(6*N), kepl(6*N);
+    BatchConversions::KeplerianToCartesian(keplerian.data(), N, cart.data());
+    BatchConversions::CartesianToKeplerian(cartesian.data(), N, kepl.data());
+    for (int i = 0; i < N; i++){
+        OrbitState state;
+        state.SetCartesianState(Rvector6(&cartesian[6*i]));
+        Rvector6 expected = state.GetKeplerianState();
+        for (int k = 0; k < 6; k++){
+            EXPECT_NEAR(cart[6*i + k], cartesian[6*i + k], 1e-9*std::max(1.0, fabs(cartesian[6*i + k])));
+            // the angles may be 0 or 2 pi
+            double diff = fabs(kepl[6*i + k] - expected[k]);
+            if (k >= 2) diff = std::min(diff, fabs(diff - 2*PI));
+            EXPECT_LT(diff, 1e-9*std::max(1.0, fabs(expected[k]))) << "state " << i << ", element " << k;
+        }
+    }
+    // a zero position has no Keplerian elements
+    RealArray bad(cartesian.begin(), cartesian.begin() + 12);
+    bad[6] = bad[7] = bad[8] = 0.0;
+    EXPECT_THROW(BatchConversions::CartesianToKeplerian(bad.data(), 2, kepl.data()), TATCException);
+}
+
+TEST_F(BatchConversionsTest, Geodetic){
+    RealArray pos(3*N), geo(3*N), back(3*N);
+    for (int i = 0; i < N; i++)
+        for (int k = 0; k < 3; k++)
+            pos[3*i + k] = cartesian[6*i + k];
+    pos[0] = 0.0; pos[1] = 0.0; pos[2] = 7000.0;   // pole
+    BatchConversions::CartesianToGeodetic(pos.data(), N, geo.data());
+    BatchConversions::GeodeticToCartesian(geo.data(), N, back.data());
+    Earth earth;
+    for (int i = 0; i < N; i++){
+        Rvector3 p(pos[3*i], pos[3*i + 1], pos[3*i + 2]);
+        Rvector3 expected = earth.Convert(p, "Cartesian", "Ellipsoid");
+        EXPECT_NEAR(geo[3*i], expected[0], 1e-12);
+        EXPECT_NEAR(geo[3*i + 1], expected[1], 1e-12);
+        EXPECT_NEAR(geo[3*i + 2], expected[2], 1e-8);
+        for (int k = 0; k < 3; k++)
+            EXPECT_NEAR(back[3*i + k], pos[3*i + k], 1e-8);
+    }
+
+    RealArray gcLat(N), gdLat(N);
+    for (int i = 0; i < N; i++)
+        gcLat[i] = -PI/2 + PI*i/(N - 1);
+    BatchConversions::GeocentricToGeodeticLat(gcLat.data(), N, gdLat.data());
+    for (int i = 0; i < N; i++)
+        EXPECT_NEAR(gdLat[i], earth.GeocentricToGeodeticLat(gcLat[i]), 1e-12);
+}
+
+TEST_F(BatchConversionsTest, Dates){
+    RealArray greg(6*N), back(N);
+    BatchConversions::JulianToGregorian(jds.data(), N, greg.data());
+    BatchConversions::GregorianToJulian(greg.data(), N, back.data());
+    for (int i = 0; i < N; i++){
+        AbsoluteDate date;
+        date.SetJulianDate(jds[i]);
+        Rvector6 expected = date.GetGregorianDate();
+        for (int k = 0; k < 6; k++)
+            EXPECT_EQ(greg[6*i + k], expected[k]);
+        EXPECT_NEAR(back[i], jds[i], 1e-8);
+    }
+    greg[1] = 13;
+    EXPECT_THROW(BatchConversions::GregorianToJulian(greg.data(), N, back.data()), TATCException);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
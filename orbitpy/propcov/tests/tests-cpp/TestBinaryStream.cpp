@@ -0,0 +1,170 @@
+/** Tests for the BinaryWriter/BinaryReader classes and the serialization of the propcov objects. */
+
+#include <gtest/gtest.h>
+
+#include "BinaryStream.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "DSPIPCustomSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+// Serialize an object and return the bytes
+template <typename T>
+std::string ToBytes(const T &obj){
+    BinaryWriter out;
+    obj.Serialize(out);
+    return out.GetBuffer();
+}
+
+TEST(BinaryStreamTest, RoundTripOfValues){
+    BinaryWriter out;
+    out.WriteHeader("Test", 2);
+    out.WriteInt(-7);
+    out.WriteReal(0.1);
+    out.WriteBool(true);
+    out.WriteString("abc");
+    out.WriteIntArray({1, 2, 3});
+    out.WriteRealArray({});
+    out.WriteRvector3(Rvector3(1.0, 2.0, 3.0));
+    Rmatrix33 m(1, 2, 3, 4, 5, 6, 7, 8, 9);
+    out.WriteRmatrix33(m);
+
+    BinaryReader in(out.GetBuffer());
+    EXPECT_EQ(in.ReadHeader("Test", 3), 2);
+    EXPECT_EQ(in.ReadInt(), -7);
+    EXPECT_EQ(in.ReadReal(), 0.1);
+    EXPECT_TRUE(in.ReadBool());
+    EXPECT_EQ(in.ReadString(), "abc");
+    EXPECT_EQ(in.ReadIntArray(), IntegerArray({1, 2, 3}));
+    EXPECT_TRUE(in.ReadRealArray().empty());
+    EXPECT_TRUE(in.ReadRvector3() == Rvector3(1.0, 2.0, 3.0));
+    EXPECT_TRUE(in.ReadRmatrix33() == m);
+    EXPECT_TRUE(in.AtEnd());
+    EXPECT_THROW(in.ReadInt(), TATCException);
+}
+
+TEST(BinaryStreamTest, BadDataThrows){
+    BinaryWriter out;
+    out.WriteHeader("Test", 2);
+    out.WriteInt(1000);     // array count larger than the data
+    std::string data = out.GetBuffer();
+    {
+        BinaryReader in(data);
+        EXPECT_THROW(in.ReadHeader("Other", 2), TATCException);
+    }
+    {
+        BinaryReader in(data);
+        EXPECT_THROW(in.ReadHeader("Test", 1), TATCException);
+    }
+    {
+        BinaryReader in(data);
+        in.ReadHeader("Test", 2);
+        EXPECT_THROW(in.ReadRealArray(), TATCException);
+    }
+    std::string truncated = ToBytes(ConicalSensor(0.5)).substr(0, 20);
+    BinaryReader in(truncated);
+    EXPECT_THROW(ConicalSensor sensor(in), TATCException);
+}
+
+TEST(BinaryStreamTest, PointGroup){
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(500);
+    std::string data = ToBytes(pg);
+    BinaryReader in(data);
+    PointGroup copy(in);
+    EXPECT_TRUE(in.AtEnd());
+    ASSERT_EQ(copy.GetNumPoints(), 500);
+    for (Integer ii = 0; ii < 500; ii++)
+        EXPECT_TRUE(*copy.GetPointPositionVector(ii) == *pg.GetPointPositionVector(ii));
+    EXPECT_EQ(ToBytes(copy), data);
+}
+
+TEST(BinaryStreamTest, Sensors){
+    ConicalSensor conical(0.4);
+    conical.SetSensorBodyOffsetAngles(0.1, 0.2, 0.3, 1, 2, 3);
+    RectangularSensor rectangular(0.2, 0.3);
+    Rvector cone(4, 0.3, 0.3, 0.3, 0.3);
+    Rvector clock(4, 0.0, PI/2, PI, 3*PI/2);
+    DSPIPCustomSensor custom(cone, clock, AnglePair({0.0, 0.0}));
+    Sensor *sensors[] = {&conical, &rectangular, &custom};
+
+    for (Sensor *sensor : sensors){
+        std::string data = ToBytes(*sensor);
+        BinaryReader in(data);
+        Sensor *copy;
+        if (sensor == &conical) copy = new ConicalSensor(in);
+        else if (sensor == &rectangular) copy = new RectangularSensor(in);
+        else copy = new DSPIPCustomSensor(in);
+        EXPECT_TRUE(in.AtEnd());
+        EXPECT_EQ(ToBytes(*copy), data);
+        EXPECT_TRUE(copy->GetBodyToSensorMatrix(0.0) == sensor->GetBodyToSensorMatrix(0.0));
+        for (Real cone = 0.0; cone < 0.6; cone += 0.05)
+            for (Real clock = 0.0; clock < 2*PI; clock += 0.3)
+                EXPECT_EQ(copy->CheckTargetVisibility(cone, clock), sensor->CheckTargetVisibility(cone, clock));
+        delete copy;
+    }
+    // the wrong class is rejected
+    std::string data = ToBytes(conical);
+    BinaryReader in(data);
+    EXPECT_THROW(RectangularSensor sensor(in), TATCException);
+}
+
+// The restored spacecraft, propagator and coverage checker continue exactly as the originals,
+// including the interpolation of the buffered states.
+TEST(BinaryStreamTest, SpacecraftAndPropagator){
+    ConicalSensor sensor(0.5);
+    TestSpacecraft craft;
+    Spacecraft *sat = craft.sat;
+    sat->SetBodyNadirOffsetAngles(0.0, 0.0, 0.1, 1, 2, 3);
+    sat->AddSensor(&sensor);
+    Propagator prop(sat);
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(5000);
+    AbsoluteDate t;
+    for (int k = 0; k < 10; k++){
+        t.SetJulianDate(2458265.0 + k*60.0/86400);
+        prop.Propagate(t);
+    }
+
+    std::string satData = ToBytes(*sat);
+    std::string propData = ToBytes(prop);
+    BinaryReader satIn(satData), propIn(propData);
+    Spacecraft sat2(satIn);
+    sat2.AddSensor(&sensor);
+    Propagator prop2(&sat2, propIn);
+    EXPECT_TRUE(satIn.AtEnd());
+    EXPECT_TRUE(propIn.AtEnd());
+    EXPECT_EQ(ToBytes(sat2), satData);
+    EXPECT_EQ(ToBytes(prop2), propData);
+    EXPECT_EQ(sat2.GetNumSensors(), 1);
+
+    Real mid = 2458265.0 + 4.5*60.0/86400;
+    ASSERT_TRUE(sat2.CanInterpolate(mid));
+    EXPECT_TRUE(sat2.Interpolate(mid) == sat->Interpolate(mid));
+
+    CoverageChecker checker(&pg, sat), checker2(&pg, &sat2);
+    for (int k = 10; k < 20; k++){
+        t.SetJulianDate(2458265.0 + k*60.0/86400);
+        EXPECT_TRUE(prop2.Propagate(t) == prop.Propagate(t));
+        EXPECT_EQ(checker2.CheckPointCoverage(), checker.CheckPointCoverage());
+    }
+    EXPECT_THROW(sat->GetSensor(1), TATCException);
+
+    // a truncated spacecraft throws (the components read so far are deleted)
+    for (size_t len = 0; len < satData.size(); len += 13){
+        std::string data = satData.substr(0, len);
+        BinaryReader truncated(data);
+        EXPECT_THROW(Spacecraft sat3(truncated), TATCException) << len;
+    }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,153 @@
+/** Tests for the CompiledScenario and ScenarioEvaluator classes: the evaluators give the results of a propagated
+ *  spacecraft and its coverage checker, the snapshot does not follow later changes of its inputs, and a scenario
+ *  shared by several threads gives the sequential results. */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "CompiledScenario.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "GMATCustomSensor.hpp"
+#include "polygon/DSPIPCustomSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class CompiledScenarioTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            pg.AddHelicalPointsByNumPoints(5000);
+        }
+        // Coverage of the steps with a propagator and coverage checker on the spacecraft
+        std::vector<IntegerArray> Expected(Spacecraft *sat, int numSteps){
+            Spacecraft copy(*sat);
+            Propagator prop(&copy);
+            CoverageChecker cc(&pg, &copy);
+            AbsoluteDate t;
+            std::vector<IntegerArray> result;
+            for (int k = 0; k < numSteps; k++){
+                t.SetJulianDate(2458265.0 + k*60.0/86400);
+                prop.Propagate(t);
+                result.push_back(cc.CheckPointCoverage());
+            }
+            return result;
+        }
+        PointGroup pg;
+};
+
+// Each sensor type, with and without spacecraft attitude offset, gives the results of the propagated spacecraft.
+TEST_F(CompiledScenarioTest, SameResultsAsSpacecraft){
+    Rvector cones(5, 0.3, 0.3, 0.3, 0.3, 0.3);
+    Rvector clocks(5, 1.25, 1.89, 4.39, 5.03, 1.25);
+    ConicalSensor conical(30.0*PI/180);
+    RectangularSensor rectangular(15.0*PI/180, 25.0*PI/180);
+    DSPIPCustomSensor dspip(cones, clocks, AnglePair{0, 0});
+    GMATCustomSensor gmatCustom(cones, clocks);
+    rectangular.SetSensorBodyOffsetAngles(0.0, 5.0, 0.0);
+    Sensor *sensors[] = {&conical, &rectangular, &dspip, &gmatCustom};
+    Real offsets[][3] = {{0.0, 0.0, 0.0}, {5.0, -3.0, 8.0}};
+    for (Sensor *sensor : sensors){
+        for (auto &offset : offsets){
+            TestSpacecraft craft;
+            Spacecraft &sat = *craft.sat;
+            sat.SetBodyNadirOffsetAngles(offset[0], offset[1], offset[2]);
+            sat.AddSensor(sensor);
+            std::vector<IntegerArray> expected = Expected(&sat, 30);
+
+            CompiledScenario scenario(&pg, &sat);
+            EXPECT_EQ(scenario.GetNumPoints(), 5000);
+            EXPECT_EQ(scenario.GetNumSensors(), 1);
+            EXPECT_EQ(scenario.GetEpoch(), 2458265.0);
+            EXPECT_EQ(scenario.GetNadirToBodyMatrix(), sat.GetNadirToBodyMatrix());
+            ScenarioEvaluator evaluator(&scenario);
+            EXPECT_EQ(evaluator.GetScenario(), &scenario);
+            Spacecraft copy(sat);
+            Propagator prop(&copy);
+            AbsoluteDate t;
+            Integer total = 0;
+            for (int k = 0; k < 30; k++){
+                Real jd = 2458265.0 + k*60.0/86400;
+                t.SetJulianDate(jd);
+                prop.Propagate(t);
+                EXPECT_EQ(evaluator.GetCartesianState(jd), copy.GetCartesianState()) << "step " << k;
+                EXPECT_EQ(evaluator.CheckPointCoverage(jd), expected[k]) << "step " << k;
+                total += expected[k].size();
+            }
+            EXPECT_GT(total, 0);
+        }
+    }
+}
+
+// Changes of the input points, spacecraft and sensors after the compilation do not affect the scenario.
+TEST_F(CompiledScenarioTest, SnapshotIsIndependentOfInputs){
+    ConicalSensor sensor(30.0*PI/180);
+    TestSpacecraft craft;
+    Spacecraft &sat = *craft.sat;
+    sat.AddSensor(&sensor);
+    std::vector<IntegerArray> expected = Expected(&sat, 20);
+    CompiledScenario scenario(&pg, &sat);
+    Rvector6 elements = scenario.GetOrbitalElements(2458265.01);
+
+    sensor.SetFieldOfView(5.0*PI/180);
+    sat.SetBodyNadirOffsetAngles(10.0, 0.0, 0.0, 1, 2, 3);
+    Propagator prop(&sat);
+    AbsoluteDate t;
+    t.SetJulianDate(2458266.0);
+    prop.Propagate(t);
+    pg.AddUserDefinedPoints(RealArray(1, 0.0), RealArray(1, 0.0));
+
+    EXPECT_EQ(scenario.GetNumPoints(), 5000);
+    EXPECT_EQ(scenario.GetEpoch(), 2458265.0);
+    EXPECT_EQ(scenario.GetOrbitalElements(2458265.01), elements);
+    ScenarioEvaluator evaluator(&scenario);
+    for (int k = 0; k < 20; k++)
+        EXPECT_EQ(evaluator.CheckPointCoverage(2458265.0 + k*60.0/86400), expected[k]) << "step " << k;
+
+    EXPECT_THROW(CompiledScenario(NULL, &sat), TATCException);
+    EXPECT_THROW(ScenarioEvaluator(NULL), TATCException);
+}
+
+// Threads sharing a scenario, each with its own evaluator, give the sequential results.
+TEST_F(CompiledScenarioTest, SharedByThreads){
+    RectangularSensor sensor(15.0*PI/180, 25.0*PI/180);
+    TestSpacecraft craft;
+    Spacecraft &sat = *craft.sat;
+    sat.SetBodyNadirOffsetAngles(5.0, -3.0, 8.0);
+    sat.AddSensor(&sensor);
+    const int numSteps = 200, numThreads = 4;
+    CompiledScenario scenario(&pg, &sat);
+    std::vector<IntegerArray> expected;
+    ScenarioEvaluator sequential(&scenario);
+    for (int k = 0; k < numSteps; k++)
+        expected.push_back(sequential.CheckPointCoverage(2458265.0 + k*60.0/86400));
+
+    std::vector<std::vector<IntegerArray>> results(numThreads, std::vector<IntegerArray>(numSteps));
+    std::vector<std::thread> threads;
+    for (int tt = 0; tt < numThreads; tt++){
+        threads.push_back(std::thread([&scenario, &results, tt](){
+            ScenarioEvaluator evaluator(&scenario);
+            evaluator.SetSinglePrecision(tt % 2 == 1);
+            IntegerArray covered;
+            for (int k = 0; k < numSteps; k++){
+                Real jd = 2458265.0 + k*60.0/86400;
+                evaluator.CheckPointCoverageInto(jd, evaluator.GetCartesianState(jd), covered);
+                results[tt][k] = covered;
+            }
+        }));
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+    for (int tt = 0; tt < numThreads; tt++)
+        EXPECT_EQ(results[tt], expected) << "thread " << tt;
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
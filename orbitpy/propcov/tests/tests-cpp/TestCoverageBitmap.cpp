@@ -0,0 +1,105 @@
+/** Tests for the CoverageBitmap class. */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+
+#include "CoverageBitmap.hpp"
+#include "CoverageChecker.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+IntegerArray ToArray(const std::set<int> &s){
+    return IntegerArray(s.begin(), s.end());
+}
+
+// Random set of `num` indices in [0, maxIdx)
+std::set<int> RandomSet(std::mt19937 &gen, int num, int maxIdx){
+    std::uniform_int_distribution<int> dist(0, maxIdx - 1);
+    std::set<int> s;
+    for (int i = 0; i < num; i++)
+        s.insert(dist(gen));
+    return s;
+}
+
+TEST(CoverageBitmapTest, AddRemoveContains){
+    CoverageBitmap bm;
+    EXPECT_TRUE(bm.IsEmpty());
+    bm.Add(5); bm.Add(70000); bm.Add(3); bm.Add(5);
+    EXPECT_EQ(bm.GetCardinality(), 3);
+    EXPECT_EQ(bm.GetNumContainers(), 2);
+    EXPECT_TRUE(bm.Contains(3));
+    EXPECT_TRUE(bm.Contains(70000));
+    EXPECT_FALSE(bm.Contains(4));
+    EXPECT_FALSE(bm.Contains(-1));
+    EXPECT_EQ(bm.ToIndices(), IntegerArray({3, 5, 70000}));
+    bm.Remove(70000);
+    EXPECT_EQ(bm.GetNumContainers(), 1);
+    EXPECT_EQ(bm.ToIndices(), IntegerArray({3, 5}));
+    EXPECT_THROW(bm.Add(-2), TATCException);
+}
+
+TEST(CoverageBitmapTest, DenseChunksUseBitmapContainers){
+    CoverageBitmap bm;
+    for (int i = 0; i < 60000; i++)
+        bm.Add(i);
+    EXPECT_EQ(bm.GetCardinality(), 60000);
+    EXPECT_EQ(bm.GetNumBitmapContainers(), 1);
+    // removing most of the indices converts the container back to an array
+    for (int i = 100; i < 60000; i++)
+        bm.Remove(i);
+    EXPECT_EQ(bm.GetCardinality(), 100);
+    EXPECT_EQ(bm.GetNumBitmapContainers(), 0);
+    EXPECT_TRUE(bm.Contains(99));
+    EXPECT_FALSE(bm.Contains(100));
+}
+
+// Compare the set operations against std::set for sparse, dense and mixed inputs.
+TEST(CoverageBitmapTest, SetOperationsMatchStdSet){
+    std::mt19937 gen(11);
+    int sizes[][2] = {{100, 200}, {20000, 50}, {50000, 40000}, {3000, 3000}};
+    for (auto &sz : sizes){
+        std::set<int> a = RandomSet(gen, sz[0], 200000);
+        std::set<int> b = RandomSet(gen, sz[1], 200000);
+        CoverageBitmap ba(ToArray(a)), bb(ToArray(b));
+        EXPECT_EQ(ba.GetCardinality(), (int) a.size());
+
+        std::set<int> u(a), i, d;
+        u.insert(b.begin(), b.end());
+        for (int x : a){
+            if (b.count(x)) i.insert(x); else d.insert(x);
+        }
+        EXPECT_EQ(ba.Union(bb).ToIndices(), ToArray(u));
+        EXPECT_EQ(ba.Intersection(bb).ToIndices(), ToArray(i));
+        EXPECT_EQ(ba.Difference(bb).ToIndices(), ToArray(d));
+        EXPECT_EQ(ba.IntersectionCardinality(bb), (int) i.size());
+        EXPECT_EQ(ba.UnionCardinality(bb), (int) u.size());
+        EXPECT_TRUE(ba.Union(bb) == CoverageBitmap(ToArray(u)));
+
+        CoverageBitmap acc(ba);
+        acc.UnionWith(bb);
+        EXPECT_EQ(acc.ToIndices(), ToArray(u));
+        EXPECT_TRUE(acc != ba || b.empty());
+    }
+}
+
+// The bitmap result of the CoverageChecker matches the index array result.
+TEST(CoverageBitmapTest, CoverageCheckerBitmapMatchesIndices){
+    TestSpacecraft craft;
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(20000);
+
+    CoverageChecker checker(&pg, craft.sat);
+    IntegerArray indices = checker.CheckPointCoverage();
+    CoverageBitmap bitmap = checker.CheckPointCoverageBitmap();
+    EXPECT_GT(indices.size(), 0);
+    EXPECT_EQ(bitmap.ToIndices(), indices);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
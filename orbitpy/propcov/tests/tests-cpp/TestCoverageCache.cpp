@@ -0,0 +1,182 @@
+/** Tests for the CoverageCache class: a repeated run is a hit with the results of the computation, the key does
+ *  not depend on the rounding noise of equivalent inputs, and the least recently used entries are evicted. */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <thread>
+#include <unistd.h>
+
+#include "CoverageCache.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "PointGroup.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class CoverageCacheTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            dir = "/tmp/TestCoverageCache_" + std::to_string(getpid());
+            std::filesystem::remove_all(dir);
+            pg.AddHelicalPointsByNumPoints(2000);
+        }
+        void TearDown() override{
+            std::filesystem::remove_all(dir);
+        }
+        std::string dir;
+        TestSpacecraft craft;
+        Spacecraft &sat = *craft.sat;
+        PointGroup pg;
+};
+
+static void ExpectSameResults(const CoverageResults &a, const CoverageResults &b){
+    EXPECT_EQ(a.numPoints, b.numPoints);
+    EXPECT_EQ(a.numSteps, b.numSteps);
+    EXPECT_EQ(a.startJd, b.startJd);
+    EXPECT_EQ(a.stepSize, b.stepSize);
+    ASSERT_EQ(a.intervals.size(), b.intervals.size());
+    for (size_t i = 0; i < a.intervals.size(); i++){
+        EXPECT_EQ(a.intervals[i].pointIndex, b.intervals[i].pointIndex);
+        EXPECT_EQ(a.intervals[i].startTime, b.intervals[i].startTime);
+        EXPECT_EQ(a.intervals[i].stopTime, b.intervals[i].stopTime);
+    }
+    EXPECT_EQ(a.numAccesses, b.numAccesses);
+    EXPECT_EQ(a.dwellTimes, b.dwellTimes);
+    EXPECT_EQ(a.maxGaps, b.maxGaps);
+}
+
+// The first run is computed and stored, the second is read from the cache (also by another cache object).
+TEST_F(CoverageCacheTest, RepeatedRunIsHit){
+    ConicalSensor sensor(30.0*PI/180);
+    sat.AddSensor(&sensor);
+    CoverageResults expected = CoverageCache::Compute(&pg, &sat, 2458265.0, 0.1, 60.0);
+
+    CoverageCache cache(dir);
+    ExpectSameResults(cache.Run(&pg, &sat, 2458265.0, 0.1, 60.0), expected);
+    EXPECT_EQ(cache.GetNumMisses(), 1);
+    EXPECT_EQ(cache.GetNumEntries(), 1);
+    EXPECT_GT(cache.GetTotalBytes(), 0);
+    ExpectSameResults(cache.Run(&pg, &sat, 2458265.0, 0.1, 60.0), expected);
+    EXPECT_EQ(cache.GetNumHits(), 1);
+    CoverageCache other(dir);
+    CoverageResults results;
+    EXPECT_TRUE(other.Lookup(&pg, &sat, 2458265.0, 0.1, 60.0, results));
+    ExpectSameResults(results, expected);
+
+    // the statistics are those of the intervals
+    EXPECT_GT(expected.intervals.size(), 0);
+    IntegerArray counts(expected.numPoints, 0);
+    RealArray dwell(expected.numPoints, 0.0), gaps(expected.numPoints, 0.0), lastStop(expected.numPoints, -1.0);
+    std::vector<AccessInterval> byStart = expected.intervals;
+    std::sort(byStart.begin(), byStart.end(),
+              [](const AccessInterval &a, const AccessInterval &b){ return a.startTime < b.startTime; });
+    for (const AccessInterval &acc : byStart){
+        Integer p = acc.pointIndex;
+        counts[p]++;
+        dwell[p] += std::round((acc.stopTime - acc.startTime)*86400/60.0 + 1)*60.0;
+        if (lastStop[p] >= 0)
+            gaps[p] = std::max(gaps[p], std::round((acc.startTime - lastStop[p])*86400/60.0 - 1)*60.0);
+        lastStop[p] = acc.stopTime;
+    }
+    EXPECT_EQ(expected.numAccesses, counts);
+    EXPECT_EQ(expected.dwellTimes, dwell);
+    EXPECT_EQ(expected.maxGaps, gaps);
+
+    // a different run is a miss; Clear deletes the entries
+    EXPECT_FALSE(cache.Lookup(&pg, &sat, 2458265.0, 0.1, 30.0, results));
+    cache.Clear();
+    EXPECT_EQ(cache.GetNumEntries(), 0);
+    EXPECT_FALSE(cache.Lookup(&pg, &sat, 2458265.0, 0.1, 60.0, results));
+}
+
+// Equivalent inputs computed differently get the same key; different inputs get different keys.
+TEST_F(CoverageCacheTest, KeyIgnoresRoundingNoise){
+    ConicalSensor sensor(30.0*PI/180), noisySensor(PI/6);
+    sat.AddSensor(&sensor);
+    std::string key = CoverageCache::GetKey(&pg, &sat, 2458265.0, 0.1, 60.0);
+    EXPECT_EQ(key.size(), 32);
+
+    // the same orbit, sensor, grid and times up to rounding noise
+    OrbitState noisyState;
+    noisyState.SetKeplerianState(7078.0 + 1e-11, 0.001, (98.0/180)*PI, (10.0/180)*PI, 0.0, PI/6);
+    AbsoluteDate noisyDate;
+    noisyDate.SetJulianDate(2458264.5 + 0.5);
+    Spacecraft noisy(&noisyDate, &noisyState, &craft.attitude, &craft.interp);
+    noisy.AddSensor(&noisySensor);
+    RealArray lats, lons;
+    pg.GetLatLonVectors(lats, lons);
+    for (size_t i = 0; i < lats.size(); i++){
+        lats[i] = (lats[i]*(180/PI))*(PI/180);
+        lons[i] = lons[i] + 1e-15;
+    }
+    PointGroup noisyPg;
+    noisyPg.AddUserDefinedPoints(lats, lons);
+    EXPECT_EQ(CoverageCache::GetKey(&noisyPg, &noisy, 2458265.0 + 1e-10, 0.1*(1 + 1e-14), 60.0), key);
+
+    // different inputs
+    EXPECT_NE(CoverageCache::GetKey(&pg, &sat, 2458265.0, 0.1, 30.0), key);
+    EXPECT_NE(CoverageCache::GetKey(&pg, &sat, 2458265.0 + 1.0/86400, 0.1, 60.0), key);
+    EXPECT_NE(CoverageCache::GetKey(&pg, &sat, 2458265.0, 0.2, 60.0), key);
+    sensor.SetFieldOfView(31.0*PI/180);
+    EXPECT_NE(CoverageCache::GetKey(&pg, &sat, 2458265.0, 0.1, 60.0), key);
+    sensor.SetFieldOfView(30.0*PI/180);
+    sensor.SetSensorBodyOffsetAngles(0.0, 5.0, 0.0);
+    EXPECT_NE(CoverageCache::GetKey(&pg, &sat, 2458265.0, 0.1, 60.0), key);
+    sensor.SetSensorBodyOffsetAngles(0.0, 0.0, 0.0);
+    EXPECT_EQ(CoverageCache::GetKey(&pg, &sat, 2458265.0, 0.1, 60.0), key);
+    sat.SetBodyNadirOffsetAngles(1.0, 0.0, 0.0);
+    EXPECT_NE(CoverageCache::GetKey(&pg, &sat, 2458265.0, 0.1, 60.0), key);
+    sat.SetBodyNadirOffsetAngles(0.0, 0.0, 0.0);
+    RectangularSensor rectangular(30.0*PI/180, 30.0*PI/180);
+    Spacecraft rectSat(&craft.date, &craft.state, &craft.attitude, &craft.interp);
+    rectSat.AddSensor(&rectangular);
+    EXPECT_NE(CoverageCache::GetKey(&pg, &rectSat, 2458265.0, 0.1, 60.0), key);
+    lats[0] += 1e-6;
+    PointGroup otherPg;
+    otherPg.AddUserDefinedPoints(lats, lons);
+    EXPECT_NE(CoverageCache::GetKey(&otherPg, &sat, 2458265.0, 0.1, 60.0), key);
+
+    // a sensor of another type is not cached
+    HalfConicalSensor half(30.0*PI/180);
+    Spacecraft halfSat(&craft.date, &craft.state, &craft.attitude, &craft.interp);
+    halfSat.AddSensor(&half);
+    EXPECT_EQ(CoverageCache::GetKey(&pg, &halfSat, 2458265.0, 0.1, 60.0), "");
+    CoverageCache cache(dir);
+    ExpectSameResults(cache.Run(&pg, &halfSat, 2458265.0, 0.05, 60.0),
+                      CoverageCache::Compute(&pg, &halfSat, 2458265.0, 0.05, 60.0));
+    EXPECT_EQ(cache.GetNumEntries(), 0);
+}
+
+// Beyond the size limit the least recently used entries are deleted.
+TEST_F(CoverageCacheTest, EvictsLeastRecentlyUsed){
+    ConicalSensor sensor(30.0*PI/180);
+    sat.AddSensor(&sensor);
+    CoverageCache cache(dir);
+    CoverageResults results;
+    cache.Run(&pg, &sat, 2458265.0, 0.05, 60.0);
+    long long entryBytes = cache.GetTotalBytes();
+    cache.SetMaxBytes(entryBytes*5/2);
+    EXPECT_EQ(cache.GetMaxBytes(), entryBytes*5/2);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    cache.Run(&pg, &sat, 2458265.1, 0.05, 60.0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    // the first run becomes the most recently used
+    EXPECT_TRUE(cache.Lookup(&pg, &sat, 2458265.0, 0.05, 60.0, results));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    cache.Run(&pg, &sat, 2458265.2, 0.05, 60.0);
+    EXPECT_EQ(cache.GetNumEvictions(), 1);
+    EXPECT_EQ(cache.GetNumEntries(), 2);
+    EXPECT_LE(cache.GetTotalBytes(), cache.GetMaxBytes());
+    EXPECT_TRUE(cache.Lookup(&pg, &sat, 2458265.0, 0.05, 60.0, results));
+    EXPECT_TRUE(cache.Lookup(&pg, &sat, 2458265.2, 0.05, 60.0, results));
+    EXPECT_FALSE(cache.Lookup(&pg, &sat, 2458265.1, 0.05, 60.0, results));
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
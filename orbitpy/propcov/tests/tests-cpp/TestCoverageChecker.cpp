@@ -0,0 +1,173 @@
+/** Tests for the CoverageChecker class: the single precision feasibility mode gives the double precision results,
+ *  and the specialized field-of-view kernels the results of Spacecraft::CheckTargetVisibility. */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "Profiler.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "GMATCustomSensor.hpp"
+#include "polygon/DSPIPCustomSensor.hpp"
+#include "PointGroup.hpp"
+#include "Earth.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class CoverageCheckerTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            Profiler::Disable();
+            Profiler::Reset();
+        }
+        void TearDown() override{
+            Profiler::Disable();
+            Profiler::Reset();
+        }
+        // Propagate an orbit and compare the double and single precision coverage at each step
+        void CompareOrbit(Real sma, Real inc, Sensor *sensor, PointGroup *pg, int numSteps){
+            TestSpacecraft craft(sma, inc);
+            Spacecraft &sat = *craft.sat;
+            if (sensor)
+                sat.AddSensor(sensor);
+            Propagator prop(&sat);
+            CoverageChecker dbl(pg, &sat), sgl(pg, &sat);
+            sgl.SetSinglePrecision(true);
+            EXPECT_TRUE(sgl.GetSinglePrecision());
+            EXPECT_FALSE(dbl.GetSinglePrecision());
+            AbsoluteDate t;
+            Integer total = 0;
+            for (int k = 0; k < numSteps; k++){
+                t.SetJulianDate(2458265.0 + k*60.0/86400);
+                prop.Propagate(t);
+                IntegerArray expected = dbl.CheckPointCoverage();
+                EXPECT_EQ(sgl.CheckPointCoverage(), expected) << "sma " << sma << ", step " << k;
+                total += expected.size();
+            }
+            EXPECT_GT(total, 0);
+        }
+};
+
+TEST_F(CoverageCheckerTest, SinglePrecisionSameAsDouble){
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(20000);
+    ConicalSensor sensor(30.0*PI/180);
+    // without sensor the covered points are the feasible points
+    CompareOrbit(7078.0, 98.0*PI/180, NULL, &pg, 100);
+    CompareOrbit(7078.0, 98.0*PI/180, &sensor, &pg, 100);
+    CompareOrbit(26560.0, 55.0*PI/180, NULL, &pg, 50);
+    CompareOrbit(42164.0, 0.1*PI/180, NULL, &pg, 20);
+}
+
+// Points on the decision boundaries (hemisphere and horizon) are re-checked in double precision.
+TEST_F(CoverageCheckerTest, SinglePrecisionGuardBand){
+    Earth earth;
+    Real radius = earth.GetRadius();
+    Real r = 7000.0;
+    // spacecraft on the x axis: the points at +-90 deg longitude are on the hemisphere boundary and
+    // the points at acos(radius/r) from it on the horizon
+    Real horizon = acos(radius/r);
+    RealArray lats = {0.0, 0.0, 0.0, 0.0, horizon, horizon - 1e-9, horizon + 1e-9, 0.0, 0.0};
+    RealArray lons = {PI/2, -PI/2, 0.0, horizon, 0.0, 0.0, 0.0, horizon - 1e-9, horizon + 1e-9};
+    PointGroup pg;
+    pg.AddUserDefinedPoints(lats, lons);
+    TestSpacecraft craft;
+    craft.state.SetCartesianState(Rvector6(r, 0.0, 0.0, 0.0, 7.5, 0.0));
+    Spacecraft &sat = *craft.sat;
+    CoverageChecker dbl(&pg, &sat), sgl(&pg, &sat);
+    sgl.SetSinglePrecision(true);
+
+    Rvector6 bodyFixed(r, 0.0, 0.0, 0.0, 7.5, 0.0);
+    Profiler::Enable();
+    IntegerArray expected = dbl.CheckPointCoverage(bodyFixed, 2458265.0, bodyFixed);
+    EXPECT_EQ(Profiler::GetCounter(Profiler::PRECISION_FALLBACKS), 0);
+    EXPECT_EQ(sgl.CheckPointCoverage(bodyFixed, 2458265.0, bodyFixed), expected);
+    Profiler::Disable();
+    EXPECT_GE(Profiler::GetCounter(Profiler::PRECISION_FALLBACKS), 6);
+    EXPECT_EQ(expected[0], 2);   // the sub-satellite point
+
+    // the mode can be switched off again, and is copied
+    CoverageChecker copy(sgl);
+    EXPECT_TRUE(copy.GetSinglePrecision());
+    EXPECT_EQ(copy.CheckPointCoverage(bodyFixed, 2458265.0, bodyFixed), expected);
+    sgl.SetSinglePrecision(false);
+    EXPECT_EQ(sgl.CheckPointCoverage(bodyFixed, 2458265.0, bodyFixed), expected);
+}
+
+// Each sensor type, with and without spacecraft attitude offset, gives the results of the spacecraft visibility test.
+TEST_F(CoverageCheckerTest, SpecializedKernelsSameAsSpacecraft){
+    Rvector cones(5, 0.3, 0.3, 0.3, 0.3, 0.3);
+    Rvector clocks(5, 1.25, 1.89, 4.39, 5.03, 1.25);
+    ConicalSensor conical(30.0*PI/180);
+    RectangularSensor rectangular(15.0*PI/180, 25.0*PI/180);
+    DSPIPCustomSensor dspip(cones, clocks, AnglePair{0, 0});
+    GMATCustomSensor gmatCustom(cones, clocks);
+    HalfConicalSensor half(30.0*PI/180);
+    rectangular.SetSensorBodyOffsetAngles(0.0, 5.0, 0.0);
+    Sensor *sensors[] = {&conical, &rectangular, &dspip, &gmatCustom, &half};
+    Real offsets[][3] = {{0.0, 0.0, 0.0}, {5.0, -3.0, 8.0}};
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(10000);
+    Earth earth;
+    Real radius = earth.GetRadius();
+    for (Sensor *sensor : sensors){
+        for (auto &offset : offsets){
+            TestSpacecraft craft;
+            Spacecraft &sat = *craft.sat;
+            sat.SetBodyNadirOffsetAngles(offset[0], offset[1], offset[2]);
+            sat.AddSensor(sensor);
+            Propagator prop(&sat);
+            CoverageChecker cc(&pg, &sat);
+            AbsoluteDate t;
+            Integer total = 0;
+            for (int k = 0; k < 20; k++){
+                Real jd = 2458265.0 + k*60.0/86400;
+                t.SetJulianDate(jd);
+                prop.Propagate(t);
+                Rvector6 cart = sat.GetCartesianState();
+                Rvector6 bodyFixed = earth.GetBodyFixedState(cart, jd);
+                Rvector3 scPos = bodyFixed.GetR();
+                IntegerArray expected;
+                for (Integer i = 0; i < pg.GetNumPoints(); i++){
+                    Rvector3 unitPos = pg.GetPointPositionVector(i)->GetUnitVector();
+                    if (unitPos * scPos.GetUnitVector() <= 0.0 || (scPos/radius - unitPos) * unitPos <= 0.0)
+                        continue;
+                    if (sat.CheckTargetVisibility(bodyFixed, unitPos*radius - scPos, jd, 0))
+                        expected.push_back(i);
+                }
+                EXPECT_EQ(cc.CheckPointCoverage(bodyFixed, jd, cart), expected) << "step " << k;
+                IntegerArray all(pg.GetNumPoints());
+                for (Integer i = 0; i < pg.GetNumPoints(); i++)
+                    all[i] = i;
+                EXPECT_EQ(cc.CheckPointCoverage(bodyFixed, jd, cart, all), expected) << "step " << k;
+                EXPECT_EQ(cc.CheckPointCoverageBitmap(bodyFixed, jd, cart).ToIndices(), expected) << "step " << k;
+                total += expected.size();
+            }
+            EXPECT_GT(total, 0);
+        }
+    }
+}
+
+// Point indices out of range are rejected before any point is tested.
+TEST_F(CoverageCheckerTest, PointIndicesOutOfRange){
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(100);
+    TestSpacecraft craft;
+    CoverageChecker cc(&pg, craft.sat);
+    Rvector6 bodyFixed(7078.0, 0.0, 0.0, 0.0, 7.5, 0.0);
+    EXPECT_THROW(cc.CheckPointCoverage(IntegerArray{0, 100}), TATCException);
+    EXPECT_THROW(cc.CheckPointCoverage(bodyFixed, 2458265.0, bodyFixed, IntegerArray{-1}), TATCException);
+    EXPECT_TRUE(cc.CheckPointCoverage(bodyFixed, 2458265.0, bodyFixed, IntegerArray{}).empty());
+    IntegerArray covered = cc.CheckPointCoverage(bodyFixed, 2458265.0, bodyFixed, IntegerArray{0, 50, 99});
+    for (Integer idx : covered)
+        EXPECT_TRUE(idx == 0 || idx == 50 || idx == 99);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
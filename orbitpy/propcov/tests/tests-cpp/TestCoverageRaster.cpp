@@ -0,0 +1,170 @@
+/** Tests for the CoverageRaster and CoverageRunner classes. */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "CoverageRaster.hpp"
+#include "CoverageRunner.hpp"
+#include "ConicalSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class CoverageRasterTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            sat->AddSensor(&sensor);
+            pg->AddHelicalPointsByNumPoints(2000);
+        }
+        ConicalSensor sensor{30.0*PI/180};
+        TestSpacecraft craft{6878.0, 51.6*PI/180};
+        Spacecraft *sat = craft.sat;
+        PointGroup grid;
+        PointGroup *pg = &grid;
+};
+
+TEST(CoverageRasterStatsTest, AccessesDwellAndGaps){
+    PointGroup pg;
+    pg.AddUserDefinedPoints({0.1*PI/180, 0.2*PI/180, 45.5*PI/180}, {0.1*PI/180, 0.3*PI/180, 100.5*PI/180});
+    CoverageRaster raster(&pg, 1.0);
+    EXPECT_EQ(raster.GetNumRows(), 180);
+    EXPECT_EQ(raster.GetNumColumns(), 360);
+    EXPECT_EQ(raster.GetCellIndex(0), raster.GetCellIndex(1));
+    Integer cell = raster.GetCellIndex(0);
+    EXPECT_EQ(cell, 90*360 + 180);
+    EXPECT_EQ(raster.GetNumPointsPerCell()[cell], 2);
+
+    raster.BeginRun(3, 0.0, 10.0, 12);
+    // cell 0: steps 1-2 (both points at step 2), 6, 9-10 => 3 accesses, 5 steps, max gap 3 steps
+    int steps0[] = {1, 2, 6, 9, 10};
+    for (int s = 0; s < 12; s++){
+        IntegerArray covered;
+        for (int k : steps0) if (k == s) covered.push_back(0);
+        if (s == 2) covered.push_back(1);
+        if (s == 4) covered.push_back(2);
+        raster.ProcessStep(s, 0.0, covered);
+    }
+    EXPECT_EQ(raster.GetAccessCounts()[cell], 3);
+    EXPECT_DOUBLE_EQ(raster.GetDwellTimes()[cell], 50.0);
+    EXPECT_DOUBLE_EQ(raster.GetMaxGaps()[cell], 30.0);
+    Integer cell2 = raster.GetCellIndex(2);
+    EXPECT_EQ(raster.GetAccessCounts()[cell2], 1);
+    EXPECT_DOUBLE_EQ(raster.GetMaxGaps()[cell2], 0.0);
+    EXPECT_THROW(raster.ProcessStep(3, 0.0, {0}), TATCException);
+}
+
+// Partial rasters merged in step order give the same statistics as a sequential accumulation,
+// including accesses spanning the boundary between two partials.
+TEST(CoverageRasterStatsTest, MergeOfPartials){
+    PointGroup pg;
+    pg.AddUserDefinedPoints({0.0, 0.5}, {0.0, 0.5});
+    CoverageRaster seq(&pg, 5.0);
+    seq.BeginRun(2, 0.0, 1.0, 20);
+    CoverageSink *p1 = seq.CreatePartial();
+    CoverageSink *p2 = seq.CreatePartial();
+    CoverageSink *p3 = seq.CreatePartial();
+    int pattern0[] = {0,1,1,0,0,0,1,1,1,1,1,0,0,0,0,0,0,1,1,0};
+    int pattern1[] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0};
+    for (int s = 0; s < 20; s++){
+        IntegerArray covered;
+        if (pattern0[s]) covered.push_back(0);
+        if (pattern1[s]) covered.push_back(1);
+        seq.ProcessStep(s, 0.0, covered);
+        (s < 8 ? p1 : (s < 10 ? p2 : p3))->ProcessStep(s, 0.0, covered);
+    }
+    CoverageRaster merged(&pg, 5.0);
+    merged.BeginRun(2, 0.0, 1.0, 20);
+    merged.MergePartial(*p1);
+    merged.MergePartial(*p2);
+    merged.MergePartial(*p3);
+    EXPECT_EQ(merged.GetAccessCounts(), seq.GetAccessCounts());
+    EXPECT_EQ(merged.GetDwellTimes(), seq.GetDwellTimes());
+    EXPECT_EQ(merged.GetMaxGaps(), seq.GetMaxGaps());
+    Integer cell = seq.GetCellIndex(0);
+    EXPECT_EQ(seq.GetAccessCounts()[cell], 3);
+    EXPECT_DOUBLE_EQ(seq.GetMaxGaps()[cell], 6.0);
+    // merging out of order is rejected
+    EXPECT_THROW(merged.MergePartial(*p1), TATCException);
+    delete p1; delete p2; delete p3;
+}
+
+// The raster of a run matches the statistics computed from the recorded per-step coverage,
+// and does not depend on the number of threads.
+TEST_F(CoverageRasterTest, RunMatchesRecordedCoverage){
+    CoverageRunner runner(pg, sat);
+    RecordingSink recorder;
+    Integer numSteps = runner.Run(recorder, 2458265.0, 0.25, 60.0);
+    EXPECT_EQ(numSteps, 360);
+    EXPECT_EQ(CoverageRunner::GetNumSteps(2458265.0, 0.25, 60.0), 360);
+
+    CoverageRaster raster(pg, 10.0);
+    runner.Run(raster, 2458265.0, 0.25, 60.0);
+    Integer numCells = raster.GetNumRows()*raster.GetNumColumns();
+    IntegerArray count(numCells, 0), dwell(numCells, 0), gap(numCells, 0), last(numCells, -1);
+    for (int s = 0; s < numSteps; s++){
+        std::set<int> cells;
+        for (int p : recorder.steps[s]) cells.insert(raster.GetCellIndex(p));
+        for (int c : cells){
+            if (last[c] < 0 || last[c] != s - 1) count[c]++;
+            if (last[c] >= 0) gap[c] = std::max(gap[c], s - last[c] - 1);
+            dwell[c]++;
+            last[c] = s;
+        }
+    }
+    Integer total = 0;
+    for (int c = 0; c < numCells; c++){
+        EXPECT_EQ(raster.GetAccessCounts()[c], count[c]);
+        EXPECT_DOUBLE_EQ(raster.GetDwellTimes()[c], dwell[c]*60.0);
+        EXPECT_DOUBLE_EQ(raster.GetMaxGaps()[c], gap[c]*60.0);
+        total += count[c];
+    }
+    EXPECT_GT(total, 0);
+
+    CoverageRaster threaded(pg, 10.0);
+    runner.SetNumThreads(4);
+    runner.Run(threaded, 2458265.0, 0.25, 60.0);
+    EXPECT_EQ(threaded.GetAccessCounts(), raster.GetAccessCounts());
+    EXPECT_EQ(threaded.GetDwellTimes(), raster.GetDwellTimes());
+    EXPECT_EQ(threaded.GetMaxGaps(), raster.GetMaxGaps());
+    // the input spacecraft is not propagated by the runner
+    EXPECT_DOUBLE_EQ(sat->GetJulianDate(), 2458265.0);
+}
+
+TEST_F(CoverageRasterTest, WriteFlatBinary){
+    CoverageRunner runner(pg, sat);
+    CoverageRaster raster(pg, 30.0);
+    runner.Run(raster, 2458265.0, 0.1, 120.0);
+    std::string fname = "TestCoverageRaster.bin";
+    raster.Write(fname);
+
+    std::ifstream in(fname, std::ios::binary);
+    char magic[4]; int32_t version, dims[2], nSteps; double sizes[2];
+    in.read(magic, 4); in.read((char*) &version, 4); in.read((char*) dims, 8);
+    in.read((char*) sizes, 16); in.read((char*) &nSteps, 4);
+    EXPECT_EQ(std::memcmp(magic, "PCRS", 4), 0);
+    EXPECT_EQ(dims[0], 6);
+    EXPECT_EQ(dims[1], 12);
+    EXPECT_DOUBLE_EQ(sizes[1], 120.0);
+    std::vector<int32_t> npts(72), counts(72);
+    std::vector<double> dwell(72), gaps(72);
+    in.read((char*) npts.data(), 72*4); in.read((char*) counts.data(), 72*4);
+    in.read((char*) dwell.data(), 72*8); in.read((char*) gaps.data(), 72*8);
+    ASSERT_TRUE(in.good());
+    for (int c = 0; c < 72; c++){
+        EXPECT_EQ(npts[c], raster.GetNumPointsPerCell()[c]);
+        EXPECT_EQ(counts[c], raster.GetAccessCounts()[c]);
+        EXPECT_EQ(dwell[c], raster.GetDwellTimes()[c]);
+        EXPECT_EQ(gaps[c], raster.GetMaxGaps()[c]);
+    }
+    in.close();
+    std::remove(fname.c_str());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
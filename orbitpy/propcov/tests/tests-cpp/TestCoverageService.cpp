@@ -0,0 +1,181 @@
+/** Tests for the CoverageService and CoverageClient classes. */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <unistd.h>
+
+#include "CoverageService.hpp"
+#include "CoverageClient.hpp"
+#include "CoverageRunner.hpp"
+#include "CoverageSink.hpp"
+#include "AbsoluteDate.hpp"
+#include "OrbitState.hpp"
+#include "Spacecraft.hpp"
+#include "ConicalSensor.hpp"
+#include "NadirPointingAttitude.hpp"
+#include "LagrangeInterpolator.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class CoverageServiceTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            path = "/tmp/TestCoverageService_" + std::to_string(getpid()) + ".sock";
+            service = new CoverageService(path);
+            service->Start();
+            server = std::thread([this]{ service->Serve(); });
+            PointGroup helical;
+            helical.AddHelicalPointsByNumPoints(1000);
+            helical.GetLatLonVectors(lats, lons);
+        }
+        void TearDown() override{
+            service->Stop();
+            server.join();
+            delete service;
+        }
+        // Coverage of a local CoverageRunner run with a conical sensor
+        RecordingSink LocalRun(const CoverageRequest &req){
+            PointGroup pg;
+            pg.AddUserDefinedPoints(lats, lons);
+            AbsoluteDate date;
+            date.SetJulianDate(req.epoch);
+            OrbitState state;
+            const RealArray &k = req.keplerianState;
+            state.SetKeplerianState(k[0], k[1], k[2], k[3], k[4], k[5]);
+            NadirPointingAttitude attitude;
+            LagrangeInterpolator interp("PropcovCppLagrangeInterpolator", 6, 7);
+            Spacecraft sat(&date, &state, &attitude, &interp);
+            ConicalSensor sensor(req.sensorParams[0]);
+            sat.AddSensor(&sensor);
+            RecordingSink sink;
+            CoverageRunner(&pg, &sat).Run(sink, req.epoch, req.duration, req.stepSize);
+            return sink;
+        }
+        CoverageRequest MakeRequest(Integer gridId, Real raan){
+            CoverageRequest req;
+            req.gridId = gridId;
+            req.sensorType = CoverageProtocol::CONICAL_SENSOR;
+            req.sensorParams = {35.0*PI/180};
+            req.epoch = 2458265.0;
+            req.keplerianState = {7078.0, 0.001, 98.0*PI/180, raan, 0.0, 30.0*PI/180};
+            req.duration = 0.2;
+            req.stepSize = 60.0;
+            return req;
+        }
+        std::string path;
+        CoverageService *service;
+        std::thread server;
+        RealArray lats, lons;
+};
+
+// The results streamed by the service match those of a local run.
+TEST_F(CoverageServiceTest, MatchesLocalRun){
+    CoverageClient client(path);
+    EXPECT_TRUE(client.Ping());
+    CoverageRequest req = MakeRequest(client.RegisterGrid(lats, lons), 10.0*PI/180);
+    RecordingSink remote;
+    EXPECT_EQ(client.RunCoverage(req, remote), 288);
+    RecordingSink local = LocalRun(req);
+    EXPECT_EQ(remote.numPoints, 1000);
+    EXPECT_EQ(remote.numSteps, 288);
+    EXPECT_EQ(remote.numEnd, 1);
+    EXPECT_TRUE(remote.inOrder);
+    EXPECT_EQ(remote.times, local.times);
+    EXPECT_EQ(remote.steps, local.steps);
+}
+
+// Identical grids share an id, and the contexts are reused by the requests with
+// the same grid and sensor (with the orbit of each request).
+TEST_F(CoverageServiceTest, CachesGridsAndContexts){
+    CoverageClient client(path);
+    Integer id = client.RegisterGrid(lats, lons);
+    EXPECT_EQ(client.RegisterGrid(lats, lons), id);
+    RealArray otherLats(lats.begin(), lats.begin() + 10), otherLons(lons.begin(), lons.begin() + 10);
+    EXPECT_NE(client.RegisterGrid(otherLats, otherLons), id);
+    EXPECT_EQ(service->GetNumCachedGrids(), 2);
+
+    for (Real raan : {10.0, 100.0, 10.0}){
+        CoverageRequest req = MakeRequest(id, raan*PI/180);
+        RecordingSink remote;
+        client.RunCoverage(req, remote);
+        EXPECT_EQ(remote.steps, LocalRun(req).steps);
+    }
+    EXPECT_EQ(service->GetNumCachedContexts(), 1);
+
+    // a second connection reuses the context as well
+    CoverageClient other(path);
+    RecordingSink sink;
+    other.RunCoverage(MakeRequest(id, 0.0), sink);
+    EXPECT_EQ(service->GetNumCachedContexts(), 1);
+    CoverageRequest req = MakeRequest(id, 0.0);
+    req.sensorParams = {20.0*PI/180};
+    other.RunCoverage(req, sink);
+    EXPECT_EQ(service->GetNumCachedContexts(), 2);
+}
+
+// Beyond the grid limit the least recently used grid is evicted with its contexts; its id becomes unknown.
+TEST_F(CoverageServiceTest, EvictsLeastRecentlyUsedGrid){
+    EXPECT_EQ(service->GetMaxCachedGrids(), CoverageService::DEFAULT_MAX_GRIDS);
+    EXPECT_THROW(service->SetMaxCachedGrids(0), TATCException);
+    service->SetMaxCachedGrids(2);
+    EXPECT_EQ(service->GetMaxCachedGrids(), 2);
+    CoverageClient client(path);
+    RealArray lats10(lats.begin(), lats.begin() + 10), lons10(lons.begin(), lons.begin() + 10);
+    RealArray lats20(lats.begin(), lats.begin() + 20), lons20(lons.begin(), lons.begin() + 20);
+    Integer full = client.RegisterGrid(lats, lons);
+    Integer first10 = client.RegisterGrid(lats10, lons10);
+    RecordingSink sink;
+    client.RunCoverage(MakeRequest(full, 0.0), sink);   // the full grid is now more recent
+    EXPECT_EQ(service->GetNumCachedContexts(), 1);
+
+    Integer first20 = client.RegisterGrid(lats20, lons20);
+    EXPECT_EQ(service->GetNumCachedGrids(), 2);
+    EXPECT_EQ(service->GetNumEvictedGrids(), 1);
+    EXPECT_THROW(client.RunCoverage(MakeRequest(first10, 0.0), sink), TATCException);
+    EXPECT_EQ(client.RegisterGrid(lats20, lons20), first20);
+    EXPECT_EQ(client.RegisterGrid(lats, lons), full);
+
+    // registering the evicted grid again gives a new id and evicts the grid of 20 points
+    Integer again = client.RegisterGrid(lats10, lons10);
+    EXPECT_NE(again, first10);
+    EXPECT_EQ(service->GetNumEvictedGrids(), 2);
+    EXPECT_EQ(service->GetNumCachedContexts(), 1);
+    EXPECT_THROW(client.RunCoverage(MakeRequest(first20, 0.0), sink), TATCException);
+
+    // the eviction of the full grid deletes its context
+    client.RegisterGrid(lats20, lons20);
+    EXPECT_EQ(service->GetNumCachedGrids(), 2);
+    EXPECT_EQ(service->GetNumEvictedGrids(), 3);
+    EXPECT_EQ(service->GetNumCachedContexts(), 0);
+    client.RunCoverage(MakeRequest(again, 0.0), sink);
+    EXPECT_EQ(sink.numPoints, 10);
+}
+
+// Failed requests are reported as exceptions; the connection stays usable.
+TEST_F(CoverageServiceTest, ErrorReplies){
+    CoverageClient client(path);
+    RecordingSink sink;
+    EXPECT_THROW(client.RunCoverage(MakeRequest(7, 0.0), sink), TATCException);
+    EXPECT_TRUE(client.Ping());
+    CoverageRequest req = MakeRequest(client.RegisterGrid(lats, lons), 0.0);
+    req.sensorParams = {1.0, 2.0};
+    EXPECT_THROW(client.RunCoverage(req, sink), TATCException);
+    EXPECT_THROW(client.RegisterGrid({0.1}, {}), TATCException);
+    EXPECT_TRUE(client.IsConnected());
+    EXPECT_TRUE(client.Ping());
+
+    client.Shutdown();
+    EXPECT_FALSE(client.IsConnected());
+    server.join();
+    EXPECT_FALSE(service->IsRunning());
+    EXPECT_THROW(CoverageClient another(path), TATCException);
+    server = std::thread([]{});
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,112 @@
+/** Tests for the CoverageStream class. */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "CoverageStream.hpp"
+#include "CoverageRunner.hpp"
+#include "CoverageSink.hpp"
+#include "ConicalSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class CoverageStreamTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            sat->AddSensor(&sensor);
+            pg->AddHelicalPointsByNumPoints(5000);
+        }
+        ConicalSensor sensor{30.0*PI/180};
+        TestSpacecraft craft;
+        Spacecraft *sat = craft.sat;
+        PointGroup grid;
+        PointGroup *pg = &grid;
+};
+
+// The chunks hold whole consecutive steps and, concatenated, give the accesses of a CoverageRunner run.
+TEST_F(CoverageStreamTest, ChunksMatchRunner){
+    RecordingSink sink;
+    CoverageRunner runner(pg, sat);
+    Integer numSteps = runner.Run(sink, 2458265.0, 0.2, 60.0);
+
+    CoverageStream stream(pg, sat, 2458265.0, 0.2, 60.0, 200, 2);
+    EXPECT_EQ(stream.GetNumSteps(), numSteps);
+    CoverageStream::Chunk chunk;
+    Integer nextStep = 0, numChunks = 0;
+    IntegerArray steps, points;
+    while (stream.Next(chunk)){
+        EXPECT_EQ(chunk.firstStep, nextStep);
+        EXPECT_GT(chunk.endStep, chunk.firstStep);
+        // only the last step of a chunk brings it to the chunk size
+        if (chunk.endStep < numSteps){
+            EXPECT_GE((Integer) chunk.pointIndices.size(), 200);
+        }
+        for (Integer s : chunk.stepIndices){
+            EXPECT_GE(s, chunk.firstStep);
+            EXPECT_LT(s, chunk.endStep);
+        }
+        EXPECT_TRUE(chunk.ranges.empty());
+        steps.insert(steps.end(), chunk.stepIndices.begin(), chunk.stepIndices.end());
+        points.insert(points.end(), chunk.pointIndices.begin(), chunk.pointIndices.end());
+        nextStep = chunk.endStep;
+        EXPECT_EQ(stream.GetNumStepsDone(), nextStep);
+        numChunks++;
+    }
+    EXPECT_EQ(nextStep, numSteps);
+    EXPECT_GT(numChunks, 3);
+    EXPECT_FALSE(stream.Next(chunk));
+
+    IntegerArray expSteps, expPoints;
+    for (Integer s = 0; s < numSteps; s++){
+        expSteps.insert(expSteps.end(), sink.steps[s].size(), s);
+        expPoints.insert(expPoints.end(), sink.steps[s].begin(), sink.steps[s].end());
+    }
+    EXPECT_EQ(steps, expSteps);
+    EXPECT_EQ(points, expPoints);
+    // the input spacecraft is not propagated
+    EXPECT_DOUBLE_EQ(sat->GetJulianDate(), 2458265.0);
+}
+
+// The range and elevation of the accesses are consistent with the orbit and the sensor.
+TEST_F(CoverageStreamTest, Geometry){
+    CoverageStream stream(pg, sat, 2458265.0, 0.05, 60.0, 1000, 1, true);
+    EXPECT_TRUE(stream.HasGeometry());
+    CoverageStream::Chunk chunk;
+    Integer total = 0;
+    while (stream.Next(chunk)){
+        ASSERT_EQ(chunk.ranges.size(), chunk.pointIndices.size());
+        ASSERT_EQ(chunk.elevations.size(), chunk.pointIndices.size());
+        for (size_t k = 0; k < chunk.ranges.size(); k++){
+            // altitude of ~700 km, 30 deg half-angle: range below ~900 km, elevation above ~55 deg
+            EXPECT_GT(chunk.ranges[k], 690.0);
+            EXPECT_LT(chunk.ranges[k], 900.0);
+            EXPECT_GT(chunk.elevations[k], 55.0*PI/180);
+            EXPECT_LE(chunk.elevations[k], PI/2);
+        }
+        total += chunk.ranges.size();
+    }
+    EXPECT_GT(total, 0);
+}
+
+// Cancelling (or destroying) a stream whose consumer stopped early does not block.
+TEST_F(CoverageStreamTest, Cancel){
+    CoverageStream stream(pg, sat, 2458265.0, 1.0, 10.0, 10, 1);
+    CoverageStream::Chunk chunk;
+    EXPECT_TRUE(stream.Next(chunk));
+    stream.Cancel();
+    EXPECT_FALSE(stream.Next(chunk));
+    EXPECT_LT(stream.GetNumStepsDone(), stream.GetNumSteps());
+    {
+        CoverageStream unused(pg, sat, 2458265.0, 1.0, 10.0, 10, 1);
+        unused.Start();
+    }
+    EXPECT_THROW(CoverageStream(pg, sat, 2458265.0, 1.0, 10.0, 0), TATCException);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,180 @@
+/** Tests for the CoverageWriter class and the step formatters. */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "CoverageWriter.hpp"
+#include "CoverageRunner.hpp"
+#include "ConicalSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+// Formatter writing the step indices slowly (the coverage loop gets ahead of the writer).
+class SlowFormatter : public StepFormatter{
+    public:
+        IntegerArray formatted;
+        Integer failAt = -1;
+        void FormatStep(std::string &buffer, const CoverageStepRecord &step){
+            if (step.stepIndex == failAt)
+                throw TATCException("SlowFormatter: failure\n");
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            formatted.push_back(step.stepIndex);
+            buffer += std::to_string(step.stepIndex) + "\n";
+        }
+};
+
+static std::string ReadFile(const std::string &filename){
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+class CoverageWriterTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            sat->AddSensor(&sensor);
+            pg.AddHelicalPointsByNumPoints(2000);
+        }
+        ConicalSensor sensor{30.0*PI/180};
+        TestSpacecraft craft{6878.0, 51.6*PI/180};
+        Spacecraft *sat = craft.sat;
+        PointGroup pg;
+};
+
+TEST_F(CoverageWriterTest, CsvAndBinaryOutputsInStepOrder){
+    CoverageRunner runner(&pg, sat);
+    RecordingSink expected;
+    Integer numSteps = runner.Run(expected, 2458265.0, 0.1, 60.0);
+
+    // small queue and buffers: the coverage loop waits for the writer, and the files are written in pieces
+    CsvStateFormatter stateFormat;
+    CsvAccessFormatter accessFormat;
+    BinaryStepFormatter binaryFormat;
+    CoverageWriter writer(2, 256);
+    writer.AddOutput("TestCoverageWriter_state.csv", &stateFormat);
+    writer.AddOutput("TestCoverageWriter_access.csv", &accessFormat);
+    writer.AddOutput("TestCoverageWriter_steps.bin", &binaryFormat);
+    EXPECT_EQ(writer.GetNumOutputs(), 3);
+    runner.SetNumThreads(2);   // the writer is sequential: the runner falls back to one thread
+    EXPECT_EQ(runner.Run(writer, 2458265.0, 0.1, 60.0), numSteps);
+    EXPECT_EQ(writer.GetNumStepsWritten(), numSteps);
+
+    // state rows (the reals are written exactly)
+    std::stringstream stateRows(ReadFile("TestCoverageWriter_state.csv"));
+    std::string line;
+    std::getline(stateRows, line);
+    EXPECT_EQ(line, "time index,jd,x [km],y [km],z [km],vx [km/s],vy [km/s],vz [km/s]");
+    for (Integer k = 0; k < numSteps; k++){
+        ASSERT_TRUE(std::getline(stateRows, line));
+        char *pos;
+        EXPECT_EQ(strtol(line.c_str(), &pos, 10), k);
+        EXPECT_EQ(strtod(pos + 1, &pos), 2458265.0 + k*60.0/86400);
+        for (Integer ii = 0; ii < 6; ii++)
+            EXPECT_EQ(strtod(pos + 1, &pos), expected.states[k][ii]) << "step " << k;
+    }
+    EXPECT_FALSE(std::getline(stateRows, line));
+
+    // access rows
+    std::string access = "time index,GP index\n";
+    Integer numAccesses = 0;
+    for (Integer k = 0; k < numSteps; k++)
+        for (Integer ptIdx : expected.steps[k]){
+            access += std::to_string(k) + "," + std::to_string(ptIdx) + "\n";
+            numAccesses++;
+        }
+    EXPECT_GT(numAccesses, 0);
+    EXPECT_EQ(ReadFile("TestCoverageWriter_access.csv"), access);
+
+    // binary records
+    std::string bin = ReadFile("TestCoverageWriter_steps.bin");
+    ASSERT_EQ(bin.size(), 4 + 3*sizeof(int32_t) + 2*sizeof(double) +
+                          numSteps*(2*sizeof(int32_t) + 7*sizeof(double)) + numAccesses*sizeof(int32_t));
+    EXPECT_EQ(bin.substr(0, 4), "PCST");
+    const char *p = bin.data() + 4 + sizeof(int32_t);
+    int32_t header[2];
+    double times[2];
+    memcpy(header, p, sizeof(header)); p += sizeof(header);
+    memcpy(times, p, sizeof(times)); p += sizeof(times);
+    EXPECT_EQ(header[0], 2000);
+    EXPECT_EQ(header[1], numSteps);
+    EXPECT_EQ(times[0], 2458265.0);
+    EXPECT_EQ(times[1], 60.0);
+    for (Integer k = 0; k < numSteps; k++){
+        int32_t step, count;
+        double jd, st[6];
+        memcpy(&step, p, sizeof(step)); p += sizeof(step);
+        memcpy(&jd, p, sizeof(jd)); p += sizeof(jd);
+        memcpy(st, p, sizeof(st)); p += sizeof(st);
+        memcpy(&count, p, sizeof(count)); p += sizeof(count);
+        EXPECT_EQ(step, k);
+        EXPECT_EQ(jd, 2458265.0 + k*60.0/86400);
+        EXPECT_EQ(st[3], expected.states[k][3]);
+        IntegerArray points(count);
+        memcpy(points.data(), p, count*sizeof(int32_t)); p += count*sizeof(int32_t);
+        EXPECT_EQ(points, expected.steps[k]) << "step " << k;
+    }
+    EXPECT_EQ(writer.GetBytesWritten(), (long long) (ReadFile("TestCoverageWriter_state.csv").size() +
+                                                      access.size() + bin.size()));
+
+    // a second run rewrites the files
+    runner.Run(writer, 2458265.0, 0.1, 60.0);
+    EXPECT_EQ(ReadFile("TestCoverageWriter_access.csv"), access);
+    std::remove("TestCoverageWriter_state.csv");
+    std::remove("TestCoverageWriter_access.csv");
+    std::remove("TestCoverageWriter_steps.bin");
+}
+
+TEST_F(CoverageWriterTest, BackPressureKeepsStepOrder){
+    CoverageRunner runner(&pg, sat);
+    SlowFormatter slow;
+    CoverageWriter writer(3, 1 << 20);
+    writer.AddOutput("TestCoverageWriter_slow.txt", &slow);
+    Integer numSteps = runner.Run(writer, 2458265.0, 0.2, 60.0);
+    ASSERT_EQ((Integer) slow.formatted.size(), numSteps);
+    for (Integer k = 0; k < numSteps; k++)
+        EXPECT_EQ(slow.formatted[k], k);
+
+    // the copy has the same outputs
+    CoverageWriter copy(writer);
+    EXPECT_EQ(copy.GetNumOutputs(), 1);
+    EXPECT_EQ(copy.GetMaxQueuedSteps(), 3);
+    std::remove("TestCoverageWriter_slow.txt");
+}
+
+TEST_F(CoverageWriterTest, Errors){
+    CoverageRunner runner(&pg, sat);
+    CsvAccessFormatter accessFormat;
+    EXPECT_THROW(CoverageWriter(0, 10), TATCException);
+    CoverageWriter writer;
+    EXPECT_THROW(writer.AddOutput("TestCoverageWriter_null.csv", NULL), TATCException);
+    EXPECT_THROW(writer.ProcessStep(0, 2458265.0, IntegerArray()), TATCException);
+
+    // unable to open a file
+    CoverageWriter bad;
+    bad.AddOutput("no_such_directory/TestCoverageWriter.csv", &accessFormat);
+    EXPECT_THROW(runner.Run(bad, 2458265.0, 0.01, 60.0), TATCException);
+
+    // an error of the writer thread is reported to the coverage loop
+    SlowFormatter failing;
+    failing.failAt = 5;
+    CoverageWriter writerFails(2, 1 << 20);
+    writerFails.AddOutput("TestCoverageWriter_fail.txt", &failing);
+    EXPECT_THROW(runner.Run(writerFails, 2458265.0, 0.1, 60.0), TATCException);
+    EXPECT_EQ(failing.formatted, IntegerArray({0, 1, 2, 3, 4}));
+    std::remove("TestCoverageWriter_fail.txt");
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
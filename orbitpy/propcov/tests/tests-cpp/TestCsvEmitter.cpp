@@ -0,0 +1,189 @@
+/** Tests for the CsvEmitter class and the legacy file formatters of the CoverageWriter: the text is that of
+ *  the ostream formatting of the orbitpropcov_grid driver, byte for byte. */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "CsvEmitter.hpp"
+#include "CoverageWriter.hpp"
+#include "CoverageRunner.hpp"
+#include "ConicalSensor.hpp"
+#include "PointGroup.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+static std::string ReadFile(const std::string &filename){
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+// The access row of the orbitpropcov_grid driver
+static std::string LegacyAccessRow(Integer step, const IntegerArray &points, Integer numPoints){
+    std::ostringstream out;
+    IntegerArray accessRow(numPoints, 0);
+    for (Integer ptIdx : points)
+        accessRow[ptIdx] = 1;
+    out << std::fixed << std::setprecision(16) << step;
+    for (Integer k = 0; k < numPoints; k++)
+        out << (accessRow[k] == 1 ? ",1" : ",");
+    out << "\n";
+    return out.str();
+}
+
+TEST(CsvEmitterTest, ShortestRoundTrip){
+    std::string buffer;
+    CsvEmitter::AppendReal(buffer, 0.1);
+    buffer += ',';
+    CsvEmitter::AppendReal(buffer, 7078.0);
+    buffer += ',';
+    CsvEmitter::AppendReal(buffer, -1e-7);
+    buffer += ',';
+    CsvEmitter::AppendInteger(buffer, -42);
+    EXPECT_EQ(buffer, "0.1,7078,-1e-07,-42");
+
+    std::mt19937_64 gen(5);
+    std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-300, 300);
+    for (int i = 0; i < 10000; i++){
+        Real value = std::ldexp(mantissa(gen), exponent(gen));
+        buffer.clear();
+        CsvEmitter::AppendReal(buffer, value);
+        EXPECT_EQ(strtod(buffer.c_str(), NULL), value) << buffer;
+        char text[32];
+        EXPECT_LE(buffer.size(), (size_t) snprintf(text, sizeof(text), "%.17g", value));
+    }
+}
+
+TEST(CsvEmitterTest, FixedSameAsStream){
+    std::mt19937_64 gen(7);
+    std::uniform_real_distribution<double> dist(-8000.0, 8000.0);
+    RealArray values = {0.0, -0.0, 1.0, 0.5, 2458265.0, 1e20, -1e-20, 123456789.123456789, 1e300};
+    for (int i = 0; i < 10000; i++)
+        values.push_back(dist(gen) * std::pow(10.0, (i % 7) - 3));
+    for (Integer precision : {0, 3, 16}){
+        for (Real value : values){
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(precision) << value;
+            std::string buffer = "x";
+            CsvEmitter::AppendFixed(buffer, value, precision);
+            EXPECT_EQ(buffer, "x" + out.str());
+        }
+    }
+    std::string buffer;
+    EXPECT_THROW(CsvEmitter::AppendFixed(buffer, 1.0, -1), TATCException);
+    EXPECT_THROW(CsvEmitter::AppendFixed(buffer, 1.0, CsvEmitter::MAX_PRECISION + 1), TATCException);
+}
+
+TEST(CsvEmitterTest, AccessRowsSameAsLegacy){
+    std::string buffer;
+    CsvEmitter::AppendAccessHeader(buffer, 3);
+    EXPECT_EQ(buffer, "TimeIndex,GP0,GP1,GP2\n");
+
+    std::mt19937 gen(3);
+    for (Integer numPoints : {1, 5, 100, 2000}){
+        for (int trial = 0; trial < 50; trial++){
+            std::bernoulli_distribution covered(trial / 50.0);
+            IntegerArray points;
+            for (Integer k = 0; k < numPoints; k++)
+                if (covered(gen))
+                    points.push_back(k);
+            buffer.clear();
+            CsvEmitter::AppendAccessRow(buffer, trial, points, numPoints);
+            EXPECT_EQ(buffer, LegacyAccessRow(trial, points, numPoints));
+        }
+    }
+    EXPECT_THROW(CsvEmitter::AppendAccessRow(buffer, 0, IntegerArray({2, 1}), 5), TATCException);
+    EXPECT_THROW(CsvEmitter::AppendAccessRow(buffer, 0, IntegerArray({1, 1}), 5), TATCException);
+    EXPECT_THROW(CsvEmitter::AppendAccessRow(buffer, 0, IntegerArray({5}), 5), TATCException);
+}
+
+// The legacy formatters write the files of the driver for the same steps.
+TEST(CsvEmitterTest, LegacyFilesSameAsDriver){
+    TestSpacecraft craft(6878.0, 51.6*PI/180);
+    ConicalSensor sensor(30.0*PI/180);
+    craft.sat->AddSensor(&sensor);
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(500);
+    Real startJd = 2458265.0, duration = 0.1, stepSize = 60.0;
+
+    CoverageRunner runner(&pg, craft.sat);
+    RecordingSink recorded;
+    Integer numSteps = runner.Run(recorded, startJd, duration, stepSize);
+
+    LegacyStateFormatter cartFormat(duration);
+    LegacyStateFormatter kepFormat(duration, true);
+    LegacyAccessFormatter accessFormat(duration);
+    CoverageWriter writer(4, 1000);
+    writer.AddOutput("TestCsvEmitter_state.csv", &cartFormat);
+    writer.AddOutput("TestCsvEmitter_state.csv_Keplerian", &kepFormat);
+    writer.AddOutput("TestCsvEmitter_access.csv", &accessFormat);
+    runner.Run(writer, startJd, duration, stepSize);
+
+    // the text of the driver (the streams are in fixed notation from the epoch line)
+    const int prc = std::numeric_limits<double>::digits10 + 1;
+    std::ostringstream satOut, satOutKep, satAcc;
+    satOut << "Satellite states are in Earth-Centered-Inertial equatorial-plane frame.\n";
+    satOut << "Epoch[JDUT1] is "<< std::fixed << std::setprecision(prc) << startJd <<"\n";
+    satOut << "Step size [s] is "<< std::fixed << std::setprecision(prc) << stepSize <<"\n";
+    satOut << "Mission Duration [Days] is "<< duration << "\n";
+    satOut << "TimeIndex,X[km],Y[km],Z[km],VX[km/s],VY[km/s],VZ[km/s]\n";
+    satOutKep << "Satellite states as Keplerian elements.\n";
+    satOutKep << "Epoch[JDUT1] is "<< std::fixed << std::setprecision(prc) << startJd <<"\n";
+    satOutKep << "Step size [s] is "<< std::fixed << std::setprecision(prc) << stepSize <<"\n";
+    satOutKep << "Mission Duration [Days] is "<< duration << "\n";
+    satOutKep << "TimeIndex,SMA[km],ECC,INC[deg],RAAN[deg],AOP[deg],TA[deg]\n";
+    satAcc << "Satellite states are in Earth-Centered-Inertial equatorial-plane frame.\n";
+    satAcc << "Epoch[JDUT1] is "<< std::fixed << std::setprecision(prc) << startJd <<"\n";
+    satAcc << "Step size [s] is "<< std::fixed << std::setprecision(prc) << stepSize <<"\n";
+    satAcc << "Mission Duration [Days] is "<< duration << ".\n";
+    satAcc << "TimeIndex,";
+    for (int i = 0; i < pg.GetNumPoints(); i++){
+        satAcc << "GP" << i;
+        if (i < pg.GetNumPoints() - 1)
+            satAcc << ",";
+    }
+    satAcc << "\n";
+    Integer numRows = 0;
+    for (Integer nSteps = 0; nSteps < numSteps; nSteps++){
+        Rvector6 cartState = recorded.states[nSteps];
+        satOut << std::setprecision(prc) << nSteps;
+        for (int i = 0; i < 6; i++)
+            satOut << "," << std::setprecision(prc) << cartState[i];
+        satOut << "\n";
+        OrbitState orbit;
+        orbit.SetCartesianState(cartState);
+        Rvector6 kepState = orbit.GetKeplerianState();
+        satOutKep << std::setprecision(prc) << nSteps;
+        satOutKep << "," << std::setprecision(prc) << kepState[0];
+        satOutKep << "," << std::setprecision(prc) << kepState[1];
+        for (int i = 2; i < 6; i++)
+            satOutKep << "," << std::setprecision(prc) << kepState[i]*GmatMathConstants::DEG_PER_RAD;
+        satOutKep << "\n";
+        if (recorded.steps[nSteps].size() > 0){
+            satAcc << LegacyAccessRow(nSteps, recorded.steps[nSteps], pg.GetNumPoints());
+            numRows++;
+        }
+    }
+    EXPECT_GT(numRows, 0);
+    EXPECT_LT(numRows, numSteps);   // steps without access have no row
+    EXPECT_EQ(ReadFile("TestCsvEmitter_state.csv"), satOut.str());
+    EXPECT_EQ(ReadFile("TestCsvEmitter_state.csv_Keplerian"), satOutKep.str());
+    EXPECT_EQ(ReadFile("TestCsvEmitter_access.csv"), satAcc.str());
+    std::remove("TestCsvEmitter_state.csv");
+    std::remove("TestCsvEmitter_state.csv_Keplerian");
+    std::remove("TestCsvEmitter_access.csv");
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+/** Tests for the FirstAccessQuery class. */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "FirstAccessQuery.hpp"
+#include "CoverageRunner.hpp"
+#include "CoverageSink.hpp"
+#include "ConicalSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+static const double START = TEST_EPOCH;
+
+// Sink recording the first access time of each point over a full run.
+class FirstAccessSink : public CoverageSink{
+    public:
+        RealArray first;
+        std::vector<Real> stepTimes;
+        std::vector<int> numCovered;
+        void BeginRun(Integer numPoints, Real startJd, Real stepSize, Integer numSteps){
+            first.assign(numPoints, -1.0);
+        }
+        void ProcessStep(Integer stepIndex, Real jd, const IntegerArray &coveredPoints){
+            for (Integer p : coveredPoints)
+                if (first[p] < 0) first[p] = jd;
+            int n = 0;
+            for (Real t : first) if (t >= 0) n++;
+            stepTimes.push_back(jd);
+            numCovered.push_back(n);
+        }
+};
+
+class FirstAccessQueryTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            for (int i = 0; i < 2; i++)
+                sats[i]->AddSensor(&sensor);
+            pg = new PointGroup();
+            pg->AddHelicalPointsByNumPoints(1000);
+        }
+        void TearDown() override{
+            delete pg;
+        }
+        ConicalSensor sensor{40.0*PI/180};
+        TestSpacecraft first{7078.0, 97.0*PI/180, 10.0*PI/180, 30.0*PI/180};
+        TestSpacecraft second{7078.0, 97.0*PI/180, 100.0*PI/180, 150.0*PI/180};
+        Spacecraft *sats[2] = {first.sat, second.sat};
+        PointGroup *pg;
+};
+
+// The first access times match those of a full run.
+TEST_F(FirstAccessQueryTest, MatchesFullRun){
+    FirstAccessSink sink;
+    CoverageRunner runner(pg, sats[0]);
+    Integer numSteps = runner.Run(sink, START, 0.5, 60.0);
+
+    FirstAccessQuery query(pg, sats[0]);
+    EXPECT_EQ(query.Run(START, 0.5, 60.0), numSteps);  // full coverage is not reached in 12 hours
+    EXPECT_EQ(query.GetFirstAccessTimes(), sink.first);
+    EXPECT_EQ(query.GetNumCovered(), sink.numCovered.back());
+    EXPECT_LT(query.GetCoverageTime(), 0.0);
+    IntegerArray uncovered = query.GetUncoveredPoints();
+    EXPECT_EQ((Integer) uncovered.size(), 1000 - query.GetNumCovered());
+    for (Integer p : uncovered)
+        EXPECT_LT(sink.first[p], 0.0);
+}
+
+// The run stops at the step where the requested fraction is reached.
+TEST_F(FirstAccessQueryTest, StopsAtCoverageFraction){
+    FirstAccessSink sink;
+    CoverageRunner runner(pg, sats[0]);
+    Integer numSteps = runner.Run(sink, START, 1.0, 60.0);
+    int k = 0;
+    while (sink.numCovered[k] < 500) k++;
+
+    FirstAccessQuery query(pg, sats[0]);
+    Integer stepsRun = query.Run(START, 1.0, 60.0, 0.5);
+    EXPECT_EQ(stepsRun, k + 1);
+    EXPECT_LT(stepsRun, numSteps);
+    EXPECT_DOUBLE_EQ(query.GetCoverageTime(), sink.stepTimes[k]);
+    EXPECT_GE(query.GetCoveredFraction(), 0.5);
+    for (int p = 0; p < 1000; p++){
+        if (sink.first[p] >= 0 && sink.first[p] <= sink.stepTimes[k])
+            EXPECT_DOUBLE_EQ(query.GetFirstAccessTimes()[p], sink.first[p]);
+        else
+            EXPECT_LT(query.GetFirstAccessTimes()[p], 0.0);
+    }
+}
+
+// A point is accessed when any spacecraft of the constellation covers it.
+TEST_F(FirstAccessQueryTest, Constellation){
+    FirstAccessSink sink0, sink1;
+    CoverageRunner runner0(pg, sats[0]), runner1(pg, sats[1]);
+    runner0.Run(sink0, START, 0.25, 60.0);
+    runner1.Run(sink1, START, 0.25, 60.0);
+
+    FirstAccessQuery query(pg, sats[0]);
+    query.AddSpacecraft(sats[1]);
+    EXPECT_EQ(query.GetNumSpacecraft(), 2);
+    query.Run(START, 0.25, 60.0);
+    for (int p = 0; p < 1000; p++){
+        Real t0 = sink0.first[p], t1 = sink1.first[p];
+        Real expected = (t0 < 0) ? t1 : ((t1 < 0) ? t0 : std::min(t0, t1));
+        EXPECT_DOUBLE_EQ(query.GetFirstAccessTimes()[p], expected);
+    }
+    EXPECT_THROW(query.Run(START, 0.25, 60.0, 0.0), TATCException);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
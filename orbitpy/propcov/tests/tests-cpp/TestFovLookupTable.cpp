@@ -0,0 +1,141 @@
+/** Tests for the FovLookupTable class: the table gives the results of the sensor test for star-shaped and other
+ *  custom fields of view, and the coverage checker with a table gives the results without it. */
+
+#include <gtest/gtest.h>
+#include <random>
+
+#include "FovLookupTable.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "ConicalSensor.hpp"
+#include "GMATCustomSensor.hpp"
+#include "polygon/DSPIPCustomSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+// Compare the table with the sensor test on random angles, denser near the field of view
+static void CompareWithSensor(Sensor *sensor, const FovLookupTable &table, Real maxCone, int numSamples){
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Real> cone(0.0, maxCone), clock(0.0, 2*PI);
+    Integer inside = 0;
+    for (int i = 0; i < numSamples; i++){
+        Real c = cone(gen), k = clock(gen);
+        bool expected = sensor->CheckTargetVisibility(c, k);
+        EXPECT_EQ(table.CheckTargetVisibility(c, k), expected) << "cone " << c << ", clock " << k;
+        inside += expected;
+    }
+    EXPECT_GT(inside, 0);
+    EXPECT_LT(inside, numSamples);
+}
+
+// A star-shaped custom sensor is classified and tested on its exact boundary.
+TEST(FovLookupTableTest, StarShapedCustomSensor){
+    // a pentagon-like polygon around the boresight with a concave vertex (closed: the first vertex is repeated)
+    Rvector cones(7, 0.3, 0.35, 0.1, 0.4, 0.3, 0.25, 0.3);
+    Rvector clocks(7, 0.2, 1.3, 2.0, 2.9, 4.2, 5.4, 0.2);
+    GMATCustomSensor sensor(cones, clocks);
+    FovLookupTable table(&sensor, 64, 128);
+    EXPECT_TRUE(table.IsStarShaped());
+    EXPECT_EQ(table.GetSensor(), &sensor);
+    EXPECT_EQ(table.GetNumConeCells(), 64);
+    EXPECT_EQ(table.GetNumClockCells(), 128);
+    EXPECT_GT(table.GetNumCells(FovLookupTable::INSIDE_CELL), 0);
+    EXPECT_GT(table.GetNumCells(FovLookupTable::OUTSIDE_CELL),
+              10*table.GetNumCells(FovLookupTable::BOUNDARY_CELL));
+    EXPECT_EQ(table.GetCellClass(0.01, 1.0), FovLookupTable::INSIDE_CELL);
+    EXPECT_EQ(table.GetCellClass(1.0, 1.0), FovLookupTable::OUTSIDE_CELL);
+    CompareWithSensor(&sensor, table, 0.5, 20000);
+
+    // the same polygon clockwise
+    Rvector reversedCones(7), reversedClocks(7);
+    for (int i = 0; i < 7; i++){
+        reversedCones[i] = cones[6 - i];
+        reversedClocks[i] = clocks[6 - i];
+    }
+    GMATCustomSensor reversed(reversedCones, reversedClocks);
+    FovLookupTable reversedTable(&reversed, 64, 128);
+    EXPECT_TRUE(reversedTable.IsStarShaped());
+    CompareWithSensor(&reversed, reversedTable, 0.5, 5000);
+
+    // the copy is the same table
+    FovLookupTable copy(table);
+    EXPECT_EQ(copy.GetNumCells(FovLookupTable::BOUNDARY_CELL), table.GetNumCells(FovLookupTable::BOUNDARY_CELL));
+    CompareWithSensor(&sensor, copy, 0.5, 2000);
+    EXPECT_THROW(FovLookupTable(NULL), TATCException);
+    EXPECT_THROW(FovLookupTable(&sensor, 0, 10), TATCException);
+}
+
+// The other sensors are classified by sampling: a custom sensor that is not star-shaped around the boresight,
+// a DSPIP custom sensor and a sensor subclass.
+TEST(FovLookupTableTest, SampledSensors){
+    // a polygon away from the boresight
+    Rvector cones(5, 0.2, 0.2, 0.4, 0.4, 0.2);
+    Rvector clocks(5, 0.3, 1.0, 1.0, 0.3, 0.3);
+    GMATCustomSensor offBoresight(cones, clocks);
+    FovLookupTable offTable(&offBoresight, 64, 128);
+    EXPECT_FALSE(offTable.IsStarShaped());
+    CompareWithSensor(&offBoresight, offTable, 0.6, 5000);
+
+    Rvector dspipCones(5, 0.3, 0.3, 0.3, 0.3, 0.3);
+    Rvector dspipClocks(5, 1.25, 1.89, 4.39, 5.03, 1.25);
+    DSPIPCustomSensor dspip(dspipCones, dspipClocks, AnglePair{0, 0});
+    FovLookupTable dspipTable(&dspip, 128, 256);
+    EXPECT_FALSE(dspipTable.IsStarShaped());
+    EXPECT_GT(dspipTable.GetNumCells(FovLookupTable::INSIDE_CELL), 0);
+    CompareWithSensor(&dspip, dspipTable, PI, 20000);
+
+    HalfConicalSensor half(30.0*PI/180);
+    FovLookupTable halfTable(&half, 64, 128);
+    CompareWithSensor(&half, halfTable, 1.0, 20000);
+    // the angles out of the table are tested exactly
+    EXPECT_EQ(halfTable.GetCellClass(-1.0, 1.0), FovLookupTable::BOUNDARY_CELL);
+    EXPECT_FALSE(halfTable.CheckTargetVisibility(0.1, 7.0));
+}
+
+// The coverage checker with a lookup table gives the results without it.
+TEST(FovLookupTableTest, CoverageCheckerSameResults){
+    Rvector cones(7, 0.3, 0.35, 0.1, 0.4, 0.3, 0.25, 0.3);
+    Rvector clocks(7, 0.2, 1.3, 2.0, 2.9, 4.2, 5.4, 0.2);
+    GMATCustomSensor gmatCustom(cones, clocks);
+    Rvector dspipCones(5, 0.3, 0.3, 0.3, 0.3, 0.3);
+    Rvector dspipClocks(5, 1.25, 1.89, 4.39, 5.03, 1.25);
+    DSPIPCustomSensor dspip(dspipCones, dspipClocks, AnglePair{0, 0});
+    Sensor *sensors[] = {&gmatCustom, &dspip};
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(10000);
+    for (Sensor *sensor : sensors){
+        TestSpacecraft craft;
+        Spacecraft &sat = *craft.sat;
+        sat.SetBodyNadirOffsetAngles(5.0, -3.0, 8.0);
+        sat.AddSensor(sensor);
+        Propagator prop(&sat);
+        CoverageChecker exact(&pg, &sat), lookup(&pg, &sat);
+        lookup.SetUseFovLookupTable(true);
+        EXPECT_TRUE(lookup.GetUseFovLookupTable());
+        EXPECT_FALSE(exact.GetUseFovLookupTable());
+        EXPECT_EQ(lookup.GetFovTableConeCells(), 128);
+        EXPECT_EQ(lookup.GetFovTableClockCells(), 256);
+        CoverageChecker copy(lookup);
+        EXPECT_TRUE(copy.GetUseFovLookupTable());
+        AbsoluteDate t;
+        Integer total = 0;
+        for (int k = 0; k < 20; k++){
+            t.SetJulianDate(2458265.0 + k*60.0/86400);
+            prop.Propagate(t);
+            IntegerArray expected = exact.CheckPointCoverage();
+            EXPECT_EQ(lookup.CheckPointCoverage(), expected) << "step " << k;
+            EXPECT_EQ(copy.CheckPointCoverage(), expected) << "step " << k;
+            total += expected.size();
+        }
+        EXPECT_GT(total, 0);
+        EXPECT_THROW(lookup.SetUseFovLookupTable(true, 0, 0), TATCException);
+    }
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
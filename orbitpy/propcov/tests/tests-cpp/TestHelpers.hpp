@@ -0,0 +1,85 @@
+/** Helpers shared by the tests: the spacecraft of the test scenarios, a sink recording the coverage of a run and a
+ *  sensor subclass without specialized visibility test. */
+
+#ifndef TestHelpers_hpp
+#define TestHelpers_hpp
+
+#include <vector>
+
+#include "CoverageSink.hpp"
+#include "ConicalSensor.hpp"
+#include "AbsoluteDate.hpp"
+#include "OrbitState.hpp"
+#include "Spacecraft.hpp"
+#include "NadirPointingAttitude.hpp"
+#include "LagrangeInterpolator.hpp"
+
+#ifndef PI
+# define PI 3.14159265358979323846 /* pi */
+#endif
+
+/// Epoch of the test scenarios
+const Real TEST_EPOCH = 2458265.0;
+
+// Nadir pointing spacecraft without sensor, at TEST_EPOCH on a near-circular orbit (7078 km, 98 deg by default).
+// The spacecraft refers to the date, state, attitude and interpolator held here.
+class TestSpacecraft{
+    public:
+        TestSpacecraft(Real sma = 7078.0, Real inc = 98.0*PI/180, Real raan = 10.0*PI/180, Real ta = 30.0*PI/180)
+            : interp("PropcovCppLagrangeInterpolator", 6, 7){
+            date.SetJulianDate(TEST_EPOCH);
+            state.SetKeplerianState(sma, 0.001, inc, raan, 0.0, ta);
+            sat = new Spacecraft(&date, &state, &attitude, &interp);
+        }
+        ~TestSpacecraft(){
+            delete sat;
+        }
+        TestSpacecraft(const TestSpacecraft&) = delete;
+        TestSpacecraft& operator=(const TestSpacecraft&) = delete;
+        AbsoluteDate date;
+        OrbitState state;
+        NadirPointingAttitude attitude;
+        LagrangeInterpolator interp;
+        Spacecraft *sat;
+};
+
+// Sink recording all the calls of a run; the time, state and covered points of a step are stored at its index.
+class RecordingSink : public CoverageSink{
+    public:
+        Integer numPoints = -1, numSteps = -1, numEnd = 0;
+        bool inOrder = true;   // steps processed in increasing order, one by one
+        std::vector<Real> times;
+        std::vector<Rvector6> states;
+        std::vector<IntegerArray> steps;
+        void BeginRun(Integer nPoints, Real startJd, Real stepSize, Integer nSteps){
+            numPoints = nPoints; numSteps = nSteps;
+            inOrder = true; lastStep = -1;
+            times.assign(nSteps, 0.0);
+            states.assign(nSteps, Rvector6());
+            steps.assign(nSteps, IntegerArray());
+        }
+        void ProcessState(Integer stepIndex, Real jd, const Rvector6 &cartState){
+            states[stepIndex] = cartState;
+        }
+        void ProcessStep(Integer stepIndex, Real jd, const IntegerArray &coveredPoints){
+            inOrder = inOrder && stepIndex == lastStep + 1;
+            lastStep = stepIndex;
+            times[stepIndex] = jd;
+            steps[stepIndex] = coveredPoints;
+        }
+        void EndRun(){ numEnd++; }
+    private:
+        Integer lastStep = -1;
+};
+
+// A sensor subclass seeing half of its cone (clock angles below pi): the coverage code only knows its own
+// (virtual) CheckTargetVisibility.
+class HalfConicalSensor : public ConicalSensor{
+    public:
+        HalfConicalSensor(Real fov) : ConicalSensor(fov) {}
+        bool CheckTargetVisibility(Real viewConeAngle, Real viewClockAngle) override{
+            return viewClockAngle < PI && ConicalSensor::CheckTargetVisibility(viewConeAngle, viewClockAngle);
+        }
+};
+
+#endif // TestHelpers_hpp
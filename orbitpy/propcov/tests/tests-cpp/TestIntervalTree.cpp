@@ -0,0 +1,131 @@
+/** Tests for the IntervalTree and AccessIntervalBuilder classes. */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+
+#include "IntervalTree.hpp"
+#include "AccessInterval.hpp"
+#include "TATCException.hpp"
+
+// Brute-force reference for the overlap query
+IntegerArray BruteOverlapping(const RealArray &starts, const RealArray &stops,
+                              Real qStart, Real qStop)
+{
+    IntegerArray result;
+    for (size_t i = 0; i < starts.size(); i++)
+        if (starts[i] <= qStop && stops[i] >= qStart)
+            result.push_back(i);
+    return result;
+}
+
+TEST(IntervalTreeTest, EmptyTree){
+    IntervalTree tree;
+    tree.Build();
+    EXPECT_EQ(tree.GetNumIntervals(), 0);
+    EXPECT_TRUE(tree.Overlapping(0, 10).empty());
+}
+
+TEST(IntervalTreeTest, SimpleQueries){
+    IntervalTree tree;
+    tree.Add(1.0, 3.0, 0);
+    tree.Add(2.0, 2.5, 1);
+    tree.Add(5.0, 9.0, 2);
+    tree.Add(4.0, 4.0, 3); // zero-length interval
+    tree.Build();
+
+    IntegerArray ids = tree.Overlapping(2.2, 2.3);
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, IntegerArray({0, 1}));
+
+    ids = tree.Containing(4.0);
+    EXPECT_EQ(ids, IntegerArray({3}));
+
+    ids = tree.Overlapping(3.0, 5.0); // closed intervals: touching counts
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, IntegerArray({0, 2, 3}));
+
+    EXPECT_TRUE(tree.Overlapping(9.5, 20.0).empty());
+    EXPECT_TRUE(tree.Overlapping(-5.0, 0.5).empty());
+}
+
+TEST(IntervalTreeTest, QueryBeforeBuildThrows){
+    IntervalTree tree;
+    tree.Add(1.0, 2.0, 0);
+    EXPECT_THROW(tree.Overlapping(0, 1), TATCException);
+    EXPECT_THROW(tree.Add(2.0, 1.0, 1), TATCException);
+}
+
+TEST(IntervalTreeTest, RandomAgainstBruteForce){
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> startDist(0.0, 1000.0);
+    std::uniform_real_distribution<double> lenDist(0.0, 20.0);
+
+    RealArray starts, stops;
+    IntervalTree tree;
+    for (int i = 0; i < 5000; i++)
+    {
+        double s = startDist(gen);
+        double e = s + lenDist(gen);
+        starts.push_back(s);
+        stops.push_back(e);
+        tree.Add(s, e, i);
+    }
+    tree.Build();
+
+    for (int q = 0; q < 200; q++)
+    {
+        double qs = startDist(gen);
+        double qe = qs + lenDist(gen);
+        IntegerArray ids = tree.Overlapping(qs, qe);
+        std::sort(ids.begin(), ids.end());
+        EXPECT_EQ(ids, BruteOverlapping(starts, stops, qs, qe));
+    }
+}
+
+TEST(AccessIntervalBuilderTest, BuildsIntervalsFromSteps){
+    AccessIntervalBuilder builder(4, 2, 1);
+    builder.AddCoverage(10.0, IntegerArray({0, 1}));
+    builder.AddCoverage(11.0, IntegerArray({1}));
+    builder.AddCoverage(12.0, IntegerArray({1, 3}));
+    builder.AddCoverage(13.0, IntegerArray({}));
+    builder.AddCoverage(14.0, IntegerArray({0}));
+    builder.Finalize();
+
+    std::vector<AccessInterval> intervals = builder.GetIntervals();
+    ASSERT_EQ(intervals.size(), 4);
+    std::sort(intervals.begin(), intervals.end(),
+              [](const AccessInterval &a, const AccessInterval &b)
+              { return a.pointIndex != b.pointIndex ? a.pointIndex < b.pointIndex : a.startTime < b.startTime; });
+
+    EXPECT_EQ(intervals[0].pointIndex, 0);
+    EXPECT_DOUBLE_EQ(intervals[0].startTime, 10.0);
+    EXPECT_DOUBLE_EQ(intervals[0].stopTime, 10.0);
+    EXPECT_EQ(intervals[1].pointIndex, 0);
+    EXPECT_DOUBLE_EQ(intervals[1].startTime, 14.0);
+    EXPECT_DOUBLE_EQ(intervals[1].stopTime, 14.0);
+    EXPECT_EQ(intervals[2].pointIndex, 1);
+    EXPECT_DOUBLE_EQ(intervals[2].startTime, 10.0);
+    EXPECT_DOUBLE_EQ(intervals[2].stopTime, 12.0);
+    EXPECT_EQ(intervals[3].pointIndex, 3);
+    EXPECT_DOUBLE_EQ(intervals[3].startTime, 12.0);
+    EXPECT_DOUBLE_EQ(intervals[3].stopTime, 12.0);
+
+    for (size_t i = 0; i < intervals.size(); i++)
+    {
+        EXPECT_EQ(intervals[i].satIndex, 2);
+        EXPECT_EQ(intervals[i].optionIndex, 1);
+    }
+}
+
+TEST(AccessIntervalBuilderTest, InvalidInputThrows){
+    AccessIntervalBuilder builder(2);
+    EXPECT_THROW(builder.AddCoverage(1.0, IntegerArray({2})), TATCException);
+    builder.AddCoverage(2.0, IntegerArray({0}));
+    EXPECT_THROW(builder.AddCoverage(1.0, IntegerArray({0})), TATCException);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
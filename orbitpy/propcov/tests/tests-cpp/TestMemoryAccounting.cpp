@@ -0,0 +1,235 @@
+/** Tests for the memory accounting and allocation counting of the Profiler class. */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "Profiler.hpp"   // the heap allocations are counted (linked with support-cpp/AllocationCounter.cpp)
+#include "AccessInterval.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "ConicalSensor.hpp"
+#include "RectangularSensor.hpp"
+#include "PointGroup.hpp"
+#include "Earth.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class MemoryAccountingTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            Profiler::Disable();
+            Profiler::Reset();
+        }
+        void TearDown() override{
+            Profiler::Disable();
+            Profiler::Reset();
+        }
+};
+
+// Plain, array and over-aligned allocations are counted.
+TEST_F(MemoryAccountingTest, AllocationsCounted){
+    struct alignas(64) Block{ double values[8]; };
+    ASSERT_TRUE(Profiler::IsCountingAllocations());
+    long long before = Profiler::GetThreadAllocations();
+    double *value = new double(1.0);
+    double *values = new double[10];
+    Block *block = new Block();
+    Block *blocks = new Block[3];
+    EXPECT_EQ(Profiler::GetThreadAllocations() - before, 4);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block) % 64, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(blocks) % 64, 0);
+    delete value;
+    delete[] values;
+    delete block;
+    delete[] blocks;
+}
+
+TEST_F(MemoryAccountingTest, SubsystemCurrentAndPeak){
+    EXPECT_TRUE(Profiler::IsCountingAllocations());
+    long long points = Profiler::GetCurrentMemory(Profiler::POINT_MEMORY);
+    long long checker = Profiler::GetCurrentMemory(Profiler::CHECKER_MEMORY);
+    long long total = Profiler::GetTotalCurrentMemory();
+    {
+        PointGroup pg;
+        pg.AddHelicalPointsByNumPoints(5000);
+        long long pgBytes = Profiler::GetCurrentMemory(Profiler::POINT_MEMORY) - points;
+        // latitude, longitude and the coordinate vectors (their elements are stored in the objects)
+        EXPECT_TRUE(pg.GetPointPositionVector(0)->IsInline());
+        EXPECT_GE(pgBytes, 5000*(2*sizeof(Real) + sizeof(Rvector3)));
+        long long bothBytes;
+        {
+            PointGroup copy(pg);
+            bothBytes = Profiler::GetCurrentMemory(Profiler::POINT_MEMORY) - points;
+            EXPECT_GT(bothBytes, pgBytes);
+            TestSpacecraft craft;
+            Spacecraft &sat = *craft.sat;
+            CoverageChecker cc(&copy, &sat);
+            EXPECT_GT(Profiler::GetCurrentMemory(Profiler::CHECKER_MEMORY), checker);
+            EXPECT_GT(Profiler::GetCurrentMemory(Profiler::INTERPOLATOR_MEMORY), 0);
+        }
+        EXPECT_EQ(Profiler::GetCurrentMemory(Profiler::POINT_MEMORY) - points, pgBytes);
+        EXPECT_EQ(Profiler::GetPeakMemory(Profiler::POINT_MEMORY) - points, bothBytes);
+        EXPECT_EQ(Profiler::GetCurrentMemory(Profiler::CHECKER_MEMORY), checker);
+    }
+    EXPECT_EQ(Profiler::GetCurrentMemory(Profiler::POINT_MEMORY), points);
+    EXPECT_EQ(Profiler::GetTotalCurrentMemory(), total);
+    EXPECT_GT(Profiler::GetTotalPeakMemory(), total);
+    EXPECT_NE(Profiler::GetReport().find("Points"), std::string::npos);
+
+    // the access intervals grow with the steps
+    long long accesses = Profiler::GetCurrentMemory(Profiler::ACCESS_MEMORY);
+    {
+        AccessIntervalBuilder builder(100);
+        for (int k = 0; k < 1000; k++)
+            builder.AddCoverage(2458265.0 + k/1440.0, IntegerArray(1, k % 100));
+        builder.Finalize();
+        EXPECT_GE(Profiler::GetCurrentMemory(Profiler::ACCESS_MEMORY) - accesses,
+                  (long long) (builder.GetIntervals().size()*sizeof(AccessInterval)));
+    }
+    EXPECT_EQ(Profiler::GetCurrentMemory(Profiler::ACCESS_MEMORY), accesses);
+
+    // a reset keeps the current usage and restarts the peaks from it
+    Profiler::Reset();
+    EXPECT_EQ(Profiler::GetTotalPeakMemory(), Profiler::GetTotalCurrentMemory());
+}
+
+// The steady-state feasibility and field-of-view loops make no heap allocation once the result array
+// has grown, and the results are those of CheckPointCoverage.
+TEST_F(MemoryAccountingTest, CoverageLoopDoesNotAllocate){
+    ConicalSensor conical(30.0*PI/180);
+    RectangularSensor rectangular(10.0*PI/180, 20.0*PI/180);
+    Sensor *sensors[] = {&conical, &rectangular};
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(5000);
+    for (Sensor *sensor : sensors){
+        TestSpacecraft craft;
+        Spacecraft &sat = *craft.sat;
+        sat.AddSensor(sensor);
+        Propagator prop(&sat);
+        CoverageChecker cc(&pg, &sat);
+        AbsoluteDate t;
+        IntegerArray covered;
+        std::vector<IntegerArray> expected;
+        // warm-up pass: the result array reaches its largest size
+        for (int k = 0; k < 100; k++){
+            t.SetJulianDate(2458265.0 + k*60.0/86400);
+            prop.Propagate(t);
+            expected.push_back(cc.CheckPointCoverage());
+            cc.CheckPointCoverageInto(covered);
+        }
+        Profiler::Reset();
+        Profiler::Enable();
+        Integer total = 0;
+        for (int k = 0; k < 100; k++){
+            t.SetJulianDate(2458265.0 + k*60.0/86400);
+            prop.Propagate(t);
+            cc.CheckPointCoverageInto(covered);
+            EXPECT_EQ(covered, expected[k]) << "step " << k;
+            total += covered.size();
+        }
+        Profiler::Disable();
+        EXPECT_GT(total, 0);
+        EXPECT_EQ(Profiler::GetStageCalls(Profiler::FEASIBILITY), 100);
+        EXPECT_EQ(Profiler::GetStageAllocations(Profiler::FEASIBILITY), 0);
+        EXPECT_EQ(Profiler::GetStageAllocations(Profiler::FOV_TEST), 0);
+        // the small vectors and matrices store their elements in the objects: the propagation and frame
+        // conversion do not allocate either
+        EXPECT_EQ(Profiler::GetStageAllocations(Profiler::PROPAGATION), 0);
+        EXPECT_EQ(Profiler::GetStageAllocations(Profiler::FRAME_CONVERSION), 0);
+    }
+}
+
+// The component-wise feasibility and field-of-view tests give the results of the Rvector3 computations
+// (Spacecraft::CheckTargetVisibility of the satellite-to-point vector).
+TEST_F(MemoryAccountingTest, SameResultsAsVectorComputation){
+    RectangularSensor sensor(15.0*PI/180, 25.0*PI/180);
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(5000);
+    TestSpacecraft craft;
+    Spacecraft &sat = *craft.sat;
+    sat.AddSensor(&sensor);
+    Propagator prop(&sat);
+    CoverageChecker cc(&pg, &sat);
+    Earth earth;
+    Real radius = earth.GetRadius();
+    AbsoluteDate t;
+    Integer total = 0;
+    for (int k = 0; k < 50; k++){
+        Real jd = 2458265.0 + k*60.0/86400;
+        t.SetJulianDate(jd);
+        prop.Propagate(t);
+        Rvector6 cart = sat.GetCartesianState();
+        Rvector6 bodyFixed = earth.GetBodyFixedState(cart, jd);
+        Rvector3 scPos = bodyFixed.GetR();
+        IntegerArray expected;
+        for (Integer i = 0; i < pg.GetNumPoints(); i++){
+            Rvector3 unitPos = pg.GetPointPositionVector(i)->GetUnitVector();
+            if (unitPos * scPos.GetUnitVector() <= 0.0 || (scPos/radius - unitPos) * unitPos <= 0.0)
+                continue;
+            if (sat.CheckTargetVisibility(bodyFixed, unitPos*radius - scPos, jd, 0))
+                expected.push_back(i);
+        }
+        IntegerArray covered = cc.CheckPointCoverage(bodyFixed, jd, cart);
+        EXPECT_EQ(covered, expected) << "step " << k;
+        total += covered.size();
+    }
+    EXPECT_GT(total, 0);
+}
+
+// Rvector3, Rvector6 and Rmatrix33 store their elements in the object: their arithmetic does not allocate, and
+// the large vectors and matrices are moved without copying.
+TEST_F(MemoryAccountingTest, SmallVectorsDoNotAllocate){
+    Earth earth;
+    TestSpacecraft craft;
+    Rvector6 cart = craft.state.GetCartesianState();
+    Rvector3 pos = cart.GetR();
+    long long before = Profiler::GetThreadAllocations();
+    Rvector3 unit = pos.GetUnitVector();
+    Rvector3 diff = unit*earth.GetRadius() - pos;
+    Rmatrix33 rot(0.0, 1.0, 0.0, -1.0, 0.0, 0.0, 0.0, 0.0, 1.0);
+    Rvector3 rotated = rot.Transpose() * (rot * diff);
+    Rvector6 bodyFixed = earth.GetBodyFixedState(cart, 2458265.0);
+    Rvector3 cross = Cross(unit, rotated);
+    EXPECT_EQ(Profiler::GetThreadAllocations() - before, 0);
+    EXPECT_TRUE(unit.IsInline() && bodyFixed.IsInline() && rot.IsInline());
+    EXPECT_NEAR((rotated - diff).GetMagnitude(), 0.0, 1e-9);
+    EXPECT_NEAR(cross*unit, 0.0, 1e-12);
+
+    // the large ones are on the heap, and moved
+    Rvector big(100);
+    for (int i = 0; i < 100; i++)
+        big[i] = i;
+    EXPECT_FALSE(big.IsInline());
+    const Real *data = big.GetDataVector();
+    before = Profiler::GetThreadAllocations();
+    Rvector moved(std::move(big));
+    EXPECT_EQ(moved.GetDataVector(), data);
+    EXPECT_FALSE(big.IsSized());
+    Rvector other(100);
+    other = std::move(moved);
+    EXPECT_EQ(other.GetDataVector(), data);
+    EXPECT_EQ(other[99], 99.0);
+    EXPECT_EQ(Profiler::GetThreadAllocations() - before, 1);   // Rvector other(100)
+    Rmatrix m(10, 10);
+    m(9, 9) = 2.0;
+    Rmatrix n(std::move(m));
+    EXPECT_EQ(n(9, 9), 2.0);
+    EXPECT_FALSE(m.IsSized());
+
+    // the sizes are checked as for the copy, and small arrays are resized in place
+    Rvector three(3, 1.0, 2.0, 3.0);
+    EXPECT_THROW(three = Rvector(4), ArrayTemplateExceptions::DimensionError);
+    three.Resize(5);
+    EXPECT_TRUE(three.IsInline());
+    EXPECT_EQ(three[2], 3.0);
+    three.Resize(2);
+    EXPECT_EQ(three.GetSize(), 2);
+    EXPECT_EQ(three[1], 2.0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
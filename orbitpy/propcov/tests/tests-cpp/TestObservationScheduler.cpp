@@ -0,0 +1,214 @@
+/** Tests for the ObservationScheduler class. */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <set>
+
+#include "ObservationScheduler.hpp"
+#include "GmatConstants.hpp"
+#include "TATCException.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+static const double SEC = 1.0/86400.0; // one second in days
+
+// Check that no target is observed twice, that each observation lies in an access window of
+// its target and that consecutive observations of a satellite are separated by the slew time.
+void CheckPlanIsValid(ObservationScheduler &scheduler, const std::vector<AccessInterval> &opps,
+                      const std::vector<ScheduledObservation> &plan, double duration){
+    std::set<int> targets;
+    for (size_t i = 0; i < plan.size(); i++){
+        const ScheduledObservation &obs = plan[i];
+        EXPECT_TRUE(targets.insert(obs.pointIndex).second);
+        const AccessInterval &opp = opps[obs.opportunityIndex];
+        EXPECT_EQ(opp.pointIndex, obs.pointIndex);
+        EXPECT_EQ(opp.satIndex, obs.satIndex);
+        EXPECT_GE(obs.startTime, opp.startTime);
+        EXPECT_LE(obs.stopTime, opp.stopTime + 2e-9);
+        EXPECT_NEAR(obs.stopTime - obs.startTime, duration*SEC, 1e-9);
+        if (i > 0 && plan[i-1].satIndex == obs.satIndex){
+            double slew = scheduler.GetSlewTime(plan[i-1].optionIndex, obs.optionIndex)*SEC;
+            EXPECT_GT(obs.startTime, plan[i-1].startTime);
+            EXPECT_GE(obs.startTime - plan[i-1].stopTime, slew - 2e-9);
+        }
+    }
+}
+
+TEST(ObservationSchedulerTest, PriorityWinsConflict){
+    ObservationScheduler scheduler;
+    scheduler.SetObservationDuration(10);
+    scheduler.SetTargetPriority(1, 5.0);
+    // both targets can only be seen over the same 10 s window by the same satellite
+    scheduler.AddOpportunity({0, 0, 0, 100.0, 100.0 + 10*SEC});
+    scheduler.AddOpportunity({0, 1, 0, 100.0, 100.0 + 10*SEC});
+
+    std::vector<ScheduledObservation> plan = scheduler.Schedule();
+    ASSERT_EQ(plan.size(), 1);
+    EXPECT_EQ(plan[0].pointIndex, 1);
+    EXPECT_DOUBLE_EQ(scheduler.GetTotalPriority(), 5.0);
+}
+
+TEST(ObservationSchedulerTest, SlewTimeSeparatesObservations){
+    ObservationScheduler scheduler;
+    scheduler.SetObservationDuration(5);
+    scheduler.AddPointingOption(20*PI/180, PI/2);   // roll left
+    scheduler.AddPointingOption(20*PI/180, -PI/2);  // roll right
+    scheduler.SetSlewModel(1*PI/180, 2);            // 1 deg/s and 2 s settle => 42 s between options
+    EXPECT_NEAR(scheduler.GetSlewTime(0, 1), 42.0, 1e-9);
+    EXPECT_DOUBLE_EQ(scheduler.GetSlewTime(1, 1), 0.0);
+
+    // target 0 through option 0 in [0, 30] s, target 1 through option 1 in [10, 60] s
+    scheduler.AddOpportunity({0, 0, 0, 1000.0, 1000.0 + 30*SEC});
+    scheduler.AddOpportunity({0, 1, 1, 1000.0 + 10*SEC, 1000.0 + 60*SEC});
+    std::vector<ScheduledObservation> plan = scheduler.Schedule();
+    ASSERT_EQ(plan.size(), 2);
+    EXPECT_NEAR((plan[1].startTime - plan[0].stopTime)/SEC, 42.0, 1e-3);
+
+    // with a slower slew the second target no longer fits
+    scheduler.SetSlewModel(0.5*PI/180, 2);
+    plan = scheduler.Schedule();
+    EXPECT_EQ(plan.size(), 1);
+}
+
+TEST(ObservationSchedulerTest, OneObservationAtATime){
+    ObservationScheduler scheduler;
+    scheduler.SetObservationDuration(1);
+    // simultaneous looks on the same satellite conflict
+    scheduler.AddOpportunity({0, 0, 0, 50.0, 50.0 + 1*SEC});
+    scheduler.AddOpportunity({0, 1, 0, 50.0, 50.0 + 1*SEC});
+    // ... but not on different satellites
+    scheduler.AddOpportunity({1, 2, 0, 50.0, 50.0 + 1*SEC});
+    std::vector<ScheduledObservation> plan = scheduler.Schedule();
+    EXPECT_EQ(plan.size(), 2);
+}
+
+TEST(ObservationSchedulerTest, LocalRepairRecoversTarget){
+    // Target 0 is tried first (short window) and takes the early slot. Target 1 has a
+    // longer window and also fits later; target 2 (highest priority) only fits in the
+    // slot taken by target 1 in the greedy pass.
+    ObservationScheduler scheduler;
+    scheduler.SetObservationDuration(10);
+    scheduler.SetTargetPriority(0, 2.0);
+    scheduler.SetTargetPriority(1, 2.0);
+    scheduler.SetTargetPriority(2, 1.0);
+    double t0 = 2000.0;
+    scheduler.AddOpportunity({0, 0, 0, t0, t0 + 10*SEC});
+    scheduler.AddOpportunity({0, 1, 0, t0 + 10*SEC, t0 + 40*SEC});
+    scheduler.AddOpportunity({0, 2, 0, t0 + 10*SEC, t0 + 20*SEC});
+    scheduler.AddOpportunity({1, 2, 0, t0 + 100*SEC, t0 + 105*SEC}); // too short for an observation
+
+    scheduler.SetMaxRepairPasses(0);
+    std::vector<ScheduledObservation> greedy = scheduler.Schedule();
+    scheduler.SetMaxRepairPasses(3);
+    std::vector<ScheduledObservation> repaired = scheduler.Schedule();
+
+    // greedy places target 1 in [10, 20] s which blocks target 2
+    EXPECT_EQ(greedy.size(), 2);
+    EXPECT_EQ(repaired.size(), 3);
+    EXPECT_GT(scheduler.GetNumRepairs(), 0);
+    std::vector<AccessInterval> opps = {{0, 0, 0, t0, t0 + 10*SEC}, {0, 1, 0, t0 + 10*SEC, t0 + 40*SEC},
+                                        {0, 2, 0, t0 + 10*SEC, t0 + 20*SEC}, {1, 2, 0, t0 + 100*SEC, t0 + 105*SEC}};
+    CheckPlanIsValid(scheduler, opps, repaired, 10);
+}
+
+// Scheduler giving access to its plan records and target observations
+class InspectedScheduler : public ObservationScheduler{
+    public:
+        const std::vector<ScheduledObservation>& GetPlanRecords() const { return plan; }
+        const IntegerArray& GetTargetObservations() const { return targetObservation; }
+};
+
+// The observations removed and restored by the local repair leave no stale record: after Schedule() the plan
+// records are the plan, ordered by satellite and start time, and each target refers to its record.
+TEST(ObservationSchedulerTest, RepairLeavesNoStaleRecord){
+    std::mt19937 gen(11);
+    std::uniform_int_distribution<int> satDist(0, 1);
+    std::uniform_int_distribution<int> ptDist(0, 999);
+    std::uniform_int_distribution<int> optDist(0, 1);
+    std::uniform_real_distribution<double> startDist(0.0, 0.05);
+    std::uniform_real_distribution<double> lenDist(5*SEC, 40*SEC);
+    InspectedScheduler scheduler;
+    scheduler.SetObservationDuration(5);
+    scheduler.AddPointingOption(20*PI/180, PI/2);
+    scheduler.AddPointingOption(20*PI/180, -PI/2);
+    scheduler.SetSlewModel(2*PI/180, 1);
+    for (int p = 0; p < 1000; p += 7)
+        scheduler.SetTargetPriority(p, 2.0);
+    std::vector<AccessInterval> opps;
+    for (int i = 0; i < 5000; i++){
+        double start = 2459000.0 + startDist(gen);
+        opps.push_back({satDist(gen), ptDist(gen), optDist(gen), start, start + lenDist(gen)});
+        scheduler.AddOpportunity(opps.back());
+    }
+
+    std::vector<ScheduledObservation> plan = scheduler.Schedule();
+    EXPECT_GT(scheduler.GetNumRepairs(), 0);
+    CheckPlanIsValid(scheduler, opps, plan, 5);
+    const std::vector<ScheduledObservation> &records = scheduler.GetPlanRecords();
+    ASSERT_EQ(records.size(), plan.size());
+    for (size_t i = 0; i < records.size(); i++){
+        EXPECT_GE(records[i].opportunityIndex, 0);
+        EXPECT_EQ(records[i].opportunityIndex, plan[i].opportunityIndex);
+        EXPECT_EQ(records[i].startTime, plan[i].startTime);
+        EXPECT_EQ(scheduler.GetTargetObservations()[records[i].pointIndex], (Integer) i);
+        if (i > 0){
+            EXPECT_TRUE(records[i-1].satIndex < records[i].satIndex ||
+                        (records[i-1].satIndex == records[i].satIndex && records[i-1].startTime < records[i].startTime));
+        }
+    }
+}
+
+TEST(ObservationSchedulerTest, InvalidInputThrows){
+    ObservationScheduler scheduler;
+    AccessInterval bad = {0, 0, 0, 2.0, 1.0};
+    EXPECT_THROW(scheduler.AddOpportunity(bad), TATCException);
+    EXPECT_THROW(scheduler.SetTargetPriority(0, 0.0), TATCException);
+    EXPECT_THROW(scheduler.SetSlewModel(-1.0, 0.0), TATCException);
+    EXPECT_THROW(scheduler.AddOpportunities(IntegerArray({0}), IntegerArray({0, 1}), IntegerArray(),
+                                            RealArray({0.0}), RealArray({1.0})), TATCException);
+}
+
+// A million random opportunities over 20 satellites, 200000 targets and 3 pointing options.
+TEST(ObservationSchedulerTest, LargeProblem){
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> satDist(0, 19);
+    std::uniform_int_distribution<int> ptDist(0, 199999);
+    std::uniform_int_distribution<int> optDist(0, 2);
+    std::uniform_real_distribution<double> startDist(0.0, 1.0);  // one day
+    std::uniform_real_distribution<double> lenDist(5*SEC, 60*SEC);
+
+    const int numOpps = 1000000;
+    IntegerArray sats(numOpps), pts(numOpps), opts(numOpps);
+    RealArray starts(numOpps), stops(numOpps);
+    std::vector<AccessInterval> opps(numOpps);
+    for (int i = 0; i < numOpps; i++){
+        sats[i] = satDist(gen); pts[i] = ptDist(gen); opts[i] = optDist(gen);
+        starts[i] = 2459000.0 + startDist(gen);
+        stops[i] = starts[i] + lenDist(gen);
+        opps[i] = {sats[i], pts[i], opts[i], starts[i], stops[i]};
+    }
+
+    ObservationScheduler scheduler;
+    scheduler.SetObservationDuration(4);
+    scheduler.AddPointingOption(0, 0);
+    scheduler.AddPointingOption(25*PI/180, PI/2);
+    scheduler.AddPointingOption(25*PI/180, -PI/2);
+    scheduler.SetSlewModel(2*PI/180, 1);
+    for (int p = 0; p < 200000; p += 10)
+        scheduler.SetTargetPriority(p, 3.0);
+    scheduler.AddOpportunities(sats, pts, opts, starts, stops);
+
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<ScheduledObservation> plan = scheduler.Schedule();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    EXPECT_GT(plan.size(), 10000);
+    EXPECT_LT(elapsed, 30.0);
+    CheckPlanIsValid(scheduler, opps, plan, 4);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
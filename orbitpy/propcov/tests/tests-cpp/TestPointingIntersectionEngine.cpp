@@ -0,0 +1,148 @@
+/** Tests for the PointingIntersectionEngine class: the ground points are those of the per-option computation of
+ *  the legacy pointing-axis intersection driver, the geodetic points of the ellipsoid lie on the rays, and the
+ *  binary table is read back. */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <unistd.h>
+
+#include "PointingIntersectionEngine.hpp"
+#include "BatchConversions.hpp"
+#include "Propagator.hpp"
+#include "Earth.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class PointingIntersectionEngineTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            // roll, pitch and yaw options; the last one points to the zenith
+            angles1 = {0.0, 20.0, -35.0, 10.0, 180.0};
+            angles2 = {0.0, 0.0, 15.0, -40.0, 0.0};
+            angles3 = {0.0, 30.0, 0.0, 5.0, 0.0};
+            // inertial states of a propagated spacecraft
+            TestSpacecraft craft;
+            Spacecraft &sat = *craft.sat;
+            Propagator prop(&sat);
+            AbsoluteDate t;
+            for (int k = 0; k < numSteps; k++){
+                jd.push_back(2458265.0 + k*60.0/86400);
+                t.SetJulianDate(jd.back());
+                prop.Propagate(t);
+                Rvector6 cart = sat.GetCartesianState();
+                for (int i = 0; i < 6; i++)
+                    states.push_back(cart[i]);
+            }
+        }
+        static const int numSteps = 100;
+        RealArray angles1, angles2, angles3, jd, states;
+};
+
+// The ground points are those of the legacy driver: spacecraft attitude, pointing axis and sphere intersection
+// for each state and option.
+TEST_F(PointingIntersectionEngineTest, SameAsPerOptionComputation){
+    PointingIntersectionEngine engine(angles1, angles2, angles3);
+    EXPECT_EQ(engine.GetNumOptions(), 5);
+    EXPECT_EQ(engine.GetFlattening(), 0.0);
+    Real radius = engine.GetEquatorialRadius();
+    RealArray latLon(numSteps*5*2);
+    engine.Intersect(jd.data(), states.data(), numSteps, latLon.data());
+
+    Earth earth;
+    TestSpacecraft craft;
+    Spacecraft &sat = *craft.sat;
+    for (int k = 0; k < numSteps; k++){
+        Rvector6 cart(&states[6*k]);
+        Rvector6 bodyFixed = earth.GetBodyFixedState(cart, jd[k]);
+        Rvector3 pos = bodyFixed.GetR();
+        for (int j = 0; j < 5; j++){
+            sat.SetBodyNadirOffsetAngles(angles1[j], angles2[j], angles3[j], 1, 2, 3);
+            Rmatrix33 bodyFixedToBody = sat.GetNadirToBodyMatrix() * sat.GetBodyFixedToReference(bodyFixed);
+            Rvector3 axis = bodyFixedToBody.Transpose() * Rvector3(0.0, 0.0, 1.0);
+            Real lat = latLon[2*(5*k + j)], lon = latLon[2*(5*k + j) + 1];
+            Real b = axis*pos, disc = b*b - (pos*pos - radius*radius);
+            if (disc < 0.0 || -b - sqrt(disc) < 0.0){
+                // the ray misses the Earth (the legacy driver reports the line intersection behind the spacecraft)
+                EXPECT_TRUE(std::isnan(lat) && std::isnan(lon)) << "step " << k << ", option " << j;
+                continue;
+            }
+            Rvector3 point = pos + axis*(-b - sqrt(disc));
+            Real r = point.GetMagnitude();
+            Real expectedLon = atan2(point[1], point[0]);
+            if (expectedLon < 0.0)
+                expectedLon += 2*PI;
+            EXPECT_NEAR(lat, asin(point[2]/r), 1e-9) << "step " << k << ", option " << j;
+            EXPECT_NEAR(lon, expectedLon, 1e-9) << "step " << k << ", option " << j;
+        }
+        // nadir is the sub-satellite point, the zenith misses
+        EXPECT_NEAR(latLon[10*k], asin(pos[2]/pos.GetMagnitude()), 1e-9);
+        EXPECT_TRUE(std::isnan(latLon[10*k + 8]));
+    }
+    Rvector3 nadir = engine.GetPointingAxis(0);
+    EXPECT_NEAR(nadir[2], 1.0, 1e-15);
+    EXPECT_THROW(engine.GetPointingAxis(5), TATCException);
+    EXPECT_THROW(PointingIntersectionEngine(angles1, angles2, RealArray(2, 0.0)), TATCException);
+}
+
+// On the flattened Earth the geodetic ground points lie on the rays.
+TEST_F(PointingIntersectionEngineTest, GeodeticPointsOnEllipsoid){
+    PointingIntersectionEngine engine(angles1, angles2, angles3);
+    engine.SetEllipsoid(Earth::RADIUS, Earth::FLATTENING);
+    EXPECT_EQ(engine.GetFlattening(), Earth::FLATTENING);
+    EXPECT_THROW(engine.SetEllipsoid(-1.0, 0.0), TATCException);
+    RealArray bodyFixed(6*numSteps), latLon(numSteps*5*2);
+    BatchConversions::InertialToBodyFixed(jd.data(), states.data(), numSteps, bodyFixed.data());
+    engine.IntersectBodyFixed(bodyFixed.data(), numSteps, latLon.data());
+
+    // the direction to the ground point is that to the ground point of the sphere (the same ray)
+    PointingIntersectionEngine sphere(angles1, angles2, angles3);
+    RealArray sphereLatLon(numSteps*5*2);
+    sphere.IntersectBodyFixed(bodyFixed.data(), numSteps, sphereLatLon.data());
+    Real radius = sphere.GetEquatorialRadius();
+    Integer hits = 0;
+    for (int k = 0; k < numSteps; k++){
+        Rvector3 pos(bodyFixed[6*k], bodyFixed[6*k + 1], bodyFixed[6*k + 2]);
+        for (int j = 0; j < 5; j++){
+            int i = 5*k + j;
+            Real geo[3] = {latLon[2*i], latLon[2*i + 1], 0.0}, cart[3];
+            EXPECT_EQ(std::isnan(geo[0]), std::isnan(sphereLatLon[2*i])) << "step " << k << ", option " << j;
+            if (std::isnan(geo[0]) || std::isnan(sphereLatLon[2*i]))
+                continue;
+            hits++;
+            BatchConversions::GeodeticToCartesian(geo, 1, cart);
+            Real lat = sphereLatLon[2*i], lon = sphereLatLon[2*i + 1];
+            Rvector3 spherePoint(radius*cos(lat)*cos(lon), radius*cos(lat)*sin(lon), radius*sin(lat));
+            Rvector3 toPoint = (Rvector3(cart[0], cart[1], cart[2]) - pos).GetUnitVector();
+            Rvector3 toSphere = (spherePoint - pos).GetUnitVector();
+            EXPECT_NEAR(toPoint*toSphere, 1.0, 1e-12) << "step " << k << ", option " << j;
+        }
+    }
+    EXPECT_EQ(hits, 4*numSteps);
+}
+
+// The table is read back with the times and ground points of Intersect.
+TEST_F(PointingIntersectionEngineTest, TableRoundTrip){
+    std::string filename = "/tmp/TestPointingIntersectionEngine_" + std::to_string(getpid()) + ".bin";
+    PointingIntersectionEngine engine(angles1, angles2, angles3);
+    engine.WriteTable(filename, jd.data(), states.data(), numSteps);
+    RealArray expected(numSteps*5*2), readJd, readLatLon;
+    engine.Intersect(jd.data(), states.data(), numSteps, expected.data());
+    EXPECT_EQ(PointingIntersectionEngine::ReadTable(filename, readJd, readLatLon), 5);
+    EXPECT_EQ(readJd, jd);
+    ASSERT_EQ(readLatLon.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++){
+        if (std::isnan(expected[i]))
+            EXPECT_TRUE(std::isnan(readLatLon[i]));
+        else
+            EXPECT_EQ(readLatLon[i], expected[i]);
+    }
+    std::remove(filename.c_str());
+    EXPECT_THROW(PointingIntersectionEngine::ReadTable(filename, readJd, readLatLon), TATCException);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
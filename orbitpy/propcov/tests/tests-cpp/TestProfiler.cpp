@@ -0,0 +1,138 @@
+/** Tests for the Profiler class. */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "Profiler.hpp"
+#include "CoverageRaster.hpp"
+#include "CoverageRunner.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "ConicalSensor.hpp"
+#include "PointGroup.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+class ProfilerTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            Profiler::Disable();
+            Profiler::Reset();
+            sat->AddSensor(&sensor);
+            pg.AddHelicalPointsByNumPoints(2000);
+        }
+        void TearDown() override{
+            Profiler::Disable();
+            Profiler::Reset();
+        }
+        // Propagate and check the coverage for numSteps minutes, return the number of covered points
+        Integer Run(int numSteps){
+            Propagator prop(sat);
+            CoverageChecker checker(&pg, sat);
+            AbsoluteDate t;
+            Integer total = 0;
+            for (int k = 0; k < numSteps; k++){
+                t.SetJulianDate(2458265.0 + k*60.0/86400);
+                prop.Propagate(t);
+                total += checker.CheckPointCoverage().size();
+            }
+            return total;
+        }
+        ConicalSensor sensor{30.0*PI/180};
+        PointGroup pg;
+        TestSpacecraft craft;
+        Spacecraft *sat = craft.sat;
+};
+
+TEST_F(ProfilerTest, DisabledRecordsNothing){
+    EXPECT_FALSE(Profiler::IsEnabled());
+    Run(20);
+    for (int s = 0; s < Profiler::NUM_STAGES; s++){
+        EXPECT_EQ(Profiler::GetStageCalls((Profiler::Stage) s), 0);
+        EXPECT_EQ(Profiler::GetStageTime((Profiler::Stage) s), 0.0);
+    }
+    for (int c = 0; c < Profiler::NUM_COUNTERS; c++)
+        EXPECT_EQ(Profiler::GetCounter((Profiler::Counter) c), 0);
+}
+
+TEST_F(ProfilerTest, StagesAndCounters){
+    Profiler::Enable();
+    Integer covered = Run(100);
+    Profiler::Disable();
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::PROPAGATION), 100);
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::FRAME_CONVERSION), 100);
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::FEASIBILITY), 100);
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::FOV_TEST), 100);
+    EXPECT_GT(Profiler::GetStageTime(Profiler::FEASIBILITY), 0.0);
+    EXPECT_EQ(Profiler::GetCounter(Profiler::POINTS_TESTED), 100*2000);
+    EXPECT_EQ(Profiler::GetCounter(Profiler::VISIBLE_POINTS), covered);
+    EXPECT_GE(Profiler::GetCounter(Profiler::FEASIBLE_POINTS), covered);
+    EXPECT_LT(Profiler::GetCounter(Profiler::FEASIBLE_POINTS), 100*2000);
+    EXPECT_NE(Profiler::GetReport().find("Feasibility"), std::string::npos);
+
+    // the data are kept while disabled, and added to when enabled again
+    Run(10);
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::PROPAGATION), 100);
+    Profiler::Enable();
+    Run(10);
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::PROPAGATION), 110);
+    Profiler::Reset();
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::PROPAGATION), 0);
+    EXPECT_EQ(Profiler::GetCounter(Profiler::POINTS_TESTED), 0);
+}
+
+// The counts of a threaded run are those of the sequential run, and the output bytes are counted.
+TEST_F(ProfilerTest, ThreadedRunAndOutput){
+    CoverageRunner runner(&pg, sat);
+    CoverageRaster raster(&pg, 10.0);
+    Profiler::Enable();
+    runner.Run(raster, 2458265.0, 0.1, 60.0);
+    long long tested = Profiler::GetCounter(Profiler::POINTS_TESTED);
+    long long visible = Profiler::GetCounter(Profiler::VISIBLE_POINTS);
+    EXPECT_EQ(tested, 144*2000);
+    EXPECT_GT(Profiler::GetStageCalls(Profiler::INTERVAL_BUILDING), 0);
+    Profiler::Reset();
+    runner.SetNumThreads(4);
+    runner.Run(raster, 2458265.0, 0.1, 60.0);
+    EXPECT_EQ(Profiler::GetCounter(Profiler::POINTS_TESTED), tested);
+    EXPECT_EQ(Profiler::GetCounter(Profiler::VISIBLE_POINTS), visible);
+
+    std::string fname = "TestProfiler.bin";
+    raster.Write(fname);
+    std::ifstream in(fname, std::ios::binary | std::ios::ate);
+    EXPECT_EQ(Profiler::GetCounter(Profiler::BYTES_WRITTEN), (long long) in.tellg());
+    EXPECT_EQ(Profiler::GetStageCalls(Profiler::OUTPUT), 1);
+    in.close();
+    std::remove(fname.c_str());
+}
+
+TEST_F(ProfilerTest, ChromeTrace){
+    Profiler::Enable(true);
+    EXPECT_TRUE(Profiler::IsTracing());
+    Run(5);
+    Profiler::Disable();
+    // propagation, frame conversion, feasibility and FOV test per step
+    EXPECT_EQ(Profiler::GetNumTraceEvents(), 20);
+    EXPECT_EQ(Profiler::GetNumDroppedTraceEvents(), 0);
+
+    std::string fname = "TestProfiler.json";
+    Profiler::WriteChromeTrace(fname);
+    std::ifstream in(fname);
+    std::stringstream buf;
+    buf << in.rdbuf();
+    std::string json = buf.str();
+    EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+    EXPECT_NE(json.find("\"name\":\"Propagation\",\"cat\":\"propcov\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"PointsTested\":10000"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 6), "}}\n]}\n");
+    in.close();
+    std::remove(fname.c_str());
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
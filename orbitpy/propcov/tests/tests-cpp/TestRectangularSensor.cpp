@@ -57,6 +57,22 @@ INSTANTIATE_TEST_CASE_P(ChkTargVis, CheckTargetVisibilityTestFixture, testing::V
     
    ));
 
+// A copy (constructed or assigned) has the poles of the sides of the original and the same visibility.
+TEST(RectangularSensorCopy, CopyKeepsPoles){
+    RectangularSensor sen(30*PI/180, 10*PI/180);
+    RectangularSensor copy(sen);
+    RectangularSensor assigned(5*PI/180, 5*PI/180);
+    assigned = sen;
+    ASSERT_EQ(copy.GetPoles().size(), 4);
+    ASSERT_EQ(assigned.GetPoles().size(), 4);
+    for (int i = 0; i < 4; i++){
+        EXPECT_EQ(copy.GetPoles()[i], sen.GetPoles()[i]);
+        EXPECT_EQ(assigned.GetPoles()[i], sen.GetPoles()[i]);
+    }
+    EXPECT_TRUE(copy.CheckTargetVisibility(14*PI/180, 90*PI/180));
+    EXPECT_FALSE(assigned.CheckTargetVisibility(6*PI/180, 0));
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
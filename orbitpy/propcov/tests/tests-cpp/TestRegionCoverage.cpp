@@ -0,0 +1,175 @@
+/** Tests for the RegionCoverage class: the Voronoi weights of the grid points sum to the area of the grid, the
+ *  region areas are those of the spherical polygons, and the fractions of a run are those of the recorded coverage. */
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "RegionCoverage.hpp"
+#include "CoverageRunner.hpp"
+#include "ConicalSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+// Area of the spherical triangle of vertices given by lat/lon (rad)
+static Real TriangleArea(const RealArray &lats, const RealArray &lons){
+    Real v[3][3];
+    for (int i = 0; i < 3; i++){
+        v[i][0] = cos(lats[i])*cos(lons[i]);
+        v[i][1] = cos(lats[i])*sin(lons[i]);
+        v[i][2] = sin(lats[i]);
+    }
+    Real triple = v[0][0]*(v[1][1]*v[2][2] - v[1][2]*v[2][1]) - v[0][1]*(v[1][0]*v[2][2] - v[1][2]*v[2][0]) +
+                  v[0][2]*(v[1][0]*v[2][1] - v[1][1]*v[2][0]);
+    Real dots = v[0][0]*v[1][0] + v[0][1]*v[1][1] + v[0][2]*v[1][2] + v[1][0]*v[2][0] + v[1][1]*v[2][1] +
+                v[1][2]*v[2][2] + v[2][0]*v[0][0] + v[2][1]*v[0][1] + v[2][2]*v[0][2];
+    return 2*atan2(fabs(triple), 1 + dots);
+}
+
+// The weights of a global grid are its Voronoi cells (sum 4pi, close to the mean cell); those of a regular
+// lat/lon grid follow the cell areas, and the border points of a regional grid are not given the rest of the sphere.
+TEST(RegionCoverageWeightsTest, VoronoiWeights){
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(5000);
+    RegionCoverage regions(&pg);
+    const RealArray &weights = regions.GetPointWeights();
+    ASSERT_EQ(weights.size(), pg.GetNumPoints());
+    Real sum = 0.0, mean = 4*PI/pg.GetNumPoints();
+    for (Real w : weights){
+        EXPECT_NEAR(w, mean, 0.2*mean);
+        sum += w;
+    }
+    EXPECT_NEAR(sum, 4*PI, 1e-9);
+
+    // 1 deg grid over lat 40..60 deg, lon 10..30 deg
+    RealArray lats, lons;
+    for (int i = 40; i <= 60; i++)
+        for (int j = 10; j <= 30; j++){
+            lats.push_back(i*PI/180);
+            lons.push_back(j*PI/180);
+        }
+    PointGroup regional;
+    regional.AddUserDefinedPoints(lats, lons);
+    RegionCoverage regionalRegions(&regional, 64);
+    const RealArray &regionalWeights = regionalRegions.GetPointWeights();
+    Real cell = (PI/180)*(PI/180), regionalSum = 0.0;
+    for (int i = 40, k = 0; i <= 60; i++)
+        for (int j = 10; j <= 30; j++, k++){
+            if (i > 40 && i < 60 && j > 10 && j < 30){
+                EXPECT_NEAR(regionalWeights[k], cell*cos(lats[k]), 0.1*cell*cos(lats[k])) << i << ", " << j;
+            }
+            regionalSum += regionalWeights[k];
+        }
+    EXPECT_LT(regionalSum, 2*(22*PI/180)*(sin(62*PI/180) - sin(38*PI/180)));
+    EXPECT_THROW(RegionCoverage(NULL), TATCException);
+    EXPECT_THROW(RegionCoverage(&pg, 0), TATCException);
+}
+
+// The points of a region are those inside the polygon, and its area is that of the spherical triangle.
+TEST(RegionCoverageWeightsTest, RegionAreas){
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(20000);
+    RegionCoverage regions(&pg);
+    RealArray lats = {10*PI/180, 20*PI/180, 45*PI/180}, lons = {-20*PI/180, 30*PI/180, 0.0};
+    EXPECT_EQ(regions.AddRegion(lats, lons, 25*PI/180, 3*PI/180), 0);
+    // the same triangle, closed and clockwise
+    RealArray closedLats = {10*PI/180, 45*PI/180, 20*PI/180, 10*PI/180};
+    RealArray closedLons = {-20*PI/180, 0.0, 30*PI/180, -20*PI/180};
+    EXPECT_EQ(regions.AddRegion(closedLats, closedLons, 25*PI/180, 3*PI/180), 1);
+    // the southern hemisphere, as a polygon on the equator
+    RealArray equatorLats(8, 0.0), equatorLons;
+    for (int i = 0; i < 8; i++)
+        equatorLons.push_back(i*PI/4);
+    EXPECT_EQ(regions.AddRegion(equatorLats, equatorLons, -PI/2, 0.0), 2);
+    EXPECT_EQ(regions.GetNumRegions(), 3);
+
+    Real area = TriangleArea(lats, lons);
+    EXPECT_NEAR(regions.GetRegionArea(0), area, 0.03*area);
+    EXPECT_EQ(regions.GetRegionPoints(1), regions.GetRegionPoints(0));
+    // the points on the equator (boundary) are inside
+    EXPECT_NEAR(regions.GetRegionArea(2), 2*PI, 0.02*2*PI);
+    for (Integer p : regions.GetRegionPoints(0)){
+        Real lat, lon;
+        pg.GetLatAndLon(p, lat, lon);
+        EXPECT_GT(lat, 9*PI/180);
+        EXPECT_LT(lat, 46*PI/180);
+    }
+    IntegerArray south;
+    for (Integer p = 0; p < pg.GetNumPoints(); p++){
+        Real lat, lon;
+        pg.GetLatAndLon(p, lat, lon);
+        if (lat <= 0.0)
+            south.push_back(p);
+    }
+    EXPECT_EQ(regions.GetRegionPoints(2), south);
+    EXPECT_THROW(regions.AddRegion({0.0, 0.1}, {0.0, 0.1}, 0.05, 0.05), TATCException);
+    EXPECT_THROW(regions.AddRegion({0.0, 0.1, 0.2}, {0.0, 0.1}, 0.05, 0.05), TATCException);
+    EXPECT_THROW(regions.GetRegionArea(3), TATCException);
+}
+
+// The fractions of a run are the weighted fractions of the recorded covered points, with one or several threads.
+TEST(RegionCoverageRunTest, RunMatchesRecordedCoverage){
+    TestSpacecraft craft(6878.0, 51.6*PI/180);
+    ConicalSensor sensor(30.0*PI/180);
+    craft.sat->AddSensor(&sensor);
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(5000);
+
+    RegionCoverage regions(&pg);
+    regions.AddRegion({-40*PI/180, -40*PI/180, 40*PI/180, 40*PI/180}, {0.0, 90*PI/180, 90*PI/180, 0.0},
+                      0.0, 45*PI/180);
+    regions.AddRegion({70*PI/180, 70*PI/180, 70*PI/180}, {0.0, 2*PI/3, 4*PI/3}, PI/2, 0.0);
+    CoverageRunner runner(&pg, craft.sat);
+    RecordingSink recorder;
+    Integer numSteps = runner.Run(recorder, 2458265.0, 0.25, 60.0);
+    runner.SetNumThreads(1);
+    runner.Run(regions, 2458265.0, 0.25, 60.0);
+    EXPECT_EQ(regions.GetNumSteps(), numSteps);
+
+    const RealArray &weights = regions.GetPointWeights();
+    for (Integer r = 0; r < 2; r++){
+        std::vector<bool> inRegion(pg.GetNumPoints(), false), seen(pg.GetNumPoints(), false);
+        for (Integer p : regions.GetRegionPoints(r))
+            inRegion[p] = true;
+        Real area = regions.GetRegionArea(r), cumulative = 0.0;
+        RealArray fractions = regions.GetCoveredFractions(r), cumulativeFractions = regions.GetCumulativeFractions(r);
+        ASSERT_EQ(fractions.size(), numSteps);
+        ASSERT_EQ(cumulativeFractions.size(), numSteps);
+        for (Integer s = 0; s < numSteps; s++){
+            Real covered = 0.0;
+            for (Integer p : recorder.steps[s])
+                if (inRegion[p]){
+                    covered += weights[p];
+                    if (!seen[p])
+                        cumulative += weights[p];
+                    seen[p] = true;
+                }
+            EXPECT_NEAR(fractions[s], covered/area, 1e-12) << "region " << r << ", step " << s;
+            EXPECT_NEAR(cumulativeFractions[s], cumulative/area, 1e-12) << "region " << r << ", step " << s;
+        }
+        EXPECT_NEAR(regions.GetTotalCoveredFraction(r), cumulative/area, 1e-12);
+    }
+    EXPECT_GT(regions.GetTotalCoveredFraction(0), 0.1);
+
+    // threaded run
+    RegionCoverage threaded(regions);
+    runner.SetNumThreads(4);
+    runner.Run(threaded, 2458265.0, 0.25, 60.0);
+    for (Integer r = 0; r < 2; r++){
+        EXPECT_EQ(threaded.GetCoveredFractions(r), regions.GetCoveredFractions(r));
+        EXPECT_EQ(threaded.GetCumulativeFractions(r), regions.GetCumulativeFractions(r));
+    }
+
+    // unit weights give the fraction of the points
+    regions.SetPointWeights(RealArray(pg.GetNumPoints(), 1.0));
+    EXPECT_EQ(regions.GetRegionArea(0), regions.GetRegionPoints(0).size());
+    EXPECT_THROW(regions.SetPointWeights(RealArray(3, 1.0)), TATCException);
+    EXPECT_THROW(regions.ProcessStep(0, 0.0, {0}), TATCException);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
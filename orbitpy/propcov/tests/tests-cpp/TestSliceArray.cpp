@@ -2,6 +2,7 @@
 #include "SliceArray.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
+#include <random>
 
 class Poly_01 : public ::testing::Test {
 
@@ -212,6 +213,104 @@ TEST_F(Poly_01,Query_08_boundsPoint)
 	EXPECT_EQ(expectedNumBounds,numBounds);
 }
 
+// Polygon with many edges around the pole, for the parallel preprocessing
+class Poly_Large : public ::testing::Test {
+
+	protected:
+
+	void SetUp() override 
+	{
+		int numElements = 3*SliceArray::PARALLEL_MIN_EDGES + 1;
+		std::vector<AnglePair> polygon(numElements);
+		AnglePair contained = {0,0};
+		std::mt19937 gen(7);
+		std::uniform_real_distribution<Real> noise(-0.05,0.05);
+
+		for (int i = 0;i < numElements - 1;i++)
+		{
+			polygon[i][1] = 2*M_PI*i/(numElements - 1);
+			polygon[i][0] = 0.6 + 0.2*sin(7*polygon[i][1]) + noise(gen);
+		}
+		polygon[numElements - 1] = polygon[0];
+
+		poly = new SlicedPolygon(polygon,contained);
+	}
+
+  	void TearDown() override 
+  	{
+  		delete(poly);
+  	}
+
+	// Edges of each slice, classified directly with the slice bounds
+	std::vector<std::vector<int>> bruteForce(SliceArray &sliceArray)
+	{
+		std::vector<Real> lonArray = sliceArray.getLonArray();
+		std::vector<Edge> edgeArray = poly->getEdgeArray();
+		std::vector<std::vector<int>> slices(lonArray.size() - 1);
+		for (int i = 0; i < slices.size(); i++)
+			for (int j = 0; j < edgeArray.size(); j++)
+			{
+				Real v1 = edgeArray[j].getBound1(), v2 = edgeArray[j].getBound2();
+				Real b1 = lonArray[i], b2 = lonArray[i + 1];
+				if ((v1 >= b1 && v1 <= b2) || (v2 >= b1 && v2 <= b2) ||
+				    util::lonBounded(v1,v2,b1) || util::lonBounded(v1,v2,b2))
+					slices[i].push_back(j);
+			}
+		return slices;
+	}
+
+	SlicedPolygon* poly;
+};
+
+TEST_F(Poly_Large,parallelSameAsSerial)
+{
+	SliceArray serial(poly->getLonArray(),poly->getEdgeArray());
+	serial.setNumThreads(1);
+	serial.preprocess();
+	SliceArray parallel(poly->getLonArray(),poly->getEdgeArray());
+	parallel.setNumThreads(4);
+	EXPECT_EQ(parallel.getNumThreads(),4);
+	parallel.preprocess();
+
+	std::vector<std::vector<int>> expected = bruteForce(serial);
+	std::vector<Real> lonArray = serial.getLonArray();
+	ASSERT_EQ(serial.getNumSlices(),expected.size());
+	ASSERT_EQ(parallel.getLonArray(),lonArray);
+	for (int i = 0; i < expected.size(); i++)
+	{
+		AnglePair query = {0.5,(lonArray[i] + lonArray[i + 1])/2};
+		EXPECT_EQ(serial.getEdges(query),expected[i]) << "slice " << i;
+		EXPECT_EQ(parallel.getEdges(query),expected[i]) << "slice " << i;
+		int count;
+		const int *first = parallel.getEdgeRange(query,count);
+		EXPECT_EQ(std::vector<int>(first,first + count),expected[i]) << "slice " << i;
+	}
+}
+
+TEST_F(Poly_Large,serializeRoundTrip)
+{
+	SliceArray* sliceArray = new SliceArray(poly->getLonArray(),poly->getEdgeArray());
+	sliceArray->preprocess();
+	poly->addPreprocessor(sliceArray);
+
+	BinaryWriter out;
+	sliceArray->serialize(out);
+	BinaryReader in(out.GetBuffer());
+	SliceArray copy(in);
+	std::vector<Real> lonArray = sliceArray->getLonArray();
+	ASSERT_EQ(copy.getLonArray(),lonArray);
+	for (int i = 0; i < lonArray.size() - 1; i++)
+	{
+		AnglePair query = {0.5,(lonArray[i] + lonArray[i + 1])/2};
+		EXPECT_EQ(copy.getEdges(query),sliceArray->getEdges(query)) << "slice " << i;
+	}
+
+	// Points inside and outside of the polygon
+	std::vector<AnglePair> queries = {{0.1,1.0},{0.2,4.0},{1.2,1.0},{1.5,3.0}};
+	std::vector<int> expected = {0,0,1,1};
+	EXPECT_EQ(poly->numCrossings(queries),expected);
+}
+
 int main(int argc, char **argv)
 {
 	testing::InitGoogleTest(&argc,argv);
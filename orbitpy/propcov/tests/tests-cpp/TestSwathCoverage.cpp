@@ -0,0 +1,197 @@
+/** Tests for the SwathCoverage class: the access intervals of the points in the strips are those of a step-by-step
+ *  test of the projected footprint, for a nadir-looking and a rolled sensor. */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <map>
+
+#include "SwathCoverage.hpp"
+#include "Projector.hpp"
+#include "Propagator.hpp"
+#include "DiscretizedSensor.hpp"
+#include "PointGroup.hpp"
+#include "TATCException.hpp"
+#include "TestHelpers.hpp"
+#include "polygon/SlicedPolygon.hpp"
+#include "polygon/SliceArray.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+// Intervals of the points in the projected footprint, tested every step (s) with the footprint perimeter polygon
+static std::map<Integer, std::vector<std::pair<Real, Real>>> ReferenceIntervals(Spacecraft *sat,
+        DiscretizedSensor *sensor, PointGroup &pg, Real startJd, Real duration, Real step){
+    Integer width = sensor->getWidthDetectors(), height = sensor->getHeightDetectors();
+    Projector projector(sat, sensor);
+    Propagator prop(sat);
+    AbsoluteDate t;
+    std::map<Integer, std::vector<std::pair<Real, Real>>> result;
+    std::vector<bool> previous(pg.GetNumPoints(), false);
+    Integer numSteps = (Integer) std::round(duration*86400/step);
+    for (Integer k = 0; k <= numSteps; k++){
+        Real jd = startJd + k*step/86400;
+        t.SetJulianDate(jd);
+        prop.Propagate(t);
+        CoordsPair corners = projector.checkCornerIntersection(projector.getEarthFixedState(jd, sat->GetCartesianState()));
+        std::vector<Rvector3> perimeter;
+        Rvector3 center(0.0, 0.0, 0.0);
+        for (Integer i = 0; i <= width; i++)
+            perimeter.push_back(corners.second[i*(height + 1)].GetUnitVector());
+        for (Integer j = 1; j <= height; j++)
+            perimeter.push_back(corners.second[width*(height + 1) + j].GetUnitVector());
+        for (Integer i = width - 1; i >= 0; i--)
+            perimeter.push_back(corners.second[i*(height + 1) + height].GetUnitVector());
+        for (Integer j = height - 1; j >= 0; j--)
+            perimeter.push_back(corners.second[j].GetUnitVector());
+        for (Rvector3 &v : perimeter)
+            center += v;
+        SlicedPolygon poly(perimeter, center.GetUnitVector());
+        SliceArray *sa = new SliceArray(poly.getLonArray(), poly.getEdgeArray());
+        sa->preprocess();
+        poly.addPreprocessor(sa);
+        for (Integer p = 0; p < pg.GetNumPoints(); p++){
+            Real lat, lon;
+            pg.GetLatAndLon(p, lat, lon);
+            Rvector3 q(cos(lat)*cos(lon), cos(lat)*sin(lon), sin(lat));
+            bool covered = (q*center.GetUnitVector() > 0.9) && poly.contains(AnglePair{PI/2 - lat, lon}) != 0;
+            if (covered && !previous[p])
+                result[p].push_back(std::make_pair(jd, jd));
+            if (covered)
+                result[p].back().second = jd;
+            previous[p] = covered;
+        }
+    }
+    return result;
+}
+
+class SwathCoverageTest : public testing::Test{
+    protected:
+        void SetUp() override{
+            pg.AddHelicalPointsByNumPoints(50000);
+        }
+        PointGroup pg;
+};
+
+// The intervals of the points in the strips are those of the footprint tested every 2 s, for a nadir-looking and
+// a rolled sensor; the accesses are not split at the segment boundaries.
+TEST_F(SwathCoverageTest, SameAsStepwiseFootprint){
+    Real startJd = 2458265.0, duration = 1200.0/86400, step = 2.0;
+    for (Real roll : {0.0, 20.0}){
+        TestSpacecraft craft;
+        Spacecraft &sat = *craft.sat;
+        sat.SetBodyNadirOffsetAngles(roll, 0.0, 0.0);
+        DiscretizedSensor sensor(20.0*PI/180, 10.0*PI/180, 20, 10);
+        sat.AddSensor(&sensor);
+
+        SwathCoverage swath(&pg, &sat, &sensor);
+        swath.SetSegmentDuration(300.0);
+        EXPECT_EQ(swath.GetSegmentDuration(), 300.0);
+        EXPECT_EQ(swath.GetSampleStep(), 10.0);
+        EXPECT_EQ(swath.Run(startJd, duration), 4);
+        EXPECT_EQ(swath.GetNumSegments(), 4);
+        std::map<Integer, std::vector<std::pair<Real, Real>>> reference =
+            ReferenceIntervals(&sat, &sensor, pg, startJd, duration, step);
+        ASSERT_GT(reference.size(), 100);
+
+        const std::vector<AccessInterval> &intervals = swath.GetIntervals();
+        std::map<Integer, std::vector<std::pair<Real, Real>>> computed;
+        for (size_t i = 0; i < intervals.size(); i++){
+            if (i > 0){
+                EXPECT_LE(intervals[i - 1].startTime, intervals[i].startTime);
+            }
+            EXPECT_LE(intervals[i].startTime, intervals[i].stopTime);
+            EXPECT_GE(intervals[i].startTime, startJd);
+            EXPECT_LE(intervals[i].stopTime, startJd + duration + 1e-9);
+            computed[intervals[i].pointIndex].push_back(std::make_pair(intervals[i].startTime, intervals[i].stopTime));
+        }
+
+        // the points seen over more than two steps have the same intervals, within a step and a half; the short
+        // accesses through the footprint corners are interpolated less accurately
+        const IntegerArray &swathPoints = swath.GetSwathPoints();
+        Integer compared = 0;
+        for (auto &entry : reference){
+            Real seen = entry.second[0].second - entry.second[0].first;
+            if (entry.second.size() != 1 || seen < 3*step/86400)
+                continue;
+            Real tol = (seen < 5*step/86400 ? 2.5 : 1.5)*step/86400;
+            EXPECT_TRUE(std::binary_search(swathPoints.begin(), swathPoints.end(), entry.first)) << entry.first;
+            ASSERT_EQ(computed[entry.first].size(), 1) << "point " << entry.first << ", roll " << roll;
+            Real refStart = entry.second[0].first, refStop = entry.second[0].second;
+            // the reference start and stop are the first and last steps in view
+            if (refStart > startJd){
+                EXPECT_NEAR(computed[entry.first][0].first, refStart - step/2/86400, tol) << entry.first;
+            }
+            else{
+                EXPECT_EQ(computed[entry.first][0].first, startJd);
+            }
+            if (refStop < startJd + duration - 1e-9){
+                EXPECT_NEAR(computed[entry.first][0].second, refStop + step/2/86400, tol) << entry.first;
+            }
+            compared++;
+        }
+        EXPECT_GT(compared, 0.9*reference.size());
+
+        // the strip points not seen by the reference are on the swath edges: they are not seen for long
+        Integer extra = 0;
+        for (Integer p : swathPoints)
+            if (reference.find(p) == reference.end()){
+                extra++;
+                for (auto &interval : computed[p])
+                    EXPECT_LT(interval.second - interval.first, 3*step/86400) << p;
+            }
+        EXPECT_LT(extra, 0.05*swathPoints.size());
+
+        // a single segment gives the same intervals
+        SwathCoverage single(swath);
+        single.SetSegmentDuration(1200.0);
+        EXPECT_EQ(single.Run(startJd, duration), 1);
+        ASSERT_EQ(single.GetIntervals().size(), intervals.size());
+        for (size_t i = 0; i < intervals.size(); i++){
+            EXPECT_EQ(single.GetIntervals()[i].pointIndex, intervals[i].pointIndex);
+            EXPECT_NEAR(single.GetIntervals()[i].startTime, intervals[i].startTime, 1e-3/86400);
+            EXPECT_NEAR(single.GetIntervals()[i].stopTime, intervals[i].stopTime, 1e-3/86400);
+        }
+    }
+}
+
+// The boundary of a segment is a closed polygon containing the footprints, and the invalid settings are rejected.
+TEST_F(SwathCoverageTest, SegmentBoundaryAndErrors){
+    TestSpacecraft craft;
+    Spacecraft &sat = *craft.sat;
+    DiscretizedSensor sensor(20.0*PI/180, 10.0*PI/180, 4, 2);
+    sat.AddSensor(&sensor);
+    EXPECT_EQ(sensor.getWidthDetectors(), 4);
+    EXPECT_EQ(sensor.getHeightDetectors(), 2);
+    SwathCoverage swath(&pg, &sat, &sensor);
+    // a partial last segment
+    EXPECT_EQ(swath.Run(2458265.0, 1500.0/86400), 3);
+    RealArray lats, lons;
+    swath.GetSegmentBoundary(2, lats, lons);
+    ASSERT_GT(lats.size(), 4);
+    EXPECT_EQ(lats.size(), lons.size());
+    EXPECT_EQ(lats.front(), lats.back());
+    EXPECT_EQ(lons.front(), lons.back());
+    EXPECT_THROW(swath.GetSegmentBoundary(3, lats, lons), TATCException);
+    EXPECT_THROW(swath.GetSegmentBoundary(-1, lats, lons), TATCException);
+
+    // a segment longer than a quarter of the orbital period (about 1481 s) is split
+    swath.SetSegmentDuration(86400.0);
+    EXPECT_EQ(swath.GetSegmentDuration(), 86400.0);
+    EXPECT_EQ(swath.Run(2458265.0, 3000.0/86400), 3);
+    EXPECT_GT(swath.GetIntervals().size(), 0);
+
+    EXPECT_THROW(swath.SetSegmentDuration(0.0), TATCException);
+    EXPECT_THROW(swath.SetSampleStep(-1.0), TATCException);
+    EXPECT_THROW(swath.Run(2458265.0, 0.0), TATCException);
+    EXPECT_THROW(SwathCoverage(NULL, &sat, &sensor), TATCException);
+    EXPECT_THROW(SwathCoverage(&pg, &sat, NULL), TATCException);
+
+    // a sensor seeing beyond the horizon
+    DiscretizedSensor wide(170.0*PI/180, 10.0*PI/180, 4, 2);
+    SwathCoverage wideSwath(&pg, &sat, &wide);
+    EXPECT_THROW(wideSwath.Run(2458265.0, 600.0/86400), TATCException);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+/** Tests that the shared objects (Earth, attitude, sensor, point group) can be used by several threads. */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "AbsoluteDate.hpp"
+#include "OrbitState.hpp"
+#include "Spacecraft.hpp"
+#include "Propagator.hpp"
+#include "CoverageChecker.hpp"
+#include "ConicalSensor.hpp"
+#include "NadirPointingAttitude.hpp"
+#include "LagrangeInterpolator.hpp"
+#include "PointGroup.hpp"
+#include "Earth.hpp"
+
+# define PI 3.14159265358979323846 /* pi */
+
+static const int NUM_SATS  = 6;
+static const int NUM_STEPS = 200;
+
+// Propagate one satellite (with its own spacecraft, propagator and checker) and record the coverage.
+static void RunSatellite(int i, NadirPointingAttitude *attitude, ConicalSensor *sensor, PointGroup *pg,
+                         std::vector<IntegerArray> *result){
+    AbsoluteDate date;
+    date.SetJulianDate(2458265.0);
+    OrbitState state;
+    state.SetKeplerianState(7078.0, 0.001, 98.0*PI/180, 30.0*i*PI/180, 0.0, 60.0*i*PI/180);
+    LagrangeInterpolator interp("PropcovCppLagrangeInterpolator", 6, 7);
+    Spacecraft sat(&date, &state, attitude, &interp);
+    sat.AddSensor(sensor);
+    Propagator prop(&sat);
+    CoverageChecker checker(pg, &sat);
+    AbsoluteDate t;
+    for (int k = 0; k < NUM_STEPS; k++){
+        t.SetJulianDate(2458265.0 + k*60.0/86400);
+        prop.Propagate(t);
+        result->push_back(checker.CheckPointCoverage());
+    }
+}
+
+// Concurrent runs sharing the attitude, the sensor and the point group give the sequential results.
+TEST(ThreadSafetyTest, SharedAttitudeSensorAndPoints){
+    NadirPointingAttitude attitude;
+    ConicalSensor sensor(30.0*PI/180);
+    PointGroup pg;
+    pg.AddHelicalPointsByNumPoints(5000);
+
+    std::vector<std::vector<IntegerArray>> sequential(NUM_SATS), concurrent(NUM_SATS);
+    for (int i = 0; i < NUM_SATS; i++)
+        RunSatellite(i, &attitude, &sensor, &pg, &sequential[i]);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NUM_SATS; i++)
+        threads.emplace_back(RunSatellite, i, &attitude, &sensor, &pg, &concurrent[i]);
+    for (std::thread &th : threads)
+        th.join();
+
+    Integer total = 0;
+    for (int i = 0; i < NUM_SATS; i++){
+        ASSERT_EQ(concurrent[i].size(), sequential[i].size());
+        for (int k = 0; k < NUM_STEPS; k++){
+            EXPECT_EQ(concurrent[i][k], sequential[i][k]) << "satellite " << i << ", step " << k;
+            total += sequential[i][k].size();
+        }
+    }
+    EXPECT_GT(total, 0);
+}
+
+// A shared Earth gives the same body-fixed states in each thread as when used alone.
+TEST(ThreadSafetyTest, SharedEarth){
+    Earth earth;
+    Rvector6 inertial(7000.0, 100.0, -200.0, 0.1, 7.5, 0.2);
+    std::vector<Rvector6> expected;
+    for (int k = 0; k < 1000; k++)
+        expected.push_back(earth.GetBodyFixedState(inertial, 2458265.0 + k*0.01));
+
+    std::vector<int> numWrong(4, 0);
+    std::vector<std::thread> threads;
+    for (int n = 0; n < 4; n++)
+        threads.emplace_back([&, n](){
+            for (int rep = 0; rep < 20; rep++)
+                for (int k = 0; k < 1000; k++)
+                    if (!(earth.GetBodyFixedState(inertial, 2458265.0 + k*0.01) == expected[k]))
+                        numWrong[n]++;
+        });
+    for (std::thread &th : threads)
+        th.join();
+    for (int n = 0; n < 4; n++)
+        EXPECT_EQ(numWrong[n], 0);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}